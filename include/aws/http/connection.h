@@ -9,6 +9,8 @@
 #include <aws/http/http.h>
 
 struct aws_client_bootstrap;
+struct aws_event_loop;
+struct aws_socket_endpoint;
 struct aws_socket_options;
 struct aws_tls_connection_options;
 struct aws_http2_setting;
@@ -20,6 +22,12 @@ struct aws_http2_setting;
  */
 struct aws_http_connection;
 
+/**
+ * A limit on the memory HTTP/1 connections may reserve for their read buffers, shared between connections.
+ * See aws_http1_connection_options.read_buffer_budget.
+ */
+struct aws_http_read_buffer_budget;
+
 /**
  * Invoked when connect completes.
  *
@@ -185,8 +193,99 @@ struct aws_http1_connection_options {
      * If zero is specified (the default) then a default capacity is chosen.
      * A capacity that is too small may hinder throughput.
      * A capacity that is too big may waste memory without helping throughput.
+     *
+     * If `read_buffer_budget` is set, this is the most the capacity may grow to.
      */
     size_t read_buffer_capacity;
+
+    /**
+     * Optional
+     * Budget shared with other connections, limiting their combined read buffer capacity.
+     * If set, the read buffer's capacity adapts to how quickly the connection's data is consumed.
+     * It starts at `read_buffer_min_capacity`, and doubles each time the peer fills the connection's window
+     * while the user keeps up with a full buffer's worth of data, as long as the budget has room.
+     * It halves after a second in which less than a quarter of the buffer was consumed.
+     * Once the budget is exhausted, connections stop growing and only open their windows within what they hold.
+     *
+     * Every connection holds at least `read_buffer_min_capacity`, even if that puts the budget over its limit.
+     * Window already granted to the peer can't be taken back, so a connection holds on to the
+     * capacity it's shrinking away from until the peer sends that much more data.
+     *
+     * Ignored if `manual_window_management` is false.
+     * Each connection holds a reference to the budget, but the caller must keep the budget alive
+     * until the connection is set up.
+     */
+    struct aws_http_read_buffer_budget *read_buffer_budget;
+
+    /**
+     * Optional
+     * Smallest capacity in bytes of the HTTP/1 connection's read buffer, when `read_buffer_budget` is set.
+     * If zero is specified (the default), the size of one aws_io_message is used.
+     * Never more than `read_buffer_capacity`.
+     */
+    size_t read_buffer_min_capacity;
+
+    /**
+     * Optional
+     * When the connection has nothing to write and new data becomes available
+     * (ex: a new request is made), wait this many nanoseconds before writing.
+     * Requests made from other threads during the delay are sent in the same aws_io_message,
+     * at the cost of added latency. If zero is specified (the default) data is written immediately.
+     *
+     * Small pipelined requests are packed into a single aws_io_message whenever they're queued
+     * at the same time, regardless of this setting.
+     */
+    uint64_t write_coalescing_delay_ns;
+};
+
+/**
+ * How an HTTP/2 connection chooses which stream sends the next DATA frame.
+ * Priorities are set per stream, via aws_http2_stream_set_priority().
+ */
+enum aws_http2_data_scheduler_type {
+    /**
+     * Streams take turns sending one frame each, and priority is ignored. This is the default.
+     */
+    AWS_HTTP2_DATA_SCHEDULER_ROUND_ROBIN,
+
+    /**
+     * Weighted fair queuing (implemented as deficit round-robin).
+     * While streams are competing, each gets a share of the connection proportional to its priority's weight.
+     */
+    AWS_HTTP2_DATA_SCHEDULER_WEIGHTED_FAIR,
+
+    /**
+     * Streams with more urgent priority always send first, streams with the same urgency take turns.
+     * Less urgent streams get nothing while a more urgent stream has data ready to send.
+     */
+    AWS_HTTP2_DATA_SCHEDULER_STRICT_PRIORITY,
+};
+
+/**
+ * Which outgoing headers an HTTP/2 connection's HPACK encoder inserts into its dynamic table.
+ * An indexed header is cheap to send again, but inserting it evicts older entries.
+ * Headers whose values change on every request (ex: timestamps, signatures) just evict the useful entries.
+ *
+ * Regardless of policy, a header is never indexed if its `aws_http_header_compression` forbids it.
+ */
+enum aws_http2_hpack_indexing_policy {
+    /**
+     * Index every header. This is the default.
+     */
+    AWS_HTTP2_HPACK_INDEXING_ALL,
+
+    /**
+     * Don't index headers whose values are known to be unique per message
+     * (ex: "authorization", "x-amz-date", "content-md5"),
+     * or headers too large to share the dynamic table (more than half its size).
+     */
+    AWS_HTTP2_HPACK_INDEXING_SELECTIVE,
+
+    /**
+     * Like SELECTIVE, but also track how often each header name's entries are reused.
+     * Names whose entries are rarely reused stop being indexed, with an occasional retry in case traffic changes.
+     */
+    AWS_HTTP2_HPACK_INDEXING_ADAPTIVE,
 };
 
 /**
@@ -243,6 +342,45 @@ struct aws_http2_connection_options {
      * See `aws_http2_on_remote_settings_change_fn`.
      */
     aws_http2_on_remote_settings_change_fn *on_remote_settings_change;
+
+    /**
+     * Optional.
+     * How to choose which stream sends the next DATA frame.
+     * Defaults to AWS_HTTP2_DATA_SCHEDULER_ROUND_ROBIN.
+     */
+    enum aws_http2_data_scheduler_type data_scheduler;
+
+    /**
+     * Optional.
+     * Which outgoing headers to insert into the HPACK dynamic table.
+     * Defaults to AWS_HTTP2_HPACK_INDEXING_ALL.
+     */
+    enum aws_http2_hpack_indexing_policy hpack_indexing_policy;
+};
+
+/**
+ * Default for aws_http_connect_racing_options.attempt_delay_ms (RFC-8305 section 5 recommends 250ms).
+ */
+#define AWS_HTTP_CONNECT_RACING_DEFAULT_ATTEMPT_DELAY_MS 250
+
+/**
+ * Options for racing connects across a host's addresses ("Happy Eyeballs", RFC-8305).
+ */
+struct aws_http_connect_racing_options {
+    /**
+     * Optional.
+     * How long to wait on a connect attempt before starting the next one alongside it.
+     * If an attempt fails, the next one starts right away.
+     * If zero, AWS_HTTP_CONNECT_RACING_DEFAULT_ATTEMPT_DELAY_MS is used.
+     */
+    uint32_t attempt_delay_ms;
+
+    /**
+     * Optional.
+     * Maximum number of addresses to try.
+     * If zero, every address the host resolver returns may be tried.
+     */
+    size_t max_attempts;
 };
 
 /**
@@ -363,6 +501,26 @@ struct aws_http_client_connection_options {
      * If connection is HTTP/2 and options were not specified, default values are used.
      */
     const struct aws_http2_connection_options *http2_options;
+
+    /**
+     * Optional.
+     * If set, the connection's channel is created on this event loop,
+     * rather than the next one the bootstrap's event loop group hands out.
+     * Must be one of the loops in the bootstrap's event loop group.
+     */
+    struct aws_event_loop *requested_event_loop;
+
+    /**
+     * Optional.
+     * If set, the host name is resolved up front, and connects are raced across its addresses,
+     * alternating between IPv6 and IPv4 and starting a new attempt each time the delay passes.
+     * The first attempt to connect is used, and any that connect later are closed.
+     * aws_http_connection_get_remote_endpoint() reports which address won.
+     *
+     * If not set, the bootstrap makes a single connect to host_name.
+     * Ignored if socket_options->domain is AWS_SOCKET_LOCAL.
+     */
+    const struct aws_http_connect_racing_options *racing_options;
 };
 
 /* Predefined settings identifiers (RFC-7540 6.5.2) */
@@ -387,7 +545,7 @@ struct aws_http2_setting {
  * Initializes aws_http1_connection_options with default values.
  */
 #define AWS_HTTP1_CONNECTION_OPTIONS_INIT                                                                              \
-    { .read_buffer_capacity = 0 }
+    { .read_buffer_capacity = 0, .read_buffer_budget = NULL }
 
 /**
  * HTTP/2: Default value for max closed streams we will keep in memory.
@@ -475,6 +633,14 @@ void aws_http_connection_update_window(struct aws_http_connection *connection, s
 AWS_HTTP_API
 enum aws_http_version aws_http_connection_get_version(const struct aws_http_connection *connection);
 
+/**
+ * Returns the address and port a client connection made with racing_options connected to.
+ * Returns NULL if the connection wasn't made by racing connects.
+ */
+AWS_HTTP_API
+const struct aws_socket_endpoint *aws_http_connection_get_remote_endpoint(
+    const struct aws_http_connection *connection);
+
 /**
  * Returns the channel hosting the HTTP connection.
  * Do not expose this function to language bindings.
@@ -482,6 +648,33 @@ enum aws_http_version aws_http_connection_get_version(const struct aws_http_conn
 AWS_HTTP_API
 struct aws_channel *aws_http_connection_get_channel(struct aws_http_connection *connection);
 
+/**
+ * Create a read buffer budget, which HTTP/1 connections may share via aws_http1_connection_options.
+ * Together, connections using the budget will reserve no more than max_bytes for their read buffers,
+ * except that each connection may always reserve its minimum capacity.
+ * The budget starts with a reference count of 1.
+ */
+AWS_HTTP_API
+struct aws_http_read_buffer_budget *aws_http_read_buffer_budget_new(struct aws_allocator *allocator, size_t max_bytes);
+
+/**
+ * Acquire a reference to the budget.
+ */
+AWS_HTTP_API
+struct aws_http_read_buffer_budget *aws_http_read_buffer_budget_acquire(struct aws_http_read_buffer_budget *budget);
+
+/**
+ * Release a reference to the budget. It is destroyed once the last connection using it is destroyed.
+ */
+AWS_HTTP_API
+void aws_http_read_buffer_budget_release(struct aws_http_read_buffer_budget *budget);
+
+/**
+ * Returns the number of bytes currently reserved from the budget by connections.
+ */
+AWS_HTTP_API
+size_t aws_http_read_buffer_budget_get_reserved_bytes(const struct aws_http_read_buffer_budget *budget);
+
 /**
  * Send a SETTINGS frame (HTTP/2 only).
  * SETTINGS will be applied locally when SETTINGS ACK is received from peer.
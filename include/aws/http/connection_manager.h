@@ -11,6 +11,7 @@
 #include <aws/common/byte_buf.h>
 
 struct aws_client_bootstrap;
+struct aws_event_loop;
 struct aws_http_connection;
 struct aws_http_connection_manager;
 struct aws_socket_options;
@@ -23,6 +24,74 @@ typedef void(aws_http_connection_manager_on_connection_setup_fn)(
 
 typedef void(aws_http_connection_manager_shutdown_complete_fn)(void *user_data);
 
+/**
+ * Default upper bound on concurrent acquisitions of a single multiplexed HTTP/2 connection.
+ * RFC-7540 Section 6.5.2 recommends peers allow at least 100 concurrent streams.
+ */
+#define AWS_HTTP_CONNECTION_MANAGER_DEFAULT_MAX_STREAMS_PER_CONNECTION (100)
+
+/*
+ * Which idle connection the manager hands out next.
+ */
+enum aws_http_connection_manager_idle_connection_policy {
+    /*
+     * Reuse the most recently released connection (the default).  Hot connections keep being reused,
+     * while cold ones age out and are culled quickly.
+     */
+    AWS_HTTP_CONNECTION_MANAGER_IDLE_CONNECTION_POLICY_LIFO,
+
+    /*
+     * Reuse the least recently released connection.  Use is spread across every idle connection,
+     * so they all stay warm and are rarely culled.
+     */
+    AWS_HTTP_CONNECTION_MANAGER_IDLE_CONNECTION_POLICY_FIFO,
+};
+
+/*
+ * How strongly an acquisition wants a connection on a particular event loop.
+ */
+enum aws_http_connection_manager_event_loop_affinity {
+    /* Any connection will do. */
+    AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_NONE,
+
+    /*
+     * Use a connection on the event loop if one is available, or if a new connection has to be made anyway.
+     * Otherwise use any connection.
+     */
+    AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_PREFERRED,
+
+    /*
+     * Only a connection on the event loop will do.  The acquisition waits for one to be released or made.
+     * If the manager is at max_connections and only has idle connections on other event loops,
+     * one of those is closed to make room.
+     */
+    AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_REQUIRED,
+};
+
+/*
+ * Options for aws_http_connection_manager_acquire_connection_with_options().
+ */
+struct aws_http_connection_manager_acquire_options {
+    /*
+     * Required.
+     * Invoked with the acquired connection, or an error.
+     */
+    aws_http_connection_manager_on_connection_setup_fn *callback;
+    void *user_data;
+
+    /*
+     * Optional.
+     * Event loop the connection's channel should live on.  Must belong to the manager's bootstrap.
+     * If NULL and affinity is not NONE, the event loop of the calling thread is used.
+     */
+    struct aws_event_loop *event_loop;
+
+    /*
+     * Defaults to AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_NONE.
+     */
+    enum aws_http_connection_manager_event_loop_affinity event_loop_affinity;
+};
+
 /*
  * Connection manager configuration struct.
  *
@@ -65,6 +134,88 @@ struct aws_http_connection_manager_options {
      * timeout will be closed automatically.
      */
     uint64_t max_connection_idle_in_milliseconds;
+
+    /**
+     * If set to true, connections that negotiate HTTP/2 are shared between acquisitions instead of being
+     * vended to one user at a time.  Each acquisition of a shared connection is good for one stream, and the
+     * connection is handed out concurrently until the peer's SETTINGS_MAX_CONCURRENT_STREAMS (or
+     * max_streams_per_connection, if smaller) is reached.  A new connection is only made once every shared
+     * connection is saturated.  A shared connection that receives GOAWAY stops being handed out and is
+     * released once all of its acquisitions have been released.
+     *
+     * Each successful acquisition must still be balanced by a call to
+     * aws_http_connection_manager_release_connection(), once the stream made on it has completed.
+     *
+     * Has no effect on HTTP/1.x connections.  HTTP/2 is only negotiated if tls_connection_options has ALPN set up.
+     */
+    bool enable_http2_multiplexing;
+
+    /**
+     * Optional.
+     * Upper bound on concurrent acquisitions of a single multiplexed HTTP/2 connection.
+     * If zero, AWS_HTTP_CONNECTION_MANAGER_DEFAULT_MAX_STREAMS_PER_CONNECTION is used.
+     * Ignored unless enable_http2_multiplexing is true.
+     */
+    size_t max_streams_per_connection;
+
+    /**
+     * Optional.
+     * If greater than 1, HTTP/1.1 connections are shared between acquisitions, with up to this many requests
+     * pipelined on each (sent without waiting on the responses before them).  As with enable_http2_multiplexing,
+     * each acquisition of a shared connection is good for one request, and a new connection is only made once
+     * every shared connection has this many acquisitions.  Acquisitions go to the least busy shared connection,
+     * but responses on a connection arrive in order, so a slow response holds up those behind it.
+     *
+     * Only enable this for idempotent requests, to servers known to support pipelining.  If a shared connection
+     * closes, every request still outstanding on it fails, and must be retried with a new acquisition.
+     * A shared connection that closes, or that a response says will close, stops being handed out and is
+     * released once all of its acquisitions have been released.
+     *
+     * If zero or 1, HTTP/1.1 connections are vended to one user at a time.
+     */
+    size_t max_pipelined_requests_per_connection;
+
+    /**
+     * Optional.
+     * Number of connections to keep established and ready for use, so acquisitions don't wait on a
+     * connect (and TLS handshake).  The manager starts making them in the background as soon as it's created,
+     * and replaces any that close.  Idle culling never takes the pool below this number.
+     * A shared HTTP/2 connection counts as ready.
+     *
+     * If a connect fails, replacing connections is put off until a connect succeeds,
+     * or the next time idle connections are culled.
+     *
+     * Must not exceed max_connections.
+     */
+    size_t min_idle_connections;
+
+    /**
+     * Optional.
+     * Which idle connection is reused first.
+     * Defaults to AWS_HTTP_CONNECTION_MANAGER_IDLE_CONNECTION_POLICY_LIFO.
+     */
+    enum aws_http_connection_manager_idle_connection_policy idle_connection_policy;
+};
+
+/*
+ * Statistics on the work done culling idle connections (see max_connection_idle_in_milliseconds).
+ * Expired connections are culled by a periodic task, and also lazily, whenever an acquire or release
+ * touches the event loop's idle connections.  Either way, only expired connections are visited.
+ */
+struct aws_http_connection_manager_cull_metrics {
+    /* Number of times the cull task has run */
+    uint64_t cull_task_run_count;
+
+    /* Idle connections culled by the cull task, in total and in its busiest run */
+    uint64_t cull_task_culled_count;
+    uint64_t cull_task_max_culled_per_run;
+
+    /* Time spent in the cull task, in total and in its longest run */
+    uint64_t cull_task_duration_ns;
+    uint64_t cull_task_max_duration_ns;
+
+    /* Idle connections culled by acquires and releases */
+    uint64_t lazily_culled_count;
 };
 
 AWS_EXTERN_C_BEGIN
@@ -111,6 +262,20 @@ void aws_http_connection_manager_acquire_connection(
     aws_http_connection_manager_on_connection_setup_fn *callback,
     void *user_data);
 
+/*
+ * Same as aws_http_connection_manager_acquire_connection(), but lets the requester ask for a connection
+ * whose channel lives on a particular event loop, so request processing doesn't hop threads.
+ * New connections made on behalf of such an acquisition are created on that event loop.
+ *
+ * The acquisition fails with AWS_ERROR_INVALID_ARGUMENT if affinity is REQUIRED, but the event loop
+ * (explicit, or the caller's own) isn't part of the manager's bootstrap.  With PREFERRED affinity,
+ * an unknown event loop is ignored.
+ */
+AWS_HTTP_API
+void aws_http_connection_manager_acquire_connection_with_options(
+    struct aws_http_connection_manager *manager,
+    const struct aws_http_connection_manager_acquire_options *options);
+
 /*
  * Returns a connection back to the manager.  All acquired connections must
  * eventually be released back to the manager in order to avoid a resource leak.
@@ -120,6 +285,14 @@ int aws_http_connection_manager_release_connection(
     struct aws_http_connection_manager *manager,
     struct aws_http_connection *connection);
 
+/*
+ * Gets statistics on idle connection culling.
+ */
+AWS_HTTP_API
+void aws_http_connection_manager_get_cull_metrics(
+    struct aws_http_connection_manager *manager,
+    struct aws_http_connection_manager_cull_metrics *out_metrics);
+
 AWS_EXTERN_C_END
 
 #endif /* AWS_HTTP_CONNECTION_MANAGER_H */
@@ -14,6 +14,8 @@
 #include <aws/common/atomics.h>
 #include <aws/io/channel.h>
 #include <aws/io/channel_bootstrap.h>
+#include <aws/io/host_resolver.h>
+#include <aws/io/socket.h>
 
 struct aws_http_message;
 struct aws_http_make_request_options;
@@ -22,8 +24,17 @@ struct aws_http_stream;
 
 typedef int aws_client_bootstrap_new_socket_channel_fn(struct aws_socket_channel_bootstrap_options *options);
 
+typedef int aws_http_connection_resolve_host_fn(
+    struct aws_client_bootstrap *bootstrap,
+    const struct aws_string *host_name,
+    aws_on_host_resolved_result_fn *on_host_resolved,
+    void *user_data);
+
 struct aws_http_connection_system_vtable {
     aws_client_bootstrap_new_socket_channel_fn *new_socket_channel;
+
+    /* Used when racing connects. If NULL, the bootstrap's host resolver is used. */
+    aws_http_connection_resolve_host_fn *resolve_host;
 };
 
 struct aws_http_connection_vtable {
@@ -117,6 +128,9 @@ struct aws_http_connection {
     struct aws_http_connection_server_data *server_data;
 
     bool manual_window_management;
+
+    /* Address that won the connect race. Empty if connects weren't raced. */
+    struct aws_socket_endpoint remote_endpoint;
 };
 
 /* Gets a client connection up and running.
@@ -135,6 +149,9 @@ struct aws_http_client_bootstrap {
     struct aws_http1_connection_options http1_options;
     struct aws_http2_connection_options http2_options;
     struct aws_http_connection *connection;
+
+    /* Copied to the connection. Set by the connect race, if there is one. */
+    struct aws_socket_endpoint remote_endpoint;
 };
 
 AWS_EXTERN_C_BEGIN
@@ -159,6 +176,12 @@ void aws_http_connection_acquire(struct aws_http_connection *connection);
 AWS_HTTP_API
 struct aws_crt_statistics_http1_channel *aws_h1_connection_get_statistics(struct aws_http_connection *connection);
 
+/**
+ * Allow tests to fake stats data
+ */
+AWS_HTTP_API
+struct aws_crt_statistics_http2_channel *aws_h2_connection_get_statistics(struct aws_http_connection *connection);
+
 /**
  * Gets the next available stream id within the connection.  Valid for creating both h1 and h2 streams.
  *
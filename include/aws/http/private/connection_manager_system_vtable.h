@@ -17,6 +17,10 @@ typedef bool(aws_http_connection_manager_is_connection_available_fn)(const struc
 typedef bool(aws_http_connection_manager_is_callers_thread_fn)(struct aws_channel *channel);
 typedef struct aws_channel *(aws_http_connection_manager_connection_get_channel_fn)(
     struct aws_http_connection *connection);
+typedef enum aws_http_version(aws_http_connection_manager_connection_get_version_fn)(
+    const struct aws_http_connection *connection);
+typedef struct aws_event_loop *(aws_http_connection_manager_connection_get_event_loop_fn)(
+    struct aws_http_connection *connection);
 
 struct aws_http_connection_manager_system_vtable {
     /*
@@ -29,6 +33,12 @@ struct aws_http_connection_manager_system_vtable {
     aws_io_clock_fn *get_monotonic_time;
     aws_http_connection_manager_is_callers_thread_fn *is_callers_thread;
     aws_http_connection_manager_connection_get_channel_fn *connection_get_channel;
+
+    /* Optional, if NULL every connection is treated as HTTP/1.1 */
+    aws_http_connection_manager_connection_get_version_fn *connection_get_version;
+
+    /* Optional, if NULL connections' event loops are unknown and acquisitions' event loop affinity is ignored */
+    aws_http_connection_manager_connection_get_event_loop_fn *connection_get_event_loop;
 };
 
 AWS_HTTP_API
@@ -15,11 +15,16 @@
 #    pragma warning(disable : 4214) /* nonstandard extension used: bit field types other than int */
 #endif
 
+struct aws_h1_read_message_owner;
+
 struct aws_h1_connection {
     struct aws_http_connection base;
 
     size_t initial_stream_window_size;
 
+    /* See aws_http1_connection_options.write_coalescing_delay_ns */
+    uint64_t write_coalescing_delay_ns;
+
     /* Task responsible for sending data.
      * As long as there is data available to send, the task will be "active" and repeatedly:
      * 1) Encode outgoing stream data to an aws_io_message and send it up the channel.
@@ -30,7 +35,7 @@ struct aws_h1_connection {
      *
      * If there is no data available to write (waiting for user to add more streams or chunks),
      * then the task stops being active. The task is made active again when the user
-     * adds more outgoing data. */
+     * adds more outgoing data (after `write_coalescing_delay_ns`, if set). */
     struct aws_channel_task outgoing_stream_task;
 
     /* Task that removes items from `synced_data` and does their on-thread work.
@@ -72,11 +77,38 @@ struct aws_h1_connection {
          * The `aws_io_message.copy_mark` is used to track progress on partially processed messages.
          * `pending_bytes` is the sum of all unprocessed bytes across all queued messages.
          * `capacity` is the limit for how many unprocessed bytes we'd like in the queue.
+         *
+         * When body slices are lent to the user (see aws_http_on_incoming_body_slice_fn), processed messages
+         * may outlive their time in the queue. `retained_bytes` is the total size of processed messages that
+         * are only alive because the user still holds slices of them. These count against `capacity` too.
          */
         struct {
             struct aws_linked_list messages;
             size_t pending_bytes;
+            size_t retained_bytes;
             size_t capacity;
+
+            /* Keeps the front message alive while the user holds slices of it.
+             * NULL until a body slice is lent from the front message. */
+            struct aws_h1_read_message_owner *front_message_owner;
+
+            /* Only set if the user passed a read_buffer_budget (and manual_window_management is on).
+             * Then `capacity` adapts between `min_capacity` and `max_capacity`, and `budget_reserved_bytes`
+             * are held from the budget: the larger of `capacity` and the bytes buffered or promised by the window. */
+            struct aws_http_read_buffer_budget *budget;
+            size_t min_capacity;
+            size_t max_capacity;
+            size_t budget_reserved_bytes;
+
+            /* Bytes processed out of the buffer since the last decision on `capacity`.
+             * Only meaningful when there's a budget. */
+            size_t consumed_bytes;
+
+            /* When the last decision on `capacity` was made */
+            uint64_t capacity_timestamp_ns;
+
+            /* True if the peer filled the connection window since the last decision on `capacity` */
+            bool is_window_exhausted;
         } read_buffer;
 
         /**
@@ -91,6 +123,10 @@ struct aws_h1_connection {
         /* Only used by tests. Sum of window_increments issued by this slot. Resets each time it's queried */
         size_t recent_window_increments;
 
+        /* Only used by tests. Most streams decoded in a single pass over the read buffer.
+         * Resets each time it's queried */
+        size_t recent_max_streams_per_batch;
+
         struct aws_crt_statistics_http1_channel stats;
 
         uint64_t outgoing_stream_timestamp_ns;
@@ -125,6 +161,10 @@ struct aws_h1_connection {
         /* If non-zero, then window_update_task is scheduled */
         size_t window_update_size;
 
+        /* Size of retained messages whose last body slice was released off-thread.
+         * Subtracted from `thread_data.read_buffer.retained_bytes` by the cross_thread_work_task. */
+        size_t released_retained_bytes;
+
         /* If non-zero, reason to immediately reject new streams. (ex: closing) */
         int new_stream_error_code;
 
@@ -140,9 +180,11 @@ struct aws_h1_connection {
 /* Allow tests to check current window stats */
 struct aws_h1_window_stats {
     size_t connection_window;
-    size_t recent_window_increments; /* Resets to 0 each time window stats are queried*/
+    size_t recent_window_increments;     /* Resets to 0 each time window stats are queried*/
+    size_t recent_max_streams_per_batch; /* Resets to 0 each time window stats are queried*/
     size_t buffer_capacity;
     size_t buffer_pending_bytes;
+    size_t buffer_retained_bytes;
     uint64_t stream_window;
     bool has_incoming_stream;
 };
@@ -175,6 +217,21 @@ AWS_EXTERN_C_END
 
 /* TODO: introduce naming conventions for private header functions */
 
+/**
+ * Reserve up to num_bytes from the budget, returning how many were reserved.
+ */
+size_t aws_http_read_buffer_budget_reserve(struct aws_http_read_buffer_budget *budget, size_t num_bytes);
+
+/**
+ * Reserve num_bytes from the budget, even if that puts it over its limit.
+ */
+void aws_http_read_buffer_budget_force_reserve(struct aws_http_read_buffer_budget *budget, size_t num_bytes);
+
+/**
+ * Return num_bytes to the budget.
+ */
+void aws_http_read_buffer_budget_unreserve(struct aws_http_read_buffer_budget *budget, size_t num_bytes);
+
 void aws_h1_connection_lock_synced_data(struct aws_h1_connection *connection);
 void aws_h1_connection_unlock_synced_data(struct aws_h1_connection *connection);
 
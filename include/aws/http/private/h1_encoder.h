@@ -122,6 +122,24 @@ bool aws_h1_encoder_is_message_in_progress(const struct aws_h1_encoder *encoder)
 AWS_HTTP_API
 bool aws_h1_encoder_is_waiting_for_chunks(const struct aws_h1_encoder *encoder);
 
+/* Body data in memory (see aws_http_body_stream_new_from_memory_slices()) is sent without copying
+ * if at least this much is available in one piece. Smaller pieces are cheaper to copy. */
+#define AWS_H1_ENCODER_ZERO_COPY_MIN_SIZE (16 * 1024)
+/* Body data sent without copying is split into pieces no larger than this */
+#define AWS_H1_ENCODER_ZERO_COPY_MAX_SIZE (1024 * 1024)
+
+/**
+ * Return true if the next piece of the current message is body data that can be sent straight from the
+ * user's memory, and set out_data to it. The caller must send it without copying, then call
+ * aws_h1_encoder_on_zero_copy_body_sent(). The memory must not be used once the message completes.
+ */
+AWS_HTTP_API
+bool aws_h1_encoder_get_zero_copy_body(struct aws_h1_encoder *encoder, struct aws_byte_cursor *out_data);
+
+/* Report that data from aws_h1_encoder_get_zero_copy_body() was sent */
+AWS_HTTP_API
+void aws_h1_encoder_on_zero_copy_body_sent(struct aws_h1_encoder *encoder, size_t len);
+
 AWS_EXTERN_C_END
 
 #endif /* AWS_HTTP_H1_ENCODER_H */
@@ -13,7 +13,11 @@
 
 #include <aws/http/private/connection_impl.h>
 #include <aws/http/private/h2_frames.h>
+#include <aws/http/private/hpack.h>
+#include <aws/http/private/mpsc_queue.h>
+#include <aws/http/statistics.h>
 
+struct aws_h2_data_scheduler;
 struct aws_h2_decoder;
 struct aws_h2_stream;
 
@@ -53,15 +57,28 @@ struct aws_h2_connection {
         /* Most recent stream-id that was initiated by peer */
         uint32_t latest_peer_initiated_stream_id;
 
+        /* List using aws_h2_stream.node, sorted by stream-id.
+         * Ids are assigned off-thread, so streams may come out of the pending_stream_queue out of order.
+         * They wait here until every stream with a lower id has arrived, since new streams
+         * must be opened in increasing order of id (RFC-7540 5.1.1). */
+        struct aws_linked_list out_of_order_stream_list;
+
+        /* Id of the next self-initiated stream to move into the active datastructures */
+        uint32_t next_stream_id_to_activate;
+
+        /* (server-only) True only while the on_incoming_request callback is running,
+         * the only time a request-handler stream may be created */
+        bool can_create_request_handler_stream;
+
         /* Maps stream-id to aws_h2_stream*.
          * Contains all streams in the open, reserved, and half-closed states (terms from RFC-7540 5.1).
          * Once a stream enters closed state, it is removed from this map. */
         struct aws_hash_table active_streams_map;
 
-        /* List using aws_h2_stream.node.
-         * Contains all streams with DATA frames to send.
-         * Any stream in this list is also in the active_streams_map. */
-        struct aws_linked_list outgoing_streams_list;
+        /* Contains all streams with DATA frames to send, and decides which one sends next.
+         * Streams are kept in lists using aws_h2_stream.node.
+         * Any stream in the scheduler is also in the active_streams_map. */
+        struct aws_h2_data_scheduler *data_scheduler;
 
         /* List using aws_h2_stream.node.
          * Contains all streams with DATA frames to send, and cannot send now due to flow control.
@@ -70,7 +87,7 @@ struct aws_h2_connection {
 
         /* List using aws_h2_frame.node.
          * Queues all frames (except DATA frames) for connection to send.
-         * When queue is empty, then we send DATA frames from the outgoing_streams_list */
+         * When queue is empty, then we send DATA frames from streams in the data_scheduler */
         struct aws_linked_list outgoing_frames_queue;
 
         /* FIFO cache for closed stream, key: stream-id, value: aws_h2_stream_closed_when.
@@ -106,20 +123,41 @@ struct aws_h2_connection {
         int channel_shutdown_error_code;
         bool channel_shutdown_immediately;
         bool channel_shutdown_waiting_for_goaway_to_be_written;
+
+        struct aws_crt_statistics_http2_channel stats;
+
+        /* Bookkeeping for the time-based stats. Each flag notes whether the condition currently holds,
+         * and each timestamp notes when the time since was last added to stats. */
+        struct {
+            bool has_outgoing;
+            bool has_incoming;
+            bool connection_window_stalled;
+            bool stream_window_stalled;
+            uint64_t outgoing_timestamp_ns;
+            uint64_t incoming_timestamp_ns;
+            uint64_t connection_window_stalled_timestamp_ns;
+            uint64_t stream_window_stalled_timestamp_ns;
+
+            /* HPACK encoder's running totals, as of the last time stats were reset */
+            struct aws_hpack_encoder_stats hpack_at_reset;
+        } stats_timing;
     } thread_data;
 
     /* Any thread may touch this data, but the lock must be held (unless it's an atomic) */
     struct {
         struct aws_mutex lock;
 
-        /* New `aws_h2_stream *` that haven't moved to `thread_data` yet */
-        struct aws_linked_list pending_stream_list;
+        /* Queue using aws_h2_stream.node (lock-free, lock need not be held).
+         * New streams that haven't moved to `thread_data` yet */
+        struct aws_mpsc_queue pending_stream_queue;
 
-        /* New `aws_h2_frames *`, connection control frames created by user that haven't moved to `thread_data` yet */
-        struct aws_linked_list pending_frame_list;
+        /* Queue using aws_h2_frame.node (lock-free, lock need not be held).
+         * Connection control frames created by user that haven't moved to `thread_data` yet */
+        struct aws_mpsc_queue pending_frame_queue;
 
-        /* New `aws_h2_pending_settings *` created by user that haven't moved to `thread_data` yet */
-        struct aws_linked_list pending_settings_list;
+        /* Queue using aws_h2_pending_settings.node (lock-free, lock need not be held).
+         * Settings created by user that haven't moved to `thread_data` yet */
+        struct aws_mpsc_queue pending_settings_queue;
 
         /* New `aws_h2_pending_ping *` created by user that haven't moved to `thread_data` yet */
         struct aws_linked_list pending_ping_list;
@@ -127,16 +165,22 @@ struct aws_h2_connection {
         /* New `aws_h2_pending_goaway *` created by user that haven't sent yet */
         struct aws_linked_list pending_goaway_list;
 
-        bool is_cross_thread_work_task_scheduled;
+        /* (atomic bool) Set by whoever schedules the cross-thread work task, cleared when the task starts running.
+         * Producers of the lock-free queues only check this on the queue's empty->non-empty transition. */
+        struct aws_atomic_var is_cross_thread_work_task_scheduled;
 
         /* The window_update value for `thread_data.window_size_self` that haven't applied yet */
         size_t window_update_size;
 
-        /* For checking status from outside the event-loop thread. */
-        bool is_open;
+        /* (atomic bool) For checking status from outside the event-loop thread. */
+        struct aws_atomic_var is_open;
 
-        /* If non-zero, reason to immediately reject new streams. (ex: closing) */
-        int new_stream_error_code;
+        /* (atomic int) If non-zero, reason to immediately reject new streams. (ex: closing) */
+        struct aws_atomic_var new_stream_error_code;
+
+        /* (atomic size_t) Id to assign to the next self-initiated stream (server even, client odd [RFC 7540 5.1.1]).
+         * Used instead of aws_http_connection.next_stream_id, so streams can be activated without the lock. */
+        struct aws_atomic_var next_stream_id;
 
         /* Last-stream-id sent in most recent GOAWAY frame. Defaults to AWS_H2_STREAM_ID_MAX + 1 indicates no GOAWAY has
          * been sent so far.*/
@@ -162,6 +206,9 @@ struct aws_h2_connection {
 struct aws_h2_pending_settings {
     struct aws_http2_setting *settings_array;
     size_t num_settings;
+    /* SETTINGS frame to send, carried along with the settings so the frames go out in the same order the
+     * settings are queued for ACK. NULL once the frame is handed to the encoder. */
+    struct aws_h2_frame *frame;
     struct aws_linked_list_node node;
     /* user callback */
     void *user_data;
@@ -227,6 +274,12 @@ struct aws_http_headers *aws_h2_create_headers_from_request(
     struct aws_http_message *request,
     struct aws_allocator *alloc);
 
+/* Transform the response to h2 style headers */
+AWS_HTTP_API
+struct aws_http_headers *aws_h2_create_headers_from_response(
+    struct aws_http_message *response,
+    struct aws_allocator *alloc);
+
 AWS_EXTERN_C_END
 
 /* Private functions called from multiple .c files... */
@@ -254,6 +307,20 @@ int aws_h2_connection_on_stream_closed(
     enum aws_h2_stream_closed_when closed_when,
     int aws_error_code);
 
+/**
+ * Stream has DATA frames to send.
+ * The connection will ask the stream to encode them whenever the outgoing frame queue is empty.
+ */
+void aws_h2_connection_add_outgoing_stream(struct aws_h2_connection *connection, struct aws_h2_stream *stream);
+
+/**
+ * Apply a new priority to the stream, rescheduling it if it's waiting to send DATA.
+ */
+void aws_h2_connection_set_stream_priority(
+    struct aws_h2_connection *connection,
+    struct aws_h2_stream *stream,
+    const struct aws_http2_stream_priority *priority);
+
 /**
  * Send RST_STREAM and close a stream reserved via PUSH_PROMISE.
  */
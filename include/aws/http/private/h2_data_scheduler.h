@@ -0,0 +1,116 @@
+#ifndef AWS_HTTP_H2_DATA_SCHEDULER_H
+#define AWS_HTTP_H2_DATA_SCHEDULER_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/connection.h>
+#include <aws/http/request_response.h>
+
+struct aws_h2_stream;
+
+/**
+ * Decides which stream sends the next DATA frame on an HTTP/2 connection.
+ * Streams with DATA to send are pushed in, and the connection pops one each time it has room for another frame.
+ *
+ * Implementations must keep scheduled streams in aws_linked_lists, using aws_h2_stream.node,
+ * so that the connection can pull a stream out at any time (ex: when it completes) via aws_linked_list_remove().
+ *
+ * Peers can't influence scheduling, only the local user can set a stream's priority.
+ * No operation does more than one pass over the scheduled streams, so there's nothing to abuse.
+ * See https://cve.mitre.org/cgi-bin/cvename.cgi?name=CVE-2019-9513
+ */
+struct aws_h2_data_scheduler;
+
+struct aws_h2_data_scheduler_vtable {
+    void (*destroy)(struct aws_h2_data_scheduler *scheduler);
+
+    /* Stream has DATA to send */
+    void (*push)(struct aws_h2_data_scheduler *scheduler, struct aws_h2_stream *stream);
+
+    /* Remove and return the stream that should send next. Only called when not empty. */
+    struct aws_h2_stream *(*pop)(struct aws_h2_data_scheduler *scheduler);
+
+    /* The most recently popped stream wrote this many bytes */
+    void (*on_data_sent)(struct aws_h2_data_scheduler *scheduler, struct aws_h2_stream *stream, size_t num_bytes);
+
+    bool (*is_empty)(const struct aws_h2_data_scheduler *scheduler);
+};
+
+struct aws_h2_data_scheduler {
+    const struct aws_h2_data_scheduler_vtable *vtable;
+    struct aws_allocator *alloc;
+
+    /* Times pop() sent a stream to the back of the line, rather than returning it. For tests. */
+    size_t num_requeues;
+};
+
+/* Data kept on each aws_h2_stream for use by the scheduler */
+struct aws_h2_data_scheduler_stream_data {
+    struct aws_http2_stream_priority priority;
+
+    /* True while stream is in the scheduler */
+    bool is_scheduled;
+
+    /* (weighted-fair only) Bytes the stream may send before its turn is over. May go negative. */
+    int64_t deficit;
+};
+
+AWS_EXTERN_C_BEGIN
+
+/**
+ * Create a scheduler. Raises AWS_ERROR_INVALID_ARGUMENT if the type is unknown.
+ */
+AWS_HTTP_API
+struct aws_h2_data_scheduler *aws_h2_data_scheduler_new(
+    struct aws_allocator *alloc,
+    enum aws_http2_data_scheduler_type type);
+
+/**
+ * Destroy a scheduler. It must be empty.
+ */
+AWS_HTTP_API
+void aws_h2_data_scheduler_destroy(struct aws_h2_data_scheduler *scheduler);
+
+AWS_HTTP_API
+void aws_h2_data_scheduler_push(struct aws_h2_data_scheduler *scheduler, struct aws_h2_stream *stream);
+
+/**
+ * Remove and return the stream that should send its next DATA frame, or NULL if the scheduler is empty.
+ * If the stream still has more to send afterwards, push it back in.
+ */
+AWS_HTTP_API
+struct aws_h2_stream *aws_h2_data_scheduler_pop(struct aws_h2_data_scheduler *scheduler);
+
+/**
+ * Report how many bytes the stream most recently popped just wrote.
+ */
+AWS_HTTP_API
+void aws_h2_data_scheduler_on_data_sent(
+    struct aws_h2_data_scheduler *scheduler,
+    struct aws_h2_stream *stream,
+    size_t num_bytes);
+
+/**
+ * Remove stream from the scheduler, if it's in there.
+ */
+AWS_HTTP_API
+void aws_h2_data_scheduler_remove(struct aws_h2_data_scheduler *scheduler, struct aws_h2_stream *stream);
+
+/**
+ * Change a stream's priority, rescheduling it if it's in the scheduler.
+ */
+AWS_HTTP_API
+void aws_h2_data_scheduler_set_priority(
+    struct aws_h2_data_scheduler *scheduler,
+    struct aws_h2_stream *stream,
+    const struct aws_http2_stream_priority *priority);
+
+AWS_HTTP_API
+bool aws_h2_data_scheduler_is_empty(const struct aws_h2_data_scheduler *scheduler);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_HTTP_H2_DATA_SCHEDULER_H */
@@ -24,6 +24,10 @@
 
 /* Return a failed aws_h2err from any callback to stop the decoder and cause a Connection Error */
 struct aws_h2_decoder_vtable {
+    /* Called once per frame, after its 9-byte prefix is decoded and validated, before any other callbacks for that
+     * frame. Unknown frame types are reported as AWS_H2_FRAME_T_UNKNOWN. */
+    struct aws_h2err (*on_frame_prefix)(enum aws_h2_frame_type type, uint32_t payload_len, void *userdata);
+
     /* For HEADERS header-block: _begin() is called, then 0+ _i() calls, then _end().
      * No other decoder callbacks will occur in this time.
      * If something is malformed, no further _i() calls occur, and it is reported in _end() */
@@ -108,6 +108,10 @@ struct aws_h2_frame_encoder {
     struct aws_hpack_context *hpack;
     struct aws_h2_frame *current_frame;
 
+    /* A HEADERS or PUSH_PROMISE frame's entire header-block is encoded here before being split into frames.
+     * Only one frame is encoded at a time, so the buffer is shared by all frames to avoid an allocation per frame. */
+    struct aws_byte_buf header_block_buf;
+
     /* Settings for frame encoder, which is based on the settings received from peer */
     struct {
         /*  the size of the largest frame payload */
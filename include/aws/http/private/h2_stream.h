@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: Apache-2.0.
  */
 
+#include <aws/http/private/h2_data_scheduler.h>
 #include <aws/http/private/h2_frames.h>
 #include <aws/http/private/request_response_impl.h>
 
@@ -69,6 +70,9 @@ struct aws_h2_stream {
         int64_t window_size_self;
         struct aws_http_message *outgoing_message;
         bool received_main_headers;
+
+        /* Priority and bookkeeping for the connection's DATA scheduler */
+        struct aws_h2_data_scheduler_stream_data scheduler_data;
     } thread_data;
 
     /* Any thread may touch this data, but the lock must be held (unless it's an atomic) */
@@ -85,8 +89,21 @@ struct aws_h2_stream {
 
         bool reset_called;
 
+        /* Priority most recently set by the user.
+         * If stream is active, `priority_changed` is set until this moves to `thread_data.scheduler_data` */
+        struct aws_http2_stream_priority priority;
+        bool priority_changed;
+
         /* Simplified stream state. */
         enum aws_h2_stream_api_state api_state;
+
+        /* (server-only) True once user has called aws_http_stream_send_response() */
+        bool has_outgoing_response;
+
+        /* (server-only) Response that hasn't moved to `thread_data.outgoing_message` yet,
+         * along with the HEADERS frame that starts it */
+        struct aws_http_message *pending_response;
+        struct aws_h2_frame *pending_response_headers_frame;
     } synced_data;
 
     /* Store the sent reset HTTP/2 error code, set to -1, if none has sent so far */
@@ -94,6 +111,11 @@ struct aws_h2_stream {
 
     /* Store the received reset HTTP/2 error code, set to -1, if none has received so far */
     int64_t received_reset_error_code;
+
+    /* (server-only) Storage for the incoming request's :method and :path,
+     * which `base.server_data->request_method_str` and `base.server_data->request_path` point into */
+    struct aws_byte_buf request_method_buf;
+    struct aws_byte_buf request_path_buf;
 };
 
 const char *aws_h2_stream_state_to_str(enum aws_h2_stream_state state);
@@ -102,6 +124,14 @@ struct aws_h2_stream *aws_h2_stream_new_request(
     struct aws_http_connection *client_connection,
     const struct aws_http_make_request_options *options);
 
+/* Create a server stream to handle the request arriving on a new peer-initiated stream-id.
+ * Must be called on the connection's thread. */
+struct aws_h2_stream *aws_h2_stream_new_request_handler(
+    const struct aws_http_request_handler_options *options,
+    uint32_t stream_id);
+
+int aws_h2_stream_send_response(struct aws_h2_stream *stream, struct aws_http_message *response);
+
 enum aws_h2_stream_state aws_h2_stream_get_state(const struct aws_h2_stream *stream);
 
 struct aws_h2err aws_h2_stream_window_size_change(struct aws_h2_stream *stream, int32_t size_changed, bool self);
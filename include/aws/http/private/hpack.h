@@ -5,6 +5,7 @@
  * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
  * SPDX-License-Identifier: Apache-2.0.
  */
+#include <aws/http/connection.h>
 #include <aws/http/request_response.h>
 
 struct aws_byte_buf;
@@ -47,6 +48,54 @@ enum aws_hpack_huffman_mode {
     AWS_HPACK_HUFFMAN_ALWAYS,
 };
 
+/**
+ * Running totals kept by an encoder, to measure how well headers are compressing.
+ */
+struct aws_hpack_encoder_stats {
+    /* Total length of names and values passed to the encoder */
+    uint64_t uncompressed_bytes;
+    /* Total length of header-blocks output by the encoder */
+    uint64_t encoded_bytes;
+
+    uint64_t num_headers;
+    /* Headers sent as a single index into the static or dynamic table */
+    uint64_t num_indexed;
+    /* Headers inserted into the dynamic table */
+    uint64_t num_inserted;
+    /* Headers that could have been inserted into the dynamic table, but the indexing policy said no */
+    uint64_t num_skipped_by_policy;
+};
+
+/**
+ * Huffman decoding is driven by a generated table (see scripts/generate_hpack_huffman_decode_table.py).
+ * Each state is a partially decoded code, and input is consumed 4 bits at a time.
+ * The shortest code is 5 bits long, so at most 1 symbol completes per transition.
+ */
+#define AWS_HPACK_HUFFMAN_DECODE_STATE_COUNT 256
+
+enum aws_hpack_huffman_decode_flags {
+    /* A symbol was completed during this transition */
+    AWS_HPACK_HUFFMAN_DECODE_F_SYMBOL = 0x1,
+    /* The string may legally end in the next state (any leftover bits are valid padding) */
+    AWS_HPACK_HUFFMAN_DECODE_F_ACCEPT = 0x2,
+    /* The EOS symbol was decoded, which is an error [5.2] */
+    AWS_HPACK_HUFFMAN_DECODE_F_FAIL = 0x4,
+};
+
+struct aws_hpack_huffman_decode_transition {
+    uint8_t state;
+    uint8_t flags;
+    uint8_t symbol;
+};
+
+extern const struct aws_hpack_huffman_decode_transition
+    aws_hpack_huffman_decode_table[AWS_HPACK_HUFFMAN_DECODE_STATE_COUNT][16];
+
+struct aws_hpack_huffman_decoder {
+    uint8_t state;
+    bool accept;
+};
+
 AWS_EXTERN_C_BEGIN
 
 /* Library-level init and shutdown */
@@ -129,6 +178,16 @@ void aws_hpack_set_protocol_max_size_setting(struct aws_hpack_context *context,
 AWS_HTTP_API
 void aws_hpack_set_huffman_mode(struct aws_hpack_context *context, enum aws_hpack_huffman_mode mode);
 
+/**
+ * Set which headers the encoder inserts into the dynamic table. The default is AWS_HTTP2_HPACK_INDEXING_ALL.
+ * Raises AWS_ERROR_INVALID_ARGUMENT if the policy is unknown.
+ */
+AWS_HTTP_API
+int aws_hpack_set_indexing_policy(struct aws_hpack_context *context, enum aws_http2_hpack_indexing_policy policy);
+
+AWS_HTTP_API
+void aws_hpack_get_encoder_stats(const struct aws_hpack_context *context, struct aws_hpack_encoder_stats *out_stats);
+
 /* Public for testing purposes.
  * Output will be dynamically resized if it's too short */
 AWS_HTTP_API
@@ -159,6 +218,40 @@ int aws_hpack_decode_string(
     struct aws_byte_buf *output,
     bool *complete);
 
+/* Public for testing purposes.
+ * Returns the length of to_encode, in bytes, after Huffman encoding */
+AWS_HTTP_API
+size_t aws_hpack_huffman_get_encoded_length(struct aws_byte_cursor to_encode);
+
+/* Public for testing purposes.
+ * Output will be dynamically resized if it's too short */
+AWS_HTTP_API
+int aws_hpack_huffman_encode(struct aws_byte_cursor to_encode, struct aws_byte_buf *output);
+
+/* Public for testing purposes */
+AWS_HTTP_API
+void aws_hpack_huffman_decoder_reset(struct aws_hpack_huffman_decoder *decoder);
+
+/**
+ * Public for testing purposes.
+ * Decode all of to_decode, which may be part of a longer Huffman string.
+ * Output will be dynamically resized if it's too short.
+ * Raises AWS_ERROR_INVALID_ARGUMENT if the EOS symbol is encountered.
+ */
+AWS_HTTP_API
+int aws_hpack_huffman_decode(
+    struct aws_hpack_huffman_decoder *decoder,
+    struct aws_byte_cursor *to_decode,
+    struct aws_byte_buf *output);
+
+/**
+ * Public for testing purposes.
+ * Call at the end of the Huffman string.
+ * Raises AWS_ERROR_INVALID_ARGUMENT if the final bits are not valid padding [5.2].
+ */
+AWS_HTTP_API
+int aws_hpack_huffman_decoder_finish(const struct aws_hpack_huffman_decoder *decoder);
+
 AWS_EXTERN_C_END
 
 #endif /* AWS_HTTP_HPACK_H */
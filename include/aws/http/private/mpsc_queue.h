@@ -0,0 +1,66 @@
+#ifndef AWS_HTTP_MPSC_QUEUE_H
+#define AWS_HTTP_MPSC_QUEUE_H
+
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/http/http.h>
+
+#include <aws/common/atomics.h>
+#include <aws/common/linked_list.h>
+
+/**
+ * Intrusive lock-free queue with many producers and a single consumer.
+ *
+ * Any thread may push. The consumer takes everything at once via aws_mpsc_queue_pop_all(),
+ * which hands the nodes back as a regular aws_linked_list, in the order they were pushed.
+ * Since nodes are plain aws_linked_list_nodes, items move between this queue and ordinary lists
+ * without any allocation.
+ *
+ * A sealed queue rejects all further pushes, so the consumer can take the final contents
+ * knowing nothing else will sneak in afterwards.
+ */
+struct aws_mpsc_queue {
+    /* Most recently pushed node, linked via node->next from newest to oldest.
+     * NULL when empty, or a sentinel once sealed. */
+    struct aws_atomic_var head;
+};
+
+AWS_EXTERN_C_BEGIN
+
+AWS_HTTP_API
+void aws_mpsc_queue_init(struct aws_mpsc_queue *queue);
+
+/**
+ * Push a node onto the queue. Any thread may call this.
+ * On success, `out_was_empty` (optional) is set true if this push took the queue from empty to non-empty,
+ * letting the producer know it is responsible for waking the consumer.
+ * Fails with AWS_ERROR_INVALID_STATE if the queue has been sealed.
+ */
+AWS_HTTP_API
+int aws_mpsc_queue_push(struct aws_mpsc_queue *queue, struct aws_linked_list_node *node, bool *out_was_empty);
+
+/**
+ * Move everything currently in the queue to the back of `out_list`, oldest first.
+ * Only the consumer may call this.
+ */
+AWS_HTTP_API
+void aws_mpsc_queue_pop_all(struct aws_mpsc_queue *queue, struct aws_linked_list *out_list);
+
+/**
+ * Seal the queue so all further pushes fail, and move its remaining contents to the back of `out_list`.
+ * Only the consumer may call this. Sealing a queue that's already sealed does nothing.
+ */
+AWS_HTTP_API
+void aws_mpsc_queue_seal(struct aws_mpsc_queue *queue, struct aws_linked_list *out_list);
+
+/**
+ * Returns true if there is nothing in the queue. A sealed queue is always empty.
+ */
+AWS_HTTP_API
+bool aws_mpsc_queue_is_empty(const struct aws_mpsc_queue *queue);
+
+AWS_EXTERN_C_END
+
+#endif /* AWS_HTTP_MPSC_QUEUE_H */
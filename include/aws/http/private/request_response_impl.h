@@ -22,8 +22,35 @@ struct aws_http_stream_vtable {
     int (*http2_reset_stream)(struct aws_http_stream *http2_stream, uint32_t http2_error);
     int (*http2_get_received_error_code)(struct aws_http_stream *http2_stream, uint32_t *http2_error);
     int (*http2_get_sent_error_code)(struct aws_http_stream *http2_stream, uint32_t *http2_error);
+    int (*http2_set_priority)(
+        struct aws_http_stream *http2_stream,
+        const struct aws_http2_stream_priority *priority);
 };
 
+/**
+ * Keeps the memory behind an aws_http_body_slice alive.
+ * The connection that lent the memory decides what happens once the last reference is released.
+ */
+struct aws_http_body_slice_owner {
+    struct aws_atomic_var refcount;
+    void (*destroy)(struct aws_http_body_slice_owner *owner);
+};
+
+/**
+ * If body_stream came from aws_http_body_stream_new_from_memory_slices(),
+ * returns true and sets out_data to the unread remainder of its current slice.
+ * out_data is empty if the stream has been read to the end.
+ */
+AWS_HTTP_API
+bool aws_http_body_stream_peek_memory_slice(struct aws_input_stream *body_stream, struct aws_byte_cursor *out_data);
+
+/**
+ * Advance a stream from aws_http_body_stream_new_from_memory_slices(), past data that was sent directly
+ * from the memory returned by aws_http_body_stream_peek_memory_slice(). len must not exceed that data's length.
+ */
+AWS_HTTP_API
+void aws_http_body_stream_skip_memory_slice(struct aws_input_stream *body_stream, size_t len);
+
 /**
  * Base class for streams.
  * There are specific implementations for each HTTP version.
@@ -39,6 +66,7 @@ struct aws_http_stream {
     aws_http_on_incoming_headers_fn *on_incoming_headers;
     aws_http_on_incoming_header_block_done_fn *on_incoming_header_block_done;
     aws_http_on_incoming_body_fn *on_incoming_body;
+    aws_http_on_incoming_body_slice_fn *on_incoming_body_slice;
     aws_http_on_stream_complete_fn *on_complete;
 
     struct aws_atomic_var refcount;
@@ -69,6 +69,17 @@ struct aws_byte_cursor aws_strutil_trim_http_whitespace(struct aws_byte_cursor c
 AWS_HTTP_API
 bool aws_strutil_is_http_token(struct aws_byte_cursor token);
 
+/**
+ * Return the number of token characters (see aws_strutil_is_http_token()) at the start of the cursor.
+ * This lets a parser validate a token and find the delimiter that follows it in one pass.
+ * Examples:
+ * "Host: example.com" -> 4
+ * ": example.com" -> 0
+ * "Host" -> 4
+ */
+AWS_HTTP_API
+size_t aws_strutil_http_token_span(struct aws_byte_cursor cursor);
+
 /**
  * Same as aws_strutil_is_http_token_valid(), but uppercase letters are forbidden.
  */
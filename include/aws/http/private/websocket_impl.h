@@ -96,6 +96,19 @@ const char *aws_websocket_opcode_str(uint8_t opcode);
 AWS_HTTP_API
 uint64_t aws_websocket_frame_encoded_size(const struct aws_websocket_frame *frame);
 
+/**
+ * XOR data against the masking-key, as described in RFC-6455 Section 5.3.
+ * Masking is its own inverse, so this is used for both masking and unmasking.
+ * `mask_offset` is the index of data[0] within the frame's payload,
+ * allowing a payload to be processed across several calls.
+ */
+AWS_HTTP_API
+void aws_websocket_apply_masking_key(
+    const uint8_t masking_key[4],
+    uint64_t mask_offset,
+    uint8_t *data,
+    size_t data_len);
+
 /**
  * Create a websocket channel-handler and insert it into the channel.
  */
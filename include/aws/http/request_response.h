@@ -8,6 +8,7 @@
 
 #include <aws/http/http.h>
 
+struct aws_http_body_slice_owner;
 struct aws_http_connection;
 struct aws_input_stream;
 
@@ -91,6 +92,36 @@ enum aws_http_header_block {
     AWS_HTTP_HEADER_BLOCK_TRAILING,
 };
 
+/**
+ * Priority of an HTTP/2 stream, used to decide which stream sends the next DATA frame.
+ * Initialize with AWS_HTTP2_STREAM_PRIORITY_INIT to set default values.
+ * See `aws_http2_data_scheduler_type` and aws_http2_stream_set_priority().
+ */
+struct aws_http2_stream_priority {
+    /**
+     * Used by AWS_HTTP2_DATA_SCHEDULER_STRICT_PRIORITY.
+     * From 0 (most urgent) to 7 (least urgent), like RFC-9218 urgency.
+     * Defaults to 3.
+     */
+    uint8_t urgency;
+
+    /**
+     * Used by AWS_HTTP2_DATA_SCHEDULER_WEIGHTED_FAIR.
+     * From 1 to 256, like RFC-7540 weight.
+     * Defaults to 16.
+     */
+    uint16_t weight;
+};
+
+#define AWS_HTTP2_STREAM_PRIORITY_MAX_URGENCY 7
+#define AWS_HTTP2_STREAM_PRIORITY_MAX_WEIGHT 256
+
+/**
+ * Initializes aws_http2_stream_priority with default values.
+ */
+#define AWS_HTTP2_STREAM_PRIORITY_INIT                                                                                 \
+    { .urgency = 3, .weight = 16, }
+
 /**
  * The definition for an outgoing HTTP request or response.
  * The message may be transformed (ex: signing the request) before its data is eventually sent.
@@ -172,6 +203,37 @@ typedef int(aws_http_on_incoming_header_block_done_fn)(
 typedef int(
     aws_http_on_incoming_body_fn)(struct aws_http_stream *stream, const struct aws_byte_cursor *data, void *user_data);
 
+/**
+ * Body data lent by the connection, see `aws_http_on_incoming_body_slice_fn`.
+ */
+struct aws_http_body_slice {
+    struct aws_byte_cursor data;
+
+    /* Private. Keeps the memory behind `data` alive. NULL if the connection can't lend its buffers. */
+    struct aws_http_body_slice_owner *owner;
+};
+
+/**
+ * Alternative to aws_http_on_incoming_body_fn, which lets the user keep body data without copying it.
+ * Called repeatedly as body data is received.
+ * This is always invoked on the HTTP connection's event-loop thread.
+ *
+ * The slice is only valid during the callback. To keep the data longer, copy the slice struct
+ * and call aws_http_body_slice_acquire() on it, then aws_http_body_slice_release() when done.
+ *
+ * On HTTP/1.1 connections the data points directly into the aws_io_message it arrived in.
+ * The whole message stays alive while any slice of it is held, and counts against the connection's
+ * read buffer. With manual_window_management, this keeps the connection's window from reopening
+ * until slices are released.
+ * Connections that can't lend their buffers deliver slices that can't be acquired, their data must be copied.
+ *
+ * Window behavior and return values are the same as aws_http_on_incoming_body_fn.
+ */
+typedef int(aws_http_on_incoming_body_slice_fn)(
+    struct aws_http_stream *stream,
+    const struct aws_http_body_slice *slice,
+    void *user_data);
+
 /**
  * Invoked when request has been completely read.
  * This is always invoked on the HTTP connection's event-loop thread.
@@ -233,6 +295,13 @@ struct aws_http_make_request_options {
      * See `aws_http_on_stream_complete_fn`.
      */
     aws_http_on_stream_complete_fn *on_complete;
+
+    /**
+     * Invoked repeatedly as body data is received, lending the data rather than requiring a copy.
+     * Optional. If set, on_response_body is not invoked.
+     * See `aws_http_on_incoming_body_slice_fn`.
+     */
+    aws_http_on_incoming_body_slice_fn *on_response_body_slice;
 };
 
 struct aws_http_request_handler_options {
@@ -381,6 +450,23 @@ bool aws_http_header_name_eq(struct aws_byte_cursor name_a, struct aws_byte_curs
 AWS_HTTP_API
 struct aws_http_headers *aws_http_headers_new(struct aws_allocator *allocator);
 
+/**
+ * Create a new headers object that stores its strings in a few large blocks,
+ * instead of making an allocation per header.
+ * This is much cheaper for building up a set of headers that mostly gets added to, like an outgoing request.
+ *
+ * block_size is the size of each block of string storage. Pass 0 to use a sensible default.
+ * A header whose strings don't fit in block_size gets a block of its own.
+ *
+ * Unlike aws_http_headers_new(), erasing a header may move the strings of the remaining headers,
+ * invalidating any cursors previously retrieved from this object.
+ * Adding headers never moves existing strings.
+ *
+ * The caller has a hold on the object and must call aws_http_headers_release() when they are done with it.
+ */
+AWS_HTTP_API
+struct aws_http_headers *aws_http_headers_new_arena(struct aws_allocator *allocator, size_t block_size);
+
 /**
  * Acquire a hold on the object, preventing it from being deleted until
  * aws_http_headers_release() is called by all those with a hold on it.
@@ -736,6 +822,36 @@ AWS_HTTP_API int aws_http_stream_activate(struct aws_http_stream *stream);
 AWS_HTTP_API
 struct aws_http_connection *aws_http_stream_get_connection(const struct aws_http_stream *stream);
 
+/**
+ * Create a body stream that reads, in order, from a list of in-memory byte ranges (gather).
+ * The list is copied, but the memory it refers to is not, and must remain valid until the stream is destroyed.
+ * The stream supports seeking and reports its length, so it works anywhere a body stream does.
+ *
+ * HTTP/1.1 connections send large ranges straight from this memory, instead of copying them into
+ * the channel's messages. Other uses of the stream (ex: HTTP/2) copy as usual.
+ */
+AWS_HTTP_API
+struct aws_input_stream *aws_http_body_stream_new_from_memory_slices(
+    struct aws_allocator *allocator,
+    const struct aws_byte_cursor *slices,
+    size_t num_slices);
+
+/**
+ * Keep a body slice's data valid after the aws_http_on_incoming_body_slice_fn that delivered it returns.
+ * Call this on a copy of the slice struct, and pass that copy to aws_http_body_slice_release() when done.
+ * Fails with AWS_ERROR_UNSUPPORTED_OPERATION if the connection can't lend its buffers,
+ * in which case the data must be copied before the callback returns.
+ */
+AWS_HTTP_API
+int aws_http_body_slice_acquire(const struct aws_http_body_slice *slice);
+
+/**
+ * Release a slice kept by aws_http_body_slice_acquire(). Its data must not be used afterwards.
+ * May be called from any thread. The slice struct is zeroed.
+ */
+AWS_HTTP_API
+void aws_http_body_slice_release(struct aws_http_body_slice *slice);
+
 /* Only valid in "request" streams, once response headers start arriving */
 AWS_HTTP_API
 int aws_http_stream_get_incoming_response_status(const struct aws_http_stream *stream, int *out_status);
@@ -780,6 +896,23 @@ void aws_http_stream_update_window(struct aws_http_stream *stream, size_t increm
 AWS_HTTP_API
 uint32_t aws_http_stream_get_id(const struct aws_http_stream *stream);
 
+/**
+ * Set the HTTP/2 stream's priority (HTTP/2 only).
+ * The stream's priority is only seen by this side of the connection, it is not sent to the peer.
+ * Which fields matter depends on the connection's `aws_http2_data_scheduler_type`.
+ * This may be called from any thread, before or after the stream is activated.
+ * It takes effect asynchronously once the stream is active.
+ *
+ * AWS_ERROR_INVALID_ARGUMENT is raised if a field is out of range.
+ *
+ * @param http2_stream HTTP/2 stream.
+ * @param priority Priority to use, see `aws_http2_stream_priority`.
+ */
+AWS_HTTP_API
+int aws_http2_stream_set_priority(
+    struct aws_http_stream *http2_stream,
+    const struct aws_http2_stream_priority *priority);
+
 /**
  * Reset the HTTP/2 stream (HTTP/2 only).
  * Note that if the stream closes before this async call is fully processed, the RST_STREAM frame will not be sent.
@@ -9,6 +9,7 @@
 #include <aws/http/http.h>
 
 struct aws_http_connection;
+struct aws_http1_connection_options;
 struct aws_server_bootstrap;
 struct aws_socket_options;
 struct aws_tls_connection_options;
@@ -104,6 +105,13 @@ struct aws_http_server_options {
      * reaches 0, no further data will be received.
      **/
     bool manual_window_management;
+
+    /**
+     * Optional.
+     * Options for incoming HTTP/1.x connections.
+     * Server makes a copy, and holds a reference to any read_buffer_budget until the server is destroyed.
+     */
+    const struct aws_http1_connection_options *http1_options;
 };
 
 /**
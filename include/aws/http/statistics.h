@@ -12,8 +12,15 @@
 
 enum aws_crt_http_statistics_category {
     AWSCRT_STAT_CAT_HTTP1_CHANNEL = AWS_CRT_STATISTICS_CATEGORY_BEGIN_RANGE(AWS_C_HTTP_PACKAGE_ID),
+    AWSCRT_STAT_CAT_HTTP2_CHANNEL,
 };
 
+/**
+ * Number of HTTP/2 frame types defined by RFC-7540, DATA (0x0) through CONTINUATION (0x9).
+ * Per-frame-type statistics are indexed by the frame type's numeric value.
+ */
+#define AWS_CRT_STATISTICS_HTTP2_FRAME_TYPE_COUNT 10
+
 /**
  * A statistics struct for http handlers.  Tracks the actual amount of time that incoming and outgoing requests are
  * waiting for their IO to complete.
@@ -26,6 +33,52 @@ struct aws_crt_statistics_http1_channel {
 
     uint32_t current_outgoing_stream_id;
     uint32_t current_incoming_stream_id;
+
+    /* Number of aws_io_messages written, and number of streams that finished writing, during the interval.
+     * Pipelined streams are packed into shared messages when they're small enough, so the ratio of the two
+     * shows how well writes are being coalesced. */
+    uint64_t num_outgoing_messages;
+    uint64_t num_outgoing_streams_done;
+};
+
+/**
+ * A statistics struct for HTTP/2 connections.
+ * Like the HTTP/1 stats, tracks how long the connection had IO it was waiting on,
+ * so throughput can be measured against that time rather than wall-clock time.
+ */
+struct aws_crt_statistics_http2_channel {
+    aws_crt_statistics_category_t category;
+
+    /* Time spent with frames or DATA waiting to be written */
+    uint64_t pending_outgoing_stream_ms;
+
+    /* Time spent with at least one active stream, waiting to receive */
+    uint64_t pending_incoming_stream_ms;
+
+    /* Time spent with DATA to send, but the peer's connection flow-control window too small to send it */
+    uint64_t connection_window_stalled_ms;
+
+    /* Time spent with at least one stream unable to send DATA due to the peer's stream flow-control window */
+    uint64_t stream_window_stalled_ms;
+
+    /* Number of active streams at the time statistics were gathered */
+    uint32_t num_active_streams;
+
+    /* True if, at any point during the sample interval, there were no active streams */
+    bool was_inactive;
+
+    /* Bytes sent and received for each frame type, including the 9-byte frame header.
+     * Indexed by frame type (ex: [0x0] for DATA, [0x1] for HEADERS). Unknown frame types are not counted.
+     * Outgoing CONTINUATION frames are counted along with the HEADERS or PUSH_PROMISE frame they continue. */
+    uint64_t frame_bytes_sent[AWS_CRT_STATISTICS_HTTP2_FRAME_TYPE_COUNT];
+    uint64_t frame_bytes_received[AWS_CRT_STATISTICS_HTTP2_FRAME_TYPE_COUNT];
+
+    /* Total length of names and values in outgoing header-blocks, before HPACK compression */
+    uint64_t header_bytes_uncompressed;
+
+    /* Length of outgoing header-blocks after HPACK compression.
+     * The compression ratio is header_bytes_uncompressed / header_bytes_compressed. */
+    uint64_t header_bytes_compressed;
 };
 
 AWS_EXTERN_C_BEGIN
@@ -48,6 +101,24 @@ void aws_crt_statistics_http1_channel_cleanup(struct aws_crt_statistics_http1_ch
 AWS_HTTP_API
 void aws_crt_statistics_http1_channel_reset(struct aws_crt_statistics_http1_channel *stats);
 
+/**
+ * Initializes a HTTP/2 channel handler statistics struct
+ */
+AWS_HTTP_API
+int aws_crt_statistics_http2_channel_init(struct aws_crt_statistics_http2_channel *stats);
+
+/**
+ * Cleans up a HTTP/2 channel handler statistics struct
+ */
+AWS_HTTP_API
+void aws_crt_statistics_http2_channel_cleanup(struct aws_crt_statistics_http2_channel *stats);
+
+/**
+ * Resets a HTTP/2 channel handler statistics struct's statistics
+ */
+AWS_HTTP_API
+void aws_crt_statistics_http2_channel_reset(struct aws_crt_statistics_http2_channel *stats);
+
 AWS_EXTERN_C_END
 
 #endif /* AWS_HTTP_STATISTICS_H */
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+# Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+# SPDX-License-Identifier: Apache-2.0.
+
+"""
+Generates source/hpack_huffman_decode_table.c from include/aws/http/private/hpack_huffman_static_table.def
+
+The table drives a finite state machine that decodes HPACK Huffman strings (RFC-7541 Appendix B) 4 bits at a time.
+Each state is an internal node of the Huffman tree. For each state, and each possible 4-bit input,
+the table says which state comes next, and whether a symbol was emitted along the way.
+The shortest code is 5 bits, so at most 1 symbol can complete in any 4 bits.
+
+Usage: python3 scripts/generate_hpack_huffman_decode_table.py
+"""
+
+import os
+import re
+
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+DEF_PATH = os.path.join(REPO_ROOT, 'include', 'aws', 'http', 'private', 'hpack_huffman_static_table.def')
+OUT_PATH = os.path.join(REPO_ROOT, 'source', 'hpack_huffman_decode_table.c')
+
+# EOS isn't in the .def file, since it's never encoded (RFC-7541 5.2)
+EOS_SYMBOL = 256
+EOS_BITS = '1' * 30
+
+# Flags, must match enum in hpack.h
+F_SYMBOL = 0x1
+F_ACCEPT = 0x2
+F_FAIL = 0x4
+
+
+class Node:
+    def __init__(self, path):
+        self.path = path
+        self.children = [None, None]
+        self.symbol = None
+        self.state_id = None
+
+    def is_leaf(self):
+        return self.symbol is not None
+
+
+def read_codes():
+    codes = {}
+    pattern = re.compile(r'^HUFFMAN_CODE\(\s*(\d+),\s*"([01]+)"')
+    with open(DEF_PATH) as f:
+        for line in f:
+            match = pattern.match(line)
+            if match:
+                codes[int(match.group(1))] = match.group(2)
+    assert len(codes) == 256, "expected 256 codes in .def file"
+    codes[EOS_SYMBOL] = EOS_BITS
+    return codes
+
+
+def build_tree(codes):
+    root = Node('')
+    for symbol, bits in codes.items():
+        node = root
+        for bit in bits:
+            bit = int(bit)
+            if node.children[bit] is None:
+                node.children[bit] = Node(node.path + str(bit))
+            node = node.children[bit]
+            assert not node.is_leaf(), "code is prefix of another code"
+        node.symbol = symbol
+
+    # Number the internal nodes breadth-first, these are the states
+    states = []
+    queue = [root]
+    while queue:
+        node = queue.pop(0)
+        if node.is_leaf():
+            continue
+        assert node.children[0] and node.children[1], "tree must be complete"
+        node.state_id = len(states)
+        states.append(node)
+        queue.extend(node.children)
+    return root, states
+
+
+def is_accepting(node):
+    # A string may end here if the bits since the last symbol could be padding.
+    # Padding must be fewer than 8 bits, and match the most significant bits of EOS (all 1s). (RFC-7541 5.2)
+    return len(node.path) < 8 and '0' not in node.path
+
+
+def build_transitions(root, states):
+    table = []
+    for state in states:
+        row = []
+        for nibble in range(16):
+            node = state
+            symbol = 0
+            flags = 0
+            for shift in (3, 2, 1, 0):
+                node = node.children[(nibble >> shift) & 1]
+                if node.is_leaf():
+                    if node.symbol == EOS_SYMBOL:
+                        flags |= F_FAIL
+                        break
+                    assert not flags & F_SYMBOL, "at most 1 symbol per nibble"
+                    flags |= F_SYMBOL
+                    symbol = node.symbol
+                    node = root
+
+            if flags & F_FAIL:
+                row.append((0, F_FAIL, 0))
+                continue
+
+            if is_accepting(node):
+                flags |= F_ACCEPT
+            row.append((node.state_id, flags, symbol))
+        table.append(row)
+    return table
+
+
+def flags_str(flags):
+    names = []
+    if flags & F_SYMBOL:
+        names.append('S')
+    if flags & F_ACCEPT:
+        names.append('A')
+    if flags & F_FAIL:
+        names.append('F')
+    return '|'.join(names) if names else '0'
+
+
+def write_table(states, table):
+    lines = []
+    lines.append('/**')
+    lines.append(' * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.')
+    lines.append(' * SPDX-License-Identifier: Apache-2.0.')
+    lines.append(' */')
+    lines.append('')
+    lines.append('/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED BY scripts/generate_hpack_huffman_decode_table.py')
+    lines.append(' * DO NOT EDIT. */')
+    lines.append('/* clang-format off */')
+    lines.append('')
+    lines.append('#include <aws/http/private/hpack.h>')
+    lines.append('')
+    lines.append('#define S AWS_HPACK_HUFFMAN_DECODE_F_SYMBOL')
+    lines.append('#define A AWS_HPACK_HUFFMAN_DECODE_F_ACCEPT')
+    lines.append('#define F AWS_HPACK_HUFFMAN_DECODE_F_FAIL')
+    lines.append('')
+    lines.append('/* {next_state, flags, symbol} */')
+    lines.append('const struct aws_hpack_huffman_decode_transition')
+    lines.append('    aws_hpack_huffman_decode_table[AWS_HPACK_HUFFMAN_DECODE_STATE_COUNT][16] = {')
+    for state, row in zip(states, table):
+        lines.append('    /* state %d: "%s" */' % (state.state_id, state.path))
+        lines.append('    {')
+        for i in range(0, 16, 4):
+            entries = ['{%3d, %-5s, %3d}' % (s, flags_str(f), sym) for (s, f, sym) in row[i:i + 4]]
+            lines.append('        ' + ', '.join(entries) + ',')
+        lines.append('    },')
+    lines.append('};')
+    lines.append('')
+    lines.append('#undef S')
+    lines.append('#undef A')
+    lines.append('#undef F')
+    lines.append('')
+
+    with open(OUT_PATH, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+def main():
+    codes = read_codes()
+    root, states = build_tree(codes)
+    assert len(states) == 256, "expected 256 states"
+    table = build_transitions(root, states)
+    write_table(states, table)
+    print('Wrote %s' % OUT_PATH)
+
+
+if __name__ == '__main__':
+    main()
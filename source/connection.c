@@ -11,11 +11,14 @@
 
 #include <aws/http/private/proxy_impl.h>
 
+#include <aws/common/clock.h>
 #include <aws/common/hash_table.h>
 #include <aws/common/mutex.h>
 #include <aws/common/string.h>
 #include <aws/http/request_response.h>
 #include <aws/io/channel_bootstrap.h>
+#include <aws/io/event_loop.h>
+#include <aws/io/host_resolver.h>
 #include <aws/io/logging.h>
 #include <aws/io/socket.h>
 #include <aws/io/tls_channel_handler.h>
@@ -25,8 +28,19 @@
 #    pragma warning(disable : 4232) /* function pointer to dll symbol */
 #endif
 
+static int s_resolve_host(
+    struct aws_client_bootstrap *bootstrap,
+    const struct aws_string *host_name,
+    aws_on_host_resolved_result_fn *on_host_resolved,
+    void *user_data) {
+
+    return aws_host_resolver_resolve_host(
+        bootstrap->host_resolver, host_name, on_host_resolved, &bootstrap->host_resolver_config, user_data);
+}
+
 static struct aws_http_connection_system_vtable s_default_system_vtable = {
     .new_socket_channel = aws_client_bootstrap_new_socket_channel,
+    .resolve_host = s_resolve_host,
 };
 
 static const struct aws_http_connection_system_vtable *s_system_vtable_ptr = &s_default_system_vtable;
@@ -47,6 +61,7 @@ struct aws_http_server {
     void *user_data;
     aws_http_server_on_incoming_connection_fn *on_incoming_connection;
     aws_http_server_on_destroy_fn *on_destroy_complete;
+    struct aws_http1_connection_options http1_options;
     struct aws_socket *socket;
 
     /* Any thread may touch this data, but the lock must be held */
@@ -341,6 +356,17 @@ int aws_http2_connection_get_remote_settings(
     return AWS_OP_SUCCESS;
 }
 
+const struct aws_socket_endpoint *aws_http_connection_get_remote_endpoint(
+    const struct aws_http_connection *connection) {
+
+    AWS_ASSERT(connection);
+    if (connection->remote_endpoint.address[0] == '\0') {
+        return NULL;
+    }
+
+    return &connection->remote_endpoint;
+}
+
 struct aws_channel *aws_http_connection_get_channel(struct aws_http_connection *connection) {
     AWS_ASSERT(connection);
     return connection->channel_slot->channel;
@@ -400,8 +426,7 @@ static void s_server_bootstrap_on_accept_channel_setup(
         goto error;
     }
     /* Create connection */
-    /* TODO: expose http1/2 options to server API */
-    struct aws_http1_connection_options http1_options = AWS_HTTP1_CONNECTION_OPTIONS_INIT;
+    /* TODO: expose http2 options to server API */
     struct aws_http2_connection_options http2_options = AWS_HTTP2_CONNECTION_OPTIONS_INIT;
     connection = s_connection_new(
         server->alloc,
@@ -410,7 +435,7 @@ static void s_server_bootstrap_on_accept_channel_setup(
         server->is_using_tls,
         server->manual_window_management,
         server->initial_window_size,
-        &http1_options,
+        &server->http1_options,
         &http2_options);
     if (!connection) {
         AWS_LOGF_ERROR(
@@ -508,6 +533,7 @@ static void s_http_server_clean_up(struct aws_http_server *server) {
     }
 
     aws_server_bootstrap_release(server->bootstrap);
+    aws_http_read_buffer_budget_release(server->http1_options.read_buffer_budget);
 
     /* invoke the user callback */
     if (server->on_destroy_complete) {
@@ -589,6 +615,10 @@ struct aws_http_server *aws_http_server_new(const struct aws_http_server_options
     server->on_destroy_complete = options->on_destroy_complete;
     server->manual_window_management = options->manual_window_management;
 
+    struct aws_http1_connection_options default_http1_options = AWS_HTTP1_CONNECTION_OPTIONS_INIT;
+    server->http1_options = options->http1_options ? *options->http1_options : default_http1_options;
+    aws_http_read_buffer_budget_acquire(server->http1_options.read_buffer_budget);
+
     int err = aws_mutex_init(&server->synced_data.lock);
     if (err) {
         AWS_LOGF_ERROR(
@@ -652,6 +682,7 @@ socket_error:
 hash_table_error:
     aws_mutex_clean_up(&server->synced_data.lock);
 mutex_error:
+    aws_http_read_buffer_budget_release(server->http1_options.read_buffer_budget);
     aws_mem_release(server->alloc, server);
     return NULL;
 }
@@ -771,6 +802,7 @@ static void s_client_bootstrap_on_channel_setup(
 
     http_bootstrap->connection->proxy_request_transform = http_bootstrap->proxy_request_transform;
     http_bootstrap->connection->user_data = http_bootstrap->user_data;
+    http_bootstrap->connection->remote_endpoint = http_bootstrap->remote_endpoint;
 
     AWS_LOGF_INFO(
         AWS_LS_HTTP_CONNECTION,
@@ -835,6 +867,511 @@ static void s_client_bootstrap_on_channel_shutdown(
     aws_mem_release(http_bootstrap->alloc, http_bootstrap);
 }
 
+/*
+ * A client connect raced across the addresses of a host ("Happy Eyeballs", RFC-8305).
+ *
+ * Attempts are started one at a time, in address order, each time attempt_delay passes or an attempt fails.
+ * The first attempt to set up a channel wins, and the http_bootstrap takes it from there.
+ * Attempts that set up a channel after that are shut down.
+ *
+ * Everything after host resolution happens on one event loop thread, which every attempt's channel also uses,
+ * so no locking is needed. The race is destroyed once it has a result and every attempt has finished
+ * (failed setup, or completed shutdown). The winner's attempt finishes when the connection shuts down.
+ */
+struct aws_http_connect_race {
+    struct aws_allocator *alloc;
+    struct aws_event_loop *event_loop;
+    struct aws_client_bootstrap *bootstrap;
+    struct aws_string *host_name;
+    uint16_t port;
+    struct aws_socket_options socket_options;
+    struct aws_tls_connection_options tls_options;
+    bool is_using_tls;
+    bool enable_read_back_pressure;
+    uint64_t attempt_delay_ns;
+    size_t max_attempts;
+
+    /* Handed the winning channel. NULL once it's been given a result and has cleaned itself up. */
+    struct aws_http_client_bootstrap *http_bootstrap;
+
+    /* Set by the host resolver callback, before resolved_task is scheduled */
+    struct aws_http_connect_attempt *attempts;
+    size_t attempt_count;
+    int resolve_error_code;
+
+    struct aws_task resolved_task;
+    struct aws_task next_attempt_task;
+    bool is_next_attempt_scheduled;
+
+    size_t started_count;
+    size_t finished_count;
+    int last_error_code;
+
+    /* True once the user has a connection, or has been told the connect failed */
+    bool has_result;
+    struct aws_http_connect_attempt *winner;
+
+    /* Number of race callbacks on the stack, the race isn't destroyed while any are running */
+    size_t callback_depth;
+};
+
+struct aws_http_connect_attempt {
+    struct aws_http_connect_race *race;
+    struct aws_string *address;
+    enum aws_address_record_type record_type;
+};
+
+static void s_connect_race_destroy(struct aws_http_connect_race *race) {
+    AWS_LOGF_TRACE(AWS_LS_HTTP_CONNECTION, "id=%p: Destroying connect race.", (void *)race);
+
+    for (size_t i = 0; i < race->attempt_count; ++i) {
+        aws_string_destroy(race->attempts[i].address);
+    }
+
+    if (race->attempts) {
+        aws_mem_release(race->alloc, race->attempts);
+    }
+
+    if (race->is_using_tls) {
+        aws_tls_connection_options_clean_up(&race->tls_options);
+    }
+
+    aws_string_destroy(race->host_name);
+    aws_mem_release(race->alloc, race);
+}
+
+/* Every race callback starts with this */
+static void s_connect_race_enter(struct aws_http_connect_race *race) {
+    ++race->callback_depth;
+}
+
+/* Every race callback ends with this, the race may be destroyed */
+static void s_connect_race_leave(struct aws_http_connect_race *race) {
+    AWS_ASSERT(race->callback_depth > 0);
+    if (--race->callback_depth > 0) {
+        return;
+    }
+
+    if (race->has_result && race->finished_count == race->started_count && !race->is_next_attempt_scheduled) {
+        s_connect_race_destroy(race);
+    }
+}
+
+/* Tell the user the connect failed. The http_bootstrap cleans itself up. */
+static void s_connect_race_fail(struct aws_http_connect_race *race, int error_code) {
+    AWS_ASSERT(!race->has_result);
+    race->has_result = true;
+
+    if (error_code == AWS_ERROR_SUCCESS) {
+        error_code = AWS_ERROR_UNKNOWN;
+    }
+
+    AWS_LOGF_ERROR(
+        AWS_LS_HTTP_CONNECTION,
+        "id=%p: Connect race to %s failed, error %d (%s).",
+        (void *)race,
+        aws_string_c_str(race->host_name),
+        error_code,
+        aws_error_name(error_code));
+
+    s_client_bootstrap_on_channel_setup(race->bootstrap, error_code, NULL, race->http_bootstrap);
+    race->http_bootstrap = NULL;
+}
+
+static void s_connect_race_on_attempt_setup(
+    struct aws_client_bootstrap *channel_bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data);
+
+static void s_connect_race_on_attempt_shutdown(
+    struct aws_client_bootstrap *channel_bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data);
+
+static int s_connect_race_start_attempt(
+    struct aws_http_connect_race *race,
+    struct aws_http_connect_attempt *attempt) {
+
+    struct aws_socket_options socket_options = race->socket_options;
+    socket_options.domain =
+        attempt->record_type == AWS_ADDRESS_RECORD_TYPE_AAAA ? AWS_SOCKET_IPV6 : AWS_SOCKET_IPV4;
+
+    struct aws_socket_channel_bootstrap_options channel_options = {
+        .bootstrap = race->bootstrap,
+        .host_name = aws_string_c_str(attempt->address),
+        .port = race->port,
+        .socket_options = &socket_options,
+        .tls_options = race->is_using_tls ? &race->tls_options : NULL,
+        .setup_callback = s_connect_race_on_attempt_setup,
+        .shutdown_callback = s_connect_race_on_attempt_shutdown,
+        .enable_read_back_pressure = race->enable_read_back_pressure,
+        .user_data = attempt,
+        .requested_event_loop = race->event_loop,
+    };
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION,
+        "id=%p: Connect race to %s starting attempt %zu of %zu, address %s.",
+        (void *)race,
+        aws_string_c_str(race->host_name),
+        race->started_count,
+        race->attempt_count,
+        aws_string_c_str(attempt->address));
+
+    if (s_system_vtable_ptr->new_socket_channel(&channel_options)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Failed to initiate socket channel to %s, error %d (%s).",
+            (void *)race,
+            aws_string_c_str(attempt->address),
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+        return AWS_OP_ERR;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static void s_connect_race_next_attempt_task(struct aws_task *task, void *arg, enum aws_task_status status);
+
+/*
+ * Start the next address's attempt, then either schedule the one after, or fail the race if it's out of addresses.
+ * Setup callbacks may fire from inside new_socket_channel(), so the race's state is re-checked after each start.
+ */
+static void s_connect_race_start_next_attempt(struct aws_http_connect_race *race) {
+    while (!race->has_result && race->started_count < race->attempt_count) {
+        struct aws_http_connect_attempt *attempt = &race->attempts[race->started_count++];
+        if (s_connect_race_start_attempt(race, attempt) == AWS_OP_SUCCESS) {
+            break;
+        }
+
+        race->last_error_code = aws_last_error();
+        ++race->finished_count;
+    }
+
+    if (race->has_result) {
+        return;
+    }
+
+    if (race->started_count < race->attempt_count) {
+        if (!race->is_next_attempt_scheduled) {
+            uint64_t now = 0;
+            aws_event_loop_current_clock_time(race->event_loop, &now);
+
+            race->is_next_attempt_scheduled = true;
+            aws_task_init(
+                &race->next_attempt_task, s_connect_race_next_attempt_task, race, "http_connect_race_next_attempt");
+            aws_event_loop_schedule_task_future(
+                race->event_loop, &race->next_attempt_task, now + race->attempt_delay_ns);
+        }
+    } else if (race->finished_count == race->started_count) {
+        s_connect_race_fail(race, race->last_error_code);
+    }
+}
+
+static void s_connect_race_cancel_next_attempt(struct aws_http_connect_race *race) {
+    if (race->is_next_attempt_scheduled) {
+        /* Runs the task with a canceled status, which clears is_next_attempt_scheduled */
+        aws_event_loop_cancel_task(race->event_loop, &race->next_attempt_task);
+    }
+}
+
+static void s_connect_race_next_attempt_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct aws_http_connect_race *race = arg;
+    s_connect_race_enter(race);
+
+    race->is_next_attempt_scheduled = false;
+
+    if (status == AWS_TASK_STATUS_RUN_READY) {
+        s_connect_race_start_next_attempt(race);
+    }
+
+    s_connect_race_leave(race);
+}
+
+static void s_connect_race_on_attempt_setup(
+    struct aws_client_bootstrap *channel_bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+
+    struct aws_http_connect_attempt *attempt = user_data;
+    struct aws_http_connect_race *race = attempt->race;
+    s_connect_race_enter(race);
+
+    if (error_code) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Connect race attempt to %s failed, error %d (%s).",
+            (void *)race,
+            aws_string_c_str(attempt->address),
+            error_code,
+            aws_error_name(error_code));
+
+        race->last_error_code = error_code;
+        ++race->finished_count;
+
+        /* Don't wait out the delay, the next address can start now (RFC-8305 section 5) */
+        if (!race->has_result) {
+            s_connect_race_cancel_next_attempt(race);
+            s_connect_race_start_next_attempt(race);
+        }
+
+        goto done;
+    }
+
+    if (race->has_result) {
+        /* Lost the race. Shutdown completes the attempt. */
+        AWS_LOGF_DEBUG(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Connect race attempt to %s connected after the race was over, closing it.",
+            (void *)race,
+            aws_string_c_str(attempt->address));
+
+        aws_channel_shutdown(channel, AWS_ERROR_SUCCESS);
+        goto done;
+    }
+
+    race->has_result = true;
+    race->winner = attempt;
+    s_connect_race_cancel_next_attempt(race);
+
+    AWS_LOGF_INFO(
+        AWS_LS_HTTP_CONNECTION,
+        "id=%p: Connect race to %s won by address %s, after starting %zu of %zu attempts.",
+        (void *)race,
+        aws_string_c_str(race->host_name),
+        aws_string_c_str(attempt->address),
+        race->started_count,
+        race->attempt_count);
+
+    struct aws_http_client_bootstrap *http_bootstrap = race->http_bootstrap;
+    snprintf(
+        http_bootstrap->remote_endpoint.address,
+        sizeof(http_bootstrap->remote_endpoint.address),
+        "%s",
+        aws_string_c_str(attempt->address));
+    http_bootstrap->remote_endpoint.port = race->port;
+
+    s_client_bootstrap_on_channel_setup(channel_bootstrap, AWS_ERROR_SUCCESS, channel, http_bootstrap);
+
+done:
+    s_connect_race_leave(race);
+}
+
+static void s_connect_race_on_attempt_shutdown(
+    struct aws_client_bootstrap *channel_bootstrap,
+    int error_code,
+    struct aws_channel *channel,
+    void *user_data) {
+
+    struct aws_http_connect_attempt *attempt = user_data;
+    struct aws_http_connect_race *race = attempt->race;
+    s_connect_race_enter(race);
+
+    if (attempt == race->winner) {
+        /* The http_bootstrap cleans itself up */
+        s_client_bootstrap_on_channel_shutdown(channel_bootstrap, error_code, channel, race->http_bootstrap);
+        race->http_bootstrap = NULL;
+    }
+
+    ++race->finished_count;
+
+    s_connect_race_leave(race);
+}
+
+static void s_connect_race_resolved_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)task;
+    struct aws_http_connect_race *race = arg;
+    s_connect_race_enter(race);
+
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        s_connect_race_fail(race, AWS_IO_EVENT_LOOP_SHUTDOWN);
+    } else if (race->resolve_error_code) {
+        s_connect_race_fail(race, race->resolve_error_code);
+    } else {
+        s_connect_race_start_next_attempt(race);
+    }
+
+    s_connect_race_leave(race);
+}
+
+/* Returns the next address of this type, at or after `position`, and moves `position` past it */
+static const struct aws_host_address *s_next_host_address(
+    const struct aws_array_list *host_addresses,
+    enum aws_address_record_type record_type,
+    size_t *position) {
+
+    while (*position < aws_array_list_length(host_addresses)) {
+        struct aws_host_address *host_address = NULL;
+        aws_array_list_get_at_ptr(host_addresses, (void **)&host_address, (*position)++);
+        if (host_address->record_type == record_type) {
+            return host_address;
+        }
+    }
+
+    return NULL;
+}
+
+/* Order the addresses to try, alternating between families, starting with IPv6 (RFC-8305 section 4) */
+static int s_connect_race_init_attempts(
+    struct aws_http_connect_race *race,
+    const struct aws_array_list *host_addresses) {
+
+    size_t capacity = aws_array_list_length(host_addresses);
+    if (race->max_attempts > 0 && race->max_attempts < capacity) {
+        capacity = race->max_attempts;
+    }
+
+    if (capacity == 0) {
+        return aws_raise_error(AWS_IO_DNS_NO_ADDRESS_FOR_HOST);
+    }
+
+    race->attempts = aws_mem_calloc(race->alloc, capacity, sizeof(struct aws_http_connect_attempt));
+    if (!race->attempts) {
+        return AWS_OP_ERR;
+    }
+
+    size_t ipv6_position = 0;
+    size_t ipv4_position = 0;
+    bool prefer_ipv6 = true;
+    while (race->attempt_count < capacity) {
+        const struct aws_host_address *host_address = NULL;
+        if (prefer_ipv6) {
+            host_address = s_next_host_address(host_addresses, AWS_ADDRESS_RECORD_TYPE_AAAA, &ipv6_position);
+        }
+        if (!host_address) {
+            host_address = s_next_host_address(host_addresses, AWS_ADDRESS_RECORD_TYPE_A, &ipv4_position);
+        }
+        if (!host_address) {
+            host_address = s_next_host_address(host_addresses, AWS_ADDRESS_RECORD_TYPE_AAAA, &ipv6_position);
+        }
+        if (!host_address) {
+            break;
+        }
+
+        struct aws_http_connect_attempt *attempt = &race->attempts[race->attempt_count];
+        attempt->race = race;
+        attempt->record_type = host_address->record_type;
+        attempt->address = aws_string_new_from_string(race->alloc, host_address->address);
+        if (!attempt->address) {
+            return AWS_OP_ERR;
+        }
+
+        ++race->attempt_count;
+        prefer_ipv6 = host_address->record_type != AWS_ADDRESS_RECORD_TYPE_AAAA;
+    }
+
+    if (race->attempt_count == 0) {
+        return aws_raise_error(AWS_IO_DNS_NO_ADDRESS_FOR_HOST);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+/* Invoked on the host resolver's thread. Copy what's needed, then move to the race's event loop. */
+static void s_connect_race_on_host_resolved(
+    struct aws_host_resolver *resolver,
+    const struct aws_string *host_name,
+    int err_code,
+    const struct aws_array_list *host_addresses,
+    void *user_data) {
+
+    (void)resolver;
+    (void)host_name;
+    struct aws_http_connect_race *race = user_data;
+
+    if (err_code == AWS_ERROR_SUCCESS && s_connect_race_init_attempts(race, host_addresses)) {
+        err_code = aws_last_error();
+    }
+
+    race->resolve_error_code = err_code;
+
+    aws_task_init(&race->resolved_task, s_connect_race_resolved_task, race, "http_connect_race_resolved");
+    aws_event_loop_schedule_task_now(race->event_loop, &race->resolved_task);
+}
+
+/*
+ * Start resolving the host, the race takes over the http_bootstrap if this succeeds.
+ * Options were validated and had defaults filled in by the caller.
+ */
+static int s_connect_race_start(
+    const struct aws_http_client_connection_options *options,
+    struct aws_http_client_bootstrap *http_bootstrap) {
+
+    struct aws_http_connect_race *race = aws_mem_calloc(options->allocator, 1, sizeof(struct aws_http_connect_race));
+    if (!race) {
+        return AWS_OP_ERR;
+    }
+
+    race->alloc = options->allocator;
+    race->bootstrap = options->bootstrap;
+    race->port = options->port;
+    race->socket_options = *options->socket_options;
+    race->enable_read_back_pressure = options->manual_window_management;
+    race->max_attempts = options->racing_options->max_attempts;
+    race->http_bootstrap = http_bootstrap;
+
+    uint32_t attempt_delay_ms = options->racing_options->attempt_delay_ms;
+    if (attempt_delay_ms == 0) {
+        attempt_delay_ms = AWS_HTTP_CONNECT_RACING_DEFAULT_ATTEMPT_DELAY_MS;
+    }
+    race->attempt_delay_ns = aws_timestamp_convert(attempt_delay_ms, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+
+    race->event_loop = options->requested_event_loop;
+    if (!race->event_loop) {
+        race->event_loop = aws_event_loop_group_get_next_loop(options->bootstrap->event_loop_group);
+    }
+
+    race->host_name = aws_string_new_from_cursor(race->alloc, &options->host_name);
+    if (!race->host_name) {
+        goto error;
+    }
+
+    if (options->tls_options) {
+        /* Attempts connect by address, so make sure TLS still verifies the host name */
+        if (aws_tls_connection_options_copy(&race->tls_options, options->tls_options)) {
+            goto error;
+        }
+        race->is_using_tls = true;
+
+        struct aws_byte_cursor server_name = options->host_name;
+        if (!race->tls_options.server_name &&
+            aws_tls_connection_options_set_server_name(&race->tls_options, race->alloc, &server_name)) {
+            goto error;
+        }
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION,
+        "id=%p: Starting connect race to %s:%d, resolving host.",
+        (void *)race,
+        aws_string_c_str(race->host_name),
+        (int)race->port);
+
+    aws_http_connection_resolve_host_fn *resolve_host =
+        s_system_vtable_ptr->resolve_host ? s_system_vtable_ptr->resolve_host : s_resolve_host;
+    if (resolve_host(race->bootstrap, race->host_name, s_connect_race_on_host_resolved, race)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Failed to start resolving host %s, error %d (%s).",
+            (void *)race,
+            aws_string_c_str(race->host_name),
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+        goto error;
+    }
+
+    return AWS_OP_SUCCESS;
+
+error:
+    s_connect_race_destroy(race);
+    return AWS_OP_ERR;
+}
+
 static int s_validate_http_client_connection_options(const struct aws_http_client_connection_options *options) {
     if (options->self_size == 0) {
         AWS_LOGF_ERROR(AWS_LS_HTTP_CONNECTION, "static: Invalid connection options, self size not initialized");
@@ -953,6 +1490,15 @@ int aws_http_client_connect_internal(
         http_bootstrap->monitoring_options = *options.monitoring_options;
     }
 
+    if (options.racing_options && options.socket_options->domain != AWS_SOCKET_LOCAL) {
+        if (s_connect_race_start(&options, http_bootstrap)) {
+            goto error;
+        }
+
+        aws_string_destroy(host_name);
+        return AWS_OP_SUCCESS;
+    }
+
     AWS_LOGF_TRACE(
         AWS_LS_HTTP_CONNECTION,
         "static: attempting to initialize a new client channel to %s:%d",
@@ -969,6 +1515,7 @@ int aws_http_client_connect_internal(
         .shutdown_callback = s_client_bootstrap_on_channel_shutdown,
         .enable_read_back_pressure = options.manual_window_management,
         .user_data = http_bootstrap,
+        .requested_event_loop = options.requested_event_loop,
     };
 
     err = s_system_vtable_ptr->new_socket_channel(&channel_options);
@@ -17,26 +17,97 @@
 #include <aws/io/socket.h>
 #include <aws/io/tls_channel_handler.h>
 
+#include <aws/common/atomics.h>
 #include <aws/common/clock.h>
 #include <aws/common/hash_table.h>
 #include <aws/common/linked_list.h>
 #include <aws/common/mutex.h>
 #include <aws/common/string.h>
 
+#include <inttypes.h>
+
 #if _MSC_VER
 #    pragma warning(disable : 4232) /* function pointer to dll symbol */
 #endif
 
 /*
  * Established connections not currently in use are tracked via this structure.
+ *
+ * These are recycled through their shard's free list, rather than freed, when a connection leaves the idle pool.
  */
 struct aws_idle_connection {
     struct aws_allocator *allocator;
     struct aws_linked_list_node node;
     uint64_t cull_timestamp;
     struct aws_http_connection *connection;
+    struct aws_idle_connection_shard *shard;
+
+    /*
+     * When a connection is vended straight from the idle pool, and the callback must be moved to the connection's
+     * thread, this struct carries the acquisition (instead of allocating an aws_http_connection_acquisition).
+     */
+    struct aws_http_connection_manager *manager;
+    aws_http_connection_manager_on_connection_setup_fn *callback;
+    void *user_data;
+    struct aws_channel_task acquisition_task;
+};
+
+/*
+ * The idle pool is split into shards, each with its own lock, so that acquiring and releasing connections from many
+ * threads doesn't serialize on the manager's lock.  There is one shard per event loop, and a connection is always
+ * idled in the shard of the event loop its channel lives on (or, if that's unknown, a shard chosen by hashing the
+ * connection).  Acquisitions with event loop affinity search that loop's shard first, and acquisitions without
+ * search all shards, starting from a rotating index.
+ *
+ * Lock ordering: a shard's lock may be taken while holding the manager's lock, but never the other way around.
+ */
+struct aws_idle_connection_shard {
+    struct aws_mutex lock;
+
+    /* aws_idle_connection structs, in the order they were idled, see aws_http_connection_manager.idle_shards */
+    struct aws_linked_list idle_connections;
+
+    /* Spare aws_idle_connection structs, so that releasing a connection doesn't allocate */
+    struct aws_linked_list free_nodes;
+
+    /* The event loop whose connections are idled here.  NULL if the manager has no bootstrap. */
+    struct aws_event_loop *event_loop;
+
+    /* Cleared (with the manager's lock held) when the manager begins shutting down.  Nothing is added after that. */
+    bool is_open;
+};
+
+/*
+ * Established HTTP/2 connections that are shared between acquisitions are tracked via this structure.
+ * Each acquisition of the connection is a lease that is good for one stream.
+ */
+struct aws_multiplexed_connection {
+    struct aws_allocator *allocator;
+    struct aws_linked_list_node node;
+    uint64_t cull_timestamp;
+    struct aws_http_connection *connection;
+
+    /* The idle shard of the connection's event loop, used to match acquisitions with event loop affinity */
+    struct aws_idle_connection_shard *shard;
+
+    /* Number of acquisitions of this connection that haven't been released yet */
+    size_t lease_count;
+
+    /* Most acquisitions this connection may have at once, kept in line with peer's SETTINGS_MAX_CONCURRENT_STREAMS */
+    size_t max_leases;
+
+    /* True if this is an HTTP/1.1 connection that requests are pipelined on */
+    bool is_pipelined;
+
+    /* Set once GOAWAY is received or the connection is no longer available.  No further leases are handed out and
+     * the connection is released once its last lease comes back. */
+    bool is_draining;
 };
 
+static struct aws_event_loop *s_connection_get_event_loop(struct aws_http_connection *connection) {
+    return aws_channel_get_event_loop(aws_http_connection_get_channel(connection));
+}
+
 /*
  * System vtable to use under normal circumstances
  */
@@ -48,6 +119,8 @@ static struct aws_http_connection_manager_system_vtable s_default_system_vtable
     .get_monotonic_time = aws_high_res_clock_get_ticks,
     .is_callers_thread = aws_channel_thread_is_callers_thread,
     .connection_get_channel = aws_http_connection_get_channel,
+    .connection_get_version = aws_http_connection_get_version,
+    .connection_get_event_loop = s_connection_get_event_loop,
 };
 
 const struct aws_http_connection_manager_system_vtable *g_aws_http_connection_manager_default_system_vtable_ptr =
@@ -94,6 +167,11 @@ enum aws_http_connection_manager_state_type { AWS_HCMST_UNINITIALIZED, AWS_HCMST
  *   conservative policy to fail all excess (beyond the # of pending connects) acquisitions; this allows us
  *   to avoid a possible recursive invocation (and potential failures) to connect again.
  *
+ *  The exception is the common case of an acquire that finds an idle connection, or a release that returns one to
+ *  the idle pool.  These only take the lock of one shard of the idle pool (see aws_idle_connection_shard) and
+ *  adjust atomic counters, so that many threads can acquire and release connections at once.  A release only falls
+ *  back to a full transaction if there are pending acquisitions, which could be waiting on the connection.
+ *
  * Lifecycle
  * Our connection manager implementation has a reasonably complex lifecycle.
  *
@@ -113,6 +191,7 @@ enum aws_http_connection_manager_state_type { AWS_HCMST_UNINITIALIZED, AWS_HCMST
  *   open_connection_count - the # of connections for whom the release callback (from http) has not been invoked
  *   vended_connection_count - the # of connections held by external users that haven't been released.  Under correct
  *      usage this should be zero before SHUTTING_DOWN is entered, but we attempt to handle incorrect usage gracefully.
+ *      Each lease on a multiplexed HTTP/2 connection counts as one vended connection.
  *
  *  While shutting down, as pending connects resolve, we immediately release new incoming (from http) connections
  *
@@ -141,7 +220,8 @@ struct aws_http_connection_manager {
     void *shutdown_complete_user_data;
 
     /*
-     * Controls access to all mutable state on the connection manager
+     * Controls access to all mutable state on the connection manager, except the idle pool's shards (which have their
+     * own locks) and the atomic counters (which may be read without the lock).
      */
     struct aws_mutex lock;
 
@@ -152,33 +232,83 @@ struct aws_http_connection_manager {
     enum aws_http_connection_manager_state_type state;
 
     /*
-     * The number of all established, idle connections.  So
+     * The number of all established, idle connections, across all shards.  So
      * that we don't have compute the size of a linked list every time.
      */
-    size_t idle_connection_count;
+    struct aws_atomic_var idle_connection_count;
 
     /*
-     * The set of all available, ready-to-be-used connections, as aws_idle_connection structs.
+     * The set of all available, ready-to-be-used connections, as aws_idle_connection structs, split into shards.
+     * Connections move in and out of the shards without the manager's lock, see aws_idle_connection_shard.
      *
-     * This must be a LIFO stack.  When connections are released by the user, they must be added on to the back.
-     * When we vend connections to the user, they must be removed from the back first.
-     * In this way, the list will always be sorted from oldest (in terms of time spent idle) to newest.  This means
-     * we can always use the cull timestamp of the front connection as the next scheduled time for culling.
-     * It also means that when we cull connections, we can quit the loop as soon as we find a connection
-     * whose timestamp is greater than the current timestamp.
+     * When connections are released by the user, they must be added on to the back of their shard's list.
+     * When we vend connections to the user, they are removed from the back (LIFO) or the front (FIFO), according to
+     * idle_connection_policy.  Either way, each list will always be sorted from oldest (in terms of time spent idle)
+     * to newest.  This means we can always use the cull timestamps of the front connections to find the next
+     * scheduled time for culling.  It also means that when we cull connections, we can quit each shard's loop as
+     * soon as we find a connection whose timestamp is greater than the current timestamp.
      */
-    struct aws_linked_list idle_connections;
+    struct aws_idle_connection_shard *idle_shards;
+    size_t idle_shard_count;
+
+    /*
+     * Rotates which shard an acquisition searches first, to spread contention across the shards.
+     */
+    struct aws_atomic_var next_acquire_shard;
+
+    /*
+     * The number of established connections that aren't multiplexed, whether idle or vended.  Unlike
+     * vended_connection_count, this doesn't change when a connection moves between the idle pool and a user,
+     * so it can be relied on to enforce max_connections while connections move without the manager's lock.
+     *
+     * Only incremented with the lock held, so max_connections is never exceeded, but decremented without it
+     * when idle connections are culled during an acquire or release.
+     */
+    struct aws_atomic_var pooled_connection_count;
+
+    /*
+     * The set of established connections that are shared between acquisitions, as aws_multiplexed_connection
+     * structs.  Only used if enable_http2_multiplexing or HTTP/1.1 pipelining is set.  Connections stay in this list
+     * while they have outstanding leases, so they are never in idle_connections.
+     */
+    struct aws_linked_list multiplexed_connections;
+
+    /*
+     * Maps each aws_http_connection in multiplexed_connections to its aws_multiplexed_connection, so releasing a
+     * lease doesn't have to search the list.
+     */
+    struct aws_hash_table multiplexed_connection_map;
+
+    /*
+     * The number of connections in multiplexed_connections.
+     */
+    size_t multiplexed_connection_count;
+
+    /*
+     * The number of vended connections that are leases on a multiplexed connection.  This is a subset of
+     * vended_connection_count.
+     */
+    size_t multiplexed_lease_count;
 
     /*
      * The set of all incomplete connection acquisition requests
      */
     struct aws_linked_list pending_acquisitions;
 
+    /*
+     * The number of pending acquisitions that want a connection on a particular event loop.  While there are none,
+     * new connections aren't pinned to event loops, and idle connections are never closed to make room.
+     */
+    size_t pending_affinity_count;
+
     /*
      * The number of all incomplete connection acquisition requests.  So
      * that we don't have compute the size of a linked list every time.
+     *
+     * Only modified with the lock held, but read without it by releases, to decide whether a connection returning
+     * to the idle pool must be handed to a waiting acquisition.
      */
-    size_t pending_acquisition_count;
+    struct aws_atomic_var pending_acquisition_count;
 
     /*
      * The number of pending new connection requests we have outstanding to the http
@@ -188,8 +318,9 @@ struct aws_http_connection_manager {
 
     /*
      * The number of connections currently being used by external users.
+     * Modified without the lock when connections move straight between the idle pool and users.
      */
-    size_t vended_connection_count;
+    struct aws_atomic_var vended_connection_count;
 
     /*
      * Always equal to # of connection shutdown callbacks not yet invoked
@@ -241,6 +372,59 @@ struct aws_http_connection_manager {
      */
     uint64_t max_connection_idle_in_milliseconds;
 
+    /*
+     * If set to true, connections that negotiate HTTP/2 are shared between acquisitions.
+     */
+    bool enable_http2_multiplexing;
+
+    /*
+     * Upper bound on leases per multiplexed connection.
+     */
+    size_t max_streams_per_connection;
+
+    /*
+     * Set once any connection negotiates HTTP/2 (with multiplexing enabled).  From then on, new connections are
+     * requested in proportion to the number of streams each can carry, rather than one per pending acquisition.
+     */
+    bool is_http2_negotiated;
+
+    /*
+     * Upper bound on leases per pipelined HTTP/1.1 connection.  Pipelining is off if this is 1 or less.
+     */
+    size_t max_pipelined_requests_per_connection;
+
+    /*
+     * Set once any HTTP/1.1 connection is shared for pipelining.  From then on, new connections are requested
+     * in proportion to the number of requests each can carry, as with is_http2_negotiated.
+     */
+    bool is_http1_pipelining_negotiated;
+
+    /*
+     * Number of connections to keep ready for use, see aws_http_connection_manager_options.min_idle_connections.
+     */
+    size_t min_idle_connections;
+
+    /*
+     * Set when a connect fails, so that a failing host isn't hammered with connects just to keep the pool warm.
+     * Cleared when a connect succeeds or idle connections are culled.
+     */
+    bool is_prewarm_suspended;
+
+    /*
+     * Whether idle connections are vended newest first (LIFO) or oldest first (FIFO).
+     */
+    enum aws_http_connection_manager_idle_connection_policy idle_connection_policy;
+
+    /*
+     * Work done by the cull task.  The lazily_culled_count field is unused, see lazily_culled_connection_count.
+     */
+    struct aws_http_connection_manager_cull_metrics cull_metrics;
+
+    /*
+     * The number of idle connections culled during acquires and releases.  Updated without the lock.
+     */
+    struct aws_atomic_var lazily_culled_connection_count;
+
     /*
      * Task to cull idle connections.  This task is run periodically on the cull_event_loop if a non-zero
      * culling time interval is specified.
@@ -257,6 +441,8 @@ struct aws_http_connection_manager_snapshot {
     size_t pending_connects_count;
     size_t vended_connection_count;
     size_t open_connection_count;
+    size_t multiplexed_connection_count;
+    size_t multiplexed_lease_count;
 
     size_t external_ref_count;
 };
@@ -269,11 +455,13 @@ static void s_aws_http_connection_manager_get_snapshot(
     struct aws_http_connection_manager_snapshot *snapshot) {
 
     snapshot->state = manager->state;
-    snapshot->idle_connection_count = manager->idle_connection_count;
-    snapshot->pending_acquisition_count = manager->pending_acquisition_count;
+    snapshot->idle_connection_count = aws_atomic_load_int(&manager->idle_connection_count);
+    snapshot->pending_acquisition_count = aws_atomic_load_int(&manager->pending_acquisition_count);
     snapshot->pending_connects_count = manager->pending_connects_count;
-    snapshot->vended_connection_count = manager->vended_connection_count;
+    snapshot->vended_connection_count = aws_atomic_load_int(&manager->vended_connection_count);
     snapshot->open_connection_count = manager->open_connection_count;
+    snapshot->multiplexed_connection_count = manager->multiplexed_connection_count;
+    snapshot->multiplexed_lease_count = manager->multiplexed_lease_count;
 
     snapshot->external_ref_count = manager->external_ref_count;
 }
@@ -285,7 +473,8 @@ static void s_aws_http_connection_manager_log_snapshot(
         AWS_LOGF_DEBUG(
             AWS_LS_HTTP_CONNECTION_MANAGER,
             "id=%p: snapshot - state=%d, idle_connection_count=%zu, pending_acquire_count=%zu, "
-            "pending_connect_count=%zu, vended_connection_count=%zu, open_connection_count=%zu, ref_count=%zu",
+            "pending_connect_count=%zu, vended_connection_count=%zu, open_connection_count=%zu, "
+            "multiplexed_connection_count=%zu, multiplexed_lease_count=%zu, ref_count=%zu",
             (void *)manager,
             (int)snapshot->state,
             snapshot->idle_connection_count,
@@ -293,6 +482,8 @@ static void s_aws_http_connection_manager_log_snapshot(
             snapshot->pending_connects_count,
             snapshot->vended_connection_count,
             snapshot->open_connection_count,
+            snapshot->multiplexed_connection_count,
+            snapshot->multiplexed_lease_count,
             snapshot->external_ref_count);
     } else {
         AWS_LOGF_DEBUG(
@@ -324,12 +515,14 @@ static bool s_aws_http_connection_manager_should_destroy(struct aws_http_connect
         return false;
     }
 
-    if (manager->vended_connection_count > 0 || manager->pending_connects_count > 0 ||
+    if (aws_atomic_load_int(&manager->vended_connection_count) > 0 || manager->pending_connects_count > 0 ||
         manager->open_connection_count > 0) {
         return false;
     }
 
-    AWS_FATAL_ASSERT(manager->idle_connection_count == 0);
+    AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->idle_connection_count) == 0);
+    AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->pooled_connection_count) == 0);
+    AWS_FATAL_ASSERT(manager->multiplexed_connection_count == 0);
 
     return true;
 }
@@ -355,6 +548,10 @@ struct aws_http_connection_acquisition {
     struct aws_http_connection *connection;
     int error_code;
     struct aws_channel_task acquisition_task;
+
+    /* Shard of the event loop this acquisition wants a connection on, or NULL if any connection will do */
+    struct aws_idle_connection_shard *affinity_shard;
+    enum aws_http_connection_manager_event_loop_affinity event_loop_affinity;
 };
 
 static void s_connection_acquisition_task(
@@ -444,7 +641,7 @@ static void s_aws_http_connection_manager_complete_acquisitions(
 }
 
 /*
- * Moves the first pending connection acquisition into a (task set) list.  Call this while holding the lock to
+ * Moves a pending connection acquisition into a (task set) list.  Call this while holding the lock to
  * build the set of callbacks to be completed once the lock is released.
  *
  * Hard Requirement: Manager's lock must held somewhere in the call stack
@@ -453,17 +650,22 @@ static void s_aws_http_connection_manager_complete_acquisitions(
  * If this was a failed acquisition then connection is null and error_code is hopefully a useful diagnostic (extreme
  * edge cases exist where it may not be though)
  */
-static void s_aws_http_connection_manager_move_front_acquisition(
+static void s_aws_http_connection_manager_move_acquisition(
     struct aws_http_connection_manager *manager,
+    struct aws_http_connection_acquisition *pending_acquisition,
     struct aws_http_connection *connection,
     int error_code,
     struct aws_linked_list *output_list) {
 
-    AWS_FATAL_ASSERT(!aws_linked_list_empty(&manager->pending_acquisitions));
-    struct aws_linked_list_node *node = aws_linked_list_pop_front(&manager->pending_acquisitions);
+    aws_linked_list_remove(&pending_acquisition->node);
 
-    AWS_FATAL_ASSERT(manager->pending_acquisition_count > 0);
-    --manager->pending_acquisition_count;
+    AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->pending_acquisition_count) > 0);
+    aws_atomic_fetch_sub(&manager->pending_acquisition_count, 1);
+
+    if (pending_acquisition->affinity_shard != NULL) {
+        AWS_FATAL_ASSERT(manager->pending_affinity_count > 0);
+        --manager->pending_affinity_count;
+    }
 
     if (error_code == AWS_ERROR_SUCCESS && connection == NULL) {
         AWS_LOGF_FATAL(
@@ -473,12 +675,28 @@ static void s_aws_http_connection_manager_move_front_acquisition(
         error_code = AWS_ERROR_UNKNOWN;
     }
 
-    struct aws_http_connection_acquisition *pending_acquisition =
-        AWS_CONTAINER_OF(node, struct aws_http_connection_acquisition, node);
     pending_acquisition->connection = connection;
     pending_acquisition->error_code = error_code;
 
-    aws_linked_list_push_back(output_list, node);
+    aws_linked_list_push_back(output_list, &pending_acquisition->node);
+}
+
+/*
+ * Moves the first pending connection acquisition into a (task set) list.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static void s_aws_http_connection_manager_move_front_acquisition(
+    struct aws_http_connection_manager *manager,
+    struct aws_http_connection *connection,
+    int error_code,
+    struct aws_linked_list *output_list) {
+
+    AWS_FATAL_ASSERT(!aws_linked_list_empty(&manager->pending_acquisitions));
+    struct aws_http_connection_acquisition *pending_acquisition = AWS_CONTAINER_OF(
+        aws_linked_list_front(&manager->pending_acquisitions), struct aws_http_connection_acquisition, node);
+
+    s_aws_http_connection_manager_move_acquisition(manager, pending_acquisition, connection, error_code, output_list);
 }
 
 /*
@@ -498,9 +716,11 @@ struct aws_connection_management_transaction {
     struct aws_allocator *allocator;
     struct aws_linked_list completions;
     struct aws_http_connection *connection_to_release;
-    struct aws_linked_list connections_to_release; /* <struct aws_idle_connection> */
+    struct aws_linked_list connections_to_release;             /* <struct aws_idle_connection> */
+    struct aws_linked_list multiplexed_connections_to_release; /* <struct aws_multiplexed_connection> */
     struct aws_http_connection_manager_snapshot snapshot;
     size_t new_connections;
+    struct aws_array_list new_connection_event_loops; /* <struct aws_event_loop *>, may be shorter */
     bool should_destroy_manager;
 };
 
@@ -510,6 +730,7 @@ static void s_aws_connection_management_transaction_init(
     AWS_ZERO_STRUCT(*work);
 
     aws_linked_list_init(&work->connections_to_release);
+    aws_linked_list_init(&work->multiplexed_connections_to_release);
     aws_linked_list_init(&work->completions);
     work->manager = manager;
     work->allocator = manager->allocator;
@@ -517,161 +738,766 @@ static void s_aws_connection_management_transaction_init(
 
 static void s_aws_connection_management_transaction_clean_up(struct aws_connection_management_transaction *work) {
     AWS_FATAL_ASSERT(aws_linked_list_empty(&work->connections_to_release));
+    AWS_FATAL_ASSERT(aws_linked_list_empty(&work->multiplexed_connections_to_release));
     AWS_FATAL_ASSERT(aws_linked_list_empty(&work->completions));
-}
 
-static void s_aws_http_connection_manager_build_transaction(struct aws_connection_management_transaction *work) {
-    struct aws_http_connection_manager *manager = work->manager;
+    aws_array_list_clean_up(&work->new_connection_event_loops);
+}
 
-    if (manager->state == AWS_HCMST_READY) {
-        /*
-         * Step 1 - If there's free connections, complete acquisition requests
-         */
-        while (!aws_linked_list_empty(&manager->idle_connections) > 0 && manager->pending_acquisition_count > 0) {
-            AWS_FATAL_ASSERT(manager->idle_connection_count >= 1);
-            /*
-             * It is absolutely critical that this is pop_back and not front.  By making the idle connections
-             * a LIFO stack, the list will always be sorted from oldest (in terms of idle time) to newest.  This means
-             * we can always use the cull timestamp of the first connection as the next scheduled time for culling.
-             * It also means that when we cull connections, we can quit the loop as soon as we find a connection
-             * whose timestamp is greater than the current timestamp.
-             */
-            struct aws_linked_list_node *node = aws_linked_list_pop_back(&manager->idle_connections);
-            struct aws_idle_connection *idle_connection = AWS_CONTAINER_OF(node, struct aws_idle_connection, node);
-            struct aws_http_connection *connection = idle_connection->connection;
+/*
+ * Returns the tracking struct for a connection that is shared between acquisitions, or NULL if the connection
+ * isn't multiplexed.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static struct aws_multiplexed_connection *s_find_multiplexed_connection(
+    struct aws_http_connection_manager *manager,
+    const struct aws_http_connection *connection) {
 
-            AWS_LOGF_DEBUG(
-                AWS_LS_HTTP_CONNECTION_MANAGER,
-                "id=%p: Grabbing pooled connection (%p)",
-                (void *)manager,
-                (void *)connection);
-            s_aws_http_connection_manager_move_front_acquisition(
-                manager, connection, AWS_ERROR_SUCCESS, &work->completions);
-            ++manager->vended_connection_count;
-            --manager->idle_connection_count;
-            aws_mem_release(idle_connection->allocator, idle_connection);
-        }
+    struct aws_hash_element *elem = NULL;
+    aws_hash_table_find(&manager->multiplexed_connection_map, connection, &elem);
+    return elem != NULL ? elem->value : NULL;
+}
 
-        /*
-         * Step 2 - if there's excess pending acquisitions and we have room to make more, make more
-         */
-        if (manager->pending_acquisition_count > manager->pending_connects_count) {
-            AWS_FATAL_ASSERT(
-                manager->max_connections >= manager->vended_connection_count + manager->pending_connects_count);
+/*
+ * Stops handing out leases on a multiplexed connection.  If it has no outstanding leases, it is moved to the
+ * transaction's release list, otherwise it is released when its last lease comes back.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static void s_drain_multiplexed_connection(
+    struct aws_connection_management_transaction *work,
+    struct aws_multiplexed_connection *multiplexed_connection) {
 
-            work->new_connections = manager->pending_acquisition_count - manager->pending_connects_count;
-            size_t max_new_connections =
-                manager->max_connections - (manager->vended_connection_count + manager->pending_connects_count);
+    struct aws_http_connection_manager *manager = work->manager;
 
-            if (work->new_connections > max_new_connections) {
-                work->new_connections = max_new_connections;
-            }
+    multiplexed_connection->is_draining = true;
 
-            manager->pending_connects_count += work->new_connections;
-        }
-    } else {
-        /*
-         * swap our internal connection set with the empty work set
-         */
-        AWS_FATAL_ASSERT(aws_linked_list_empty(&work->connections_to_release));
-        aws_linked_list_swap_contents(&manager->idle_connections, &work->connections_to_release);
-        manager->idle_connection_count = 0;
+    if (multiplexed_connection->lease_count == 0) {
+        aws_hash_table_remove(&manager->multiplexed_connection_map, multiplexed_connection->connection, NULL, NULL);
+        aws_linked_list_remove(&multiplexed_connection->node);
+        aws_linked_list_push_back(&work->multiplexed_connections_to_release, &multiplexed_connection->node);
 
-        /*
-         * Move all manager pending acquisitions to the work completion list
-         */
-        while (!aws_linked_list_empty(&manager->pending_acquisitions)) {
-            AWS_LOGF_DEBUG(
-                AWS_LS_HTTP_CONNECTION_MANAGER,
-                "id=%p: Failing pending connection acquisition due to manager shut down",
-                (void *)manager);
-            s_aws_http_connection_manager_move_front_acquisition(
-                manager, NULL, AWS_ERROR_HTTP_CONNECTION_MANAGER_SHUTTING_DOWN, &work->completions);
-        }
+        AWS_FATAL_ASSERT(manager->multiplexed_connection_count > 0);
+        --manager->multiplexed_connection_count;
+    }
+}
 
-        AWS_LOGF_INFO(
-            AWS_LS_HTTP_CONNECTION_MANAGER,
-            "id=%p: manager release, failing %zu pending acquisitions",
-            (void *)manager,
-            manager->pending_acquisition_count);
-        manager->pending_acquisition_count = 0;
+/*
+ * How many acquisitions a new connection is expected to serve, going by the connections made so far.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static size_t s_get_leases_per_new_connection(struct aws_http_connection_manager *manager) {
+    if (manager->is_http2_negotiated) {
+        return manager->max_streams_per_connection;
+    }
 
-        work->should_destroy_manager = s_aws_http_connection_manager_should_destroy(manager);
+    if (manager->is_http1_pipelining_negotiated) {
+        return manager->max_pipelined_requests_per_connection;
     }
 
-    s_aws_http_connection_manager_get_snapshot(manager, &work->snapshot);
+    return 1;
 }
 
-static void s_aws_http_connection_manager_execute_transaction(struct aws_connection_management_transaction *work);
-
 /*
- * The final last gasp of a connection manager where memory is cleaned up.  Destruction is split up into two parts,
- * a begin and a finish.  Idle connection culling requires a scheduled task on an arbitrary event loop.  If idle
- * connection culling is on then this task must be cancelled before destruction can finish, but you can only cancel
- * a task from the same event loop that it is scheduled on.  To resolve this, when using idle connection culling,
- * we schedule a finish destruction task on the event loop that the culling task is on.  This finish task
- * cancels the culling task and then calls this function.  If we are not using idle connection culling, we can
- * call this function immediately from the start of destruction.
+ * How many pending acquisitions the pending connects are expected to satisfy.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
  */
-static void s_aws_http_connection_manager_finish_destroy(struct aws_http_connection_manager *manager) {
-    if (manager == NULL) {
-        return;
-    }
+static size_t s_get_pending_connect_capacity(struct aws_http_connection_manager *manager) {
+    return manager->pending_connects_count * s_get_leases_per_new_connection(manager);
+}
 
-    AWS_LOGF_INFO(AWS_LS_HTTP_CONNECTION_MANAGER, "id=%p: Destroying self", (void *)manager);
+static int s_get_cull_timestamp(struct aws_http_connection_manager *manager, uint64_t *out_cull_timestamp) {
+    uint64_t now = 0;
+    if (manager->system_vtable->get_monotonic_time(&now)) {
+        return AWS_OP_ERR;
+    }
 
-    AWS_FATAL_ASSERT(manager->pending_connects_count == 0);
-    AWS_FATAL_ASSERT(manager->vended_connection_count == 0);
-    AWS_FATAL_ASSERT(manager->pending_acquisition_count == 0);
-    AWS_FATAL_ASSERT(manager->open_connection_count == 0);
-    AWS_FATAL_ASSERT(aws_linked_list_empty(&manager->pending_acquisitions));
-    AWS_FATAL_ASSERT(aws_linked_list_empty(&manager->idle_connections));
+    *out_cull_timestamp =
+        now + aws_timestamp_convert(
+                  manager->max_connection_idle_in_milliseconds, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+    return AWS_OP_SUCCESS;
+}
 
-    aws_string_destroy(manager->host);
-    if (manager->tls_connection_options) {
-        aws_tls_connection_options_clean_up(manager->tls_connection_options);
-        aws_mem_release(manager->allocator, manager->tls_connection_options);
+/* Decrement the counter, unless that would take it below the floor */
+static bool s_atomic_decrement_if_above(struct aws_atomic_var *var, size_t floor) {
+    size_t value = aws_atomic_load_int(var);
+    while (value > floor) {
+        if (aws_atomic_compare_exchange_int(var, &value, value - 1)) {
+            return true;
+        }
     }
+    return false;
+}
 
-    if (manager->proxy_config) {
-        aws_http_proxy_config_destroy(manager->proxy_config);
-    }
+/* Decrement the counter, unless it's already zero */
+static bool s_atomic_decrement_if_positive(struct aws_atomic_var *var) {
+    return s_atomic_decrement_if_above(var, 0);
+}
 
-    /*
-     * If this task exists then we are actually in the corresponding event loop running the final destruction task.
-     * In that case, we've already cancelled this task and when you cancel, it runs synchronously.  So in that
-     * case the task has run as cancelled, it was not rescheduled, and so we can safely release the memory.
-     */
-    if (manager->cull_task) {
-        aws_mem_release(manager->allocator, manager->cull_task);
+/*
+ * Move connections whose idle time is up from the front of a shard's list to `expired_connections`, and return how
+ * many were moved.  Since the list is sorted by cull timestamp, this only visits the expired connections, plus one.
+ * The pool is never taken below min_idle_connections.
+ *
+ * Hard Requirement: Shard's lock must be held somewhere in the call stack
+ */
+static size_t s_expire_idle_connections(
+    struct aws_http_connection_manager *manager,
+    struct aws_idle_connection_shard *shard,
+    uint64_t now,
+    struct aws_linked_list *expired_connections) {
+
+    if (!shard->is_open) {
+        return 0;
     }
 
-    aws_mutex_clean_up(&manager->lock);
+    size_t expired_count = 0;
+    while (!aws_linked_list_empty(&shard->idle_connections)) {
+        struct aws_linked_list_node *node = aws_linked_list_front(&shard->idle_connections);
+        struct aws_idle_connection *idle_connection = AWS_CONTAINER_OF(node, struct aws_idle_connection, node);
+        if (idle_connection->cull_timestamp > now ||
+            !s_atomic_decrement_if_above(&manager->idle_connection_count, manager->min_idle_connections)) {
+            break;
+        }
 
-    aws_client_bootstrap_release(manager->bootstrap);
+        aws_linked_list_remove(node);
+        aws_linked_list_push_back(expired_connections, node);
+        AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->pooled_connection_count) > 0);
+        aws_atomic_fetch_sub(&manager->pooled_connection_count, 1);
+        ++expired_count;
 
-    if (manager->shutdown_complete_callback) {
-        manager->shutdown_complete_callback(manager->shutdown_complete_user_data);
+        AWS_LOGF_DEBUG(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: culling idle connection (%p)",
+            (void *)manager,
+            (void *)idle_connection->connection);
     }
 
-    aws_mem_release(manager->allocator, manager);
+    return expired_count;
 }
 
-/* This is scheduled to run on the cull task's event loop.  If there's no cull task we just destroy the
- * manager directly without a cross-thread task.  */
-static void s_final_destruction_task(struct aws_task *task, void *arg, enum aws_task_status status) {
-    (void)status;
-    struct aws_http_connection_manager *manager = arg;
-    struct aws_allocator *allocator = manager->allocator;
+/*
+ * Returns the shard of an event loop, or NULL if the event loop isn't part of the manager's bootstrap.
+ */
+static struct aws_idle_connection_shard *s_get_event_loop_shard(
+    struct aws_http_connection_manager *manager,
+    const struct aws_event_loop *event_loop) {
 
-    if (manager->cull_task) {
-        AWS_FATAL_ASSERT(manager->cull_event_loop != NULL);
-        aws_event_loop_cancel_task(manager->cull_event_loop, manager->cull_task);
+    if (event_loop == NULL) {
+        return NULL;
     }
 
-    s_aws_http_connection_manager_finish_destroy(manager);
+    for (size_t i = 0; i < manager->idle_shard_count; ++i) {
+        if (manager->idle_shards[i].event_loop == event_loop) {
+            return &manager->idle_shards[i];
+        }
+    }
 
-    aws_mem_release(allocator, task);
+    return NULL;
+}
+
+/*
+ * Returns the shard of the event loop running on the calling thread, or NULL if the caller isn't on one of the
+ * manager's event loops.
+ */
+static struct aws_idle_connection_shard *s_get_callers_shard(struct aws_http_connection_manager *manager) {
+    for (size_t i = 0; i < manager->idle_shard_count; ++i) {
+        struct aws_event_loop *event_loop = manager->idle_shards[i].event_loop;
+        if (event_loop != NULL && aws_event_loop_thread_is_callers_thread(event_loop)) {
+            return &manager->idle_shards[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Returns the shard a connection is idled in.  A connection always uses the same shard.
+ */
+static struct aws_idle_connection_shard *s_get_connection_shard(
+    struct aws_http_connection_manager *manager,
+    struct aws_http_connection *connection) {
+
+    if (manager->system_vtable->connection_get_event_loop != NULL) {
+        struct aws_idle_connection_shard *shard =
+            s_get_event_loop_shard(manager, manager->system_vtable->connection_get_event_loop(connection));
+        if (shard != NULL) {
+            return shard;
+        }
+    }
+
+    return &manager->idle_shards[aws_hash_ptr(connection) % manager->idle_shard_count];
+}
+
+/*
+ * Whether a connection is shared between acquisitions.  Doesn't require the manager's lock.
+ */
+static bool s_is_multiplexed_connection(
+    struct aws_http_connection_manager *manager,
+    const struct aws_http_connection *connection) {
+
+    if (manager->system_vtable->connection_get_version == NULL) {
+        return false;
+    }
+
+    switch (manager->system_vtable->connection_get_version(connection)) {
+        case AWS_HTTP_VERSION_2:
+            return manager->enable_http2_multiplexing;
+        case AWS_HTTP_VERSION_1_1:
+            return manager->max_pipelined_requests_per_connection > 1;
+        default:
+            return false;
+    }
+}
+
+/*
+ * Pop the next connection to vend from a shard, according to the idle connection policy, or return NULL if there's
+ * none.  The connection is counted as vended.
+ *
+ * Hard Requirement: Shard's lock must be held somewhere in the call stack
+ */
+static struct aws_idle_connection *s_pop_idle_connection(
+    struct aws_http_connection_manager *manager,
+    struct aws_idle_connection_shard *shard) {
+
+    if (!shard->is_open || aws_linked_list_empty(&shard->idle_connections)) {
+        return NULL;
+    }
+
+    AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->idle_connection_count) >= 1);
+
+    /*
+     * Connections are only ever added to the back, so popping either end keeps the list sorted from oldest
+     * (in terms of idle time) to newest, which culling relies on.
+     */
+    struct aws_linked_list_node *node =
+        manager->idle_connection_policy == AWS_HTTP_CONNECTION_MANAGER_IDLE_CONNECTION_POLICY_FIFO
+            ? aws_linked_list_pop_front(&shard->idle_connections)
+            : aws_linked_list_pop_back(&shard->idle_connections);
+    aws_atomic_fetch_add(&manager->vended_connection_count, 1);
+    aws_atomic_fetch_sub(&manager->idle_connection_count, 1);
+
+    return AWS_CONTAINER_OF(node, struct aws_idle_connection, node);
+}
+
+/*
+ * Cull a shard's expired connections (if `now` is set), then pop its next connection to vend.
+ */
+static struct aws_idle_connection *s_take_idle_connection_from_shard(
+    struct aws_http_connection_manager *manager,
+    struct aws_idle_connection_shard *shard,
+    const uint64_t *now,
+    struct aws_linked_list *expired_connections) {
+
+    aws_mutex_lock(&shard->lock);
+
+    if (now != NULL) {
+        s_expire_idle_connections(manager, shard, *now, expired_connections);
+    }
+
+    struct aws_idle_connection *idle_connection = s_pop_idle_connection(manager, shard);
+
+    aws_mutex_unlock(&shard->lock);
+
+    return idle_connection;
+}
+
+/*
+ * Take an idle connection for an acquisition, or return NULL if there's none it can use.
+ * The affinity shard (if any) is searched first.  The others are then searched, starting from a rotating index,
+ * unless the acquisition requires the affinity shard's event loop.
+ *
+ * If idle culling is on, expired connections in the searched shards are culled along the way (so they're never
+ * vended), and moved to `expired_connections` for the caller to release.
+ *
+ * Takes each shard's lock in turn, so it may be called with or without the manager's lock.
+ */
+static struct aws_idle_connection *s_take_idle_connection(
+    struct aws_http_connection_manager *manager,
+    struct aws_idle_connection_shard *affinity_shard,
+    enum aws_http_connection_manager_event_loop_affinity affinity,
+    struct aws_linked_list *expired_connections) {
+
+    uint64_t now_storage = 0;
+    const uint64_t *now = NULL;
+    if (manager->max_connection_idle_in_milliseconds > 0 &&
+        manager->system_vtable->get_monotonic_time(&now_storage) == AWS_OP_SUCCESS) {
+        now = &now_storage;
+    }
+
+    struct aws_idle_connection *idle_connection = NULL;
+
+    if (affinity_shard != NULL) {
+        idle_connection = s_take_idle_connection_from_shard(manager, affinity_shard, now, expired_connections);
+
+        if (idle_connection != NULL || affinity == AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_REQUIRED) {
+            return idle_connection;
+        }
+    }
+
+    size_t first_shard = aws_atomic_fetch_add(&manager->next_acquire_shard, 1);
+    for (size_t i = 0; i < manager->idle_shard_count && idle_connection == NULL; ++i) {
+        struct aws_idle_connection_shard *shard = &manager->idle_shards[(first_shard + i) % manager->idle_shard_count];
+        if (shard == affinity_shard) {
+            continue;
+        }
+
+        idle_connection = s_take_idle_connection_from_shard(manager, shard, now, expired_connections);
+    }
+
+    return idle_connection;
+}
+
+/* Return a node, no longer in the idle stack, to its shard's free list */
+static void s_recycle_idle_connection_node(struct aws_idle_connection *idle_connection) {
+    struct aws_idle_connection_shard *shard = idle_connection->shard;
+
+    aws_mutex_lock(&shard->lock);
+    aws_linked_list_push_back(&shard->free_nodes, &idle_connection->node);
+    aws_mutex_unlock(&shard->lock);
+}
+
+/*
+ * Returns a multiplexed connection with room for another lease that suits the acquisition, or NULL if there's none.
+ * HTTP/2 connections are filled in order, but pipelined HTTP/1.1 connections are balanced, since each request
+ * waits on the responses ahead of it.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static struct aws_multiplexed_connection *s_find_multiplexed_connection_for_acquisition(
+    struct aws_http_connection_manager *manager,
+    const struct aws_http_connection_acquisition *pending_acquisition) {
+
+    struct aws_multiplexed_connection *least_busy = NULL;
+    struct aws_multiplexed_connection *fallback = NULL;
+
+    const struct aws_linked_list_node *end = aws_linked_list_end(&manager->multiplexed_connections);
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&manager->multiplexed_connections); node != end;
+         node = aws_linked_list_next(node)) {
+        struct aws_multiplexed_connection *multiplexed_connection =
+            AWS_CONTAINER_OF(node, struct aws_multiplexed_connection, node);
+        if (multiplexed_connection->is_draining ||
+            multiplexed_connection->lease_count >= multiplexed_connection->max_leases) {
+            continue;
+        }
+
+        /* An HTTP/1.1 connection closing after a response can't take more requests, but drains on its next release */
+        if (multiplexed_connection->is_pipelined &&
+            !manager->system_vtable->is_connection_available(multiplexed_connection->connection)) {
+            continue;
+        }
+
+        if (pending_acquisition->affinity_shard == NULL ||
+            pending_acquisition->affinity_shard == multiplexed_connection->shard) {
+            if (!multiplexed_connection->is_pipelined) {
+                return multiplexed_connection;
+            }
+
+            if (least_busy == NULL || multiplexed_connection->lease_count < least_busy->lease_count) {
+                least_busy = multiplexed_connection;
+            }
+            continue;
+        }
+
+        if (fallback == NULL &&
+            pending_acquisition->event_loop_affinity != AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_REQUIRED) {
+            fallback = multiplexed_connection;
+        }
+    }
+
+    return least_busy != NULL ? least_busy : fallback;
+}
+
+/*
+ * Idle connections left over after step 1 of s_aws_http_connection_manager_build_transaction() can't be used by
+ * any pending acquisition, so if acquisitions are waiting on particular event loops, those connections are on the
+ * wrong ones.  Close up to `count` of them, oldest first, to make room for connections on the right event loops.
+ * Returns the number closed.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static size_t s_evict_idle_connections(struct aws_connection_management_transaction *work, size_t count) {
+    struct aws_http_connection_manager *manager = work->manager;
+
+    if (manager->pending_affinity_count == 0 || aws_atomic_load_int(&manager->idle_connection_count) == 0) {
+        return 0;
+    }
+
+    size_t evicted = 0;
+    for (size_t i = 0; i < manager->idle_shard_count && evicted < count; ++i) {
+        struct aws_idle_connection_shard *shard = &manager->idle_shards[i];
+        aws_mutex_lock(&shard->lock);
+
+        while (evicted < count && !aws_linked_list_empty(&shard->idle_connections)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&shard->idle_connections);
+            aws_linked_list_push_back(&work->connections_to_release, node);
+            aws_atomic_fetch_sub(&manager->idle_connection_count, 1);
+            AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->pooled_connection_count) > 0);
+            aws_atomic_fetch_sub(&manager->pooled_connection_count, 1);
+            ++evicted;
+        }
+
+        aws_mutex_unlock(&shard->lock);
+    }
+
+    if (evicted > 0) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: Closing %zu idle connections to make room for connections on other event loops",
+            (void *)manager,
+            evicted);
+    }
+
+    return evicted;
+}
+
+/*
+ * Choose the event loop of each new connection in the transaction.  Connects are assumed to serve the pending
+ * acquisitions in order, so each new connection is pinned to the event loop of the acquisition it's expected to
+ * serve, skipping those that `prior_connects` (the connects already underway) will serve.  Connections for
+ * acquisitions without affinity are left to the bootstrap.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static void s_pin_new_connections(struct aws_connection_management_transaction *work, size_t prior_connects) {
+    struct aws_http_connection_manager *manager = work->manager;
+
+    if (manager->pending_affinity_count == 0) {
+        return;
+    }
+
+    if (aws_array_list_init_dynamic(
+            &work->new_connection_event_loops,
+            work->allocator,
+            work->new_connections,
+            sizeof(struct aws_event_loop *))) {
+        /* The new connections just won't be pinned */
+        return;
+    }
+
+    size_t acquisitions_per_connection = s_get_leases_per_new_connection(manager);
+    size_t next_index = prior_connects * acquisitions_per_connection;
+    size_t index = 0;
+
+    const struct aws_linked_list_node *end = aws_linked_list_end(&manager->pending_acquisitions);
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&manager->pending_acquisitions);
+         node != end && aws_array_list_length(&work->new_connection_event_loops) < work->new_connections;
+         node = aws_linked_list_next(node), ++index) {
+
+        if (index != next_index) {
+            continue;
+        }
+
+        struct aws_http_connection_acquisition *pending_acquisition =
+            AWS_CONTAINER_OF(node, struct aws_http_connection_acquisition, node);
+        struct aws_event_loop *event_loop =
+            pending_acquisition->affinity_shard ? pending_acquisition->affinity_shard->event_loop : NULL;
+        aws_array_list_push_back(&work->new_connection_event_loops, &event_loop);
+        next_index += acquisitions_per_connection;
+    }
+}
+
+/*
+ * How many more connections it takes to have min_idle_connections ready for use.  Shared HTTP/2 connections count as
+ * ready, since they can take more acquisitions.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static size_t s_get_prewarm_deficit(struct aws_http_connection_manager *manager) {
+    if (manager->is_prewarm_suspended) {
+        return 0;
+    }
+
+    size_t ready_connections =
+        aws_atomic_load_int(&manager->idle_connection_count) + manager->multiplexed_connection_count;
+    if (ready_connections >= manager->min_idle_connections) {
+        return 0;
+    }
+
+    return manager->min_idle_connections - ready_connections;
+}
+
+static void s_aws_http_connection_manager_build_transaction(struct aws_connection_management_transaction *work) {
+    struct aws_http_connection_manager *manager = work->manager;
+
+    if (manager->state == AWS_HCMST_READY) {
+        /*
+         * Step 1 - If there's free connections, complete acquisition requests
+         *
+         * pending_acquisition_count must already be up to date when the shards are searched.  A release that
+         * adds to a shard after we've searched it is guaranteed to see the pending acquisition, and will run
+         * another transaction.
+         *
+         * Acquisitions are served in order, but one waiting on an event loop with no idle connections doesn't hold
+         * up those behind it.
+         */
+        struct aws_linked_list_node *node = aws_linked_list_begin(&manager->pending_acquisitions);
+        while (node != aws_linked_list_end(&manager->pending_acquisitions) &&
+               aws_atomic_load_int(&manager->idle_connection_count) > 0) {
+            struct aws_http_connection_acquisition *pending_acquisition =
+                AWS_CONTAINER_OF(node, struct aws_http_connection_acquisition, node);
+            node = aws_linked_list_next(node);
+
+            struct aws_linked_list expired_connections;
+            aws_linked_list_init(&expired_connections);
+
+            struct aws_idle_connection *idle_connection = s_take_idle_connection(
+                manager,
+                pending_acquisition->affinity_shard,
+                pending_acquisition->event_loop_affinity,
+                &expired_connections);
+
+            /* Connections culled along the way are released with the rest of the transaction's */
+            size_t expired_count = 0;
+            while (!aws_linked_list_empty(&expired_connections)) {
+                struct aws_linked_list_node *expired_node = aws_linked_list_pop_front(&expired_connections);
+                aws_linked_list_push_back(&work->connections_to_release, expired_node);
+                ++expired_count;
+            }
+            if (expired_count > 0) {
+                aws_atomic_fetch_add(&manager->lazily_culled_connection_count, expired_count);
+            }
+
+            if (idle_connection == NULL) {
+                continue;
+            }
+
+            struct aws_http_connection *connection = idle_connection->connection;
+            s_recycle_idle_connection_node(idle_connection);
+
+            AWS_LOGF_DEBUG(
+                AWS_LS_HTTP_CONNECTION_MANAGER,
+                "id=%p: Grabbing pooled connection (%p)",
+                (void *)manager,
+                (void *)connection);
+            s_aws_http_connection_manager_move_acquisition(
+                manager, pending_acquisition, connection, AWS_ERROR_SUCCESS, &work->completions);
+        }
+
+        /*
+         * Step 1b - If there's shared HTTP/2 connections with spare stream capacity, complete acquisition requests
+         */
+        node = aws_linked_list_begin(&manager->pending_acquisitions);
+        while (node != aws_linked_list_end(&manager->pending_acquisitions) &&
+               !aws_linked_list_empty(&manager->multiplexed_connections)) {
+            struct aws_http_connection_acquisition *pending_acquisition =
+                AWS_CONTAINER_OF(node, struct aws_http_connection_acquisition, node);
+            node = aws_linked_list_next(node);
+
+            struct aws_multiplexed_connection *multiplexed_connection =
+                s_find_multiplexed_connection_for_acquisition(manager, pending_acquisition);
+            if (multiplexed_connection == NULL) {
+                continue;
+            }
+
+            AWS_LOGF_DEBUG(
+                AWS_LS_HTTP_CONNECTION_MANAGER,
+                "id=%p: Sharing multiplexed connection (%p)",
+                (void *)manager,
+                (void *)multiplexed_connection->connection);
+            s_aws_http_connection_manager_move_acquisition(
+                manager,
+                pending_acquisition,
+                multiplexed_connection->connection,
+                AWS_ERROR_SUCCESS,
+                &work->completions);
+            ++multiplexed_connection->lease_count;
+            ++manager->multiplexed_lease_count;
+            aws_atomic_fetch_add(&manager->vended_connection_count, 1);
+        }
+
+        /*
+         * Step 2 - if there's excess pending acquisitions, or too few connections ready for use,
+         * and we have room to make more, make more
+         */
+        /* Each new connection may be expected to carry many streams, or pipelined requests */
+        size_t leases_per_new_connection = s_get_leases_per_new_connection(manager);
+        size_t connections_needed = aws_atomic_load_int(&manager->pending_acquisition_count);
+        connections_needed = (connections_needed + leases_per_new_connection - 1) / leases_per_new_connection;
+
+        /* Pending connects serve acquisitions first, whatever is left over becomes idle */
+        size_t acquisition_connections_needed = connections_needed;
+        connections_needed += s_get_prewarm_deficit(manager);
+
+        if (connections_needed > manager->pending_connects_count) {
+            /*
+             * Leases share a connection, so count the multiplexed connections rather than their leases.
+             * Other connections are counted whether idle or vended, since they move between the two without the lock.
+             */
+            size_t connections_in_use = aws_atomic_load_int(&manager->pooled_connection_count) +
+                                        manager->multiplexed_connection_count + manager->pending_connects_count;
+            AWS_FATAL_ASSERT(manager->max_connections >= connections_in_use);
+
+            work->new_connections = connections_needed - manager->pending_connects_count;
+            size_t max_new_connections = manager->max_connections - connections_in_use;
+
+            /* Only make room for connections that acquisitions are waiting on */
+            if (work->new_connections > max_new_connections &&
+                acquisition_connections_needed > manager->pending_connects_count) {
+                size_t shortfall = aws_min_size(
+                    work->new_connections - max_new_connections,
+                    acquisition_connections_needed - manager->pending_connects_count);
+                max_new_connections += s_evict_idle_connections(work, shortfall);
+            }
+
+            if (work->new_connections > max_new_connections) {
+                work->new_connections = max_new_connections;
+            }
+
+            if (work->new_connections > 0) {
+                s_pin_new_connections(work, manager->pending_connects_count);
+            }
+
+            manager->pending_connects_count += work->new_connections;
+        }
+    } else {
+        /*
+         * close each shard, and move its idle connections into the work set
+         */
+        for (size_t i = 0; i < manager->idle_shard_count; ++i) {
+            struct aws_idle_connection_shard *shard = &manager->idle_shards[i];
+            aws_mutex_lock(&shard->lock);
+
+            shard->is_open = false;
+            while (!aws_linked_list_empty(&shard->idle_connections)) {
+                struct aws_linked_list_node *node = aws_linked_list_pop_front(&shard->idle_connections);
+                aws_linked_list_push_back(&work->connections_to_release, node);
+                aws_atomic_fetch_sub(&manager->idle_connection_count, 1);
+                AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->pooled_connection_count) > 0);
+                aws_atomic_fetch_sub(&manager->pooled_connection_count, 1);
+            }
+
+            aws_mutex_unlock(&shard->lock);
+        }
+
+        /*
+         * Multiplexed connections are released now if nobody is using them, or as soon as their last lease returns
+         */
+        struct aws_linked_list_node *node = aws_linked_list_begin(&manager->multiplexed_connections);
+        while (node != aws_linked_list_end(&manager->multiplexed_connections)) {
+            struct aws_multiplexed_connection *multiplexed_connection =
+                AWS_CONTAINER_OF(node, struct aws_multiplexed_connection, node);
+            node = aws_linked_list_next(node);
+            s_drain_multiplexed_connection(work, multiplexed_connection);
+        }
+
+        /*
+         * Move all manager pending acquisitions to the work completion list
+         */
+        while (!aws_linked_list_empty(&manager->pending_acquisitions)) {
+            AWS_LOGF_DEBUG(
+                AWS_LS_HTTP_CONNECTION_MANAGER,
+                "id=%p: Failing pending connection acquisition due to manager shut down",
+                (void *)manager);
+            s_aws_http_connection_manager_move_front_acquisition(
+                manager, NULL, AWS_ERROR_HTTP_CONNECTION_MANAGER_SHUTTING_DOWN, &work->completions);
+        }
+
+        AWS_LOGF_INFO(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: manager release, failing %zu pending acquisitions",
+            (void *)manager,
+            aws_atomic_load_int(&manager->pending_acquisition_count));
+        aws_atomic_store_int(&manager->pending_acquisition_count, 0);
+
+        work->should_destroy_manager = s_aws_http_connection_manager_should_destroy(manager);
+    }
+
+    s_aws_http_connection_manager_get_snapshot(manager, &work->snapshot);
+}
+
+static void s_aws_http_connection_manager_execute_transaction(struct aws_connection_management_transaction *work);
+
+/*
+ * The final last gasp of a connection manager where memory is cleaned up.  Destruction is split up into two parts,
+ * a begin and a finish.  Idle connection culling requires a scheduled task on an arbitrary event loop.  If idle
+ * connection culling is on then this task must be cancelled before destruction can finish, but you can only cancel
+ * a task from the same event loop that it is scheduled on.  To resolve this, when using idle connection culling,
+ * we schedule a finish destruction task on the event loop that the culling task is on.  This finish task
+ * cancels the culling task and then calls this function.  If we are not using idle connection culling, we can
+ * call this function immediately from the start of destruction.
+ */
+static void s_aws_http_connection_manager_finish_destroy(struct aws_http_connection_manager *manager) {
+    if (manager == NULL) {
+        return;
+    }
+
+    AWS_LOGF_INFO(AWS_LS_HTTP_CONNECTION_MANAGER, "id=%p: Destroying self", (void *)manager);
+
+    AWS_FATAL_ASSERT(manager->pending_connects_count == 0);
+    AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->vended_connection_count) == 0);
+    AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->pending_acquisition_count) == 0);
+    AWS_FATAL_ASSERT(manager->open_connection_count == 0);
+    AWS_FATAL_ASSERT(aws_linked_list_empty(&manager->pending_acquisitions));
+    AWS_FATAL_ASSERT(aws_linked_list_empty(&manager->multiplexed_connections));
+
+    for (size_t i = 0; i < manager->idle_shard_count; ++i) {
+        struct aws_idle_connection_shard *shard = &manager->idle_shards[i];
+        AWS_FATAL_ASSERT(aws_linked_list_empty(&shard->idle_connections));
+
+        while (!aws_linked_list_empty(&shard->free_nodes)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&shard->free_nodes);
+            struct aws_idle_connection *idle_connection = AWS_CONTAINER_OF(node, struct aws_idle_connection, node);
+            aws_mem_release(idle_connection->allocator, idle_connection);
+        }
+
+        aws_mutex_clean_up(&shard->lock);
+    }
+
+    if (manager->idle_shards) {
+        aws_mem_release(manager->allocator, manager->idle_shards);
+    }
+
+    aws_string_destroy(manager->host);
+    if (manager->tls_connection_options) {
+        aws_tls_connection_options_clean_up(manager->tls_connection_options);
+        aws_mem_release(manager->allocator, manager->tls_connection_options);
+    }
+
+    if (manager->proxy_config) {
+        aws_http_proxy_config_destroy(manager->proxy_config);
+    }
+
+    aws_hash_table_clean_up(&manager->multiplexed_connection_map);
+
+    /*
+     * If this task exists then we are actually in the corresponding event loop running the final destruction task.
+     * In that case, we've already cancelled this task and when you cancel, it runs synchronously.  So in that
+     * case the task has run as cancelled, it was not rescheduled, and so we can safely release the memory.
+     */
+    if (manager->cull_task) {
+        aws_mem_release(manager->allocator, manager->cull_task);
+    }
+
+    aws_mutex_clean_up(&manager->lock);
+
+    aws_client_bootstrap_release(manager->bootstrap);
+
+    if (manager->shutdown_complete_callback) {
+        manager->shutdown_complete_callback(manager->shutdown_complete_user_data);
+    }
+
+    aws_mem_release(manager->allocator, manager);
+}
+
+/* This is scheduled to run on the cull task's event loop.  If there's no cull task we just destroy the
+ * manager directly without a cross-thread task.  */
+static void s_final_destruction_task(struct aws_task *task, void *arg, enum aws_task_status status) {
+    (void)status;
+    struct aws_http_connection_manager *manager = arg;
+    struct aws_allocator *allocator = manager->allocator;
+
+    if (manager->cull_task) {
+        AWS_FATAL_ASSERT(manager->cull_event_loop != NULL);
+        aws_event_loop_cancel_task(manager->cull_event_loop, manager->cull_task);
+    }
+
+    s_aws_http_connection_manager_finish_destroy(manager);
+
+    aws_mem_release(allocator, task);
 }
 
 static void s_aws_http_connection_manager_begin_destroy(struct aws_http_connection_manager *manager) {
@@ -720,18 +1546,23 @@ static void s_schedule_connection_culling(struct aws_http_connection_manager *ma
         goto on_error;
     }
 
-    uint64_t cull_task_time = 0;
-    const struct aws_linked_list_node *end = aws_linked_list_end(&manager->idle_connections);
-    struct aws_linked_list_node *oldest_node = aws_linked_list_begin(&manager->idle_connections);
-    if (oldest_node != end) {
-        /*
-         * Since the connections are in LIFO order in the list, the front of the list has the closest
-         * cull time.
-         */
-        struct aws_idle_connection *oldest_idle_connection =
-            AWS_CONTAINER_OF(oldest_node, struct aws_idle_connection, node);
-        cull_task_time = oldest_idle_connection->cull_timestamp;
-    } else {
+    uint64_t cull_task_time = UINT64_MAX;
+    for (size_t i = 0; i < manager->idle_shard_count; ++i) {
+        struct aws_idle_connection_shard *shard = &manager->idle_shards[i];
+        aws_mutex_lock(&shard->lock);
+        if (!aws_linked_list_empty(&shard->idle_connections)) {
+            /*
+             * Since the connections are in the order they were idled in each list, the front of the list has the
+             * closest cull time.
+             */
+            struct aws_idle_connection *oldest_idle_connection =
+                AWS_CONTAINER_OF(aws_linked_list_front(&shard->idle_connections), struct aws_idle_connection, node);
+            cull_task_time = aws_min_u64(cull_task_time, oldest_idle_connection->cull_timestamp);
+        }
+        aws_mutex_unlock(&shard->lock);
+    }
+
+    if (cull_task_time == UINT64_MAX) {
         /*
          * There are no connections in the list, so the absolute minimum anything could be culled is the full
          * culling interval from now.
@@ -767,6 +1598,16 @@ struct aws_http_connection_manager *aws_http_connection_manager_new(
         return NULL;
     }
 
+    if (options->min_idle_connections > options->max_connections) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "(static) min_idle_connections (%zu) exceeds max_connections (%zu) for connection manager creation",
+            options->min_idle_connections,
+            options->max_connections);
+        aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+        return NULL;
+    }
+
     if (options->monitoring_options && !aws_http_connection_monitoring_options_is_valid(options->monitoring_options)) {
         AWS_LOGF_ERROR(
             AWS_LS_HTTP_CONNECTION_MANAGER, "(static) invalid monitoring options for connection manager creation");
@@ -786,9 +1627,47 @@ struct aws_http_connection_manager *aws_http_connection_manager_new(
         goto on_error;
     }
 
-    aws_linked_list_init(&manager->idle_connections);
+    aws_atomic_init_int(&manager->idle_connection_count, 0);
+    aws_atomic_init_int(&manager->pooled_connection_count, 0);
+    aws_atomic_init_int(&manager->lazily_culled_connection_count, 0);
+    aws_atomic_init_int(&manager->next_acquire_shard, 0);
+    aws_atomic_init_int(&manager->pending_acquisition_count, 0);
+    aws_atomic_init_int(&manager->vended_connection_count, 0);
+
+    /* Users (and connections) live on the event loop threads, so one shard per event loop keeps contention low */
+    size_t shard_count = 1;
+    if (options->bootstrap != NULL) {
+        shard_count = aws_max_size(1, aws_event_loop_group_get_loop_count(options->bootstrap->event_loop_group));
+    }
+
+    manager->idle_shards = aws_mem_calloc(allocator, shard_count, sizeof(struct aws_idle_connection_shard));
+    if (manager->idle_shards == NULL) {
+        goto on_error;
+    }
+
+    for (size_t i = 0; i < shard_count; ++i) {
+        struct aws_idle_connection_shard *shard = &manager->idle_shards[i];
+        if (aws_mutex_init(&shard->lock)) {
+            goto on_error;
+        }
+
+        aws_linked_list_init(&shard->idle_connections);
+        aws_linked_list_init(&shard->free_nodes);
+        shard->is_open = true;
+        if (options->bootstrap != NULL) {
+            shard->event_loop = aws_event_loop_group_get_loop_at(options->bootstrap->event_loop_group, i);
+        }
+        manager->idle_shard_count = i + 1;
+    }
+
+    aws_linked_list_init(&manager->multiplexed_connections);
     aws_linked_list_init(&manager->pending_acquisitions);
 
+    if (aws_hash_table_init(
+            &manager->multiplexed_connection_map, allocator, 16, aws_hash_ptr, aws_ptr_eq, NULL, NULL)) {
+        goto on_error;
+    }
+
     manager->host = aws_string_new_from_cursor(allocator, &options->host);
     if (manager->host == NULL) {
         goto on_error;
@@ -824,11 +1703,31 @@ struct aws_http_connection_manager *aws_http_connection_manager_new(
     manager->shutdown_complete_user_data = options->shutdown_complete_user_data;
     manager->enable_read_back_pressure = options->enable_read_back_pressure;
     manager->max_connection_idle_in_milliseconds = options->max_connection_idle_in_milliseconds;
+    manager->enable_http2_multiplexing = options->enable_http2_multiplexing;
+    manager->max_streams_per_connection = options->max_streams_per_connection;
+    if (manager->max_streams_per_connection == 0) {
+        manager->max_streams_per_connection = AWS_HTTP_CONNECTION_MANAGER_DEFAULT_MAX_STREAMS_PER_CONNECTION;
+    }
+    manager->max_pipelined_requests_per_connection = options->max_pipelined_requests_per_connection;
+    manager->min_idle_connections = options->min_idle_connections;
+    manager->idle_connection_policy = options->idle_connection_policy;
 
     s_schedule_connection_culling(manager);
 
     AWS_LOGF_INFO(AWS_LS_HTTP_CONNECTION_MANAGER, "id=%p: Successfully created", (void *)manager);
 
+    if (manager->min_idle_connections > 0) {
+        /* Start warming up the pool.  Connects complete in the background, this doesn't wait on them. */
+        struct aws_connection_management_transaction work;
+        s_aws_connection_management_transaction_init(&work, manager);
+
+        aws_mutex_lock(&manager->lock);
+        s_aws_http_connection_manager_build_transaction(&work);
+        aws_mutex_unlock(&manager->lock);
+
+        s_aws_http_connection_manager_execute_transaction(&work);
+    }
+
     return manager;
 
 on_error:
@@ -886,7 +1785,22 @@ static void s_aws_http_connection_manager_on_connection_shutdown(
     int error_code,
     void *user_data);
 
-static int s_aws_http_connection_manager_new_connection(struct aws_http_connection_manager *manager) {
+static void s_aws_http_connection_manager_on_http2_goaway_received(
+    struct aws_http_connection *http2_connection,
+    uint32_t last_stream_id,
+    uint32_t http2_error_code,
+    void *user_data);
+
+static void s_aws_http_connection_manager_on_http2_remote_settings_change(
+    struct aws_http_connection *http2_connection,
+    const struct aws_http2_setting *settings_array,
+    size_t num_settings,
+    void *user_data);
+
+static int s_aws_http_connection_manager_new_connection(
+    struct aws_http_connection_manager *manager,
+    struct aws_event_loop *event_loop) {
+
     struct aws_http_client_connection_options options;
     AWS_ZERO_STRUCT(options);
     options.self_size = sizeof(struct aws_http_client_connection_options);
@@ -901,11 +1815,19 @@ static int s_aws_http_connection_manager_new_connection(struct aws_http_connecti
     options.on_setup = s_aws_http_connection_manager_on_connection_setup;
     options.on_shutdown = s_aws_http_connection_manager_on_connection_shutdown;
     options.manual_window_management = manager->enable_read_back_pressure;
+    options.requested_event_loop = event_loop;
 
     if (aws_http_connection_monitoring_options_is_valid(&manager->monitoring_options)) {
         options.monitoring_options = &manager->monitoring_options;
     }
 
+    struct aws_http2_connection_options http2_options = AWS_HTTP2_CONNECTION_OPTIONS_INIT;
+    if (manager->enable_http2_multiplexing) {
+        http2_options.on_goaway_received = s_aws_http_connection_manager_on_http2_goaway_received;
+        http2_options.on_remote_settings_change = s_aws_http_connection_manager_on_http2_remote_settings_change;
+        options.http2_options = &http2_options;
+    }
+
     struct aws_http_proxy_options proxy_options;
     AWS_ZERO_STRUCT(proxy_options);
 
@@ -940,116 +1862,405 @@ static void s_aws_http_connection_manager_execute_transaction(struct aws_connect
      */
     s_aws_http_connection_manager_log_snapshot(manager, &work->snapshot);
 
-    /*
-     * Step 2 - Perform any requested connection releases
-     */
-    while (!aws_linked_list_empty(&work->connections_to_release)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_back(&work->connections_to_release);
-        struct aws_idle_connection *idle_connection = AWS_CONTAINER_OF(node, struct aws_idle_connection, node);
+    /*
+     * Step 2 - Perform any requested connection releases
+     */
+    while (!aws_linked_list_empty(&work->connections_to_release)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_back(&work->connections_to_release);
+        struct aws_idle_connection *idle_connection = AWS_CONTAINER_OF(node, struct aws_idle_connection, node);
+
+        AWS_LOGF_INFO(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: Releasing connection (id=%p)",
+            (void *)manager,
+            (void *)idle_connection->connection);
+        manager->system_vtable->release_connection(idle_connection->connection);
+        aws_mem_release(idle_connection->allocator, idle_connection);
+    }
+
+    while (!aws_linked_list_empty(&work->multiplexed_connections_to_release)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_back(&work->multiplexed_connections_to_release);
+        struct aws_multiplexed_connection *multiplexed_connection =
+            AWS_CONTAINER_OF(node, struct aws_multiplexed_connection, node);
+
+        AWS_LOGF_INFO(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: Releasing multiplexed connection (id=%p)",
+            (void *)manager,
+            (void *)multiplexed_connection->connection);
+        manager->system_vtable->release_connection(multiplexed_connection->connection);
+        aws_mem_release(multiplexed_connection->allocator, multiplexed_connection);
+    }
+
+    if (work->connection_to_release) {
+        AWS_LOGF_INFO(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: Releasing connection (id=%p)",
+            (void *)manager,
+            (void *)work->connection_to_release);
+        manager->system_vtable->release_connection(work->connection_to_release);
+    }
+
+    /*
+     * Step 3 - Make new connections
+     */
+    struct aws_array_list errors;
+    AWS_ZERO_STRUCT(errors);
+    /* Even if we can't init this array, we still need to invoke error callbacks properly */
+    bool push_errors = false;
+
+    if (work->new_connections > 0) {
+        AWS_LOGF_INFO(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: Requesting %zu new connections from http",
+            (void *)manager,
+            work->new_connections);
+        push_errors = aws_array_list_init_dynamic(&errors, work->allocator, work->new_connections, sizeof(int)) ==
+                      AWS_ERROR_SUCCESS;
+    }
+
+    for (size_t i = 0; i < work->new_connections; ++i) {
+        struct aws_event_loop *event_loop = NULL;
+        if (i < aws_array_list_length(&work->new_connection_event_loops)) {
+            aws_array_list_get_at(&work->new_connection_event_loops, &event_loop, i);
+        }
+
+        if (s_aws_http_connection_manager_new_connection(manager, event_loop)) {
+            ++new_connection_failures;
+            representative_error = aws_last_error();
+            if (push_errors) {
+                AWS_FATAL_ASSERT(aws_array_list_push_back(&errors, &representative_error) == AWS_OP_SUCCESS);
+            }
+        }
+    }
+
+    if (new_connection_failures > 0) {
+        /*
+         * We failed and aren't going to receive a callback, but the current state assumes we will receive
+         * a callback.  So we need to re-lock and update the state ourselves.
+         */
+        aws_mutex_lock(&manager->lock);
+
+        AWS_FATAL_ASSERT(manager->pending_connects_count >= new_connection_failures);
+        manager->pending_connects_count -= new_connection_failures;
+        manager->is_prewarm_suspended = true;
+
+        /*
+         * Rather than failing one acquisition for each connection failure, if there's at least one
+         * connection failure, we instead fail all excess acquisitions, since there's no pending
+         * connect that will necessarily resolve them.
+         *
+         * Try to correspond an error with the acquisition failure, but as a fallback just use the
+         * representative error.
+         */
+        size_t i = 0;
+        while (aws_atomic_load_int(&manager->pending_acquisition_count) > s_get_pending_connect_capacity(manager)) {
+            int error = representative_error;
+            if (i < aws_array_list_length(&errors)) {
+                aws_array_list_get_at(&errors, &error, i);
+            }
+
+            AWS_LOGF_DEBUG(
+                AWS_LS_HTTP_CONNECTION_MANAGER,
+                "id=%p: Failing excess connection acquisition with error code %d",
+                (void *)manager,
+                (int)error);
+            s_aws_http_connection_manager_move_front_acquisition(manager, NULL, error, &work->completions);
+            ++i;
+        }
+
+        should_destroy = s_aws_http_connection_manager_should_destroy(manager);
+
+        aws_mutex_unlock(&manager->lock);
+    }
+
+    /*
+     * Step 4 - Perform acquisition callbacks
+     */
+    s_aws_http_connection_manager_complete_acquisitions(&work->completions, work->allocator);
+
+    aws_array_list_clean_up(&errors);
+
+    /*
+     * Step 5 - destroy the manager if necessary
+     */
+    if (should_destroy) {
+        s_aws_http_connection_manager_begin_destroy(manager);
+    }
+
+    /*
+     * Step 6 - Clean up work.  Do this here rather than at the end of every caller.
+     */
+    s_aws_connection_management_transaction_clean_up(work);
+}
+
+/*
+ * Push a connection onto the back of its shard's idle list.
+ *
+ * If `expired_connections` is set and idle culling is on, connections in the shard whose idle time is up are culled
+ * first, and moved to `expired_connections` for the caller to release.
+ *
+ * Hard Requirement: Shard's lock must be held somewhere in the call stack
+ */
+static int s_push_idle_connection(
+    struct aws_http_connection_manager *manager,
+    struct aws_idle_connection_shard *shard,
+    struct aws_http_connection *connection,
+    struct aws_linked_list *expired_connections) {
+
+    if (!shard->is_open) {
+        return aws_raise_error(AWS_ERROR_HTTP_CONNECTION_MANAGER_SHUTTING_DOWN);
+    }
+
+    /* Get the timestamp with the lock held, so the list stays sorted */
+    uint64_t now = 0;
+    if (manager->system_vtable->get_monotonic_time(&now)) {
+        return AWS_OP_ERR;
+    }
+
+    uint64_t cull_timestamp =
+        now + aws_timestamp_convert(
+                  manager->max_connection_idle_in_milliseconds, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+
+    /* Get the node before culling anything, so a failure leaves the pool untouched */
+    struct aws_idle_connection *idle_connection = NULL;
+    if (!aws_linked_list_empty(&shard->free_nodes)) {
+        idle_connection =
+            AWS_CONTAINER_OF(aws_linked_list_pop_back(&shard->free_nodes), struct aws_idle_connection, node);
+    } else {
+        idle_connection = aws_mem_calloc(manager->allocator, 1, sizeof(struct aws_idle_connection));
+        if (idle_connection == NULL) {
+            return AWS_OP_ERR;
+        }
+
+        idle_connection->allocator = manager->allocator;
+        idle_connection->shard = shard;
+    }
+
+    if (expired_connections != NULL && manager->max_connection_idle_in_milliseconds > 0) {
+        s_expire_idle_connections(manager, shard, now, expired_connections);
+    }
+
+    idle_connection->connection = connection;
+    idle_connection->cull_timestamp = cull_timestamp;
+
+    aws_linked_list_push_back(&shard->idle_connections, &idle_connection->node);
+    aws_atomic_fetch_add(&manager->idle_connection_count, 1);
+
+    return AWS_OP_SUCCESS;
+}
+
+/*
+ * Add a connection to the idle pool.  Fails if the manager is shutting down.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static int s_idle_connection(struct aws_http_connection_manager *manager, struct aws_http_connection *connection) {
+    struct aws_idle_connection_shard *shard = s_get_connection_shard(manager, connection);
+
+    aws_mutex_lock(&shard->lock);
+    int result = s_push_idle_connection(manager, shard, connection, NULL);
+    aws_mutex_unlock(&shard->lock);
+
+    return result;
+}
+
+static void s_idle_connection_acquisition_task(
+    struct aws_channel_task *channel_task,
+    void *arg,
+    enum aws_task_status status) {
+    (void)channel_task;
+
+    struct aws_idle_connection *idle_connection = arg;
+    struct aws_http_connection_manager *manager = idle_connection->manager;
+    struct aws_http_connection *connection = idle_connection->connection;
+    aws_http_connection_manager_on_connection_setup_fn *callback = idle_connection->callback;
+    void *user_data = idle_connection->user_data;
+
+    /* Recycle the node before invoking the callback, which may release the connection and the manager */
+    s_recycle_idle_connection_node(idle_connection);
+
+    /* Same as s_connection_acquisition_task(), if the task is canceled the channel shut down */
+    if (status != AWS_TASK_STATUS_RUN_READY) {
+        AWS_LOGF_WARN(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: Failed to complete connection acquisition because the connection was closed",
+            (void *)manager);
+        callback(NULL, AWS_ERROR_HTTP_CONNECTION_CLOSED, user_data);
+        /* release it back to prevent a leak of the connection count. */
+        aws_http_connection_manager_release_connection(manager, connection);
+    } else {
+        AWS_LOGF_DEBUG(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: Successfully completed connection acquisition with connection id=%p",
+            (void *)manager,
+            (void *)connection);
+        callback(connection, AWS_ERROR_SUCCESS, user_data);
+    }
+}
+
+/*
+ * Release connections culled during an acquire or release, with no locks held.  Returns the number released.
+ */
+static size_t s_release_expired_connections(
+    struct aws_http_connection_manager *manager,
+    struct aws_linked_list *expired_connections) {
+
+    size_t expired_count = 0;
+    while (!aws_linked_list_empty(expired_connections)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(expired_connections);
+        struct aws_idle_connection *idle_connection = AWS_CONTAINER_OF(node, struct aws_idle_connection, node);
+
+        AWS_LOGF_INFO(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: Releasing connection (id=%p)",
+            (void *)manager,
+            (void *)idle_connection->connection);
+        manager->system_vtable->release_connection(idle_connection->connection);
+        aws_mem_release(idle_connection->allocator, idle_connection);
+        ++expired_count;
+    }
+
+    if (expired_count > 0) {
+        aws_atomic_fetch_add(&manager->lazily_culled_connection_count, expired_count);
+    }
+
+    return expired_count;
+}
+
+/*
+ * Try to complete an acquisition with an idle connection, without taking the manager's lock.
+ * Returns false if the acquisition must go through the regular path instead.
+ */
+static bool s_try_acquire_idle_connection(
+    struct aws_http_connection_manager *manager,
+    struct aws_idle_connection_shard *affinity_shard,
+    enum aws_http_connection_manager_event_loop_affinity affinity,
+    aws_http_connection_manager_on_connection_setup_fn *callback,
+    void *user_data) {
+
+    /* Nothing to find, or connections should go to acquisitions that were already waiting */
+    if (aws_atomic_load_int(&manager->idle_connection_count) == 0 ||
+        aws_atomic_load_int(&manager->pending_acquisition_count) > 0) {
+        return false;
+    }
+
+    struct aws_linked_list expired_connections;
+    aws_linked_list_init(&expired_connections);
+
+    struct aws_idle_connection *idle_connection =
+        s_take_idle_connection(manager, affinity_shard, affinity, &expired_connections);
+
+    /* An acquisition that started waiting meanwhile may have found the pool full before the cull made room */
+    if (s_release_expired_connections(manager, &expired_connections) > 0 &&
+        aws_atomic_load_int(&manager->pending_acquisition_count) > 0) {
+        struct aws_connection_management_transaction work;
+        s_aws_connection_management_transaction_init(&work, manager);
+
+        aws_mutex_lock(&manager->lock);
+        s_aws_http_connection_manager_build_transaction(&work);
+        aws_mutex_unlock(&manager->lock);
 
-        AWS_LOGF_INFO(
-            AWS_LS_HTTP_CONNECTION_MANAGER,
-            "id=%p: Releasing connection (id=%p)",
-            (void *)manager,
-            (void *)idle_connection->connection);
-        manager->system_vtable->release_connection(idle_connection->connection);
-        aws_mem_release(idle_connection->allocator, idle_connection);
+        s_aws_http_connection_manager_execute_transaction(&work);
     }
 
-    if (work->connection_to_release) {
-        AWS_LOGF_INFO(
-            AWS_LS_HTTP_CONNECTION_MANAGER,
-            "id=%p: Releasing connection (id=%p)",
-            (void *)manager,
-            (void *)work->connection_to_release);
-        manager->system_vtable->release_connection(work->connection_to_release);
+    if (idle_connection == NULL) {
+        return false;
     }
 
-    /*
-     * Step 3 - Make new connections
-     */
-    struct aws_array_list errors;
-    AWS_ZERO_STRUCT(errors);
-    /* Even if we can't init this array, we still need to invoke error callbacks properly */
-    bool push_errors = false;
+    struct aws_http_connection *connection = idle_connection->connection;
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION_MANAGER,
+        "id=%p: Grabbing pooled connection (%p)",
+        (void *)manager,
+        (void *)connection);
 
-    if (work->new_connections > 0) {
-        AWS_LOGF_INFO(
-            AWS_LS_HTTP_CONNECTION_MANAGER,
-            "id=%p: Requesting %zu new connections from http",
-            (void *)manager,
-            work->new_connections);
-        push_errors = aws_array_list_init_dynamic(&errors, work->allocator, work->new_connections, sizeof(int)) ==
-                      AWS_ERROR_SUCCESS;
+    /* As in s_aws_http_connection_manager_complete_acquisitions(), move the callback to the connection's thread */
+    struct aws_channel *channel = manager->system_vtable->connection_get_channel(connection);
+    AWS_PRECONDITION(channel);
+    if (!manager->system_vtable->is_callers_thread(channel)) {
+        idle_connection->manager = manager;
+        idle_connection->callback = callback;
+        idle_connection->user_data = user_data;
+        aws_channel_task_init(
+            &idle_connection->acquisition_task,
+            s_idle_connection_acquisition_task,
+            idle_connection,
+            "s_idle_connection_acquisition_task");
+        aws_channel_schedule_task_now(channel, &idle_connection->acquisition_task);
+        return true;
     }
 
-    for (size_t i = 0; i < work->new_connections; ++i) {
-        if (s_aws_http_connection_manager_new_connection(manager)) {
-            ++new_connection_failures;
-            representative_error = aws_last_error();
-            if (push_errors) {
-                AWS_FATAL_ASSERT(aws_array_list_push_back(&errors, &representative_error) == AWS_OP_SUCCESS);
-            }
-        }
-    }
+    s_recycle_idle_connection_node(idle_connection);
 
-    if (new_connection_failures > 0) {
-        /*
-         * We failed and aren't going to receive a callback, but the current state assumes we will receive
-         * a callback.  So we need to re-lock and update the state ourselves.
-         */
-        aws_mutex_lock(&manager->lock);
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION_MANAGER,
+        "id=%p: Successfully completed connection acquisition with connection id=%p",
+        (void *)manager,
+        (void *)connection);
+    callback(connection, AWS_ERROR_SUCCESS, user_data);
+    return true;
+}
 
-        AWS_FATAL_ASSERT(manager->pending_connects_count >= new_connection_failures);
-        manager->pending_connects_count -= new_connection_failures;
+/*
+ * Try to return a vended connection to the idle pool, without taking the manager's lock.
+ * Returns false if the release must go through the regular path instead.
+ */
+static bool s_try_release_to_idle_pool(
+    struct aws_http_connection_manager *manager,
+    struct aws_http_connection *connection,
+    struct aws_linked_list *expired_connections) {
 
-        /*
-         * Rather than failing one acquisition for each connection failure, if there's at least one
-         * connection failure, we instead fail all excess acquisitions, since there's no pending
-         * connect that will necessarily resolve them.
-         *
-         * Try to correspond an error with the acquisition failure, but as a fallback just use the
-         * representative error.
-         */
-        size_t i = 0;
-        while (manager->pending_acquisition_count > manager->pending_connects_count) {
-            int error = representative_error;
-            if (i < aws_array_list_length(&errors)) {
-                aws_array_list_get_at(&errors, &error, i);
-            }
+    struct aws_idle_connection_shard *shard = s_get_connection_shard(manager, connection);
+    bool released = false;
 
-            AWS_LOGF_DEBUG(
-                AWS_LS_HTTP_CONNECTION_MANAGER,
-                "id=%p: Failing excess connection acquisition with error code %d",
-                (void *)manager,
-                (int)error);
-            s_aws_http_connection_manager_move_front_acquisition(manager, NULL, error, &work->completions);
-            ++i;
+    aws_mutex_lock(&shard->lock);
+
+    /* A closed shard means we're shutting down, and an underflow is an error.  The regular path deals with both. */
+    if (shard->is_open && s_atomic_decrement_if_positive(&manager->vended_connection_count)) {
+        if (s_push_idle_connection(manager, shard, connection, expired_connections)) {
+            aws_atomic_fetch_add(&manager->vended_connection_count, 1);
+        } else {
+            released = true;
         }
+    }
 
-        should_destroy = s_aws_http_connection_manager_should_destroy(manager);
+    aws_mutex_unlock(&shard->lock);
 
-        aws_mutex_unlock(&manager->lock);
-    }
+    return released;
+}
 
-    /*
-     * Step 4 - Perform acquisition callbacks
-     */
-    s_aws_http_connection_manager_complete_acquisitions(&work->completions, work->allocator);
+/*
+ * Find the shard of the event loop an acquisition wants a connection on.  Sets it to NULL if the acquisition has no
+ * (usable) preference.  Fails if the acquisition requires an event loop that the manager has no connections on.
+ */
+static int s_get_affinity_shard(
+    struct aws_http_connection_manager *manager,
+    const struct aws_http_connection_manager_acquire_options *options,
+    struct aws_idle_connection_shard **out_shard) {
 
-    aws_array_list_clean_up(&errors);
+    *out_shard = NULL;
 
-    /*
-     * Step 5 - destroy the manager if necessary
-     */
-    if (should_destroy) {
-        s_aws_http_connection_manager_begin_destroy(manager);
+    /* If connections' event loops can't be determined, there's no affinity to honor */
+    if (options->event_loop_affinity == AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_NONE ||
+        manager->system_vtable->connection_get_event_loop == NULL) {
+        return AWS_OP_SUCCESS;
     }
 
-    /*
-     * Step 6 - Clean up work.  Do this here rather than at the end of every caller.
-     */
-    s_aws_connection_management_transaction_clean_up(work);
+    *out_shard = options->event_loop ? s_get_event_loop_shard(manager, options->event_loop)
+                                     : s_get_callers_shard(manager);
+
+    if (*out_shard == NULL &&
+        options->event_loop_affinity == AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_REQUIRED) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_CONNECTION_MANAGER,
+            "id=%p: Acquisition requires an event loop (%p) that isn't part of the manager's bootstrap",
+            (void *)manager,
+            (void *)options->event_loop);
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    return AWS_OP_SUCCESS;
 }
 
 void aws_http_connection_manager_acquire_connection(
@@ -1057,8 +2268,36 @@ void aws_http_connection_manager_acquire_connection(
     aws_http_connection_manager_on_connection_setup_fn *callback,
     void *user_data) {
 
+    struct aws_http_connection_manager_acquire_options options = {
+        .callback = callback,
+        .user_data = user_data,
+    };
+
+    aws_http_connection_manager_acquire_connection_with_options(manager, &options);
+}
+
+void aws_http_connection_manager_acquire_connection_with_options(
+    struct aws_http_connection_manager *manager,
+    const struct aws_http_connection_manager_acquire_options *options) {
+
     AWS_LOGF_DEBUG(AWS_LS_HTTP_CONNECTION_MANAGER, "id=%p: Acquire connection", (void *)manager);
 
+    aws_http_connection_manager_on_connection_setup_fn *callback = options->callback;
+    void *user_data = options->user_data;
+
+    struct aws_idle_connection_shard *affinity_shard = NULL;
+    if (s_get_affinity_shard(manager, options, &affinity_shard)) {
+        callback(NULL, aws_last_error(), user_data);
+        return;
+    }
+
+    enum aws_http_connection_manager_event_loop_affinity affinity =
+        affinity_shard ? options->event_loop_affinity : AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_NONE;
+
+    if (s_try_acquire_idle_connection(manager, affinity_shard, affinity, callback, user_data)) {
+        return;
+    }
+
     struct aws_http_connection_acquisition *request =
         aws_mem_calloc(manager->allocator, 1, sizeof(struct aws_http_connection_acquisition));
     if (request == NULL) {
@@ -1070,6 +2309,8 @@ void aws_http_connection_manager_acquire_connection(
     request->callback = callback;
     request->user_data = user_data;
     request->manager = manager;
+    request->affinity_shard = affinity_shard;
+    request->event_loop_affinity = affinity;
 
     struct aws_connection_management_transaction work;
     s_aws_connection_management_transaction_init(&work, manager);
@@ -1086,7 +2327,10 @@ void aws_http_connection_manager_acquire_connection(
     }
 
     aws_linked_list_push_back(&manager->pending_acquisitions, &request->node);
-    ++manager->pending_acquisition_count;
+    aws_atomic_fetch_add(&manager->pending_acquisition_count, 1);
+    if (affinity_shard != NULL) {
+        ++manager->pending_affinity_count;
+    }
 
     s_aws_http_connection_manager_build_transaction(&work);
 
@@ -1095,36 +2339,42 @@ void aws_http_connection_manager_acquire_connection(
     s_aws_http_connection_manager_execute_transaction(&work);
 }
 
-static int s_idle_connection(struct aws_http_connection_manager *manager, struct aws_http_connection *connection) {
-    struct aws_idle_connection *idle_connection =
-        aws_mem_calloc(manager->allocator, 1, sizeof(struct aws_idle_connection));
-    if (idle_connection == NULL) {
+/*
+ * Start sharing a new HTTP/2 connection, or pipelined HTTP/1.1 connection, between acquisitions.
+ *
+ * Hard Requirement: Manager's lock must held somewhere in the call stack
+ */
+static int s_multiplex_connection(struct aws_http_connection_manager *manager, struct aws_http_connection *connection) {
+    struct aws_multiplexed_connection *multiplexed_connection =
+        aws_mem_calloc(manager->allocator, 1, sizeof(struct aws_multiplexed_connection));
+    if (multiplexed_connection == NULL) {
         return AWS_OP_ERR;
     }
 
-    idle_connection->allocator = manager->allocator;
-    idle_connection->connection = connection;
-
-    uint64_t idle_start_timestamp = 0;
-    if (manager->system_vtable->get_monotonic_time(&idle_start_timestamp)) {
-        goto on_error;
+    multiplexed_connection->allocator = manager->allocator;
+    multiplexed_connection->connection = connection;
+    multiplexed_connection->shard = s_get_connection_shard(manager, connection);
+    multiplexed_connection->is_pipelined =
+        manager->system_vtable->connection_get_version(connection) == AWS_HTTP_VERSION_1_1;
+    multiplexed_connection->max_leases = multiplexed_connection->is_pipelined
+                                             ? manager->max_pipelined_requests_per_connection
+                                             : manager->max_streams_per_connection;
+
+    if (s_get_cull_timestamp(manager, &multiplexed_connection->cull_timestamp) ||
+        aws_hash_table_put(&manager->multiplexed_connection_map, connection, multiplexed_connection, NULL)) {
+        aws_mem_release(multiplexed_connection->allocator, multiplexed_connection);
+        return AWS_OP_ERR;
     }
 
-    idle_connection->cull_timestamp =
-        idle_start_timestamp +
-        aws_timestamp_convert(
-            manager->max_connection_idle_in_milliseconds, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
-
-    aws_linked_list_push_back(&manager->idle_connections, &idle_connection->node);
-    ++manager->idle_connection_count;
+    aws_linked_list_push_back(&manager->multiplexed_connections, &multiplexed_connection->node);
+    ++manager->multiplexed_connection_count;
+    if (multiplexed_connection->is_pipelined) {
+        manager->is_http1_pipelining_negotiated = true;
+    } else {
+        manager->is_http2_negotiated = true;
+    }
 
     return AWS_OP_SUCCESS;
-
-on_error:
-
-    aws_mem_release(idle_connection->allocator, idle_connection);
-
-    return AWS_OP_ERR;
 }
 
 int aws_http_connection_manager_release_connection(
@@ -1140,10 +2390,31 @@ int aws_http_connection_manager_release_connection(
     AWS_LOGF_DEBUG(
         AWS_LS_HTTP_CONNECTION_MANAGER, "id=%p: Releasing connection (id=%p)", (void *)manager, (void *)connection);
 
+    struct aws_linked_list expired_connections;
+    aws_linked_list_init(&expired_connections);
+
+    if (!should_release_connection && !s_is_multiplexed_connection(manager, connection) &&
+        s_try_release_to_idle_pool(manager, connection, &expired_connections)) {
+
+        s_release_expired_connections(manager, &expired_connections);
+
+        /* An acquisition may have started waiting before the connection was pooled, make sure it gets one */
+        if (aws_atomic_load_int(&manager->pending_acquisition_count) == 0) {
+            return AWS_OP_SUCCESS;
+        }
+
+        aws_mutex_lock(&manager->lock);
+        s_aws_http_connection_manager_build_transaction(&work);
+        aws_mutex_unlock(&manager->lock);
+
+        s_aws_http_connection_manager_execute_transaction(&work);
+        return AWS_OP_SUCCESS;
+    }
+
     aws_mutex_lock(&manager->lock);
 
     /* We're probably hosed in this case, but let's not underflow */
-    if (manager->vended_connection_count == 0) {
+    if (!s_atomic_decrement_if_positive(&manager->vended_connection_count)) {
         AWS_LOGF_FATAL(
             AWS_LS_HTTP_CONNECTION_MANAGER,
             "id=%p: Connection released when vended connection count is zero",
@@ -1154,12 +2425,31 @@ int aws_http_connection_manager_release_connection(
 
     result = AWS_OP_SUCCESS;
 
-    --manager->vended_connection_count;
+    struct aws_multiplexed_connection *multiplexed_connection = s_find_multiplexed_connection(manager, connection);
+    if (multiplexed_connection != NULL) {
+        /* Releasing one lease on a shared connection; the connection itself is released once it's drained */
+        AWS_FATAL_ASSERT(multiplexed_connection->lease_count > 0 && manager->multiplexed_lease_count > 0);
+        --multiplexed_connection->lease_count;
+        --manager->multiplexed_lease_count;
+
+        if (multiplexed_connection->lease_count == 0) {
+            s_get_cull_timestamp(manager, &multiplexed_connection->cull_timestamp);
+        }
+
+        if (should_release_connection || multiplexed_connection->is_draining) {
+            s_drain_multiplexed_connection(&work, multiplexed_connection);
+        }
 
-    if (!should_release_connection) {
-        if (s_idle_connection(manager, connection)) {
+        should_release_connection = false;
+    } else {
+        if (!should_release_connection && s_idle_connection(manager, connection)) {
             should_release_connection = true;
         }
+
+        if (should_release_connection) {
+            AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->pooled_connection_count) > 0);
+            aws_atomic_fetch_sub(&manager->pooled_connection_count, 1);
+        }
     }
 
     s_aws_http_connection_manager_build_transaction(&work);
@@ -1185,12 +2475,16 @@ static void s_aws_http_connection_manager_on_connection_setup(
     struct aws_connection_management_transaction work;
     s_aws_connection_management_transaction_init(&work, manager);
 
+    bool is_multiplexed = false;
+
     if (connection != NULL) {
         AWS_LOGF_DEBUG(
             AWS_LS_HTTP_CONNECTION_MANAGER,
             "id=%p: Received new connection (id=%p) from http layer",
             (void *)manager,
             (void *)connection);
+
+        is_multiplexed = s_is_multiplexed_connection(manager, connection);
     } else {
         AWS_LOGF_WARN(
             AWS_LS_HTTP_CONNECTION_MANAGER,
@@ -1207,8 +2501,19 @@ static void s_aws_http_connection_manager_on_connection_setup(
     AWS_FATAL_ASSERT(manager->pending_connects_count > 0);
     --manager->pending_connects_count;
 
+    manager->is_prewarm_suspended = connection == NULL;
+
     if (connection != NULL) {
-        if (is_shutting_down || s_idle_connection(manager, connection)) {
+        int add_err = AWS_OP_SUCCESS;
+        if (!is_shutting_down) {
+            add_err = is_multiplexed ? s_multiplex_connection(manager, connection)
+                                     : s_idle_connection(manager, connection);
+            if (!is_multiplexed && !add_err) {
+                aws_atomic_fetch_add(&manager->pooled_connection_count, 1);
+            }
+        }
+
+        if (is_shutting_down || add_err) {
             /*
              * release it immediately
              */
@@ -1228,7 +2533,7 @@ static void s_aws_http_connection_manager_on_connection_setup(
          *
          * This won't happen during shutdown since there are no pending acquisitions at that point.
          */
-        while (manager->pending_acquisition_count > manager->pending_connects_count) {
+        while (aws_atomic_load_int(&manager->pending_acquisition_count) > s_get_pending_connect_capacity(manager)) {
             AWS_LOGF_DEBUG(
                 AWS_LS_HTTP_CONNECTION_MANAGER,
                 "id=%p: Failing excess connection acquisition with error code %d",
@@ -1270,18 +2575,28 @@ static void s_aws_http_connection_manager_on_connection_shutdown(
     /*
      * Find and, if found, remove it from idle connections
      */
-    const struct aws_linked_list_node *end = aws_linked_list_end(&manager->idle_connections);
-    for (struct aws_linked_list_node *node = aws_linked_list_begin(&manager->idle_connections); node != end;
+    struct aws_idle_connection_shard *shard = s_get_connection_shard(manager, connection);
+    aws_mutex_lock(&shard->lock);
+    const struct aws_linked_list_node *end = aws_linked_list_end(&shard->idle_connections);
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&shard->idle_connections); node != end;
          node = aws_linked_list_next(node)) {
         struct aws_idle_connection *current_idle_connection = AWS_CONTAINER_OF(node, struct aws_idle_connection, node);
         if (current_idle_connection->connection == connection) {
             aws_linked_list_remove(node);
+            aws_linked_list_push_back(&shard->free_nodes, node);
             work.connection_to_release = connection;
-            aws_mem_release(current_idle_connection->allocator, current_idle_connection);
-            --manager->idle_connection_count;
+            aws_atomic_fetch_sub(&manager->idle_connection_count, 1);
+            AWS_FATAL_ASSERT(aws_atomic_load_int(&manager->pooled_connection_count) > 0);
+            aws_atomic_fetch_sub(&manager->pooled_connection_count, 1);
             break;
         }
     }
+    aws_mutex_unlock(&shard->lock);
+
+    struct aws_multiplexed_connection *multiplexed_connection = s_find_multiplexed_connection(manager, connection);
+    if (multiplexed_connection != NULL) {
+        s_drain_multiplexed_connection(&work, multiplexed_connection);
+    }
 
     s_aws_http_connection_manager_build_transaction(&work);
 
@@ -1297,6 +2612,9 @@ static void s_cull_idle_connections(struct aws_http_connection_manager *manager)
         return;
     }
 
+    uint64_t start_ticks = 0;
+    aws_high_res_clock_get_ticks(&start_ticks);
+
     uint64_t now = 0;
     if (manager->system_vtable->get_monotonic_time(&now)) {
         return;
@@ -1305,37 +2623,73 @@ static void s_cull_idle_connections(struct aws_http_connection_manager *manager)
     struct aws_connection_management_transaction work;
     s_aws_connection_management_transaction_init(&work, manager);
 
+    /*
+     * Each shard's list is sorted by cull timestamp, so this only visits expired connections.
+     * The shards don't need the manager's lock, and are closed once the manager starts shutting down.
+     */
+    size_t culled_count = 0;
+    for (size_t i = 0; i < manager->idle_shard_count; ++i) {
+        struct aws_idle_connection_shard *shard = &manager->idle_shards[i];
+        aws_mutex_lock(&shard->lock);
+        culled_count += s_expire_idle_connections(manager, shard, now, &work.connections_to_release);
+        aws_mutex_unlock(&shard->lock);
+    }
+
     aws_mutex_lock(&manager->lock);
 
     /* Only if we're not shutting down */
     if (manager->state == AWS_HCMST_READY) {
-        const struct aws_linked_list_node *end = aws_linked_list_end(&manager->idle_connections);
-        struct aws_linked_list_node *current_node = aws_linked_list_begin(&manager->idle_connections);
-        while (current_node != end) {
-            struct aws_linked_list_node *node = current_node;
-            struct aws_idle_connection *current_idle_connection =
-                AWS_CONTAINER_OF(node, struct aws_idle_connection, node);
-            if (current_idle_connection->cull_timestamp > now) {
-                break;
-            }
+        struct aws_linked_list_node *current_node = NULL;
 
+        /* Multiplexed connections aren't kept in cull order, but there are few of them */
+        current_node = aws_linked_list_begin(&manager->multiplexed_connections);
+        while (current_node != aws_linked_list_end(&manager->multiplexed_connections)) {
+            struct aws_multiplexed_connection *multiplexed_connection =
+                AWS_CONTAINER_OF(current_node, struct aws_multiplexed_connection, node);
             current_node = aws_linked_list_next(current_node);
-            aws_linked_list_remove(node);
-            aws_linked_list_push_back(&work.connections_to_release, node);
-            --manager->idle_connection_count;
 
-            AWS_LOGF_DEBUG(
-                AWS_LS_HTTP_CONNECTION_MANAGER,
-                "id=%p: culling idle connection (%p)",
-                (void *)manager,
-                (void *)current_idle_connection->connection);
+            if (multiplexed_connection->lease_count == 0 && multiplexed_connection->cull_timestamp <= now) {
+                AWS_LOGF_DEBUG(
+                    AWS_LS_HTTP_CONNECTION_MANAGER,
+                    "id=%p: culling idle multiplexed connection (%p)",
+                    (void *)manager,
+                    (void *)multiplexed_connection->connection);
+                s_drain_multiplexed_connection(&work, multiplexed_connection);
+                ++culled_count;
+            }
+        }
+
+        /* Give connects another chance, and replace connections that closed since the pool was last topped up */
+        if (manager->min_idle_connections > 0) {
+            manager->is_prewarm_suspended = false;
         }
+
+        /* Culling may have made room for connects that acquisitions are waiting on */
+        s_aws_http_connection_manager_build_transaction(&work);
     }
 
+    uint64_t end_ticks = 0;
+    aws_high_res_clock_get_ticks(&end_ticks);
+    uint64_t duration_ns = end_ticks > start_ticks ? end_ticks - start_ticks : 0;
+
+    struct aws_http_connection_manager_cull_metrics *metrics = &manager->cull_metrics;
+    ++metrics->cull_task_run_count;
+    metrics->cull_task_culled_count += culled_count;
+    metrics->cull_task_max_culled_per_run = aws_max_u64(metrics->cull_task_max_culled_per_run, culled_count);
+    metrics->cull_task_duration_ns += duration_ns;
+    metrics->cull_task_max_duration_ns = aws_max_u64(metrics->cull_task_max_duration_ns, duration_ns);
+
     s_aws_http_connection_manager_get_snapshot(manager, &work.snapshot);
 
     aws_mutex_unlock(&manager->lock);
 
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION_MANAGER,
+        "id=%p: culled %zu idle connections in %" PRIu64 "ns",
+        (void *)manager,
+        culled_count,
+        duration_ns);
+
     s_aws_http_connection_manager_execute_transaction(&work);
 }
 
@@ -1351,3 +2705,99 @@ static void s_cull_task(struct aws_task *task, void *arg, enum aws_task_status s
 
     s_schedule_connection_culling(manager);
 }
+
+void aws_http_connection_manager_get_cull_metrics(
+    struct aws_http_connection_manager *manager,
+    struct aws_http_connection_manager_cull_metrics *out_metrics) {
+
+    AWS_PRECONDITION(manager);
+    AWS_PRECONDITION(out_metrics);
+
+    aws_mutex_lock(&manager->lock);
+    *out_metrics = manager->cull_metrics;
+    aws_mutex_unlock(&manager->lock);
+
+    out_metrics->lazily_culled_count = aws_atomic_load_int(&manager->lazily_culled_connection_count);
+}
+
+static void s_aws_http_connection_manager_on_http2_goaway_received(
+    struct aws_http_connection *http2_connection,
+    uint32_t last_stream_id,
+    uint32_t http2_error_code,
+    void *user_data) {
+
+    struct aws_http_connection_manager *manager = user_data;
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION_MANAGER,
+        "id=%p: GOAWAY received for connection (id=%p), last_stream_id=%" PRIu32 " http2_error_code=%" PRIu32
+        ", draining it",
+        (void *)manager,
+        (void *)http2_connection,
+        last_stream_id,
+        http2_error_code);
+
+    struct aws_connection_management_transaction work;
+    s_aws_connection_management_transaction_init(&work, manager);
+
+    aws_mutex_lock(&manager->lock);
+
+    struct aws_multiplexed_connection *multiplexed_connection =
+        s_find_multiplexed_connection(manager, http2_connection);
+    if (multiplexed_connection != NULL) {
+        s_drain_multiplexed_connection(&work, multiplexed_connection);
+    }
+
+    s_aws_http_connection_manager_build_transaction(&work);
+
+    aws_mutex_unlock(&manager->lock);
+
+    s_aws_http_connection_manager_execute_transaction(&work);
+}
+
+static void s_aws_http_connection_manager_on_http2_remote_settings_change(
+    struct aws_http_connection *http2_connection,
+    const struct aws_http2_setting *settings_array,
+    size_t num_settings,
+    void *user_data) {
+
+    struct aws_http_connection_manager *manager = user_data;
+
+    bool max_leases_changed = false;
+    size_t max_leases = 0;
+    for (size_t i = 0; i < num_settings; ++i) {
+        if (settings_array[i].id == AWS_HTTP2_SETTINGS_MAX_CONCURRENT_STREAMS) {
+            max_leases = aws_min_size(settings_array[i].value, manager->max_streams_per_connection);
+            max_leases_changed = true;
+        }
+    }
+
+    if (!max_leases_changed) {
+        return;
+    }
+
+    AWS_LOGF_DEBUG(
+        AWS_LS_HTTP_CONNECTION_MANAGER,
+        "id=%p: Connection (id=%p) now allows %zu concurrent acquisitions",
+        (void *)manager,
+        (void *)http2_connection,
+        max_leases);
+
+    struct aws_connection_management_transaction work;
+    s_aws_connection_management_transaction_init(&work, manager);
+
+    aws_mutex_lock(&manager->lock);
+
+    struct aws_multiplexed_connection *multiplexed_connection =
+        s_find_multiplexed_connection(manager, http2_connection);
+    if (multiplexed_connection != NULL) {
+        multiplexed_connection->max_leases = max_leases;
+    }
+
+    /* If capacity grew, pending acquisitions may now be satisfied */
+    s_aws_http_connection_manager_build_transaction(&work);
+
+    aws_mutex_unlock(&manager->lock);
+
+    s_aws_http_connection_manager_execute_transaction(&work);
+}
@@ -34,6 +34,8 @@ static void s_process_statistics(
     uint64_t bytes_written = 0;
     uint32_t current_outgoing_stream_id = 0;
     uint32_t current_incoming_stream_id = 0;
+    bool is_http2 = false;
+    bool http2_was_inactive = false;
 
     /*
      * Pull out the data needed to perform the throughput calculation
@@ -64,6 +66,17 @@ static void s_process_statistics(
                 break;
             }
 
+            case AWSCRT_STAT_CAT_HTTP2_CHANNEL: {
+                struct aws_crt_statistics_http2_channel *http2_stats =
+                    (struct aws_crt_statistics_http2_channel *)stats_base;
+                pending_read_interval_ms = http2_stats->pending_incoming_stream_ms;
+                pending_write_interval_ms = http2_stats->pending_outgoing_stream_ms;
+                http2_was_inactive |= http2_stats->was_inactive;
+                is_http2 = true;
+
+                break;
+            }
+
             default:
                 break;
         }
@@ -105,14 +118,18 @@ static void s_process_statistics(
         bytes_per_second);
 
     /*
-     * Check throughput only if at least one stream exists and was observed in that role previously
-     *
-     * ToDo: This logic only makes sense from an h1 perspective.  A similar requirement could be placed on
-     * h2 stats by analyzing/tracking the min and max stream ids (per odd/even) at process timepoints.
+     * For h1, check throughput only if at least one stream exists and was observed in that role previously.
+     * For h2, many streams come and go, so instead check throughput only if the connection had active streams
+     * for the entire interval.
      */
-    bool check_throughput =
-        (current_incoming_stream_id != 0 && current_incoming_stream_id == impl->last_incoming_stream_id) ||
-        (current_outgoing_stream_id != 0 && current_outgoing_stream_id == impl->last_outgoing_stream_id);
+    bool check_throughput = false;
+    if (is_http2) {
+        check_throughput = !http2_was_inactive;
+    } else {
+        check_throughput =
+            (current_incoming_stream_id != 0 && current_incoming_stream_id == impl->last_incoming_stream_id) ||
+            (current_outgoing_stream_id != 0 && current_outgoing_stream_id == impl->last_outgoing_stream_id);
+    }
 
     impl->last_outgoing_stream_id = current_outgoing_stream_id;
     impl->last_incoming_stream_id = current_incoming_stream_id;
@@ -23,6 +23,9 @@ enum {
     DECODER_INITIAL_SCRATCH_SIZE = 256,
 };
 
+/* With a read_buffer_budget, how long a buffer must be underused before its capacity shrinks */
+static const uint64_t s_read_buffer_shrink_interval_ns = AWS_TIMESTAMP_NANOS;
+
 static int s_handler_process_read_message(
     struct aws_channel_handler *handler,
     struct aws_channel_slot *slot,
@@ -241,6 +244,72 @@ static size_t s_calculate_midchannel_desired_connection_window(struct aws_h1_con
     return aws_channel_slot_downstream_read_window(connection->base.channel_slot);
 }
 
+/* Start over measuring how the read-buffer is used, after deciding on its capacity */
+static void s_reset_read_buffer_usage(struct aws_h1_connection *connection, uint64_t now_ns) {
+    connection->thread_data.read_buffer.consumed_bytes = 0;
+    connection->thread_data.read_buffer.is_window_exhausted = false;
+    connection->thread_data.read_buffer.capacity_timestamp_ns = now_ns;
+}
+
+/*
+ * Grow or shrink the read-buffer's capacity, based on how it's been used, and settle up with the budget.
+ * Only called when the connection has a read_buffer_budget.
+ */
+static void s_adapt_read_buffer_capacity(struct aws_h1_connection *connection) {
+    struct aws_http_read_buffer_budget *budget = connection->thread_data.read_buffer.budget;
+    const size_t capacity = connection->thread_data.read_buffer.capacity;
+
+    uint64_t now_ns = connection->thread_data.read_buffer.capacity_timestamp_ns;
+    aws_channel_current_clock_time(connection->base.channel_slot->channel, &now_ns);
+
+    size_t new_capacity = capacity;
+    if (connection->thread_data.read_buffer.is_window_exhausted &&
+        connection->thread_data.read_buffer.consumed_bytes >= capacity) {
+        /* The peer is held back by the window, while the user keeps up with a whole buffer's worth of data.
+         * The buffer is the bottleneck, grow it. */
+        new_capacity = aws_mul_size_saturating(capacity, 2);
+        s_reset_read_buffer_usage(connection, now_ns);
+
+    } else if (now_ns - connection->thread_data.read_buffer.capacity_timestamp_ns >= s_read_buffer_shrink_interval_ns) {
+        if (connection->thread_data.read_buffer.consumed_bytes < capacity / 4) {
+            new_capacity = capacity / 2;
+        }
+        s_reset_read_buffer_usage(connection, now_ns);
+    }
+
+    new_capacity = aws_max_size(connection->thread_data.read_buffer.min_capacity, new_capacity);
+    new_capacity = aws_min_size(connection->thread_data.read_buffer.max_capacity, new_capacity);
+
+    if (new_capacity > connection->thread_data.read_buffer.budget_reserved_bytes) {
+        /* Grow as far as the budget allows */
+        size_t reserved = aws_http_read_buffer_budget_reserve(
+            budget, new_capacity - connection->thread_data.read_buffer.budget_reserved_bytes);
+        connection->thread_data.read_buffer.budget_reserved_bytes += reserved;
+        new_capacity = aws_min_size(new_capacity, connection->thread_data.read_buffer.budget_reserved_bytes);
+    }
+
+    if (new_capacity != capacity) {
+        AWS_LOGF_DEBUG(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Read buffer capacity changing from %zu to %zu.",
+            (void *)&connection->base,
+            capacity,
+            new_capacity);
+        connection->thread_data.read_buffer.capacity = new_capacity;
+    }
+
+    /* Return whatever isn't needed for the capacity, or for data the peer may send into the current window */
+    size_t needed_bytes = aws_add_size_saturating(
+        connection->thread_data.read_buffer.pending_bytes, connection->thread_data.read_buffer.retained_bytes);
+    needed_bytes = aws_add_size_saturating(needed_bytes, connection->thread_data.connection_window);
+    needed_bytes = aws_max_size(needed_bytes, new_capacity);
+    if (connection->thread_data.read_buffer.budget_reserved_bytes > needed_bytes) {
+        aws_http_read_buffer_budget_unreserve(
+            budget, connection->thread_data.read_buffer.budget_reserved_bytes - needed_bytes);
+        connection->thread_data.read_buffer.budget_reserved_bytes = needed_bytes;
+    }
+}
+
 /* Calculate the desired window size for a connection that is processing data for aws_http_streams. */
 static size_t s_calculate_stream_mode_desired_connection_window(struct aws_h1_connection *connection) {
     AWS_ASSERT(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
@@ -250,22 +319,31 @@ static size_t s_calculate_stream_mode_desired_connection_window(struct aws_h1_co
         return SIZE_MAX;
     }
 
-    /* Connection window should match the available space in the read-buffer */
+    if (connection->thread_data.read_buffer.budget) {
+        s_adapt_read_buffer_capacity(connection);
+    }
+
+    /* Connection window should match the available space in the read-buffer.
+     * (unless an adaptive read-buffer just shrank below what's already buffered) */
     AWS_ASSERT(
-        connection->thread_data.read_buffer.pending_bytes <= connection->thread_data.read_buffer.capacity &&
+        (connection->thread_data.read_buffer.pending_bytes <= connection->thread_data.read_buffer.capacity ||
+         connection->thread_data.read_buffer.budget) &&
         "This isn't fatal, but our math is off");
-    const size_t desired_connection_window = aws_sub_size_saturating(
-        connection->thread_data.read_buffer.capacity, connection->thread_data.read_buffer.pending_bytes);
+    size_t buffered_bytes = aws_add_size_saturating(
+        connection->thread_data.read_buffer.pending_bytes, connection->thread_data.read_buffer.retained_bytes);
+    const size_t desired_connection_window =
+        aws_sub_size_saturating(connection->thread_data.read_buffer.capacity, buffered_bytes);
 
     AWS_LOGF_TRACE(
         AWS_LS_HTTP_CONNECTION,
-        "id=%p: Window stats: connection=%zu+%zu stream=%" PRIu64 " buffer=%zu/%zu",
+        "id=%p: Window stats: connection=%zu+%zu stream=%" PRIu64 " buffer=%zu(+%zu retained)/%zu",
         (void *)&connection->base,
         connection->thread_data.connection_window,
         desired_connection_window - connection->thread_data.connection_window /*increment_size*/,
         connection->thread_data.incoming_stream ? connection->thread_data.incoming_stream->thread_data.stream_window
                                                 : 0,
         connection->thread_data.read_buffer.pending_bytes,
+        connection->thread_data.read_buffer.retained_bytes,
         connection->thread_data.read_buffer.capacity);
 
     return desired_connection_window;
@@ -452,6 +530,9 @@ static void s_cross_thread_work_task(struct aws_channel_task *channel_task, void
     aws_linked_list_move_all_back(
         &connection->thread_data.stream_list, &connection->synced_data.new_client_stream_list);
 
+    size_t released_retained_bytes = connection->synced_data.released_retained_bytes;
+    connection->synced_data.released_retained_bytes = 0;
+
     aws_h1_connection_unlock_synced_data(connection);
     /* END CRITICAL SECTION */
 
@@ -459,6 +540,13 @@ static void s_cross_thread_work_task(struct aws_channel_task *channel_task, void
     if (has_new_client_streams) {
         aws_h1_connection_try_write_outgoing_stream(connection);
     }
+
+    /* User let go of body slices, so there's room in the read buffer again */
+    if (released_retained_bytes > 0) {
+        AWS_ASSERT(connection->thread_data.read_buffer.retained_bytes >= released_retained_bytes);
+        connection->thread_data.read_buffer.retained_bytes -= released_retained_bytes;
+        aws_h1_connection_try_process_read_messages(connection);
+    }
 }
 
 static void s_stream_complete(struct aws_h1_stream *stream, int error_code) {
@@ -623,6 +711,7 @@ static struct aws_h1_stream *s_update_outgoing_stream_ptr(struct aws_h1_connecti
     /* If current stream is done sending data... */
     if (current && !aws_h1_encoder_is_message_in_progress(&connection->thread_data.encoder)) {
         current->is_outgoing_message_done = true;
+        connection->thread_data.stats.num_outgoing_streams_done++;
 
         /* RFC-7230 section 6.6: Tear-down.
          * If this was the final stream, don't allows any further streams to be sent */
@@ -773,9 +862,70 @@ void aws_h1_connection_try_write_outgoing_stream(struct aws_h1_connection *conne
     }
 
     connection->thread_data.is_outgoing_stream_task_active = true;
+
+    if (connection->write_coalescing_delay_ns > 0) {
+        /* Wait a bit, in case more data arrives that can be sent in the same message */
+        uint64_t now_ns = 0;
+        if (!aws_channel_current_clock_time(connection->base.channel_slot->channel, &now_ns)) {
+            AWS_LOGF_TRACE(
+                AWS_LS_HTTP_CONNECTION,
+                "id=%p: Outgoing stream task will begin in %" PRIu64 "ns.",
+                (void *)&connection->base,
+                connection->write_coalescing_delay_ns);
+
+            aws_channel_schedule_task_future(
+                connection->base.channel_slot->channel,
+                &connection->outgoing_stream_task,
+                now_ns + connection->write_coalescing_delay_ns);
+            return;
+        }
+        /* If the clock failed, just don't wait */
+    }
+
     s_write_outgoing_stream(connection, true /*first_try*/);
 }
 
+/* Send body data straight from the user's memory, in an aws_io_message whose buffer points at that memory.
+ * The encoder doesn't finish the stream until the task runs again, after this message completes,
+ * so the user can't free the memory while it's still being written. */
+static int s_write_zero_copy_body(struct aws_h1_connection *connection, struct aws_byte_cursor data) {
+    /* Allocated by us, rather than from the channel's message pool, since there's no buffer to allocate.
+     * Whoever finishes with the message releases it with aws_mem_release(msg->allocator, msg) as usual,
+     * and message_data has no allocator, so the user's memory is left alone. */
+    struct aws_io_message *msg = aws_mem_calloc(connection->base.alloc, 1, sizeof(struct aws_io_message));
+    if (!msg) {
+        return AWS_OP_ERR;
+    }
+
+    msg->allocator = connection->base.alloc;
+    msg->message_type = AWS_IO_MESSAGE_APPLICATION_DATA;
+    msg->message_data = aws_byte_buf_from_array(data.ptr, data.len);
+    msg->on_completion = s_on_channel_write_complete;
+    msg->user_data = connection;
+
+    AWS_LOGF_TRACE(
+        AWS_LS_HTTP_CONNECTION,
+        "id=%p: Outgoing stream task is sending %zu bytes of body without copying.",
+        (void *)&connection->base,
+        data.len);
+
+    if (aws_channel_slot_send_message(connection->base.channel_slot, msg, AWS_CHANNEL_DIR_WRITE)) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Failed to send message in write direction, error %d (%s). Closing connection.",
+            (void *)&connection->base,
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+
+        aws_mem_release(msg->allocator, msg);
+        return AWS_OP_ERR;
+    }
+
+    aws_h1_encoder_on_zero_copy_body_sent(&connection->thread_data.encoder, data.len);
+    connection->thread_data.stats.num_outgoing_messages++;
+    return AWS_OP_SUCCESS;
+}
+
 /* Do the actual work of the outgoing-stream-task */
 static void s_write_outgoing_stream(struct aws_h1_connection *connection, bool first_try) {
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
@@ -807,6 +957,15 @@ static void s_write_outgoing_stream(struct aws_h1_connection *connection, bool f
         AWS_LOGF_TRACE(AWS_LS_HTTP_CONNECTION, "id=%p: Outgoing stream task has begun.", (void *)&connection->base);
     }
 
+    /* If the next piece of body is in the user's memory, send it from there instead of copying */
+    struct aws_byte_cursor zero_copy_body;
+    if (aws_h1_encoder_get_zero_copy_body(&connection->thread_data.encoder, &zero_copy_body)) {
+        if (s_write_zero_copy_body(connection, zero_copy_body)) {
+            s_shutdown_due_to_error(connection, aws_last_error());
+        }
+        return;
+    }
+
     struct aws_io_message *msg = aws_channel_slot_acquire_max_message_for_write(connection->base.channel_slot);
     if (!msg) {
         AWS_LOGF_ERROR(
@@ -825,10 +984,29 @@ static void s_write_outgoing_stream(struct aws_h1_connection *connection, bool f
     /*
      * Fill message data from the outgoing stream.
      * Note that we might be resuming work on a stream from a previous run of this task.
+     *
+     * If the stream finishes and there's room left, keep going with the next pipelined stream.
+     * That way a burst of small requests goes out in one message, instead of one message (and syscall) each.
      */
-    if (AWS_OP_SUCCESS != aws_h1_encoder_process(&connection->thread_data.encoder, &msg->message_data)) {
-        /* Error sending data, abandon ship */
-        goto error;
+    while (true) {
+        if (AWS_OP_SUCCESS != aws_h1_encoder_process(&connection->thread_data.encoder, &msg->message_data)) {
+            /* Error sending data, abandon ship */
+            goto error;
+        }
+
+        /* Stop if the stream isn't done. Either the message is full, or the stream is waiting on its body */
+        if (aws_h1_encoder_is_message_in_progress(&connection->thread_data.encoder)) {
+            break;
+        }
+
+        if (msg->message_data.len == msg->message_data.capacity) {
+            break;
+        }
+
+        outgoing_stream = s_update_outgoing_stream_ptr(connection);
+        if (!outgoing_stream || aws_h1_encoder_is_waiting_for_chunks(&connection->thread_data.encoder)) {
+            break;
+        }
     }
 
     if (msg->message_data.len > 0) {
@@ -848,17 +1026,21 @@ static void s_write_outgoing_stream(struct aws_h1_connection *connection, bool f
 
             goto error;
         }
+        connection->thread_data.stats.num_outgoing_messages++;
 
     } else {
         /* If message is empty, warn that no work is being done
          * and reschedule the task to try again next tick.
          * It's likely that body isn't ready, so body streaming function has no data to write yet.
-         * If this scenario turns out to be common we should implement a "pause" feature. */
-        AWS_LOGF_WARN(
-            AWS_LS_HTTP_CONNECTION,
-            "id=%p: Current outgoing stream %p sent no data, will try again next tick.",
-            (void *)&connection->base,
-            outgoing_stream ? (void *)&outgoing_stream->base : NULL);
+         * If this scenario turns out to be common we should implement a "pause" feature.
+         * (It's also empty, harmlessly, when a stream whose body was sent without copying finishes) */
+        if (aws_h1_encoder_is_message_in_progress(&connection->thread_data.encoder)) {
+            AWS_LOGF_WARN(
+                AWS_LS_HTTP_CONNECTION,
+                "id=%p: Current outgoing stream %p sent no data, will try again next tick.",
+                (void *)&connection->base,
+                outgoing_stream ? (void *)&outgoing_stream->base : NULL);
+        }
 
         aws_mem_release(msg->allocator, msg);
 
@@ -1081,6 +1263,121 @@ static int s_mark_head_done(struct aws_h1_stream *incoming_stream) {
     return AWS_OP_SUCCESS;
 }
 
+/**
+ * Keeps an aws_io_message from the read buffer alive while the user holds body slices of it.
+ * The connection holds 1 reference while the message is in the read buffer, and each acquired slice holds 1.
+ */
+struct aws_h1_read_message_owner {
+    struct aws_http_body_slice_owner base;
+    struct aws_allocator *alloc;
+    struct aws_io_message *message;
+
+    /* NULL if the connection was destroyed before it finished processing the message */
+    struct aws_h1_connection *connection;
+
+    /* Non-zero if the connection finished processing the message while the user still held slices of it.
+     * These bytes were added to the connection's retained_bytes, and a hold was acquired on the channel
+     * so the connection can be told when they're released. */
+    size_t retained_bytes;
+};
+
+/* Invoked on whatever thread releases the last reference */
+static void s_read_message_owner_destroy(struct aws_http_body_slice_owner *owner_base) {
+    struct aws_h1_read_message_owner *owner = AWS_CONTAINER_OF(owner_base, struct aws_h1_read_message_owner, base);
+    struct aws_h1_connection *connection = owner->connection;
+    size_t retained_bytes = owner->retained_bytes;
+
+    aws_mem_release(owner->message->allocator, owner->message);
+    aws_mem_release(owner->alloc, owner);
+
+    if (retained_bytes == 0) {
+        return;
+    }
+
+    AWS_ASSERT(connection);
+    bool should_schedule_task = false;
+    { /* BEGIN CRITICAL SECTION */
+        aws_h1_connection_lock_synced_data(connection);
+
+        connection->synced_data.released_retained_bytes += retained_bytes;
+        if (!connection->synced_data.is_cross_thread_work_task_scheduled) {
+            connection->synced_data.is_cross_thread_work_task_scheduled = true;
+            should_schedule_task = true;
+        }
+
+        aws_h1_connection_unlock_synced_data(connection);
+    } /* END CRITICAL SECTION */
+
+    struct aws_channel *channel = connection->base.channel_slot->channel;
+    if (should_schedule_task) {
+        AWS_LOGF_TRACE(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Scheduling connection cross-thread work task.",
+            (void *)&connection->base);
+        aws_channel_schedule_task_now(channel, &connection->cross_thread_work_task);
+    }
+
+    /* The connection may be destroyed once the hold is released */
+    aws_channel_release_hold(channel);
+}
+
+/* Get the owner of the front message in the read buffer, creating it if necessary */
+static struct aws_h1_read_message_owner *s_get_front_message_owner(struct aws_h1_connection *connection) {
+    if (connection->thread_data.read_buffer.front_message_owner) {
+        return connection->thread_data.read_buffer.front_message_owner;
+    }
+
+    struct aws_h1_read_message_owner *owner =
+        aws_mem_calloc(connection->base.alloc, 1, sizeof(struct aws_h1_read_message_owner));
+    if (!owner) {
+        return NULL;
+    }
+
+    struct aws_linked_list_node *front = aws_linked_list_front(&connection->thread_data.read_buffer.messages);
+    owner->base.destroy = s_read_message_owner_destroy;
+    aws_atomic_init_int(&owner->base.refcount, 1);
+    owner->alloc = connection->base.alloc;
+    owner->message = AWS_CONTAINER_OF(front, struct aws_io_message, queueing_handle);
+    owner->connection = connection;
+
+    connection->thread_data.read_buffer.front_message_owner = owner;
+    return owner;
+}
+
+/* Remove the front message from the read buffer, once the connection is done with it.
+ * The message is destroyed, unless the user is still holding slices of it. */
+static void s_pop_front_read_message(struct aws_h1_connection *connection) {
+    struct aws_linked_list_node *front = aws_linked_list_pop_front(&connection->thread_data.read_buffer.messages);
+    struct aws_io_message *message = AWS_CONTAINER_OF(front, struct aws_io_message, queueing_handle);
+
+    struct aws_h1_read_message_owner *owner = connection->thread_data.read_buffer.front_message_owner;
+    if (!owner) {
+        aws_mem_release(message->allocator, message);
+        return;
+    }
+
+    connection->thread_data.read_buffer.front_message_owner = NULL;
+
+    /* If the connection's reference is the only one, nobody else can acquire one now (slices can only be
+     * acquired from inside the callback, or from a slice that's already acquired), so skip the bookkeeping */
+    if (aws_atomic_load_int(&owner->base.refcount) > 1) {
+        owner->retained_bytes = message->message_data.len;
+        connection->thread_data.read_buffer.retained_bytes += owner->retained_bytes;
+        aws_channel_acquire_hold(connection->base.channel_slot->channel);
+
+        AWS_LOGF_TRACE(
+            AWS_LS_HTTP_CONNECTION,
+            "id=%p: Message of size %zu is retained by body slices.",
+            (void *)&connection->base,
+            owner->retained_bytes);
+    }
+
+    size_t prev_refcount = aws_atomic_fetch_sub(&owner->base.refcount, 1);
+    if (prev_refcount == 1) {
+        s_read_message_owner_destroy(&owner->base);
+    }
+}
+
 static int s_decoder_on_body(const struct aws_byte_cursor *data, bool finished, void *user_data) {
     (void)finished;
 
@@ -1121,18 +1418,29 @@ static int s_decoder_on_body(const struct aws_byte_cursor *data, bool finished,
         }
     }
 
-    if (incoming_stream->base.on_incoming_body) {
-        err = incoming_stream->base.on_incoming_body(&incoming_stream->base, data, incoming_stream->base.user_data);
-        if (err) {
-            AWS_LOGF_ERROR(
-                AWS_LS_HTTP_STREAM,
-                "id=%p: Incoming body callback raised error %d (%s).",
-                (void *)&incoming_stream->base,
-                aws_last_error(),
-                aws_error_name(aws_last_error()));
-
+    if (incoming_stream->base.on_incoming_body_slice) {
+        /* Lend the data straight out of the read buffer */
+        struct aws_h1_read_message_owner *owner = s_get_front_message_owner(connection);
+        if (!owner) {
             return AWS_OP_ERR;
         }
+
+        struct aws_http_body_slice slice = {.data = *data, .owner = &owner->base};
+        err = incoming_stream->base.on_incoming_body_slice(
+            &incoming_stream->base, &slice, incoming_stream->base.user_data);
+    } else if (incoming_stream->base.on_incoming_body) {
+        err = incoming_stream->base.on_incoming_body(&incoming_stream->base, data, incoming_stream->base.user_data);
+    }
+
+    if (err) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_STREAM,
+            "id=%p: Incoming body callback raised error %d (%s).",
+            (void *)&incoming_stream->base,
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+
+        return AWS_OP_ERR;
     }
 
     return AWS_OP_SUCCESS;
@@ -1234,6 +1542,8 @@ static struct aws_h1_connection *s_connection_new(
     /* 1 refcount for user */
     aws_atomic_init_int(&connection->base.refcount, 1);
 
+    connection->write_coalescing_delay_ns = http1_options->write_coalescing_delay_ns;
+
     if (manual_window_management) {
         connection->initial_stream_window_size = initial_window_size;
 
@@ -1248,6 +1558,21 @@ static struct aws_h1_connection *s_connection_new(
                 aws_max_size(clamp_min, aws_min_size(clamp_max, initial_window_size));
         }
 
+        if (http1_options->read_buffer_budget) {
+            /* Capacity adapts to usage, starting from the minimum, which is always reserved */
+            connection->thread_data.read_buffer.budget =
+                aws_http_read_buffer_budget_acquire(http1_options->read_buffer_budget);
+            connection->thread_data.read_buffer.max_capacity = connection->thread_data.read_buffer.capacity;
+            connection->thread_data.read_buffer.min_capacity = aws_min_size(
+                connection->thread_data.read_buffer.max_capacity,
+                http1_options->read_buffer_min_capacity > 0 ? http1_options->read_buffer_min_capacity
+                                                            : g_aws_channel_max_fragment_size);
+            connection->thread_data.read_buffer.capacity = connection->thread_data.read_buffer.min_capacity;
+            connection->thread_data.read_buffer.budget_reserved_bytes = connection->thread_data.read_buffer.capacity;
+            aws_http_read_buffer_budget_force_reserve(
+                connection->thread_data.read_buffer.budget, connection->thread_data.read_buffer.budget_reserved_bytes);
+        }
+
         connection->thread_data.connection_window = connection->thread_data.read_buffer.capacity;
     } else {
         /* No backpressure, keep connection window at SIZE_MAX */
@@ -1306,6 +1631,11 @@ static struct aws_h1_connection *s_connection_new(
 error_decoder:
     aws_mutex_clean_up(&connection->synced_data.lock);
 error_mutex:
+    if (connection->thread_data.read_buffer.budget) {
+        aws_http_read_buffer_budget_unreserve(
+            connection->thread_data.read_buffer.budget, connection->thread_data.read_buffer.budget_reserved_bytes);
+        aws_http_read_buffer_budget_release(connection->thread_data.read_buffer.budget);
+    }
     aws_mem_release(alloc, connection);
 error_connection_alloc:
     return NULL;
@@ -1353,6 +1683,17 @@ static void s_handler_destroy(struct aws_channel_handler *handler) {
     AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.stream_list));
     AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.new_client_stream_list));
 
+    /* Body slices of a partially processed message may outlive the connection.
+     * Detach, so the last slice released just destroys the message. */
+    struct aws_h1_read_message_owner *front_message_owner = connection->thread_data.read_buffer.front_message_owner;
+    if (front_message_owner) {
+        aws_linked_list_pop_front(&connection->thread_data.read_buffer.messages);
+        front_message_owner->connection = NULL;
+        if (aws_atomic_fetch_sub(&front_message_owner->base.refcount, 1) == 1) {
+            s_read_message_owner_destroy(&front_message_owner->base);
+        }
+    }
+
     /* Clean up any buffered read messages. */
     while (!aws_linked_list_empty(&connection->thread_data.read_buffer.messages)) {
         struct aws_linked_list_node *node = aws_linked_list_pop_front(&connection->thread_data.read_buffer.messages);
@@ -1360,6 +1701,12 @@ static void s_handler_destroy(struct aws_channel_handler *handler) {
         aws_mem_release(msg->allocator, msg);
     }
 
+    if (connection->thread_data.read_buffer.budget) {
+        aws_http_read_buffer_budget_unreserve(
+            connection->thread_data.read_buffer.budget, connection->thread_data.read_buffer.budget_reserved_bytes);
+        aws_http_read_buffer_budget_release(connection->thread_data.read_buffer.budget);
+    }
+
     aws_h1_decoder_destroy(connection->thread_data.incoming_stream_decoder);
     aws_h1_encoder_clean_up(&connection->thread_data.encoder);
     aws_mutex_clean_up(&connection->synced_data.lock);
@@ -1438,11 +1785,12 @@ static int s_try_process_next_midchannel_read_message(struct aws_h1_connection *
 
         /* If the last of queued_msg has been copied, it can be deleted now. */
         if (queued_msg->copy_mark == queued_msg->message_data.len) {
-            aws_linked_list_remove(queued_msg_node);
-            aws_mem_release(queued_msg->allocator, queued_msg);
+            s_pop_front_read_message(connection);
         }
     } else {
-        /* Sending all of queued_msg along. */
+        /* Sending all of queued_msg along.
+         * No body slices can have been lent from it, since none of it was processed as HTTP data. */
+        AWS_ASSERT(!connection->thread_data.read_buffer.front_message_owner);
         AWS_LOGF_TRACE(
             AWS_LS_HTTP_CONNECTION,
             "id=%p: Sending full switched-protocol message of size %zu to downstream handler.",
@@ -1568,6 +1916,9 @@ static int s_handler_process_read_message(
         return aws_raise_error(AWS_ERROR_INVALID_STATE);
     }
     connection->thread_data.connection_window -= message_size;
+    if (connection->thread_data.connection_window == 0) {
+        connection->thread_data.read_buffer.is_window_exhausted = true;
+    }
 
     /* Push message into queue of buffered messages */
     aws_linked_list_push_back(&connection->thread_data.read_buffer.messages, &message->queueing_handle);
@@ -1631,17 +1982,8 @@ shutdown:
     s_shutdown_due_to_error(connection, aws_last_error());
 }
 
-/* Try to process the next queued aws_io_message as normal HTTP data for an aws_http_stream.
- * This MUST NOT be called if the connection has switched protocols and become a midchannel handler. */
-static int s_try_process_next_stream_read_message(struct aws_h1_connection *connection, bool *out_stop_processing) {
-    AWS_ASSERT(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
-    AWS_ASSERT(!connection->thread_data.has_switched_protocols);
-    AWS_ASSERT(!connection->thread_data.is_reading_stopped);
-    AWS_ASSERT(!aws_linked_list_empty(&connection->thread_data.read_buffer.messages));
-
-    *out_stop_processing = false;
-
-    /* Ensure that an incoming stream exists to receive the data */
+/* Ensure that an incoming stream exists to receive the data, and set up the decoder for it */
+static int s_begin_decoding_incoming_stream(struct aws_h1_connection *connection) {
     if (!connection->thread_data.incoming_stream) {
         if (aws_http_connection_is_client(&connection->base)) {
             /* Client side */
@@ -1674,73 +2016,124 @@ static int s_try_process_next_stream_read_message(struct aws_h1_connection *conn
 
     struct aws_h1_stream *incoming_stream = connection->thread_data.incoming_stream;
 
-    /* Stop processing if stream's window reaches 0. */
-    const uint64_t stream_window = incoming_stream->thread_data.stream_window;
-    if (stream_window == 0) {
-        AWS_LOGF_TRACE(
-            AWS_LS_HTTP_CONNECTION,
-            "id=%p: HTTP-stream's window is 0, cannot process message now.",
-            (void *)&connection->base);
-        *out_stop_processing = true;
-        return AWS_OP_SUCCESS;
-    }
+    /* Set some decoder state, based on current stream */
+    aws_h1_decoder_set_logging_id(connection->thread_data.incoming_stream_decoder, incoming_stream);
 
-    struct aws_linked_list_node *queued_msg_node = aws_linked_list_front(&connection->thread_data.read_buffer.messages);
-    struct aws_io_message *queued_msg = AWS_CONTAINER_OF(queued_msg_node, struct aws_io_message, queueing_handle);
+    bool body_headers_ignored = incoming_stream->base.request_method == AWS_HTTP_METHOD_HEAD;
+    aws_h1_decoder_set_body_headers_ignored(connection->thread_data.incoming_stream_decoder, body_headers_ignored);
 
-    /* Note that copy_mark is used to mark the progress of partially decoded messages */
-    struct aws_byte_cursor message_cursor = aws_byte_cursor_from_buf(&queued_msg->message_data);
-    aws_byte_cursor_advance(&message_cursor, queued_msg->copy_mark);
+    return AWS_OP_SUCCESS;
+}
 
-    /* Don't process more data than the stream's window can accept.
-     *
-     * TODO: Let the decoder know about stream-window size so it can stop itself,
-     * instead of limiting the amount of data we feed into the decoder at a time.
-     * This would be more optimal, AND avoid an edge-case where the stream-window goes
-     * to 0 as the body ends, and the connection can't proceed to the trailing headers.
-     */
-    message_cursor.len = (size_t)aws_min_u64(message_cursor.len, stream_window);
+/* Try to process queued aws_io_messages as normal HTTP data for aws_http_streams.
+ * This MUST NOT be called if the connection has switched protocols and become a midchannel handler. */
+static int s_try_process_next_stream_read_message(struct aws_h1_connection *connection, bool *out_stop_processing) {
+    AWS_ASSERT(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
+    AWS_ASSERT(!connection->thread_data.has_switched_protocols);
+    AWS_ASSERT(!connection->thread_data.is_reading_stopped);
+    AWS_ASSERT(!aws_linked_list_empty(&connection->thread_data.read_buffer.messages));
 
-    const size_t prev_cursor_len = message_cursor.len;
+    *out_stop_processing = false;
 
-    /* Set some decoder state, based on current stream */
-    aws_h1_decoder_set_logging_id(connection->thread_data.incoming_stream_decoder, incoming_stream);
+    /* Decode as many queued messages as we can in one pass.
+     * When a request/response ends and the next pipelined stream takes over, we carry on with that stream.
+     * We only go back to the caller when something stops us, or a callback switches protocols or stops reading. */
+    struct aws_h1_stream *incoming_stream = NULL;
+    size_t batch_bytes_processed = 0;
+    size_t batch_messages_processed = 0;
+    size_t batch_streams_processed = 0;
+    while (!aws_linked_list_empty(&connection->thread_data.read_buffer.messages)) {
+        if (!incoming_stream || connection->thread_data.incoming_stream != incoming_stream) {
+            if (s_begin_decoding_incoming_stream(connection)) {
+                return AWS_OP_ERR;
+            }
+            incoming_stream = connection->thread_data.incoming_stream;
+            ++batch_streams_processed;
+        }
 
-    bool body_headers_ignored = incoming_stream->base.request_method == AWS_HTTP_METHOD_HEAD;
-    aws_h1_decoder_set_body_headers_ignored(connection->thread_data.incoming_stream_decoder, body_headers_ignored);
+        /* Stop processing if stream's window reaches 0. */
+        const uint64_t stream_window = incoming_stream->thread_data.stream_window;
+        if (stream_window == 0) {
+            AWS_LOGF_TRACE(
+                AWS_LS_HTTP_CONNECTION,
+                "id=%p: HTTP-stream's window is 0, cannot process message now.",
+                (void *)&connection->base);
+            *out_stop_processing = true;
+            break;
+        }
 
-    /* As decoder runs, it invokes the internal s_decoder_X callbacks, which in turn invoke user callbacks.
-     * The decoder will stop once it hits the end of the request/response OR the end of the message data. */
-    if (aws_h1_decode(connection->thread_data.incoming_stream_decoder, &message_cursor)) {
-        AWS_LOGF_ERROR(
-            AWS_LS_HTTP_CONNECTION,
-            "id=%p: Message processing failed, error %d (%s). Closing connection.",
-            (void *)&connection->base,
-            aws_last_error(),
-            aws_error_name(aws_last_error()));
+        struct aws_linked_list_node *queued_msg_node =
+            aws_linked_list_front(&connection->thread_data.read_buffer.messages);
+        struct aws_io_message *queued_msg = AWS_CONTAINER_OF(queued_msg_node, struct aws_io_message, queueing_handle);
 
-        return AWS_OP_ERR;
+        /* Note that copy_mark is used to mark the progress of partially decoded messages */
+        struct aws_byte_cursor message_cursor = aws_byte_cursor_from_buf(&queued_msg->message_data);
+        aws_byte_cursor_advance(&message_cursor, queued_msg->copy_mark);
+
+        /* Don't process more data than the stream's window can accept.
+         *
+         * TODO: Let the decoder know about stream-window size so it can stop itself,
+         * instead of limiting the amount of data we feed into the decoder at a time.
+         * This would be more optimal, AND avoid an edge-case where the stream-window goes
+         * to 0 as the body ends, and the connection can't proceed to the trailing headers.
+         */
+        message_cursor.len = (size_t)aws_min_u64(message_cursor.len, stream_window);
+
+        const size_t prev_cursor_len = message_cursor.len;
+
+        /* As decoder runs, it invokes the internal s_decoder_X callbacks, which in turn invoke user callbacks.
+         * The decoder will stop once it hits the end of the request/response OR the end of the message data. */
+        if (aws_h1_decode(connection->thread_data.incoming_stream_decoder, &message_cursor)) {
+            AWS_LOGF_ERROR(
+                AWS_LS_HTTP_CONNECTION,
+                "id=%p: Message processing failed, error %d (%s). Closing connection.",
+                (void *)&connection->base,
+                aws_last_error(),
+                aws_error_name(aws_last_error()));
+
+            return AWS_OP_ERR;
+        }
+
+        size_t bytes_processed = prev_cursor_len - message_cursor.len;
+        queued_msg->copy_mark += bytes_processed;
+        batch_bytes_processed += bytes_processed;
+
+        AWS_ASSERT(connection->thread_data.read_buffer.pending_bytes >= bytes_processed);
+        connection->thread_data.read_buffer.pending_bytes -= bytes_processed;
+
+        /* If the last of queued_msg has been processed, it can be deleted now.
+         * Otherwise, it remains in the queue for further processing later. */
+        bool is_msg_done = queued_msg->copy_mark == queued_msg->message_data.len;
+        if (is_msg_done) {
+            s_pop_front_read_message(connection);
+            ++batch_messages_processed;
+        }
+
+        /* Let the caller deal with whatever a callback may have changed */
+        if (connection->thread_data.has_switched_protocols || connection->thread_data.is_reading_stopped) {
+            break;
+        }
+
+        /* Decoder stopped early without moving on to the next stream (ex: it hit the end of the stream's window) */
+        if (!is_msg_done && connection->thread_data.incoming_stream == incoming_stream) {
+            break;
+        }
     }
 
-    size_t bytes_processed = prev_cursor_len - message_cursor.len;
-    queued_msg->copy_mark += bytes_processed;
+    connection->thread_data.read_buffer.consumed_bytes =
+        aws_add_size_saturating(connection->thread_data.read_buffer.consumed_bytes, batch_bytes_processed);
 
-    AWS_ASSERT(connection->thread_data.read_buffer.pending_bytes >= bytes_processed);
-    connection->thread_data.read_buffer.pending_bytes -= bytes_processed;
+    connection->thread_data.recent_max_streams_per_batch =
+        aws_max_size(connection->thread_data.recent_max_streams_per_batch, batch_streams_processed);
 
     AWS_LOGF_TRACE(
         AWS_LS_HTTP_CONNECTION,
-        "id=%p: Decoded %zu bytes of message, %zu bytes remain.",
+        "id=%p: Decoded %zu bytes across %zu streams, finishing %zu messages, %zu bytes remain.",
         (void *)&connection->base,
-        bytes_processed,
-        queued_msg->message_data.len - queued_msg->copy_mark);
-
-    /* If the last of queued_msg has been processed, it can be deleted now.
-     * Otherwise, it remains in the queue for further processing later. */
-    if (queued_msg->copy_mark == queued_msg->message_data.len) {
-        aws_linked_list_remove(&queued_msg->queueing_handle);
-        aws_mem_release(queued_msg->allocator, queued_msg);
-    }
+        batch_bytes_processed,
+        batch_streams_processed,
+        batch_messages_processed,
+        connection->thread_data.read_buffer.pending_bytes);
 
     return AWS_OP_SUCCESS;
 }
@@ -1937,7 +2330,9 @@ struct aws_h1_window_stats aws_h1_connection_window_stats(struct aws_http_connec
         .connection_window = connection->thread_data.connection_window,
         .buffer_capacity = connection->thread_data.read_buffer.capacity,
         .buffer_pending_bytes = connection->thread_data.read_buffer.pending_bytes,
+        .buffer_retained_bytes = connection->thread_data.read_buffer.retained_bytes,
         .recent_window_increments = connection->thread_data.recent_window_increments,
+        .recent_max_streams_per_batch = connection->thread_data.recent_max_streams_per_batch,
         .has_incoming_stream = connection->thread_data.incoming_stream != NULL,
         .stream_window = connection->thread_data.incoming_stream
                              ? connection->thread_data.incoming_stream->thread_data.stream_window
@@ -1946,6 +2341,7 @@ struct aws_h1_window_stats aws_h1_connection_window_stats(struct aws_http_connec
 
     /* Resets each time it's queried */
     connection->thread_data.recent_window_increments = 0;
+    connection->thread_data.recent_max_streams_per_batch = 0;
 
     return stats;
 }
@@ -415,25 +415,26 @@ static int s_linestate_header(struct aws_h1_decoder *decoder, struct aws_byte_cu
 
     /* Each header field consists of a case-insensitive field name followed by a colon (":"),
      * optional leading whitespace, the field value, and optional trailing whitespace.
-     * RFC-7230 3.2 */
-    struct aws_byte_cursor splits[2];
-    err = s_cursor_split_first_n_times(input, ':', splits, 2); /* value may contain more colons */
-    if (err) {
-        AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Invalid incoming header, missing colon.", decoder->logging_id);
-        AWS_LOGF_DEBUG(
-            AWS_LS_HTTP_STREAM, "id=%p: Bad header is: '" PRInSTR "'", decoder->logging_id, AWS_BYTE_CURSOR_PRI(input));
-        return aws_raise_error(AWS_ERROR_HTTP_PROTOCOL_ERROR);
-    }
-
-    struct aws_byte_cursor name = splits[0];
-    if (name.len == 0 || !aws_strutil_is_http_token(name)) {
-        AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Invalid incoming header, bad name.", decoder->logging_id);
+     * RFC-7230 3.2
+     *
+     * The name must be a token, and a colon can't appear in a token, so a single pass over the name
+     * both validates it and finds the colon. The value is never walked, only its ends are trimmed. */
+    struct aws_byte_cursor input_remainder = input;
+    const size_t name_len = aws_strutil_http_token_span(input);
+    if (AWS_UNLIKELY(name_len == 0 || name_len == input.len || input.ptr[name_len] != ':')) {
+        if (memchr(input.ptr, ':', input.len) == NULL) {
+            AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Invalid incoming header, missing colon.", decoder->logging_id);
+        } else {
+            AWS_LOGF_ERROR(AWS_LS_HTTP_STREAM, "id=%p: Invalid incoming header, bad name.", decoder->logging_id);
+        }
         AWS_LOGF_DEBUG(
             AWS_LS_HTTP_STREAM, "id=%p: Bad header is: '" PRInSTR "'", decoder->logging_id, AWS_BYTE_CURSOR_PRI(input));
         return aws_raise_error(AWS_ERROR_HTTP_PROTOCOL_ERROR);
     }
 
-    struct aws_byte_cursor value = aws_strutil_trim_http_whitespace(splits[1]);
+    struct aws_byte_cursor name = aws_byte_cursor_advance(&input_remainder, name_len);
+    aws_byte_cursor_advance(&input_remainder, 1); /* skip colon */
+    struct aws_byte_cursor value = aws_strutil_trim_http_whitespace(input_remainder);
 
     struct aws_h1_decoded_header header;
     header.name = aws_http_str_to_header_name(name);
@@ -778,6 +778,48 @@ bool aws_h1_encoder_is_message_in_progress(const struct aws_h1_encoder *encoder)
     return encoder->message;
 }
 
+bool aws_h1_encoder_get_zero_copy_body(struct aws_h1_encoder *encoder, struct aws_byte_cursor *out_data) {
+    AWS_ZERO_STRUCT(*out_data);
+
+    if (!encoder->message || encoder->state != AWS_H1_ENCODER_STATE_UNCHUNKED_BODY) {
+        return false;
+    }
+
+    struct aws_byte_cursor data;
+    if (!aws_http_body_stream_peek_memory_slice(encoder->message->body, &data)) {
+        return false;
+    }
+
+    /* Never send past the declared length. If the stream has more, the next normal read reports the error. */
+    const uint64_t remaining_length = encoder->message->content_length - encoder->progress_bytes;
+    data.len = (size_t)aws_min_u64(data.len, remaining_length);
+    data.len = aws_min_size(data.len, AWS_H1_ENCODER_ZERO_COPY_MAX_SIZE);
+    if (data.len < AWS_H1_ENCODER_ZERO_COPY_MIN_SIZE) {
+        return false;
+    }
+
+    *out_data = data;
+    return true;
+}
+
+void aws_h1_encoder_on_zero_copy_body_sent(struct aws_h1_encoder *encoder, size_t len) {
+    AWS_PRECONDITION(encoder->state == AWS_H1_ENCODER_STATE_UNCHUNKED_BODY);
+
+    aws_http_body_stream_skip_memory_slice(encoder->message->body, len);
+    encoder->progress_bytes += len;
+
+    ENCODER_LOGF(
+        TRACE,
+        encoder,
+        "Sent %zu bytes of body without copying, progress: %" PRIu64 "/%" PRIu64,
+        len,
+        encoder->progress_bytes,
+        encoder->message->content_length);
+
+    /* Remain in this state. The next call to process() notices that the body is done.
+     * This way the stream isn't considered done sending until the last of its memory has been written. */
+}
+
 bool aws_h1_encoder_is_waiting_for_chunks(const struct aws_h1_encoder *encoder) {
     return encoder->state == AWS_H1_ENCODER_STATE_CHUNK_NEXT &&
            aws_linked_list_empty(encoder->message->pending_chunk_list);
@@ -0,0 +1,79 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h1_connection.h>
+
+#include <aws/common/atomics.h>
+#include <aws/common/math.h>
+
+/* Connections on any thread reserve from the budget, so it's all atomics */
+struct aws_http_read_buffer_budget {
+    struct aws_allocator *alloc;
+    struct aws_atomic_var refcount;
+    struct aws_atomic_var reserved_bytes;
+    size_t max_bytes;
+};
+
+struct aws_http_read_buffer_budget *aws_http_read_buffer_budget_new(struct aws_allocator *allocator, size_t max_bytes) {
+    struct aws_http_read_buffer_budget *budget =
+        aws_mem_calloc(allocator, 1, sizeof(struct aws_http_read_buffer_budget));
+    if (!budget) {
+        return NULL;
+    }
+
+    budget->alloc = allocator;
+    budget->max_bytes = max_bytes;
+    aws_atomic_init_int(&budget->refcount, 1);
+    aws_atomic_init_int(&budget->reserved_bytes, 0);
+    return budget;
+}
+
+struct aws_http_read_buffer_budget *aws_http_read_buffer_budget_acquire(struct aws_http_read_buffer_budget *budget) {
+    if (budget) {
+        aws_atomic_fetch_add(&budget->refcount, 1);
+    }
+    return budget;
+}
+
+void aws_http_read_buffer_budget_release(struct aws_http_read_buffer_budget *budget) {
+    if (!budget) {
+        return;
+    }
+
+    size_t prev_refcount = aws_atomic_fetch_sub(&budget->refcount, 1);
+    AWS_ASSERT(prev_refcount != 0);
+    if (prev_refcount == 1) {
+        AWS_ASSERT(aws_atomic_load_int(&budget->reserved_bytes) == 0 && "Every connection should have unreserved");
+        aws_mem_release(budget->alloc, budget);
+    }
+}
+
+size_t aws_http_read_buffer_budget_get_reserved_bytes(const struct aws_http_read_buffer_budget *budget) {
+    return aws_atomic_load_int((struct aws_atomic_var *)&budget->reserved_bytes);
+}
+
+size_t aws_http_read_buffer_budget_reserve(struct aws_http_read_buffer_budget *budget, size_t num_bytes) {
+    size_t reserved = aws_atomic_load_int(&budget->reserved_bytes);
+    while (true) {
+        size_t granted = aws_min_size(num_bytes, aws_sub_size_saturating(budget->max_bytes, reserved));
+        if (granted == 0) {
+            return 0;
+        }
+
+        /* On failure, `reserved` is updated to the current value and we try again */
+        if (aws_atomic_compare_exchange_int(&budget->reserved_bytes, &reserved, reserved + granted)) {
+            return granted;
+        }
+    }
+}
+
+void aws_http_read_buffer_budget_force_reserve(struct aws_http_read_buffer_budget *budget, size_t num_bytes) {
+    aws_atomic_fetch_add(&budget->reserved_bytes, num_bytes);
+}
+
+void aws_http_read_buffer_budget_unreserve(struct aws_http_read_buffer_budget *budget, size_t num_bytes) {
+    size_t prev_reserved = aws_atomic_fetch_sub(&budget->reserved_bytes, num_bytes);
+    AWS_FATAL_ASSERT(prev_reserved >= num_bytes);
+}
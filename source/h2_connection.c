@@ -4,6 +4,7 @@
  */
 
 #include <aws/http/private/h2_connection.h>
+#include <aws/http/private/h2_data_scheduler.h>
 #include <aws/http/private/h2_stream.h>
 
 #include <aws/http/private/h2_decoder.h>
@@ -46,10 +47,15 @@ static int s_handler_shutdown(
 static size_t s_handler_initial_window_size(struct aws_channel_handler *handler);
 static size_t s_handler_message_overhead(struct aws_channel_handler *handler);
 static void s_handler_destroy(struct aws_channel_handler *handler);
+static void s_reset_statistics(struct aws_channel_handler *handler);
+static void s_gather_statistics(struct aws_channel_handler *handler, struct aws_array_list *stats);
 static void s_handler_installed(struct aws_channel_handler *handler, struct aws_channel_slot *slot);
 static struct aws_http_stream *s_connection_make_request(
     struct aws_http_connection *client_connection,
     const struct aws_http_make_request_options *options);
+static struct aws_http_stream *s_connection_new_server_request_handler_stream(
+    const struct aws_http_request_handler_options *options);
+static int s_connection_stream_send_response(struct aws_http_stream *stream, struct aws_http_message *response);
 static void s_connection_close(struct aws_http_connection *connection_base);
 static bool s_connection_is_open(const struct aws_http_connection *connection_base);
 static bool s_connection_new_requests_allowed(const struct aws_http_connection *connection_base);
@@ -108,6 +114,7 @@ static struct aws_h2_pending_settings *s_new_pending_settings(
     aws_http2_on_change_settings_complete_fn *on_completed,
     void *user_data);
 
+static struct aws_h2err s_decoder_on_frame_prefix(enum aws_h2_frame_type type, uint32_t payload_len, void *userdata);
 static struct aws_h2err s_decoder_on_headers_begin(uint32_t stream_id, void *userdata);
 static struct aws_h2err s_decoder_on_headers_i(
     uint32_t stream_id,
@@ -153,12 +160,14 @@ static struct aws_http_connection_vtable s_h2_connection_vtable = {
             .initial_window_size = s_handler_initial_window_size,
             .message_overhead = s_handler_message_overhead,
             .destroy = s_handler_destroy,
+            .reset_statistics = s_reset_statistics,
+            .gather_statistics = s_gather_statistics,
         },
 
     .on_channel_handler_installed = s_handler_installed,
     .make_request = s_connection_make_request,
-    .new_server_request_handler_stream = NULL,
-    .stream_send_response = NULL,
+    .new_server_request_handler_stream = s_connection_new_server_request_handler_stream,
+    .stream_send_response = s_connection_stream_send_response,
     .close = s_connection_close,
     .is_open = s_connection_is_open,
     .new_requests_allowed = s_connection_new_requests_allowed,
@@ -173,6 +182,7 @@ static struct aws_http_connection_vtable s_h2_connection_vtable = {
 };
 
 static const struct aws_h2_decoder_vtable s_h2_decoder_vtable = {
+    .on_frame_prefix = s_decoder_on_frame_prefix,
     .on_headers_begin = s_decoder_on_headers_begin,
     .on_headers_i = s_decoder_on_headers_i,
     .on_headers_end = s_decoder_on_headers_end,
@@ -201,20 +211,48 @@ static void s_unlock_synced_data(struct aws_h2_connection *connection) {
     (void)err;
 }
 
-static void s_acquire_stream_and_connection_lock(struct aws_h2_stream *stream, struct aws_h2_connection *connection) {
+static void s_lock_stream_synced_data(struct aws_h2_stream *stream) {
     int err = aws_mutex_lock(&stream->synced_data.lock);
-    err |= aws_mutex_lock(&connection->synced_data.lock);
-    AWS_ASSERT(!err && "lock connection and stream failed");
+    AWS_ASSERT(!err && "lock stream failed");
     (void)err;
 }
 
-static void s_release_stream_and_connection_lock(struct aws_h2_stream *stream, struct aws_h2_connection *connection) {
-    int err = aws_mutex_unlock(&connection->synced_data.lock);
-    err |= aws_mutex_unlock(&stream->synced_data.lock);
-    AWS_ASSERT(!err && "unlock connection and stream failed");
+static void s_unlock_stream_synced_data(struct aws_h2_stream *stream) {
+    int err = aws_mutex_unlock(&stream->synced_data.lock);
+    AWS_ASSERT(!err && "unlock stream failed");
     (void)err;
 }
 
+/* Schedule the cross-thread work task, unless it's already scheduled. Any thread may call this. */
+static void s_try_schedule_cross_thread_work_task(struct aws_h2_connection *connection) {
+    if (aws_atomic_exchange_int(&connection->synced_data.is_cross_thread_work_task_scheduled, true)) {
+        return;
+    }
+
+    CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
+    aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
+}
+
+/* Push onto one of the lock-free queues that the cross-thread work task drains,
+ * scheduling the task if the queue was empty. Any thread may call this.
+ * Fails if the queue has been sealed because the connection is shut down. */
+static int s_push_cross_thread_work(
+    struct aws_h2_connection *connection,
+    struct aws_mpsc_queue *queue,
+    struct aws_linked_list_node *node) {
+
+    bool was_empty = false;
+    if (aws_mpsc_queue_push(queue, node, &was_empty)) {
+        return AWS_OP_ERR;
+    }
+
+    /* If the queue already had something in it, whoever pushed that has made sure the task will run */
+    if (was_empty) {
+        s_try_schedule_cross_thread_work_task(connection);
+    }
+    return AWS_OP_SUCCESS;
+}
+
 /**
  * Internal function for bringing connection to a stop.
  * Invoked multiple times, including when:
@@ -246,8 +284,8 @@ static void s_stop(
      * we don't consider the connection "open" anymore so user can't create more streams */
     { /* BEGIN CRITICAL SECTION */
         s_lock_synced_data(connection);
-        connection->synced_data.new_stream_error_code = AWS_ERROR_HTTP_CONNECTION_CLOSED;
-        connection->synced_data.is_open = false;
+        aws_atomic_store_int(&connection->synced_data.new_stream_error_code, AWS_ERROR_HTTP_CONNECTION_CLOSED);
+        aws_atomic_store_int(&connection->synced_data.is_open, false);
         s_unlock_synced_data(connection);
     } /* END CRITICAL SECTION */
 
@@ -296,7 +334,8 @@ static struct aws_h2_connection *s_connection_new(
     connection->base.channel_handler.impl = connection;
     connection->base.http_version = AWS_HTTP_VERSION_2;
     /* Init the next stream id (server must use even ids, client odd [RFC 7540 5.1.1])*/
-    connection->base.next_stream_id = (server ? 2 : 1);
+    aws_atomic_init_int(&connection->synced_data.next_stream_id, server ? 2 : 1);
+    connection->thread_data.next_stream_id_to_activate = server ? 2 : 1;
     connection->base.manual_window_management = manual_window_management;
 
     connection->on_goaway_received = http2_options->on_goaway_received;
@@ -314,13 +353,15 @@ static struct aws_h2_connection *s_connection_new(
     connection->synced_data.goaway_sent_last_stream_id = max_stream_id + 1;
     connection->synced_data.goaway_received_last_stream_id = max_stream_id + 1;
 
-    aws_linked_list_init(&connection->synced_data.pending_stream_list);
-    aws_linked_list_init(&connection->synced_data.pending_frame_list);
-    aws_linked_list_init(&connection->synced_data.pending_settings_list);
+    aws_mpsc_queue_init(&connection->synced_data.pending_stream_queue);
+    aws_mpsc_queue_init(&connection->synced_data.pending_frame_queue);
+    aws_mpsc_queue_init(&connection->synced_data.pending_settings_queue);
     aws_linked_list_init(&connection->synced_data.pending_ping_list);
     aws_linked_list_init(&connection->synced_data.pending_goaway_list);
+    aws_atomic_init_int(&connection->synced_data.is_cross_thread_work_task_scheduled, false);
+
+    aws_linked_list_init(&connection->thread_data.out_of_order_stream_list);
 
-    aws_linked_list_init(&connection->thread_data.outgoing_streams_list);
     aws_linked_list_init(&connection->thread_data.pending_settings_queue);
     aws_linked_list_init(&connection->thread_data.pending_ping_queue);
     aws_linked_list_init(&connection->thread_data.stalled_window_streams_list);
@@ -332,6 +373,17 @@ static struct aws_h2_connection *s_connection_new(
         goto error;
     }
 
+    connection->thread_data.data_scheduler = aws_h2_data_scheduler_new(alloc, http2_options->data_scheduler);
+    if (!connection->thread_data.data_scheduler) {
+        CONNECTION_LOGF(
+            ERROR,
+            connection,
+            "DATA scheduler init error %d (%s).",
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+        goto error;
+    }
+
     if (aws_hash_table_init(
             &connection->thread_data.active_streams_map, alloc, 8, aws_hash_ptr, aws_ptr_eq, NULL, NULL)) {
 
@@ -361,8 +413,8 @@ static struct aws_h2_connection *s_connection_new(
     connection->thread_data.goaway_received_last_stream_id = AWS_H2_STREAM_ID_MAX;
     connection->thread_data.goaway_sent_last_stream_id = AWS_H2_STREAM_ID_MAX;
 
-    connection->synced_data.is_open = true;
-    connection->synced_data.new_stream_error_code = AWS_ERROR_SUCCESS;
+    aws_atomic_init_int(&connection->synced_data.is_open, true);
+    aws_atomic_init_int(&connection->synced_data.new_stream_error_code, AWS_ERROR_SUCCESS);
 
     /* Create a new decoder */
     struct aws_h2_decoder_params params = {
@@ -384,6 +436,19 @@ static struct aws_h2_connection *s_connection_new(
             ERROR, connection, "Encoder init error %d (%s)", aws_last_error(), aws_error_name(aws_last_error()));
         goto error;
     }
+
+    if (aws_hpack_set_indexing_policy(connection->thread_data.encoder.hpack, http2_options->hpack_indexing_policy)) {
+        CONNECTION_LOGF(
+            ERROR,
+            connection,
+            "HPACK indexing policy error %d (%s)",
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+        goto error;
+    }
+
+    aws_crt_statistics_http2_channel_init(&connection->thread_data.stats);
+    connection->thread_data.stats.was_inactive = true;
     /* User data from connection base is not ready until the handler installed */
     connection->thread_data.init_pending_settings = s_new_pending_settings(
         connection->base.alloc,
@@ -443,10 +508,13 @@ static void s_handler_destroy(struct aws_channel_handler *handler) {
         aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map) == 0);
 
     AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.stalled_window_streams_list));
-    AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.outgoing_streams_list));
-    AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_stream_list));
-    AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_frame_list));
-    AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_settings_list));
+    AWS_ASSERT(
+        !connection->thread_data.data_scheduler ||
+        aws_h2_data_scheduler_is_empty(connection->thread_data.data_scheduler));
+    AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.out_of_order_stream_list));
+    AWS_ASSERT(aws_mpsc_queue_is_empty(&connection->synced_data.pending_stream_queue));
+    AWS_ASSERT(aws_mpsc_queue_is_empty(&connection->synced_data.pending_frame_queue));
+    AWS_ASSERT(aws_mpsc_queue_is_empty(&connection->synced_data.pending_settings_queue));
     AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_ping_list));
     AWS_ASSERT(aws_linked_list_empty(&connection->synced_data.pending_goaway_list));
     AWS_ASSERT(aws_linked_list_empty(&connection->thread_data.pending_ping_queue));
@@ -463,6 +531,9 @@ static void s_handler_destroy(struct aws_channel_handler *handler) {
         /* if initial settings were never sent, we need to clear the memory here */
         aws_mem_release(connection->base.alloc, connection->thread_data.init_pending_settings);
     }
+    if (connection->thread_data.data_scheduler) {
+        aws_h2_data_scheduler_destroy(connection->thread_data.data_scheduler);
+    }
     aws_h2_decoder_destroy(connection->thread_data.decoder);
     aws_h2_frame_encoder_clean_up(&connection->thread_data.encoder);
     aws_hash_table_clean_up(&connection->thread_data.active_streams_map);
@@ -617,13 +688,89 @@ static void s_outgoing_frames_task(struct aws_channel_task *task, void *arg, enu
     s_write_outgoing_frames(connection, false /*first_try*/);
 }
 
+static void s_add_time_measurement_to_stats(uint64_t start_ns, uint64_t end_ns, uint64_t *output_ms) {
+    if (end_ns > start_ns) {
+        *output_ms += aws_timestamp_convert(end_ns - start_ns, AWS_TIMESTAMP_NANOS, AWS_TIMESTAMP_MILLIS, NULL);
+    }
+}
+
+/* If the condition was holding, add the time since its timestamp to the stat. Then note whether it holds now. */
+static void s_update_stats_condition(
+    bool holds_now,
+    bool *held,
+    uint64_t *timestamp_ns,
+    uint64_t now_ns,
+    uint64_t *output_ms) {
+
+    if (*held) {
+        s_add_time_measurement_to_stats(*timestamp_ns, now_ns, output_ms);
+    }
+    *held = holds_now;
+    *timestamp_ns = now_ns;
+}
+
+/* Bring time-based stats up to date.
+ * Call this whenever one of the conditions they measure might have changed */
+static void s_update_statistics(struct aws_h2_connection *connection) {
+    uint64_t now_ns = 0;
+    if (aws_channel_current_clock_time(connection->base.channel_slot->channel, &now_ns)) {
+        return;
+    }
+
+    struct aws_crt_statistics_http2_channel *stats = &connection->thread_data.stats;
+    size_t num_active_streams = aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map);
+    bool has_data = !aws_h2_data_scheduler_is_empty(connection->thread_data.data_scheduler);
+    bool has_stream_window_stalled = !aws_linked_list_empty(&connection->thread_data.stalled_window_streams_list);
+    bool has_outgoing =
+        has_data || has_stream_window_stalled || !aws_linked_list_empty(&connection->thread_data.outgoing_frames_queue);
+
+    s_update_stats_condition(
+        has_outgoing,
+        &connection->thread_data.stats_timing.has_outgoing,
+        &connection->thread_data.stats_timing.outgoing_timestamp_ns,
+        now_ns,
+        &stats->pending_outgoing_stream_ms);
+
+    s_update_stats_condition(
+        num_active_streams > 0,
+        &connection->thread_data.stats_timing.has_incoming,
+        &connection->thread_data.stats_timing.incoming_timestamp_ns,
+        now_ns,
+        &stats->pending_incoming_stream_ms);
+
+    s_update_stats_condition(
+        has_data && connection->thread_data.window_size_peer <= AWS_H2_MIN_WINDOW_SIZE,
+        &connection->thread_data.stats_timing.connection_window_stalled,
+        &connection->thread_data.stats_timing.connection_window_stalled_timestamp_ns,
+        now_ns,
+        &stats->connection_window_stalled_ms);
+
+    s_update_stats_condition(
+        has_stream_window_stalled,
+        &connection->thread_data.stats_timing.stream_window_stalled,
+        &connection->thread_data.stats_timing.stream_window_stalled_timestamp_ns,
+        now_ns,
+        &stats->stream_window_stalled_ms);
+
+    if (num_active_streams == 0) {
+        stats->was_inactive = true;
+    }
+}
+
+static void s_count_frame_bytes_sent(struct aws_h2_connection *connection, enum aws_h2_frame_type type, size_t len) {
+    if ((size_t)type < AWS_CRT_STATISTICS_HTTP2_FRAME_TYPE_COUNT) {
+        connection->thread_data.stats.frame_bytes_sent[type] += len;
+    }
+}
+
 static void s_write_outgoing_frames(struct aws_h2_connection *connection, bool first_try) {
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
     AWS_PRECONDITION(connection->thread_data.is_outgoing_frames_task_active);
 
     struct aws_channel_slot *channel_slot = connection->base.channel_slot;
     struct aws_linked_list *outgoing_frames_queue = &connection->thread_data.outgoing_frames_queue;
-    struct aws_linked_list *outgoing_streams_list = &connection->thread_data.outgoing_streams_list;
+
+    s_update_statistics(connection);
 
     if (connection->thread_data.is_writing_stopped) {
         return;
@@ -632,7 +779,7 @@ static void s_write_outgoing_frames(struct aws_h2_connection *connection, bool f
     /* Determine whether there's work to do, and end task immediately if there's not.
      * Note that we stop writing DATA frames if the channel is trying to shut down */
     bool has_control_frames = !aws_linked_list_empty(outgoing_frames_queue);
-    bool has_data_frames = !aws_linked_list_empty(outgoing_streams_list);
+    bool has_data_frames = !aws_h2_data_scheduler_is_empty(connection->thread_data.data_scheduler);
     bool may_write_data_frames = (connection->thread_data.window_size_peer > AWS_H2_MIN_WINDOW_SIZE) &&
                                  !connection->thread_data.channel_shutdown_waiting_for_goaway_to_be_written;
     bool will_write = has_control_frames || (has_data_frames && may_write_data_frames);
@@ -684,7 +831,7 @@ static void s_write_outgoing_frames(struct aws_h2_connection *connection, bool f
     }
 
     /* If outgoing_frames_queue emptied, and connection is running normally,
-     * then write as many DATA frames from outgoing_streams_list as possible. */
+     * then write as many DATA frames from the data_scheduler as possible. */
     if (aws_linked_list_empty(outgoing_frames_queue) && may_write_data_frames) {
         if (s_encode_data_from_outgoing_streams(connection, &msg->message_data)) {
             goto error;
@@ -738,6 +885,7 @@ static int s_encode_outgoing_frames_queue(struct aws_h2_connection *connection,
         struct aws_linked_list_node *frame_node = aws_linked_list_front(outgoing_frames_queue);
         struct aws_h2_frame *frame = AWS_CONTAINER_OF(frame_node, struct aws_h2_frame, node);
         connection->thread_data.current_outgoing_frame = frame;
+        size_t prev_output_len = output->len;
         bool frame_complete;
         if (aws_h2_encode_frame(&connection->thread_data.encoder, frame, output, &frame_complete)) {
             CONNECTION_LOGF(
@@ -750,6 +898,8 @@ static int s_encode_outgoing_frames_queue(struct aws_h2_connection *connection,
             return AWS_OP_ERR;
         }
 
+        s_count_frame_bytes_sent(connection, frame->type, output->len - prev_output_len);
+
         if (!frame_complete) {
             if (output->len == 0) {
                 /* We're in trouble if an empty message isn't big enough for this frame to do any work with */
@@ -777,11 +927,11 @@ static int s_encode_outgoing_frames_queue(struct aws_h2_connection *connection,
     return AWS_OP_SUCCESS;
 }
 
-/* Write as many DATA frames from outgoing_streams_list as possible. */
+/* Write as many DATA frames from the data_scheduler as possible. */
 static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connection, struct aws_byte_buf *output) {
 
     AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
-    struct aws_linked_list *outgoing_streams_list = &connection->thread_data.outgoing_streams_list;
+    struct aws_h2_data_scheduler *data_scheduler = connection->thread_data.data_scheduler;
     struct aws_linked_list *stalled_window_streams_list = &connection->thread_data.stalled_window_streams_list;
 
     /* If a stream stalls, put it in this list until the function ends so we don't keep trying to read from it.
@@ -791,10 +941,10 @@ static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connect
 
     int aws_error_code = 0;
 
-    /* We simply round-robin through streams, instead of using stream priority.
-     * Respecting priority is not required (RFC-7540 5.3), so we're ignoring it for now. This also keeps use safe
+    /* The data_scheduler picks which stream goes next, based on priorities set by the local user.
+     * Respecting the peer's PRIORITY frames is not required (RFC-7540 5.3), so we ignore them. This keeps us safe
      * from priority DOS attacks: https://cve.mitre.org/cgi-bin/cvename.cgi?name=CVE-2019-9513 */
-    while (!aws_linked_list_empty(outgoing_streams_list)) {
+    while (!aws_h2_data_scheduler_is_empty(data_scheduler)) {
         if (connection->thread_data.window_size_peer <= AWS_H2_MIN_WINDOW_SIZE) {
             CONNECTION_LOGF(
                 DEBUG,
@@ -813,8 +963,9 @@ static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connect
             goto done;
         }
 
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(outgoing_streams_list);
-        struct aws_h2_stream *stream = AWS_CONTAINER_OF(node, struct aws_h2_stream, node);
+        struct aws_h2_stream *stream = aws_h2_data_scheduler_pop(data_scheduler);
+        struct aws_linked_list_node *node = &stream->node;
+        size_t prev_output_len = output->len;
 
         /* Ask stream to encode a data frame.
          * Stream may complete itself as a result of encoding its data,
@@ -833,12 +984,19 @@ static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connect
             goto done;
         }
 
-        /* If stream has more data, push it into the appropriate list. */
+        s_count_frame_bytes_sent(connection, AWS_H2_FRAME_T_DATA, output->len - prev_output_len);
+
+        /* If stream has more data, push it into the appropriate list.
+         * Don't touch a COMPLETE stream, it may have been destroyed. */
+        if (data_encode_status != AWS_H2_DATA_ENCODE_COMPLETE) {
+            aws_h2_data_scheduler_on_data_sent(data_scheduler, stream, output->len - prev_output_len);
+        }
+
         switch (data_encode_status) {
             case AWS_H2_DATA_ENCODE_COMPLETE:
                 break;
             case AWS_H2_DATA_ENCODE_ONGOING:
-                aws_linked_list_push_back(outgoing_streams_list, node);
+                aws_h2_data_scheduler_push(data_scheduler, stream);
                 break;
             case AWS_H2_DATA_ENCODE_ONGOING_BODY_STALLED:
                 aws_linked_list_push_back(&stalled_streams_list, node);
@@ -858,9 +1016,10 @@ static int s_encode_data_from_outgoing_streams(struct aws_h2_connection *connect
     }
 
 done:
-    /* Return any stalled streams to outgoing_streams_list */
+    /* Return any stalled streams to the data_scheduler */
     while (!aws_linked_list_empty(&stalled_streams_list)) {
-        aws_linked_list_push_back(outgoing_streams_list, aws_linked_list_pop_front(&stalled_streams_list));
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&stalled_streams_list);
+        aws_h2_data_scheduler_push(data_scheduler, AWS_CONTAINER_OF(node, struct aws_h2_stream, node));
     }
 
     if (aws_error_code) {
@@ -908,8 +1067,9 @@ struct aws_h2err s_get_active_stream_for_incoming_frame(
     bool client_initiated = (stream_id % 2) == 1;
     bool self_initiated_stream = client_initiated && (connection->base.client_data != NULL);
     bool peer_initiated_stream = !self_initiated_stream;
+    size_t next_stream_id = aws_atomic_load_int(&connection->synced_data.next_stream_id);
 
-    if ((self_initiated_stream && stream_id >= connection->base.next_stream_id) ||
+    if ((self_initiated_stream && stream_id >= next_stream_id) ||
         (peer_initiated_stream && stream_id > connection->thread_data.latest_peer_initiated_stream_id)) {
         /* Illegal to receive frames for a stream in the idle state (stream doesn't exist yet)
          * (except server receiving HEADERS to start a stream, but that's handled elsewhere) */
@@ -1027,12 +1187,81 @@ struct aws_h2err s_get_active_stream_for_incoming_frame(
 
 /* Decoder callbacks */
 
+/* Server received HEADERS on a new client-initiated stream-id. Ask the user for a request-handler stream. */
+static struct aws_h2err s_server_on_new_request_stream(struct aws_h2_connection *connection, uint32_t stream_id) {
+    AWS_PRECONDITION(connection->base.server_data);
+    AWS_PRECONDITION(!connection->thread_data.can_create_request_handler_stream);
+
+    /* The identifier of a newly established stream MUST be numerically greater than all streams that the initiating
+     * endpoint has opened or reserved. Any lower ids that were skipped are implicitly closed (RFC-7540 5.1.1) */
+    connection->thread_data.latest_peer_initiated_stream_id = stream_id;
+
+    if (stream_id > connection->thread_data.goaway_sent_last_stream_id) {
+        /* Once GOAWAY sent, ignore new streams whose id > last-stream-id */
+        CONNECTION_LOGF(
+            TRACE,
+            connection,
+            "Ignoring new stream id=%" PRIu32 " because GOAWAY sent with last-stream-id=%" PRIu32,
+            stream_id,
+            connection->thread_data.goaway_sent_last_stream_id);
+        return AWS_H2ERR_SUCCESS;
+    }
+
+    uint32_t max_concurrent_streams = connection->thread_data.settings_self[AWS_HTTP2_SETTINGS_MAX_CONCURRENT_STREAMS];
+    if (aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map) >= max_concurrent_streams) {
+        /* RFC-7540 5.1.2 - refuse streams beyond our limit, peer may retry them later */
+        CONNECTION_LOGF(
+            DEBUG, connection, "Refusing new stream id=%" PRIu32 ", max concurrent streams are reached", stream_id);
+        if (aws_h2_connection_send_rst_and_close_reserved_stream(
+                connection, stream_id, AWS_HTTP2_ERR_REFUSED_STREAM)) {
+            return aws_h2err_from_last_error();
+        }
+        return AWS_H2ERR_SUCCESS;
+    }
+
+    /* The user MUST create the new request-handler stream during the on-incoming-request callback. */
+    connection->thread_data.can_create_request_handler_stream = true;
+
+    struct aws_http_stream *new_stream =
+        connection->base.server_data->on_incoming_request(&connection->base, connection->base.user_data);
+
+    connection->thread_data.can_create_request_handler_stream = false;
+
+    struct aws_hash_element *found = NULL;
+    aws_hash_table_find(&connection->thread_data.active_streams_map, (void *)(size_t)stream_id, &found);
+    if (!new_stream || !found || found->value != AWS_CONTAINER_OF(new_stream, struct aws_h2_stream, base)) {
+        CONNECTION_LOGF(
+            ERROR,
+            connection,
+            "Incoming request callback failed to create request-handler stream for id=%" PRIu32 ", refusing it",
+            stream_id);
+        if (aws_h2_connection_send_rst_and_close_reserved_stream(
+                connection, stream_id, AWS_HTTP2_ERR_REFUSED_STREAM)) {
+            return aws_h2err_from_last_error();
+        }
+        return AWS_H2ERR_SUCCESS;
+    }
+
+    return aws_h2_stream_on_decoder_headers_begin(found->value);
+}
+
+static struct aws_h2err s_decoder_on_frame_prefix(enum aws_h2_frame_type type, uint32_t payload_len, void *userdata) {
+    struct aws_h2_connection *connection = userdata;
+
+    if ((size_t)type < AWS_CRT_STATISTICS_HTTP2_FRAME_TYPE_COUNT) {
+        connection->thread_data.stats.frame_bytes_received[type] += AWS_H2_FRAME_PREFIX_SIZE + (uint64_t)payload_len;
+    }
+    return AWS_H2ERR_SUCCESS;
+}
+
 struct aws_h2err s_decoder_on_headers_begin(uint32_t stream_id, void *userdata) {
     struct aws_h2_connection *connection = userdata;
 
-    if (connection->base.server_data) {
-        /* Server would create new request-handler stream... */
-        return aws_h2err_from_aws_code(AWS_ERROR_UNIMPLEMENTED);
+    bool client_initiated = (stream_id % 2) == 1;
+    if (connection->base.server_data && client_initiated &&
+        stream_id > connection->thread_data.latest_peer_initiated_stream_id) {
+
+        return s_server_on_new_request_stream(connection, stream_id);
     }
 
     struct aws_h2_stream *stream;
@@ -1534,7 +1763,7 @@ static struct aws_h2err s_decoder_on_window_update(uint32_t stream_id, uint32_t
                     " Stream will resume sending data.",
                     stream->thread_data.window_size_peer);
                 aws_linked_list_remove(&stream->node);
-                aws_linked_list_push_back(&connection->thread_data.outgoing_streams_list, &stream->node);
+                aws_h2_data_scheduler_push(connection->thread_data.data_scheduler, stream);
             }
         }
     }
@@ -1562,7 +1791,7 @@ struct aws_h2err s_decoder_on_goaway_begin(
     { /* BEGIN CRITICAL SECTION */
         s_lock_synced_data(connection);
 
-        connection->synced_data.new_stream_error_code = AWS_ERROR_HTTP_GOAWAY_RECEIVED;
+        aws_atomic_store_int(&connection->synced_data.new_stream_error_code, AWS_ERROR_HTTP_GOAWAY_RECEIVED);
         connection->synced_data.goaway_received_last_stream_id = last_stream;
         connection->synced_data.goaway_received_http2_error_code = error_code;
 
@@ -1701,11 +1930,13 @@ static void s_stream_complete(struct aws_h2_connection *connection, struct aws_h
         AWS_H2_STREAM_LOG(DEBUG, stream, "Server stream complete");
     }
 
-    /* Remove stream from active_streams_map and outgoing_stream_list (if it was in them at all) */
+    /* Remove stream from active_streams_map, the data_scheduler, and stalled lists (if it was in them at all) */
     aws_hash_table_remove(&connection->thread_data.active_streams_map, (void *)(size_t)stream->base.id, NULL, NULL);
+    aws_h2_data_scheduler_remove(connection->thread_data.data_scheduler, stream);
     if (stream->node.next) {
         aws_linked_list_remove(&stream->node);
     }
+    s_update_statistics(connection);
 
     /* Invoke callback */
     if (stream->base.on_complete) {
@@ -1722,7 +1953,7 @@ struct aws_http_headers *aws_h2_create_headers_from_request(
 
     struct aws_http_headers *old_headers = aws_http_message_get_headers(request);
     bool is_pseudoheader = false;
-    struct aws_http_headers *result = aws_http_headers_new(alloc);
+    struct aws_http_headers *result = aws_http_headers_new_arena(alloc, 0 /*default block_size*/);
     struct aws_http_header header_iter;
     struct aws_byte_buf lower_name_buf;
     AWS_ZERO_STRUCT(lower_name_buf);
@@ -1820,6 +2051,66 @@ error:
     return NULL;
 }
 
+struct aws_http_headers *aws_h2_create_headers_from_response(
+    struct aws_http_message *response,
+    struct aws_allocator *alloc) {
+
+    struct aws_http_headers *old_headers = aws_http_message_get_headers(response);
+    struct aws_http_headers *result = aws_http_headers_new_arena(alloc, 0 /*default block_size*/);
+    struct aws_byte_buf lower_name_buf;
+    AWS_ZERO_STRUCT(lower_name_buf);
+    if (!result) {
+        return NULL;
+    }
+
+    /* :status must come first (RFC-7540 8.1.2.1) */
+    int status_code;
+    if (aws_http_message_get_response_status(response, &status_code)) {
+        goto error;
+    }
+    if (status_code < 100 || status_code > 999) {
+        aws_raise_error(AWS_ERROR_HTTP_INVALID_STATUS_CODE);
+        goto error;
+    }
+    char status_str[4];
+    snprintf(status_str, sizeof(status_str), "%03d", status_code);
+    if (aws_http_headers_add(result, aws_http_header_status, aws_byte_cursor_from_c_str(status_str))) {
+        goto error;
+    }
+
+    /* name should be converted to lower case */
+    if (aws_byte_buf_init(&lower_name_buf, alloc, 256)) {
+        goto error;
+    }
+    for (size_t iter = 0; iter < aws_http_headers_count(old_headers); iter++) {
+        struct aws_http_header header_iter;
+        if (aws_http_headers_get_index(old_headers, iter, &header_iter)) {
+            goto error;
+        }
+        aws_byte_buf_append_with_lookup(&lower_name_buf, &header_iter.name, aws_lookup_table_to_lower_get());
+        struct aws_byte_cursor lower_name_cursor = aws_byte_cursor_from_buf(&lower_name_buf);
+        enum aws_http_header_name name_enum = aws_http_lowercase_str_to_header_name(lower_name_cursor);
+        switch (name_enum) {
+            case AWS_HTTP_HEADER_CONNECTION:
+            case AWS_HTTP_HEADER_TRANSFER_ENCODING:
+                /* connection-specific header fields are not allowed in HTTP/2 (RFC-7540 8.1.2.2) */
+                break;
+            default:
+                if (aws_http_headers_add(result, lower_name_cursor, header_iter.value)) {
+                    goto error;
+                }
+                break;
+        }
+        aws_byte_buf_reset(&lower_name_buf, false);
+    }
+    aws_byte_buf_clean_up(&lower_name_buf);
+    return result;
+error:
+    aws_http_headers_release(result);
+    aws_byte_buf_clean_up(&lower_name_buf);
+    return NULL;
+}
+
 int aws_h2_connection_on_stream_closed(
     struct aws_h2_connection *connection,
     struct aws_h2_stream *stream,
@@ -1859,6 +2150,24 @@ static int s_record_closed_stream(
     return AWS_OP_SUCCESS;
 }
 
+void aws_h2_connection_add_outgoing_stream(struct aws_h2_connection *connection, struct aws_h2_stream *stream) {
+    AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
+    AWS_PRECONDITION(stream->node.next == NULL);
+
+    aws_h2_data_scheduler_push(connection->thread_data.data_scheduler, stream);
+}
+
+void aws_h2_connection_set_stream_priority(
+    struct aws_h2_connection *connection,
+    struct aws_h2_stream *stream,
+    const struct aws_http2_stream_priority *priority) {
+    AWS_PRECONDITION(aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel));
+
+    aws_h2_data_scheduler_set_priority(connection->thread_data.data_scheduler, stream, priority);
+    AWS_H2_STREAM_LOGF(
+        TRACE, stream, "Priority set to urgency:%u weight:%u", (unsigned)priority->urgency, (unsigned)priority->weight);
+}
+
 int aws_h2_connection_send_rst_and_close_reserved_stream(
     struct aws_h2_connection *connection,
     uint32_t stream_id,
@@ -1907,6 +2216,7 @@ static void s_move_stream_to_thread(
         AWS_H2_STREAM_LOG(ERROR, stream, "Failed inserting stream into map");
         goto error;
     }
+    s_update_statistics(connection);
 
     bool has_outgoing_data = false;
     if (aws_h2_stream_on_activated(stream, &has_outgoing_data)) {
@@ -1914,7 +2224,7 @@ static void s_move_stream_to_thread(
     }
 
     if (has_outgoing_data) {
-        aws_linked_list_push_back(&connection->thread_data.outgoing_streams_list, &stream->node);
+        aws_h2_connection_add_outgoing_stream(connection, stream);
     }
 
     return;
@@ -1923,6 +2233,21 @@ error:
     s_stream_complete(connection, stream, aws_last_error());
 }
 
+/* Insert stream into the out_of_order_stream_list, keeping it sorted by id.
+ * Streams nearly always arrive in order, so search from the back. */
+static void s_insert_out_of_order_stream(struct aws_h2_connection *connection, struct aws_h2_stream *stream) {
+    struct aws_linked_list *list = &connection->thread_data.out_of_order_stream_list;
+    struct aws_linked_list_node *iter = aws_linked_list_rbegin(list);
+    while (iter != aws_linked_list_rend(list)) {
+        struct aws_h2_stream *iter_stream = AWS_CONTAINER_OF(iter, struct aws_h2_stream, node);
+        if (iter_stream->base.id < stream->base.id) {
+            break;
+        }
+        iter = aws_linked_list_prev(iter);
+    }
+    aws_linked_list_insert_after(iter, &stream->node);
+}
+
 /* Perform on-thread work that is triggered by calls to the connection/stream API */
 static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
     (void)task;
@@ -1932,14 +2257,20 @@ static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, e
 
     struct aws_h2_connection *connection = arg;
 
+    /* Clear the flag before draining anything, so that work queued after the drain schedules the task again */
+    aws_atomic_store_int(&connection->synced_data.is_cross_thread_work_task_scheduled, false);
+
     struct aws_linked_list pending_frames;
     aws_linked_list_init(&pending_frames);
+    aws_mpsc_queue_pop_all(&connection->synced_data.pending_frame_queue, &pending_frames);
 
     struct aws_linked_list pending_streams;
     aws_linked_list_init(&pending_streams);
+    aws_mpsc_queue_pop_all(&connection->synced_data.pending_stream_queue, &pending_streams);
 
     struct aws_linked_list pending_settings;
     aws_linked_list_init(&pending_settings);
+    aws_mpsc_queue_pop_all(&connection->synced_data.pending_settings_queue, &pending_settings);
 
     struct aws_linked_list pending_ping;
     aws_linked_list_init(&pending_ping);
@@ -1948,23 +2279,19 @@ static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, e
     aws_linked_list_init(&pending_goaway);
 
     size_t window_update_size;
-    int new_stream_error_code;
     { /* BEGIN CRITICAL SECTION */
         s_lock_synced_data(connection);
-        connection->synced_data.is_cross_thread_work_task_scheduled = false;
 
-        aws_linked_list_swap_contents(&connection->synced_data.pending_frame_list, &pending_frames);
-        aws_linked_list_swap_contents(&connection->synced_data.pending_stream_list, &pending_streams);
-        aws_linked_list_swap_contents(&connection->synced_data.pending_settings_list, &pending_settings);
         aws_linked_list_swap_contents(&connection->synced_data.pending_ping_list, &pending_ping);
         aws_linked_list_swap_contents(&connection->synced_data.pending_goaway_list, &pending_goaway);
         window_update_size = connection->synced_data.window_update_size;
         connection->synced_data.window_update_size = 0;
-        new_stream_error_code = connection->synced_data.new_stream_error_code;
 
         s_unlock_synced_data(connection);
     } /* END CRITICAL SECTION */
 
+    int new_stream_error_code = (int)aws_atomic_load_int(&connection->synced_data.new_stream_error_code);
+
     /* Enqueue new pending control frames */
     while (!aws_linked_list_empty(&pending_frames)) {
         struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_frames);
@@ -1977,17 +2304,34 @@ static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, e
     connection->thread_data.window_size_self =
         aws_add_size_saturating(connection->thread_data.window_size_self, window_update_size);
 
-    /* Process new pending_streams */
+    /* Process new pending_streams, in order of stream-id */
     while (!aws_linked_list_empty(&pending_streams)) {
         struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_streams);
         struct aws_h2_stream *stream = AWS_CONTAINER_OF(node, struct aws_h2_stream, node);
+        s_insert_out_of_order_stream(connection, stream);
+    }
+
+    /* If a stream with a lower id hasn't been pushed yet, its activate() call is still in progress.
+     * Streams with higher ids wait here and the task runs again once that push lands. */
+    struct aws_linked_list *out_of_order_streams = &connection->thread_data.out_of_order_stream_list;
+    while (!aws_linked_list_empty(out_of_order_streams)) {
+        struct aws_linked_list_node *node = aws_linked_list_front(out_of_order_streams);
+        struct aws_h2_stream *stream = AWS_CONTAINER_OF(node, struct aws_h2_stream, node);
+        if (stream->base.id != connection->thread_data.next_stream_id_to_activate) {
+            break;
+        }
+        aws_linked_list_pop_front(out_of_order_streams);
+        connection->thread_data.next_stream_id_to_activate += 2;
         s_move_stream_to_thread(connection, stream, new_stream_error_code);
     }
 
-    /* Move pending settings to thread data */
+    /* Send new SETTINGS frames and move pending settings to thread data */
     while (!aws_linked_list_empty(&pending_settings)) {
-        aws_linked_list_push_back(
-            &connection->thread_data.pending_settings_queue, aws_linked_list_pop_front(&pending_settings));
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_settings);
+        struct aws_h2_pending_settings *settings = AWS_CONTAINER_OF(node, struct aws_h2_pending_settings, node);
+        aws_h2_connection_enqueue_outgoing_frame(connection, settings->frame);
+        settings->frame = NULL;
+        aws_linked_list_push_back(&connection->thread_data.pending_settings_queue, node);
     }
 
     /* Move pending PING to thread data */
@@ -2008,54 +2352,70 @@ static void s_cross_thread_work_task(struct aws_channel_task *task, void *arg, e
     aws_h2_try_write_outgoing_frames(connection);
 }
 
+/* Reserve the next self-initiated stream-id. Any thread may call this. Returns 0 and raises an error if ids are
+ * exhausted. */
+static uint32_t s_reserve_next_stream_id(struct aws_h2_connection *connection) {
+    size_t next_id = aws_atomic_load_int(&connection->synced_data.next_stream_id);
+    do {
+        if (AWS_UNLIKELY(next_id > AWS_H2_STREAM_ID_MAX)) {
+            CONNECTION_LOG(INFO, connection, "All available stream ids are gone");
+            aws_raise_error(AWS_ERROR_HTTP_STREAM_IDS_EXHAUSTED);
+            return 0;
+        }
+    } while (!aws_atomic_compare_exchange_int(&connection->synced_data.next_stream_id, &next_id, next_id + 2));
+
+    return (uint32_t)next_id;
+}
+
 int aws_h2_stream_activate(struct aws_http_stream *stream) {
     struct aws_h2_stream *h2_stream = AWS_CONTAINER_OF(stream, struct aws_h2_stream, base);
 
     struct aws_http_connection *base_connection = stream->owning_connection;
     struct aws_h2_connection *connection = AWS_CONTAINER_OF(base_connection, struct aws_h2_connection, base);
 
+    /* Only the stream's lock is taken. The connection's lock is avoided so that many threads may activate
+     * streams at once, without contending with each other. */
     int err;
-    bool was_cross_thread_work_scheduled = false;
     { /* BEGIN CRITICAL SECTION */
-        s_acquire_stream_and_connection_lock(h2_stream, connection);
+        s_lock_stream_synced_data(h2_stream);
 
         if (stream->id) {
             /* stream has already been activated. */
-            s_release_stream_and_connection_lock(h2_stream, connection);
+            s_unlock_stream_synced_data(h2_stream);
             return AWS_OP_SUCCESS;
         }
 
-        err = connection->synced_data.new_stream_error_code;
+        err = (int)aws_atomic_load_int(&connection->synced_data.new_stream_error_code);
         if (err) {
-            s_release_stream_and_connection_lock(h2_stream, connection);
+            s_unlock_stream_synced_data(h2_stream);
             goto error;
         }
 
-        stream->id = aws_http_connection_get_next_stream_id(base_connection);
-
-        if (stream->id) {
-            /* success */
-            was_cross_thread_work_scheduled = connection->synced_data.is_cross_thread_work_task_scheduled;
-            connection->synced_data.is_cross_thread_work_task_scheduled = true;
+        stream->id = s_reserve_next_stream_id(connection);
+        if (!stream->id) {
+            /* s_reserve_next_stream_id() raises its own error. */
+            s_unlock_stream_synced_data(h2_stream);
+            return AWS_OP_ERR;
+        }
 
-            aws_linked_list_push_back(&connection->synced_data.pending_stream_list, &h2_stream->node);
-            h2_stream->synced_data.api_state = AWS_H2_STREAM_API_STATE_ACTIVE;
+        /* connection keeps activated stream alive until stream completes.
+         * Take this reference before the push, the stream might complete on the event-loop thread immediately. */
+        aws_atomic_fetch_add(&stream->refcount, 1);
+        h2_stream->synced_data.api_state = AWS_H2_STREAM_API_STATE_ACTIVE;
+
+        if (s_push_cross_thread_work(connection, &connection->synced_data.pending_stream_queue, &h2_stream->node)) {
+            /* Queue is sealed, the connection has finished shutting down */
+            stream->id = 0;
+            h2_stream->synced_data.api_state = AWS_H2_STREAM_API_STATE_INIT;
+            aws_atomic_fetch_sub(&stream->refcount, 1);
+            err = AWS_ERROR_HTTP_CONNECTION_CLOSED;
         }
 
-        s_release_stream_and_connection_lock(h2_stream, connection);
+        s_unlock_stream_synced_data(h2_stream);
     } /* END CRITICAL SECTION */
 
-    if (!stream->id) {
-        /* aws_http_connection_get_next_stream_id() raises its own error. */
-        return AWS_OP_ERR;
-    }
-
-    /* connection keeps activated stream alive until stream completes */
-    aws_atomic_fetch_add(&stream->refcount, 1);
-
-    if (!was_cross_thread_work_scheduled) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
+    if (err) {
+        goto error;
     }
 
     return AWS_OP_SUCCESS;
@@ -2091,12 +2451,7 @@ static struct aws_http_stream *s_connection_make_request(
         return NULL;
     }
 
-    int new_stream_error_code;
-    { /* BEGIN CRITICAL SECTION */
-        s_lock_synced_data(connection);
-        new_stream_error_code = connection->synced_data.new_stream_error_code;
-        s_unlock_synced_data(connection);
-    } /* END CRITICAL SECTION */
+    int new_stream_error_code = (int)aws_atomic_load_int(&connection->synced_data.new_stream_error_code);
     if (new_stream_error_code) {
         aws_raise_error(new_stream_error_code);
         CONNECTION_LOGF(
@@ -2117,6 +2472,57 @@ error:
     return NULL;
 }
 
+static struct aws_http_stream *s_connection_new_server_request_handler_stream(
+    const struct aws_http_request_handler_options *options) {
+
+    struct aws_h2_connection *connection = AWS_CONTAINER_OF(options->server_connection, struct aws_h2_connection, base);
+
+    if (!aws_channel_thread_is_callers_thread(connection->base.channel_slot->channel) ||
+        !connection->thread_data.can_create_request_handler_stream) {
+
+        CONNECTION_LOG(
+            ERROR,
+            connection,
+            "aws_http_stream_new_server_request_handler() can only be called during incoming request callback.");
+        aws_raise_error(AWS_ERROR_INVALID_STATE);
+        return NULL;
+    }
+
+    uint32_t stream_id = connection->thread_data.latest_peer_initiated_stream_id;
+    struct aws_h2_stream *stream = aws_h2_stream_new_request_handler(options, stream_id);
+    if (!stream) {
+        CONNECTION_LOGF(
+            ERROR,
+            connection,
+            "Failed to create request handler stream, error %d (%s)",
+            aws_last_error(),
+            aws_error_name(aws_last_error()));
+        return NULL;
+    }
+
+    if (aws_hash_table_put(&connection->thread_data.active_streams_map, (void *)(size_t)stream_id, stream, NULL)) {
+        AWS_H2_STREAM_LOG(ERROR, stream, "Failed inserting stream into map");
+        /* Force destruction of the stream, avoiding ref counting */
+        stream->base.vtable->destroy(&stream->base);
+        return NULL;
+    }
+    s_update_statistics(connection);
+
+    /* Prevent further streams from being created until it's ok to do so. */
+    connection->thread_data.can_create_request_handler_stream = false;
+
+    /* Connection owns stream, and must outlive stream */
+    aws_http_connection_acquire(&connection->base);
+
+    AWS_H2_STREAM_LOG(DEBUG, stream, "Created HTTP/2 request handler stream");
+    return &stream->base;
+}
+
+static int s_connection_stream_send_response(struct aws_http_stream *stream, struct aws_http_message *response) {
+    struct aws_h2_stream *h2_stream = AWS_CONTAINER_OF(stream, struct aws_h2_stream, base);
+    return aws_h2_stream_send_response(h2_stream, response);
+}
+
 static void s_connection_close(struct aws_http_connection *connection_base) {
     struct aws_h2_connection *connection = AWS_CONTAINER_OF(connection_base, struct aws_h2_connection, base);
 
@@ -2126,26 +2532,12 @@ static void s_connection_close(struct aws_http_connection *connection_base) {
 
 static bool s_connection_is_open(const struct aws_http_connection *connection_base) {
     struct aws_h2_connection *connection = AWS_CONTAINER_OF(connection_base, struct aws_h2_connection, base);
-    bool is_open;
-
-    { /* BEGIN CRITICAL SECTION */
-        s_lock_synced_data(connection);
-        is_open = connection->synced_data.is_open;
-        s_unlock_synced_data(connection);
-    } /* END CRITICAL SECTION */
-
-    return is_open;
+    return aws_atomic_load_int(&connection->synced_data.is_open);
 }
 
 static bool s_connection_new_requests_allowed(const struct aws_http_connection *connection_base) {
     struct aws_h2_connection *connection = AWS_CONTAINER_OF(connection_base, struct aws_h2_connection, base);
-    int new_stream_error_code;
-    { /* BEGIN CRITICAL SECTION */
-        s_lock_synced_data(connection);
-        new_stream_error_code = connection->synced_data.new_stream_error_code;
-        s_unlock_synced_data(connection);
-    } /* END CRITICAL SECTION */
-    return new_stream_error_code == 0;
+    return aws_atomic_load_int(&connection->synced_data.new_stream_error_code) == 0;
 }
 
 static void s_connection_update_window(struct aws_http_connection *connection_base, size_t increment_size) {
@@ -2173,29 +2565,26 @@ static void s_connection_update_window(struct aws_http_connection *connection_ba
     }
 
     int err = 0;
-    bool cross_thread_work_should_schedule = false;
-    bool connection_open;
+    bool connection_open = aws_atomic_load_int(&connection->synced_data.is_open);
     size_t sum_size;
     { /* BEGIN CRITICAL SECTION */
         s_lock_synced_data(connection);
 
         err |= aws_add_size_checked(connection->synced_data.window_update_size, increment_size, &sum_size);
         err |= sum_size > AWS_H2_WINDOW_UPDATE_MAX;
-        connection_open = connection->synced_data.is_open;
 
         if (!err && connection_open) {
-            cross_thread_work_should_schedule = !connection->synced_data.is_cross_thread_work_task_scheduled;
-            connection->synced_data.is_cross_thread_work_task_scheduled = true;
-            aws_linked_list_push_back(
-                &connection->synced_data.pending_frame_list, &connection_window_update_frame->node);
             connection->synced_data.window_update_size = sum_size;
         }
         s_unlock_synced_data(connection);
     } /* END CRITICAL SECTION */
 
-    if (cross_thread_work_should_schedule) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
+    if (!err && connection_open) {
+        if (s_push_cross_thread_work(
+                connection, &connection->synced_data.pending_frame_queue, &connection_window_update_frame->node)) {
+            /* Queue is sealed, the connection has finished shutting down */
+            connection_open = false;
+        }
     }
 
     if (!connection_open) {
@@ -2248,27 +2637,16 @@ static int s_connection_change_settings(
         return AWS_OP_ERR;
     }
 
-    bool was_cross_thread_work_scheduled = false;
-    bool connection_open;
-    { /* BEGIN CRITICAL SECTION */
-        s_lock_synced_data(connection);
-
-        connection_open = connection->synced_data.is_open;
-        if (!connection_open) {
-            s_unlock_synced_data(connection);
-            goto closed;
-        }
-        was_cross_thread_work_scheduled = connection->synced_data.is_cross_thread_work_task_scheduled;
-        connection->synced_data.is_cross_thread_work_task_scheduled = true;
-        aws_linked_list_push_back(&connection->synced_data.pending_frame_list, &settings_frame->node);
-        aws_linked_list_push_back(&connection->synced_data.pending_settings_list, &pending_settings->node);
-
-        s_unlock_synced_data(connection);
-    } /* END CRITICAL SECTION */
+    if (!aws_atomic_load_int(&connection->synced_data.is_open)) {
+        goto closed;
+    }
 
-    if (!was_cross_thread_work_scheduled) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
+    /* The frame travels with the pending settings, so SETTINGS frames are sent in the same order their ACKs
+     * are expected, even when several threads change settings at once */
+    pending_settings->frame = settings_frame;
+    if (s_push_cross_thread_work(connection, &connection->synced_data.pending_settings_queue, &pending_settings->node)) {
+        /* Queue is sealed, the connection has finished shutting down */
+        goto closed;
     }
 
     return AWS_OP_SUCCESS;
@@ -2312,28 +2690,23 @@ static int s_connection_send_ping(
         return AWS_OP_ERR;
     }
 
-    bool was_cross_thread_work_scheduled = false;
-    bool connection_open;
     { /* BEGIN CRITICAL SECTION */
         s_lock_synced_data(connection);
 
-        connection_open = connection->synced_data.is_open;
-        if (!connection_open) {
+        /* The frame is pushed while the lock is held, so PING frames are sent in the same order their ACKs are
+         * expected. is_open is checked under the lock, s_stop() sets it under the lock before the queue can be
+         * sealed, so the push can't fail. */
+        if (!aws_atomic_load_int(&connection->synced_data.is_open) ||
+            aws_mpsc_queue_push(&connection->synced_data.pending_frame_queue, &ping_frame->node, NULL)) {
             s_unlock_synced_data(connection);
             goto closed;
         }
-        was_cross_thread_work_scheduled = connection->synced_data.is_cross_thread_work_task_scheduled;
-        connection->synced_data.is_cross_thread_work_task_scheduled = true;
-        aws_linked_list_push_back(&connection->synced_data.pending_frame_list, &ping_frame->node);
         aws_linked_list_push_back(&connection->synced_data.pending_ping_list, &pending_ping->node);
 
         s_unlock_synced_data(connection);
     } /* END CRITICAL SECTION */
 
-    if (!was_cross_thread_work_scheduled) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
-    }
+    s_try_schedule_cross_thread_work_task(connection);
 
     return AWS_OP_SUCCESS;
 
@@ -2359,18 +2732,13 @@ static int s_connection_send_goaway(
         return AWS_OP_ERR;
     }
 
-    bool was_cross_thread_work_scheduled = false;
-    bool connection_open;
     { /* BEGIN CRITICAL SECTION */
         s_lock_synced_data(connection);
 
-        connection_open = connection->synced_data.is_open;
-        if (!connection_open) {
+        if (!aws_atomic_load_int(&connection->synced_data.is_open)) {
             s_unlock_synced_data(connection);
             goto closed;
         }
-        was_cross_thread_work_scheduled = connection->synced_data.is_cross_thread_work_task_scheduled;
-        connection->synced_data.is_cross_thread_work_task_scheduled = true;
         aws_linked_list_push_back(&connection->synced_data.pending_goaway_list, &pending_goaway->node);
         s_unlock_synced_data(connection);
     } /* END CRITICAL SECTION */
@@ -2384,10 +2752,7 @@ static int s_connection_send_goaway(
             http2_error);
     }
 
-    if (!was_cross_thread_work_scheduled) {
-        CONNECTION_LOG(TRACE, connection, "Scheduling cross-thread work task");
-        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &connection->cross_thread_work_task);
-    }
+    s_try_schedule_cross_thread_work_task(connection);
     return AWS_OP_SUCCESS;
 
 closed:
@@ -2705,29 +3070,43 @@ static void s_finish_shutdown(struct aws_h2_connection *connection) {
         s_stream_complete(connection, stream, AWS_ERROR_HTTP_CONNECTION_CLOSED);
     }
 
-    /* It's OK to access synced_data without holding the lock because
-     * no more streams or user-requested control frames can be added after s_stop() has been invoked. */
-    while (!aws_linked_list_empty(&connection->synced_data.pending_stream_list)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(&connection->synced_data.pending_stream_list);
+    /* Seal the lock-free queues, so whatever is taken out now is the last of it.
+     * Any later attempt to push fails and reports the connection as closed. */
+    struct aws_linked_list pending_streams;
+    aws_linked_list_init(&pending_streams);
+    aws_linked_list_move_all_back(&pending_streams, &connection->thread_data.out_of_order_stream_list);
+    aws_mpsc_queue_seal(&connection->synced_data.pending_stream_queue, &pending_streams);
+    while (!aws_linked_list_empty(&pending_streams)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_streams);
         struct aws_h2_stream *stream = AWS_CONTAINER_OF(node, struct aws_h2_stream, node);
         s_stream_complete(connection, stream, AWS_ERROR_HTTP_CONNECTION_CLOSED);
     }
 
-    while (!aws_linked_list_empty(&connection->synced_data.pending_frame_list)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(&connection->synced_data.pending_frame_list);
+    struct aws_linked_list pending_frames;
+    aws_linked_list_init(&pending_frames);
+    aws_mpsc_queue_seal(&connection->synced_data.pending_frame_queue, &pending_frames);
+    while (!aws_linked_list_empty(&pending_frames)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_frames);
         struct aws_h2_frame *frame = AWS_CONTAINER_OF(node, struct aws_h2_frame, node);
         aws_h2_frame_destroy(frame);
     }
 
     /* invoke pending callbacks haven't moved into thread, and clean up the data */
-    while (!aws_linked_list_empty(&connection->synced_data.pending_settings_list)) {
-        struct aws_linked_list_node *node = aws_linked_list_pop_front(&connection->synced_data.pending_settings_list);
+    struct aws_linked_list pending_settings;
+    aws_linked_list_init(&pending_settings);
+    aws_mpsc_queue_seal(&connection->synced_data.pending_settings_queue, &pending_settings);
+    while (!aws_linked_list_empty(&pending_settings)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&pending_settings);
         struct aws_h2_pending_settings *settings = AWS_CONTAINER_OF(node, struct aws_h2_pending_settings, node);
         if (settings->on_completed) {
             settings->on_completed(&connection->base, AWS_ERROR_HTTP_CONNECTION_CLOSED, settings->user_data);
         }
+        aws_h2_frame_destroy(settings->frame);
         aws_mem_release(connection->base.alloc, settings);
     }
+
+    /* It's OK to access the rest of synced_data without holding the lock because
+     * no more user-requested control frames can be added after s_stop() has been invoked. */
     while (!aws_linked_list_empty(&connection->synced_data.pending_ping_list)) {
         struct aws_linked_list_node *node = aws_linked_list_pop_front(&connection->synced_data.pending_ping_list);
         struct aws_h2_pending_ping *ping = AWS_CONTAINER_OF(node, struct aws_h2_pending_ping, node);
@@ -2779,3 +3158,41 @@ static size_t s_handler_message_overhead(struct aws_channel_handler *handler) {
     /* "All frames begin with a fixed 9-octet header followed by a variable-length payload" (RFC-7540 4.1) */
     return 9;
 }
+
+static void s_reset_statistics(struct aws_channel_handler *handler) {
+    struct aws_h2_connection *connection = handler->impl;
+
+    aws_crt_statistics_http2_channel_reset(&connection->thread_data.stats);
+    connection->thread_data.stats.was_inactive =
+        aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map) == 0;
+    aws_hpack_get_encoder_stats(
+        connection->thread_data.encoder.hpack, &connection->thread_data.stats_timing.hpack_at_reset);
+}
+
+static void s_gather_statistics(struct aws_channel_handler *handler, struct aws_array_list *stats) {
+    struct aws_h2_connection *connection = handler->impl;
+
+    /* TODO: Like HTTP/1, this doesn't account for user-controlled pauses,
+     * such as a stream's body being supplied slowly, or the user letting a stream's read window go to zero. */
+    s_update_statistics(connection);
+    connection->thread_data.stats.num_active_streams =
+        (uint32_t)aws_hash_table_get_entry_count(&connection->thread_data.active_streams_map);
+
+    struct aws_hpack_encoder_stats hpack_stats;
+    aws_hpack_get_encoder_stats(connection->thread_data.encoder.hpack, &hpack_stats);
+    const struct aws_hpack_encoder_stats *hpack_at_reset = &connection->thread_data.stats_timing.hpack_at_reset;
+    connection->thread_data.stats.header_bytes_uncompressed =
+        hpack_stats.uncompressed_bytes - hpack_at_reset->uncompressed_bytes;
+    connection->thread_data.stats.header_bytes_compressed = hpack_stats.encoded_bytes - hpack_at_reset->encoded_bytes;
+
+    void *stats_base = &connection->thread_data.stats;
+    aws_array_list_push_back(stats, &stats_base);
+}
+
+struct aws_crt_statistics_http2_channel *aws_h2_connection_get_statistics(struct aws_http_connection *connection) {
+    AWS_ASSERT(aws_channel_thread_is_callers_thread(connection->channel_slot->channel));
+
+    struct aws_h2_connection *h2_conn = (void *)connection;
+
+    return &h2_conn->thread_data.stats;
+}
@@ -0,0 +1,400 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include <aws/http/private/h2_data_scheduler.h>
+
+#include <aws/http/private/h2_stream.h>
+
+#include <aws/common/math.h>
+
+enum {
+    /* Weighted-fair: bytes a stream may send per turn, for each unit of weight.
+     * At the default weight of 16, a stream's turn is about one max-size DATA frame.
+     * A low-weight stream can overdraw by many turns' worth, but pop() credits
+     * the rounds it would sit out all at once, rather than cycling through them. */
+    AWS_H2_WEIGHTED_FAIR_QUANTUM_PER_WEIGHT = 1024,
+
+    AWS_H2_STRICT_PRIORITY_URGENCY_COUNT = AWS_HTTP2_STREAM_PRIORITY_MAX_URGENCY + 1,
+};
+
+static struct aws_h2_stream *s_stream_from_node(struct aws_linked_list_node *node) {
+    return AWS_CONTAINER_OF(node, struct aws_h2_stream, node);
+}
+
+/*****************************************************************************
+ * Round-robin: streams take turns, one frame each.
+ *****************************************************************************/
+
+struct round_robin_scheduler {
+    struct aws_h2_data_scheduler base;
+    struct aws_linked_list streams;
+};
+
+static void s_round_robin_destroy(struct aws_h2_data_scheduler *scheduler) {
+    struct round_robin_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct round_robin_scheduler, base);
+    aws_mem_release(scheduler->alloc, impl);
+}
+
+static void s_round_robin_push(struct aws_h2_data_scheduler *scheduler, struct aws_h2_stream *stream) {
+    struct round_robin_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct round_robin_scheduler, base);
+    aws_linked_list_push_back(&impl->streams, &stream->node);
+}
+
+static struct aws_h2_stream *s_round_robin_pop(struct aws_h2_data_scheduler *scheduler) {
+    struct round_robin_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct round_robin_scheduler, base);
+    return s_stream_from_node(aws_linked_list_pop_front(&impl->streams));
+}
+
+static void s_round_robin_on_data_sent(
+    struct aws_h2_data_scheduler *scheduler,
+    struct aws_h2_stream *stream,
+    size_t num_bytes) {
+
+    (void)scheduler;
+    (void)stream;
+    (void)num_bytes;
+}
+
+static bool s_round_robin_is_empty(const struct aws_h2_data_scheduler *scheduler) {
+    const struct round_robin_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct round_robin_scheduler, base);
+    return aws_linked_list_empty(&impl->streams);
+}
+
+static const struct aws_h2_data_scheduler_vtable s_round_robin_vtable = {
+    .destroy = s_round_robin_destroy,
+    .push = s_round_robin_push,
+    .pop = s_round_robin_pop,
+    .on_data_sent = s_round_robin_on_data_sent,
+    .is_empty = s_round_robin_is_empty,
+};
+
+static struct aws_h2_data_scheduler *s_round_robin_new(struct aws_allocator *alloc) {
+    struct round_robin_scheduler *impl = aws_mem_calloc(alloc, 1, sizeof(struct round_robin_scheduler));
+    if (!impl) {
+        return NULL;
+    }
+
+    impl->base.vtable = &s_round_robin_vtable;
+    impl->base.alloc = alloc;
+    aws_linked_list_init(&impl->streams);
+    return &impl->base;
+}
+
+/*****************************************************************************
+ * Weighted-fair: deficit round-robin.
+ * Streams take turns, and each turn a stream gets credit proportional to its weight.
+ * It keeps sending until it has spent its credit.
+ *****************************************************************************/
+
+struct weighted_fair_scheduler {
+    struct aws_h2_data_scheduler base;
+    struct aws_linked_list streams;
+
+    /* Stream whose turn it is. Compared by address only, it may no longer exist. */
+    const struct aws_h2_stream *current_stream;
+};
+
+static void s_weighted_fair_destroy(struct aws_h2_data_scheduler *scheduler) {
+    struct weighted_fair_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct weighted_fair_scheduler, base);
+    aws_mem_release(scheduler->alloc, impl);
+}
+
+static void s_weighted_fair_push(struct aws_h2_data_scheduler *scheduler, struct aws_h2_stream *stream) {
+    struct weighted_fair_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct weighted_fair_scheduler, base);
+    struct aws_h2_data_scheduler_stream_data *data = &stream->thread_data.scheduler_data;
+
+    if (stream == impl->current_stream && data->deficit > 0) {
+        /* Stream still has credit, let it continue its turn */
+        aws_linked_list_push_front(&impl->streams, &stream->node);
+        return;
+    }
+
+    /* A stream returning after some time away doesn't get to keep leftover credit (negative balance is kept) */
+    if (data->deficit > 0) {
+        data->deficit = 0;
+    }
+    aws_linked_list_push_back(&impl->streams, &stream->node);
+}
+
+static int64_t s_weighted_fair_quantum(const struct aws_h2_data_scheduler_stream_data *data) {
+    return (int64_t)data->priority.weight * AWS_H2_WEIGHTED_FAIR_QUANTUM_PER_WEIGHT;
+}
+
+/* Number of passes through the line before this stream would get back into credit */
+static int64_t s_weighted_fair_passes_until_credit(const struct aws_h2_data_scheduler_stream_data *data) {
+    if (data->deficit > 0) {
+        return 0;
+    }
+    return (-data->deficit / s_weighted_fair_quantum(data)) + 1;
+}
+
+/* If every stream is deep in debt, cycling through the line pass after pass until one gets into credit
+ * would cost O(streams * passes). Instead, find the fewest passes any stream needs,
+ * and give every stream the credit from all but the last of those passes in one step.
+ * The outcome is identical, but afterwards the last pass finds a stream before going all the way around. */
+static void s_weighted_fair_skip_empty_passes(struct weighted_fair_scheduler *impl) {
+    int64_t min_passes = INT64_MAX;
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&impl->streams);
+         node != aws_linked_list_end(&impl->streams);
+         node = aws_linked_list_next(node)) {
+
+        const struct aws_h2_data_scheduler_stream_data *data = &s_stream_from_node(node)->thread_data.scheduler_data;
+        min_passes = aws_min_i64(min_passes, s_weighted_fair_passes_until_credit(data));
+    }
+
+    if (min_passes <= 1) {
+        return;
+    }
+
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&impl->streams);
+         node != aws_linked_list_end(&impl->streams);
+         node = aws_linked_list_next(node)) {
+
+        struct aws_h2_data_scheduler_stream_data *data = &s_stream_from_node(node)->thread_data.scheduler_data;
+        data->deficit += (min_passes - 1) * s_weighted_fair_quantum(data);
+    }
+}
+
+static struct aws_h2_stream *s_weighted_fair_pop(struct aws_h2_data_scheduler *scheduler) {
+    struct weighted_fair_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct weighted_fair_scheduler, base);
+
+    /* Common case: the stream at the front has credit, or gets enough from this turn */
+    struct aws_h2_stream *front = s_stream_from_node(aws_linked_list_front(&impl->streams));
+    if (s_weighted_fair_passes_until_credit(&front->thread_data.scheduler_data) > 1) {
+        s_weighted_fair_skip_empty_passes(impl);
+    }
+
+    /* Each time a stream reaches the front, it gets one turn's worth of credit.
+     * If it's still in debt, it goes to the back and waits for another turn.
+     * Some stream now gets into credit during this pass, so nothing is sent to the back more than once. */
+    while (true) {
+        struct aws_h2_stream *stream = s_stream_from_node(aws_linked_list_pop_front(&impl->streams));
+        struct aws_h2_data_scheduler_stream_data *data = &stream->thread_data.scheduler_data;
+        if (data->deficit <= 0) {
+            data->deficit += s_weighted_fair_quantum(data);
+        }
+
+        if (data->deficit > 0) {
+            impl->current_stream = stream;
+            return stream;
+        }
+
+        aws_linked_list_push_back(&impl->streams, &stream->node);
+        ++scheduler->num_requeues;
+    }
+}
+
+static void s_weighted_fair_on_data_sent(
+    struct aws_h2_data_scheduler *scheduler,
+    struct aws_h2_stream *stream,
+    size_t num_bytes) {
+
+    (void)scheduler;
+    stream->thread_data.scheduler_data.deficit -= (int64_t)num_bytes;
+}
+
+static bool s_weighted_fair_is_empty(const struct aws_h2_data_scheduler *scheduler) {
+    const struct weighted_fair_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct weighted_fair_scheduler, base);
+    return aws_linked_list_empty(&impl->streams);
+}
+
+static const struct aws_h2_data_scheduler_vtable s_weighted_fair_vtable = {
+    .destroy = s_weighted_fair_destroy,
+    .push = s_weighted_fair_push,
+    .pop = s_weighted_fair_pop,
+    .on_data_sent = s_weighted_fair_on_data_sent,
+    .is_empty = s_weighted_fair_is_empty,
+};
+
+static struct aws_h2_data_scheduler *s_weighted_fair_new(struct aws_allocator *alloc) {
+    struct weighted_fair_scheduler *impl = aws_mem_calloc(alloc, 1, sizeof(struct weighted_fair_scheduler));
+    if (!impl) {
+        return NULL;
+    }
+
+    impl->base.vtable = &s_weighted_fair_vtable;
+    impl->base.alloc = alloc;
+    aws_linked_list_init(&impl->streams);
+    return &impl->base;
+}
+
+/*****************************************************************************
+ * Strict priority: the most urgent streams always go first.
+ * Streams of equal urgency take turns, one frame each.
+ *****************************************************************************/
+
+struct strict_priority_scheduler {
+    struct aws_h2_data_scheduler base;
+    struct aws_linked_list streams_by_urgency[AWS_H2_STRICT_PRIORITY_URGENCY_COUNT];
+};
+
+static void s_strict_priority_destroy(struct aws_h2_data_scheduler *scheduler) {
+    struct strict_priority_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct strict_priority_scheduler, base);
+    aws_mem_release(scheduler->alloc, impl);
+}
+
+static void s_strict_priority_push(struct aws_h2_data_scheduler *scheduler, struct aws_h2_stream *stream) {
+    struct strict_priority_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct strict_priority_scheduler, base);
+    uint8_t urgency = stream->thread_data.scheduler_data.priority.urgency;
+    AWS_ASSERT(urgency < AWS_H2_STRICT_PRIORITY_URGENCY_COUNT);
+    aws_linked_list_push_back(&impl->streams_by_urgency[urgency], &stream->node);
+}
+
+static struct aws_h2_stream *s_strict_priority_pop(struct aws_h2_data_scheduler *scheduler) {
+    struct strict_priority_scheduler *impl = AWS_CONTAINER_OF(scheduler, struct strict_priority_scheduler, base);
+    for (size_t i = 0; i < AWS_H2_STRICT_PRIORITY_URGENCY_COUNT; ++i) {
+        if (!aws_linked_list_empty(&impl->streams_by_urgency[i])) {
+            return s_stream_from_node(aws_linked_list_pop_front(&impl->streams_by_urgency[i]));
+        }
+    }
+
+    AWS_FATAL_ASSERT(0 && "pop() called on empty scheduler");
+    return NULL;
+}
+
+static void s_strict_priority_on_data_sent(
+    struct aws_h2_data_scheduler *scheduler,
+    struct aws_h2_stream *stream,
+    size_t num_bytes) {
+
+    (void)scheduler;
+    (void)stream;
+    (void)num_bytes;
+}
+
+static bool s_strict_priority_is_empty(const struct aws_h2_data_scheduler *scheduler) {
+    const struct strict_priority_scheduler *impl =
+        AWS_CONTAINER_OF(scheduler, struct strict_priority_scheduler, base);
+    for (size_t i = 0; i < AWS_H2_STRICT_PRIORITY_URGENCY_COUNT; ++i) {
+        if (!aws_linked_list_empty(&impl->streams_by_urgency[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static const struct aws_h2_data_scheduler_vtable s_strict_priority_vtable = {
+    .destroy = s_strict_priority_destroy,
+    .push = s_strict_priority_push,
+    .pop = s_strict_priority_pop,
+    .on_data_sent = s_strict_priority_on_data_sent,
+    .is_empty = s_strict_priority_is_empty,
+};
+
+static struct aws_h2_data_scheduler *s_strict_priority_new(struct aws_allocator *alloc) {
+    struct strict_priority_scheduler *impl = aws_mem_calloc(alloc, 1, sizeof(struct strict_priority_scheduler));
+    if (!impl) {
+        return NULL;
+    }
+
+    impl->base.vtable = &s_strict_priority_vtable;
+    impl->base.alloc = alloc;
+    for (size_t i = 0; i < AWS_H2_STRICT_PRIORITY_URGENCY_COUNT; ++i) {
+        aws_linked_list_init(&impl->streams_by_urgency[i]);
+    }
+    return &impl->base;
+}
+
+/*****************************************************************************
+ * Common
+ *****************************************************************************/
+
+struct aws_h2_data_scheduler *aws_h2_data_scheduler_new(
+    struct aws_allocator *alloc,
+    enum aws_http2_data_scheduler_type type) {
+
+    AWS_PRECONDITION(alloc);
+
+    switch (type) {
+        case AWS_HTTP2_DATA_SCHEDULER_ROUND_ROBIN:
+            return s_round_robin_new(alloc);
+        case AWS_HTTP2_DATA_SCHEDULER_WEIGHTED_FAIR:
+            return s_weighted_fair_new(alloc);
+        case AWS_HTTP2_DATA_SCHEDULER_STRICT_PRIORITY:
+            return s_strict_priority_new(alloc);
+        default:
+            aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+            return NULL;
+    }
+}
+
+void aws_h2_data_scheduler_destroy(struct aws_h2_data_scheduler *scheduler) {
+    if (!scheduler) {
+        return;
+    }
+
+    AWS_ASSERT(aws_h2_data_scheduler_is_empty(scheduler));
+    scheduler->vtable->destroy(scheduler);
+}
+
+void aws_h2_data_scheduler_push(struct aws_h2_data_scheduler *scheduler, struct aws_h2_stream *stream) {
+    AWS_PRECONDITION(scheduler);
+    AWS_PRECONDITION(stream);
+    AWS_PRECONDITION(!stream->thread_data.scheduler_data.is_scheduled);
+    AWS_PRECONDITION(stream->node.next == NULL);
+
+    stream->thread_data.scheduler_data.is_scheduled = true;
+    scheduler->vtable->push(scheduler, stream);
+}
+
+struct aws_h2_stream *aws_h2_data_scheduler_pop(struct aws_h2_data_scheduler *scheduler) {
+    AWS_PRECONDITION(scheduler);
+
+    if (scheduler->vtable->is_empty(scheduler)) {
+        return NULL;
+    }
+
+    struct aws_h2_stream *stream = scheduler->vtable->pop(scheduler);
+    AWS_ASSERT(stream->thread_data.scheduler_data.is_scheduled);
+    stream->thread_data.scheduler_data.is_scheduled = false;
+    return stream;
+}
+
+void aws_h2_data_scheduler_on_data_sent(
+    struct aws_h2_data_scheduler *scheduler,
+    struct aws_h2_stream *stream,
+    size_t num_bytes) {
+
+    AWS_PRECONDITION(scheduler);
+    AWS_PRECONDITION(stream);
+
+    scheduler->vtable->on_data_sent(scheduler, stream, num_bytes);
+}
+
+void aws_h2_data_scheduler_remove(struct aws_h2_data_scheduler *scheduler, struct aws_h2_stream *stream) {
+    AWS_PRECONDITION(scheduler);
+    AWS_PRECONDITION(stream);
+    (void)scheduler;
+
+    if (stream->thread_data.scheduler_data.is_scheduled) {
+        aws_linked_list_remove(&stream->node);
+        stream->thread_data.scheduler_data.is_scheduled = false;
+    }
+}
+
+void aws_h2_data_scheduler_set_priority(
+    struct aws_h2_data_scheduler *scheduler,
+    struct aws_h2_stream *stream,
+    const struct aws_http2_stream_priority *priority) {
+
+    AWS_PRECONDITION(scheduler);
+    AWS_PRECONDITION(stream);
+    AWS_PRECONDITION(priority);
+
+    bool was_scheduled = stream->thread_data.scheduler_data.is_scheduled;
+    aws_h2_data_scheduler_remove(scheduler, stream);
+
+    stream->thread_data.scheduler_data.priority = *priority;
+
+    if (was_scheduled) {
+        aws_h2_data_scheduler_push(scheduler, stream);
+    }
+}
+
+bool aws_h2_data_scheduler_is_empty(const struct aws_h2_data_scheduler *scheduler) {
+    AWS_PRECONDITION(scheduler);
+
+    return scheduler->vtable->is_empty(scheduler);
+}
@@ -656,6 +656,8 @@ static struct aws_h2err s_state_fn_prefix(struct aws_h2_decoder *decoder, struct
         frame->stream_id,
         frame->payload_len);
 
+    DECODER_CALL_VTABLE_ARGS(decoder, on_frame_prefix, frame->type, frame->payload_len);
+
     if (decoder->frame_in_progress.type == AWS_H2_FRAME_T_DATA) {
         /* We invoke the on_data_begin here to report the whole payload size */
         DECODER_CALL_VTABLE_STREAM_ARGS(decoder, on_data_begin, frame->payload_len, frame->flags.end_stream);
@@ -301,6 +301,11 @@ int aws_h2_frame_encoder_init(
         return AWS_OP_ERR;
     }
 
+    if (aws_byte_buf_init(&encoder->header_block_buf, allocator, s_encoded_header_block_reserve)) {
+        aws_hpack_context_destroy(encoder->hpack);
+        return AWS_OP_ERR;
+    }
+
     encoder->settings.max_frame_size = aws_h2_settings_initial[AWS_HTTP2_SETTINGS_MAX_FRAME_SIZE];
     return AWS_OP_SUCCESS;
 }
@@ -308,6 +313,7 @@ void aws_h2_frame_encoder_clean_up(struct aws_h2_frame_encoder *encoder) {
     AWS_PRECONDITION(encoder);
 
     aws_hpack_context_destroy(encoder->hpack);
+    aws_byte_buf_clean_up(&encoder->header_block_buf);
 }
 
 /***********************************************************************************************************************
@@ -487,8 +493,9 @@ struct aws_h2_frame_headers {
         AWS_H2_HEADERS_STATE_COMPLETE,
     } state;
 
-    struct aws_byte_buf whole_encoded_header_block;
-    struct aws_byte_cursor header_block_cursor; /* tracks progress sending encoded header-block in fragments */
+    /* Points into encoder's header_block_buf.
+     * Tracks progress sending encoded header-block in fragments */
+    struct aws_byte_cursor header_block_cursor;
 };
 
 static struct aws_h2_frame *s_frame_new_headers_or_push_promise(
@@ -528,10 +535,6 @@ static struct aws_h2_frame *s_frame_new_headers_or_push_promise(
         return NULL;
     }
 
-    if (aws_byte_buf_init(&frame->whole_encoded_header_block, allocator, s_encoded_header_block_reserve)) {
-        goto error;
-    }
-
     if (frame_type == AWS_H2_FRAME_T_HEADERS) {
         frame->end_stream = end_stream;
         if (optional_priority) {
@@ -549,10 +552,6 @@ static struct aws_h2_frame *s_frame_new_headers_or_push_promise(
     frame->pad_length = pad_length;
 
     return &frame->base;
-
-error:
-    s_frame_headers_destroy(&frame->base);
-    return NULL;
 }
 
 struct aws_h2_frame *aws_h2_frame_new_headers(
@@ -595,7 +594,6 @@ struct aws_h2_frame *aws_h2_frame_new_push_promise(
 static void s_frame_headers_destroy(struct aws_h2_frame *frame_base) {
     struct aws_h2_frame_headers *frame = AWS_CONTAINER_OF(frame_base, struct aws_h2_frame_headers, base);
     aws_http_headers_release((struct aws_http_headers *)frame->headers);
-    aws_byte_buf_clean_up(&frame->whole_encoded_header_block);
     aws_mem_release(frame->base.alloc, frame);
 }
 
@@ -749,7 +747,8 @@ static int s_frame_headers_encode(
     /* Pre-encode the entire header-block into another buffer
      * the first time we're called. */
     if (frame->state == AWS_H2_HEADERS_STATE_INIT) {
-        if (aws_hpack_encode_header_block(encoder->hpack, frame->headers, &frame->whole_encoded_header_block)) {
+        aws_byte_buf_reset(&encoder->header_block_buf, false);
+        if (aws_hpack_encode_header_block(encoder->hpack, frame->headers, &encoder->header_block_buf)) {
             ENCODER_LOGF(
                 ERROR,
                 encoder,
@@ -760,7 +759,7 @@ static int s_frame_headers_encode(
             goto error;
         }
 
-        frame->header_block_cursor = aws_byte_cursor_from_buf(&frame->whole_encoded_header_block);
+        frame->header_block_cursor = aws_byte_cursor_from_buf(&encoder->header_block_buf);
         frame->state = AWS_H2_HEADERS_STATE_FIRST_FRAME;
     }
 
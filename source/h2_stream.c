@@ -18,7 +18,14 @@ static int s_stream_get_received_error_code(struct aws_http_stream *stream_base,
 static int s_stream_get_sent_error_code(struct aws_http_stream *stream_base, uint32_t *out_http2_error);
 
 static void s_stream_cross_thread_work_task(struct aws_channel_task *task, void *arg, enum aws_task_status status);
+static int s_stream_set_priority(
+    struct aws_http_stream *stream_base,
+    const struct aws_http2_stream_priority *priority);
 static struct aws_h2err s_send_rst_and_close_stream(struct aws_h2_stream *stream, struct aws_h2err stream_error);
+static struct aws_h2err s_send_response_headers(
+    struct aws_h2_stream *stream,
+    struct aws_http_message *response,
+    struct aws_h2_frame *headers_frame);
 
 struct aws_http_stream_vtable s_h2_stream_vtable = {
     .destroy = s_stream_destroy,
@@ -28,6 +35,7 @@ struct aws_http_stream_vtable s_h2_stream_vtable = {
     .http2_reset_stream = s_stream_reset_stream,
     .http2_get_received_error_code = s_stream_get_received_error_code,
     .http2_get_sent_error_code = s_stream_get_sent_error_code,
+    .http2_set_priority = s_stream_set_priority,
 };
 
 const char *aws_h2_stream_state_to_str(enum aws_h2_stream_state state) {
@@ -215,53 +223,121 @@ static int s_stream_send_update_window_frame(struct aws_h2_stream *stream, size_
     return AWS_OP_SUCCESS;
 }
 
-struct aws_h2_stream *aws_h2_stream_new_request(
-    struct aws_http_connection *client_connection,
-    const struct aws_http_make_request_options *options) {
-    AWS_PRECONDITION(client_connection);
-    AWS_PRECONDITION(options);
+/* Common new() logic for client & server streams */
+static struct aws_h2_stream *s_stream_new_common(
+    struct aws_http_connection *owning_connection,
+    void *user_data,
+    aws_http_on_incoming_headers_fn *on_incoming_headers,
+    aws_http_on_incoming_header_block_done_fn *on_incoming_header_block_done,
+    aws_http_on_incoming_body_fn *on_incoming_body,
+    aws_http_on_stream_complete_fn *on_complete) {
 
-    struct aws_h2_stream *stream = aws_mem_calloc(client_connection->alloc, 1, sizeof(struct aws_h2_stream));
+    struct aws_h2_stream *stream = aws_mem_calloc(owning_connection->alloc, 1, sizeof(struct aws_h2_stream));
     if (!stream) {
         return NULL;
     }
 
     /* Initialize base stream */
     stream->base.vtable = &s_h2_stream_vtable;
-    stream->base.alloc = client_connection->alloc;
-    stream->base.owning_connection = client_connection;
-    stream->base.user_data = options->user_data;
-    stream->base.on_incoming_headers = options->on_response_headers;
-    stream->base.on_incoming_header_block_done = options->on_response_header_block_done;
-    stream->base.on_incoming_body = options->on_response_body;
-    stream->base.on_complete = options->on_complete;
-    stream->base.client_data = &stream->base.client_or_server_data.client;
-    stream->base.client_data->response_status = AWS_HTTP_STATUS_CODE_UNKNOWN;
-
-    /* Stream refcount starts at 1, and gets incremented again for the connection upon a call to activate() */
+    stream->base.alloc = owning_connection->alloc;
+    stream->base.owning_connection = owning_connection;
+    stream->base.user_data = user_data;
+    stream->base.on_incoming_headers = on_incoming_headers;
+    stream->base.on_incoming_header_block_done = on_incoming_header_block_done;
+    stream->base.on_incoming_body = on_incoming_body;
+    stream->base.on_complete = on_complete;
+
+    /* Stream refcount starts at 1, and gets incremented again for the connection once it's active */
     aws_atomic_init_int(&stream->base.refcount, 1);
 
     /* Init H2 specific stuff */
     stream->thread_data.state = AWS_H2_STREAM_STATE_IDLE;
-    stream->thread_data.outgoing_message = options->request;
 
     stream->sent_reset_error_code = -1;
     stream->received_reset_error_code = -1;
 
     stream->synced_data.user_reset_error_code = AWS_HTTP2_ERR_COUNT;
     stream->synced_data.api_state = AWS_H2_STREAM_API_STATE_INIT;
+
+    struct aws_http2_stream_priority default_priority = AWS_HTTP2_STREAM_PRIORITY_INIT;
+    stream->synced_data.priority = default_priority;
+    stream->thread_data.scheduler_data.priority = default_priority;
     if (aws_mutex_init(&stream->synced_data.lock)) {
         AWS_H2_STREAM_LOGF(
             ERROR, stream, "Mutex init error %d (%s).", aws_last_error(), aws_error_name(aws_last_error()));
         aws_mem_release(stream->base.alloc, stream);
         return NULL;
     }
-    aws_http_message_acquire(stream->thread_data.outgoing_message);
     aws_channel_task_init(
         &stream->cross_thread_work_task, s_stream_cross_thread_work_task, stream, "HTTP/2 stream cross-thread work");
     return stream;
 }
 
+struct aws_h2_stream *aws_h2_stream_new_request(
+    struct aws_http_connection *client_connection,
+    const struct aws_http_make_request_options *options) {
+    AWS_PRECONDITION(client_connection);
+    AWS_PRECONDITION(options);
+
+    struct aws_h2_stream *stream = s_stream_new_common(
+        client_connection,
+        options->user_data,
+        options->on_response_headers,
+        options->on_response_header_block_done,
+        options->on_response_body,
+        options->on_complete);
+    if (!stream) {
+        return NULL;
+    }
+
+    stream->base.client_data = &stream->base.client_or_server_data.client;
+    stream->base.client_data->response_status = AWS_HTTP_STATUS_CODE_UNKNOWN;
+    stream->base.on_incoming_body_slice = options->on_response_body_slice;
+
+    stream->thread_data.outgoing_message = options->request;
+    aws_http_message_acquire(stream->thread_data.outgoing_message);
+    return stream;
+}
+
+struct aws_h2_stream *aws_h2_stream_new_request_handler(
+    const struct aws_http_request_handler_options *options,
+    uint32_t stream_id) {
+    AWS_PRECONDITION(options);
+    AWS_PRECONDITION(stream_id != 0);
+
+    struct aws_h2_stream *stream = s_stream_new_common(
+        options->server_connection,
+        options->user_data,
+        options->on_request_headers,
+        options->on_request_header_block_done,
+        options->on_request_body,
+        options->on_complete);
+    if (!stream) {
+        return NULL;
+    }
+    AWS_PRECONDITION_ON_CHANNEL_THREAD(stream);
+
+    stream->base.id = stream_id;
+    stream->base.server_data = &stream->base.client_or_server_data.server;
+    stream->base.server_data->on_request_done = options->on_request_done;
+
+    /* Request-handler (server) streams don't need user to call activate() on them.
+     * They are created on the event-loop thread, while the peer's HEADERS are being decoded. */
+    stream->synced_data.api_state = AWS_H2_STREAM_API_STATE_ACTIVE;
+
+    /* Initialize the flow-control window size */
+    struct aws_h2_connection *connection = s_get_h2_connection(stream);
+    stream->thread_data.window_size_peer =
+        connection->thread_data.settings_peer[AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE];
+    stream->thread_data.window_size_self =
+        connection->thread_data.settings_self[AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE];
+
+    /* connection keeps request-handler stream alive until stream completes */
+    aws_atomic_fetch_add(&stream->base.refcount, 1);
+
+    return stream;
+}
+
 static void s_stream_cross_thread_work_task(struct aws_channel_task *task, void *arg, enum aws_task_status status) {
     (void)task;
 
@@ -284,20 +360,36 @@ static void s_stream_cross_thread_work_task(struct aws_channel_task *task, void
     bool reset_called;
     size_t window_update_size;
     uint32_t user_reset_error_code;
+    bool priority_changed;
+    struct aws_http2_stream_priority priority;
+    struct aws_http_message *pending_response;
+    struct aws_h2_frame *pending_response_headers_frame;
 
     { /* BEGIN CRITICAL SECTION */
         s_lock_synced_data(stream);
         stream->synced_data.is_cross_thread_work_task_scheduled = false;
 
+        pending_response = stream->synced_data.pending_response;
+        stream->synced_data.pending_response = NULL;
+        pending_response_headers_frame = stream->synced_data.pending_response_headers_frame;
+        stream->synced_data.pending_response_headers_frame = NULL;
+
         /* window_update_size is ensured to be not greater than AWS_H2_WINDOW_UPDATE_MAX */
         window_update_size = stream->synced_data.window_update_size;
         stream->synced_data.window_update_size = 0;
         reset_called = stream->synced_data.reset_called;
         user_reset_error_code = stream->synced_data.user_reset_error_code;
+        priority_changed = stream->synced_data.priority_changed;
+        stream->synced_data.priority_changed = false;
+        priority = stream->synced_data.priority;
 
         s_unlock_synced_data(stream);
     } /* END CRITICAL SECTION */
 
+    if (priority_changed) {
+        aws_h2_connection_set_stream_priority(connection, stream, &priority);
+    }
+
     if (window_update_size > 0 && !ignore_window_update) {
         if (s_stream_send_update_window_frame(stream, window_update_size)) {
             /* Treat this as a connection error */
@@ -309,7 +401,15 @@ static void s_stream_cross_thread_work_task(struct aws_channel_task *task, void
      * overflows, remote peer will find it out. So just apply the change and ignore the possible overflow.*/
     stream->thread_data.window_size_self += window_update_size;
 
-    if (reset_called) {
+    if (pending_response) {
+        struct aws_h2err returned_h2err =
+            s_send_response_headers(stream, pending_response, pending_response_headers_frame);
+        if (aws_h2err_failed(returned_h2err)) {
+            aws_h2_connection_shutdown_due_to_write_err(connection, returned_h2err.aws_code);
+        }
+    }
+
+    if (reset_called && aws_h2_stream_get_state(stream) != AWS_H2_STREAM_STATE_CLOSED) {
         struct aws_h2err h2err;
         h2err.h2_code = user_reset_error_code;
         if (stream->base.server_data && stream->thread_data.state == AWS_H2_STREAM_STATE_HALF_CLOSED_LOCAL) {
@@ -341,6 +441,13 @@ static void s_stream_destroy(struct aws_http_stream *stream_base) {
     aws_mutex_clean_up(&stream->synced_data.lock);
     aws_http_message_release(stream->thread_data.outgoing_message);
 
+    /* Response may never have made it to the thread, if stream closed first */
+    aws_http_message_release(stream->synced_data.pending_response);
+    aws_h2_frame_destroy(stream->synced_data.pending_response_headers_frame);
+
+    aws_byte_buf_clean_up(&stream->request_method_buf);
+    aws_byte_buf_clean_up(&stream->request_path_buf);
+
     aws_mem_release(stream->base.alloc, stream);
 }
 
@@ -407,6 +514,37 @@ static void s_stream_update_window(struct aws_http_stream *stream_base, size_t i
     }
 }
 
+static int s_stream_set_priority(
+    struct aws_http_stream *stream_base,
+    const struct aws_http2_stream_priority *priority) {
+
+    struct aws_h2_stream *stream = AWS_CONTAINER_OF(stream_base, struct aws_h2_stream, base);
+    struct aws_h2_connection *connection = s_get_h2_connection(stream);
+    bool cross_thread_work_should_schedule = false;
+
+    { /* BEGIN CRITICAL SECTION */
+        s_lock_synced_data(stream);
+
+        /* If the stream isn't active yet, this gets picked up when it activates */
+        stream->synced_data.priority = *priority;
+        if (stream->synced_data.api_state == AWS_H2_STREAM_API_STATE_ACTIVE) {
+            stream->synced_data.priority_changed = true;
+            cross_thread_work_should_schedule = !stream->synced_data.is_cross_thread_work_task_scheduled;
+            stream->synced_data.is_cross_thread_work_task_scheduled = true;
+        }
+        s_unlock_synced_data(stream);
+    } /* END CRITICAL SECTION */
+
+    if (cross_thread_work_should_schedule) {
+        AWS_H2_STREAM_LOG(TRACE, stream, "Scheduling stream cross-thread work task");
+        /* increment the refcount of stream to keep it alive until the task runs */
+        aws_atomic_fetch_add(&stream->base.refcount, 1);
+        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &stream->cross_thread_work_task);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
 static int s_stream_reset_stream(struct aws_http_stream *stream_base, uint32_t http2_error) {
 
     struct aws_h2_stream *stream = AWS_CONTAINER_OF(stream_base, struct aws_h2_stream, base);
@@ -467,6 +605,131 @@ static int s_stream_get_sent_error_code(struct aws_http_stream *stream_base, uin
     return AWS_OP_SUCCESS;
 }
 
+/* A response to HEAD must not have a body (RFC-7231 4.3.2) */
+static bool s_response_has_body(const struct aws_h2_stream *stream, struct aws_http_message *response) {
+    return aws_http_message_get_body_stream(response) != NULL && stream->base.request_method != AWS_HTTP_METHOD_HEAD;
+}
+
+int aws_h2_stream_send_response(struct aws_h2_stream *stream, struct aws_http_message *response) {
+    AWS_PRECONDITION(stream->base.server_data);
+
+    struct aws_h2_connection *connection = s_get_h2_connection(stream);
+    int error_code = 0;
+
+    /* Validate the response and create its HEADERS frame now, so the user learns of any problems immediately.
+     * The frame is moved to the connection's thread by the cross-thread work task */
+    struct aws_h2_frame *headers_frame = NULL;
+    struct aws_http_headers *h2_headers = aws_h2_create_headers_from_response(response, stream->base.alloc);
+    if (!h2_headers) {
+        AWS_H2_STREAM_LOGF(
+            ERROR, stream, "Failed to create HTTP/2 style headers from response %s", aws_error_name(aws_last_error()));
+        return AWS_OP_ERR;
+    }
+
+    headers_frame = aws_h2_frame_new_headers(
+        stream->base.alloc,
+        stream->base.id,
+        h2_headers,
+        !s_response_has_body(stream, response) /* end_stream */,
+        0 /* padding - not currently configurable via public API */,
+        NULL /* priority - not currently configurable via public API */);
+
+    /* Release refcount of h2_headers here, let frame take the full ownership of it */
+    aws_http_headers_release(h2_headers);
+    if (!headers_frame) {
+        AWS_H2_STREAM_LOGF(ERROR, stream, "Failed to create HEADERS frame: %s", aws_error_name(aws_last_error()));
+        return AWS_OP_ERR;
+    }
+
+    bool cross_thread_work_should_schedule = false;
+    { /* BEGIN CRITICAL SECTION */
+        s_lock_synced_data(stream);
+
+        if (stream->synced_data.api_state == AWS_H2_STREAM_API_STATE_COMPLETE) {
+            error_code = AWS_ERROR_HTTP_STREAM_HAS_COMPLETED;
+        } else if (stream->synced_data.has_outgoing_response) {
+            error_code = AWS_ERROR_INVALID_STATE;
+        } else {
+            stream->synced_data.has_outgoing_response = true;
+            stream->synced_data.pending_response = response;
+            aws_http_message_acquire(response);
+            stream->synced_data.pending_response_headers_frame = headers_frame;
+
+            cross_thread_work_should_schedule = !stream->synced_data.is_cross_thread_work_task_scheduled;
+            stream->synced_data.is_cross_thread_work_task_scheduled = true;
+        }
+        s_unlock_synced_data(stream);
+    } /* END CRITICAL SECTION */
+
+    if (error_code) {
+        AWS_H2_STREAM_LOGF(
+            ERROR, stream, "Failed to send response, error %d (%s)", error_code, aws_error_name(error_code));
+        aws_h2_frame_destroy(headers_frame);
+        return aws_raise_error(error_code);
+    }
+
+    AWS_H2_STREAM_LOG(DEBUG, stream, "Created response");
+
+    if (cross_thread_work_should_schedule) {
+        AWS_H2_STREAM_LOG(TRACE, stream, "Scheduling stream cross-thread work task");
+        /* increment the refcount of stream to keep it alive until the task runs */
+        aws_atomic_fetch_add(&stream->base.refcount, 1);
+        aws_channel_schedule_task_now(connection->base.channel_slot->channel, &stream->cross_thread_work_task);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+/* Response has arrived on the connection's thread, start sending it.
+ * A Connection Error is returned if something goes catastrophically wrong */
+static struct aws_h2err s_send_response_headers(
+    struct aws_h2_stream *stream,
+    struct aws_http_message *response,
+    struct aws_h2_frame *headers_frame) {
+
+    AWS_PRECONDITION_ON_CHANNEL_THREAD(stream);
+    AWS_PRECONDITION(
+        stream->thread_data.state == AWS_H2_STREAM_STATE_OPEN ||
+        stream->thread_data.state == AWS_H2_STREAM_STATE_HALF_CLOSED_REMOTE);
+
+    struct aws_h2_connection *connection = s_get_h2_connection(stream);
+
+    /* Stream takes ownership of response, connection takes ownership of frame */
+    stream->thread_data.outgoing_message = response;
+    aws_h2_connection_enqueue_outgoing_frame(connection, headers_frame);
+
+    if (s_response_has_body(stream, response)) {
+        /* DATA frames are sent later, whenever the connection has nothing more urgent to send */
+        AWS_H2_STREAM_LOG(TRACE, stream, "Sending response HEADERS");
+        aws_h2_connection_add_outgoing_stream(connection, stream);
+        return AWS_H2ERR_SUCCESS;
+    }
+
+    if (stream->thread_data.state == AWS_H2_STREAM_STATE_OPEN) {
+        /* Else can't close until we receive END_STREAM */
+        stream->thread_data.state = AWS_H2_STREAM_STATE_HALF_CLOSED_LOCAL;
+        AWS_H2_STREAM_LOG(TRACE, stream, "Sending response HEADERS with END_STREAM. State -> HALF_CLOSED_LOCAL");
+        return AWS_H2ERR_SUCCESS;
+    }
+
+    /* Both sides have sent END_STREAM */
+    stream->thread_data.state = AWS_H2_STREAM_STATE_CLOSED;
+    AWS_H2_STREAM_LOG(TRACE, stream, "Sending response HEADERS with END_STREAM. State -> CLOSED");
+    { /* BEGIN CRITICAL SECTION */
+        s_lock_synced_data(stream);
+        stream->synced_data.api_state = AWS_H2_STREAM_API_STATE_COMPLETE;
+        s_unlock_synced_data(stream);
+    } /* END CRITICAL SECTION */
+
+    /* Tell connection that stream is now closed */
+    if (aws_h2_connection_on_stream_closed(
+            connection, stream, AWS_H2_STREAM_CLOSED_WHEN_BOTH_SIDES_END_STREAM, AWS_ERROR_SUCCESS)) {
+        return aws_h2err_from_last_error();
+    }
+
+    return AWS_H2ERR_SUCCESS;
+}
+
 enum aws_h2_stream_state aws_h2_stream_get_state(const struct aws_h2_stream *stream) {
     AWS_PRECONDITION_ON_CHANNEL_THREAD(stream);
     return stream->thread_data.state;
@@ -556,6 +819,11 @@ int aws_h2_stream_on_activated(struct aws_h2_stream *stream, bool *out_has_outgo
         goto error;
     }
 
+    /* Pick up any priority the user set before activating */
+    s_lock_synced_data(stream);
+    stream->thread_data.scheduler_data.priority = stream->synced_data.priority;
+    s_unlock_synced_data(stream);
+
     /* Initialize the flow-control window size */
     stream->thread_data.window_size_peer =
         connection->thread_data.settings_peer[AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE];
@@ -563,7 +831,7 @@ int aws_h2_stream_on_activated(struct aws_h2_stream *stream, bool *out_has_outgo
         connection->thread_data.settings_self[AWS_HTTP2_SETTINGS_INITIAL_WINDOW_SIZE];
 
     if (has_body_stream) {
-        /* If stream has DATA to send, put it in the outgoing_streams_list, and we'll send data later */
+        /* If stream has DATA to send, put it in the data_scheduler, and we'll send data later */
         stream->thread_data.state = AWS_H2_STREAM_STATE_OPEN;
         AWS_H2_STREAM_LOG(TRACE, stream, "Sending HEADERS. State -> OPEN");
     } else {
@@ -670,6 +938,13 @@ struct aws_h2err aws_h2_stream_on_decoder_headers_begin(struct aws_h2_stream *st
         return s_send_rst_and_close_stream(stream, stream_err);
     }
 
+    if (stream->thread_data.state == AWS_H2_STREAM_STATE_IDLE) {
+        /* Server receiving request HEADERS opens the stream (RFC-7540 5.1) */
+        AWS_ASSERT(stream->base.server_data);
+        stream->thread_data.state = AWS_H2_STREAM_STATE_OPEN;
+        AWS_H2_STREAM_LOG(TRACE, stream, "Receiving request HEADERS. State -> OPEN");
+    }
+
     return AWS_H2ERR_SUCCESS;
 }
 
@@ -716,7 +991,32 @@ struct aws_h2err aws_h2_stream_on_decoder_headers_i(
     }
 
     if (is_server) {
-        return aws_h2err_from_aws_code(AWS_ERROR_UNIMPLEMENTED);
+        /* Server keeps a copy of the request's :method and :path, they're exposed via server_data */
+        if (block_type == AWS_HTTP_HEADER_BLOCK_MAIN &&
+            (name_enum == AWS_HTTP_HEADER_METHOD || name_enum == AWS_HTTP_HEADER_PATH)) {
+
+            struct aws_byte_buf *storage_buf =
+                (name_enum == AWS_HTTP_HEADER_METHOD) ? &stream->request_method_buf : &stream->request_path_buf;
+            if (storage_buf->buffer != NULL) {
+                AWS_H2_STREAM_LOGF(
+                    ERROR,
+                    stream,
+                    "Malformed message, duplicate " PRInSTR " header",
+                    AWS_BYTE_CURSOR_PRI(header->name));
+                goto malformed;
+            }
+
+            if (aws_byte_buf_init_copy_from_cursor(storage_buf, stream->base.alloc, header->value)) {
+                return aws_h2err_from_last_error();
+            }
+
+            if (name_enum == AWS_HTTP_HEADER_METHOD) {
+                stream->base.server_data->request_method_str = aws_byte_cursor_from_buf(storage_buf);
+                stream->base.request_method = aws_http_str_to_method(header->value);
+            } else {
+                stream->base.server_data->request_path = aws_byte_cursor_from_buf(storage_buf);
+            }
+        }
 
     } else {
         /* Client */
@@ -767,6 +1067,16 @@ struct aws_h2err aws_h2_stream_on_decoder_headers_end(
         case AWS_HTTP_HEADER_BLOCK_MAIN:
             AWS_H2_STREAM_LOG(TRACE, stream, "Main header-block done.");
             stream->thread_data.received_main_headers = true;
+
+            /* RFC-7540 8.1.2.3 - requests must have :method, and all but CONNECT must have :path */
+            if (stream->base.server_data &&
+                (stream->request_method_buf.buffer == NULL ||
+                 (stream->request_path_buf.buffer == NULL &&
+                  stream->base.request_method != AWS_HTTP_METHOD_CONNECT))) {
+
+                AWS_H2_STREAM_LOG(ERROR, stream, "Malformed request lacks required pseudo-header fields.");
+                return s_send_rst_and_close_stream(stream, aws_h2err_from_h2_code(AWS_HTTP2_ERR_PROTOCOL_ERROR));
+            }
             break;
         case AWS_HTTP_HEADER_BLOCK_TRAILING:
             AWS_H2_STREAM_LOG(TRACE, stream, "Trailing 1xx header-block done.");
@@ -868,7 +1178,15 @@ struct aws_h2err aws_h2_stream_on_decoder_data_i(struct aws_h2_stream *stream, s
     /* Not calling s_check_state_allows_frame_type() here because we already checked at start of DATA frame in
      * aws_h2_stream_on_decoder_data_begin() */
 
-    if (stream->base.on_incoming_body) {
+    if (stream->base.on_incoming_body_slice) {
+        /* HTTP/2 does not lend its read buffers, so this slice cannot be acquired */
+        struct aws_http_body_slice slice = {.data = data, .owner = NULL};
+        if (stream->base.on_incoming_body_slice(&stream->base, &slice, stream->base.user_data)) {
+            AWS_H2_STREAM_LOGF(
+                ERROR, stream, "Incoming body callback raised error, %s", aws_error_name(aws_last_error()));
+            return aws_h2err_from_last_error();
+        }
+    } else if (stream->base.on_incoming_body) {
         if (stream->base.on_incoming_body(&stream->base, &data, stream->base.user_data)) {
             AWS_H2_STREAM_LOGF(
                 ERROR, stream, "Incoming body callback raised error, %s", aws_error_name(aws_last_error()));
@@ -917,6 +1235,14 @@ struct aws_h2err aws_h2_stream_on_decoder_end_stream(struct aws_h2_stream *strea
      * an actual frame type. It's a flag on DATA or HEADERS frames, and we
      * already checked the legality of those frames in their respective callbacks. */
 
+    if (stream->base.server_data && stream->base.server_data->on_request_done) {
+        if (stream->base.server_data->on_request_done(&stream->base, stream->base.user_data)) {
+            AWS_H2_STREAM_LOGF(
+                ERROR, stream, "Incoming request done callback raised error, %s", aws_error_name(aws_last_error()));
+            return aws_h2err_from_last_error();
+        }
+    }
+
     if (stream->thread_data.state == AWS_H2_STREAM_STATE_HALF_CLOSED_LOCAL) {
         /* Both sides have sent END_STREAM */
         stream->thread_data.state = AWS_H2_STREAM_STATE_CLOSED;
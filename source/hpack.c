@@ -6,8 +6,6 @@
 
 #include <aws/http/request_response.h>
 
-#include <aws/compression/huffman.h>
-
 #include <aws/common/byte_buf.h>
 #include <aws/common/hash_table.h>
 #include <aws/common/logging.h>
@@ -19,17 +17,30 @@
 
 /* RFC-7540 6.5.2 */
 const size_t s_hpack_dynamic_table_initial_size = 4096;
-const size_t s_hpack_dynamic_table_initial_elements = 512;
 /* TBD */
 const size_t s_hpack_dynamic_table_max_size = 16 * 1024 * 1024;
 
-/* Used for growing the dynamic table buffer when it fills up */
-const float s_hpack_dynamic_table_buffer_growth_rate = 1.5F;
+/* Every dynamic table entry costs at least this many bytes [4.1] */
+#define HPACK_DYNAMIC_TABLE_ENTRY_OVERHEAD 32
+
+/* Dynamic table storage starts this small, and doubles as needed (up to what max_size can use) */
+#define HPACK_DYNAMIC_TABLE_INITIAL_ENTRIES_CAPACITY 8
+#define HPACK_DYNAMIC_TABLE_INITIAL_STRINGS_CAPACITY 256
 
 /* Used while decoding the header name & value, grows if necessary */
 const size_t s_hpack_decoder_scratch_initial_size = 512;
 
-struct aws_huffman_symbol_coder *hpack_get_coder(void);
+/* RFC-7541 Appendix B, indexed by symbol */
+struct hpack_huffman_code {
+    uint32_t pattern;
+    uint8_t num_bits;
+};
+
+static const struct hpack_huffman_code s_huffman_codes[256] = {
+#define HUFFMAN_CODE(psymbol, pbit_string, pbit_code, pnum_bits) {.pattern = pbit_code, .num_bits = pnum_bits},
+#include <aws/http/private/hpack_huffman_static_table.def>
+#undef HUFFMAN_CODE
+};
 
 /* Return a byte with the N right-most bits masked.
  * Ex: 2 -> 00000011 */
@@ -136,20 +147,15 @@ struct aws_http_header s_static_header_table[] = {
 };
 static const size_t s_static_header_table_size = AWS_ARRAY_SIZE(s_static_header_table);
 
-struct aws_byte_cursor s_static_header_table_name_only[] = {
-#define HEADER(_index, _name) [_index] = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(_name),
-#define HEADER_WITH_VALUE(_index, _name, _value) HEADER(_index, _name)
-
-#include <aws/http/private/hpack_header_static_table.def>
-
-#undef HEADER
-#undef HEADER_WITH_VALUE
-};
-
-/* aws_http_header * -> size_t */
-static struct aws_hash_table s_static_header_reverse_lookup;
-/* aws_byte_cursor * -> size_t */
-static struct aws_hash_table s_static_header_reverse_lookup_name_only;
+/*
+ * Static table lookups use a precomputed hash of each name, in a small open-addressed table.
+ * Entries that share a name are adjacent in the static table, so once the name is found,
+ * finding the name-and-value is a short scan with no further hashing.
+ */
+#define HPACK_STATIC_NAME_BUCKETS 128 /* Power of 2, and more than twice the number of entries */
+static uint64_t s_static_header_name_hashes[AWS_ARRAY_SIZE(s_static_header_table)];
+/* Index of the first static table entry with a given name, or 0 if the bucket is empty */
+static uint8_t s_static_name_buckets[HPACK_STATIC_NAME_BUCKETS];
 
 static uint64_t s_header_hash(const void *key) {
     const struct aws_http_header *header = key;
@@ -170,44 +176,116 @@ static bool s_header_eq(const void *a, const void *b) {
 }
 
 void aws_hpack_static_table_init(struct aws_allocator *allocator) {
+    (void)allocator;
+    AWS_FATAL_ASSERT(s_static_header_table_size * 2 < HPACK_STATIC_NAME_BUCKETS);
+
+    memset(s_static_name_buckets, 0, sizeof(s_static_name_buckets));
 
-    int result = aws_hash_table_init(
-        &s_static_header_reverse_lookup,
-        allocator,
-        s_static_header_table_size - 1,
-        s_header_hash,
-        s_header_eq,
-        NULL,
-        NULL);
-    AWS_FATAL_ASSERT(AWS_OP_SUCCESS == result);
-
-    result = aws_hash_table_init(
-        &s_static_header_reverse_lookup_name_only,
-        allocator,
-        s_static_header_table_size - 1,
-        aws_hash_byte_cursor_ptr,
-        (aws_hash_callback_eq_fn *)aws_byte_cursor_eq,
-        NULL,
-        NULL);
-    AWS_FATAL_ASSERT(AWS_OP_SUCCESS == result);
-
-    /* Process in reverse so that name_only prefers lower indices */
-    for (size_t i = s_static_header_table_size - 1; i > 0; --i) {
-        /* the tables are created as 1-based indexing */
-        result = aws_hash_table_put(&s_static_header_reverse_lookup, &s_static_header_table[i], (void *)i, NULL);
-        AWS_FATAL_ASSERT(AWS_OP_SUCCESS == result);
-
-        result = aws_hash_table_put(
-            &s_static_header_reverse_lookup_name_only, &s_static_header_table_name_only[i], (void *)(i), NULL);
-        AWS_FATAL_ASSERT(AWS_OP_SUCCESS == result);
+    /* the tables are created as 1-based indexing */
+    for (size_t i = 1; i < s_static_header_table_size; ++i) {
+        const struct aws_byte_cursor *name = &s_static_header_table[i].name;
+        s_static_header_name_hashes[i] = aws_hash_byte_cursor_ptr(name);
+
+        /* Only the first entry with a given name goes in a bucket */
+        if (aws_byte_cursor_eq(name, &s_static_header_table[i - 1].name)) {
+            continue;
+        }
+
+        size_t bucket = s_static_header_name_hashes[i] & (HPACK_STATIC_NAME_BUCKETS - 1);
+        while (s_static_name_buckets[bucket] != 0) {
+            bucket = (bucket + 1) & (HPACK_STATIC_NAME_BUCKETS - 1);
+        }
+        s_static_name_buckets[bucket] = (uint8_t)i;
     }
 }
 
 void aws_hpack_static_table_clean_up() {
-    aws_hash_table_clean_up(&s_static_header_reverse_lookup);
-    aws_hash_table_clean_up(&s_static_header_reverse_lookup_name_only);
+    /* Nothing to clean up, the static lookup table doesn't allocate */
+}
+
+/* Returns index of the first static table entry with this name, or 0 if not found */
+static size_t s_static_table_find_name(const struct aws_byte_cursor *name, uint64_t name_hash) {
+    size_t bucket = name_hash & (HPACK_STATIC_NAME_BUCKETS - 1);
+    size_t index;
+    while ((index = s_static_name_buckets[bucket]) != 0) {
+        if (s_static_header_name_hashes[index] == name_hash &&
+            aws_byte_cursor_eq(&s_static_header_table[index].name, name)) {
+            return index;
+        }
+        bucket = (bucket + 1) & (HPACK_STATIC_NAME_BUCKETS - 1);
+    }
+    return 0;
 }
 
+/*
+ * The encoder remembers how it encoded each header of the previous header-block, by position.
+ * Requests on a connection tend to repeat most of their headers exactly (ex: only :path, date, and signature change),
+ * so when a header matches its slot, the table lookups and string encoding can be skipped.
+ */
+#define HPACK_ENCODER_CACHE_SLOTS 32
+/* Don't bother remembering headers larger than this (name.len + value.len) */
+#define HPACK_ENCODER_CACHE_MAX_HEADER_LEN 256
+
+enum hpack_cached_representation {
+    /* Nothing cached, encode normally */
+    HPACK_CACHED_NONE,
+    /* Encoding doesn't depend on the dynamic table, so the bytes can be replayed as-is */
+    HPACK_CACHED_BYTES,
+    /* Indexed header field, referring to an entry in the dynamic table.
+     * The entry's index shifts as new entries are inserted, and the entry may be evicted,
+     * so the index is recalculated from the entry's insertion id each time. */
+    HPACK_CACHED_DYNAMIC_INDEXED,
+};
+
+struct hpack_encoder_cache_slot {
+    enum hpack_cached_representation type;
+    enum aws_http_header_compression compression;
+    size_t name_len;
+    size_t value_len;
+
+    /* If HPACK_CACHED_DYNAMIC_INDEXED. Id of dynamic table entry (see dynamic_table.num_inserted) */
+    uint64_t dynamic_entry_id;
+
+    /* Holds copy of name, then value, then (if HPACK_CACHED_BYTES) the encoded representation */
+    struct aws_byte_buf storage;
+};
+
+/*
+ * Headers whose values are unique per message. Indexing them just evicts entries that might have been reused.
+ * Used by AWS_HTTP2_HPACK_INDEXING_SELECTIVE and AWS_HTTP2_HPACK_INDEXING_ADAPTIVE.
+ */
+static const struct aws_byte_cursor s_never_index_names[] = {
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("authorization"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-length"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("content-md5"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("date"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("etag"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("if-match"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("if-none-match"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-content-sha256"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-date"),
+    AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("x-amz-request-id"),
+};
+
+/*
+ * AWS_HTTP2_HPACK_INDEXING_ADAPTIVE keeps a few counters per header name, in a small direct-mapped table.
+ * Names are identified by hash alone. A collision just mixes two names' counters, which only costs compression.
+ */
+#define HPACK_ADAPTIVE_NAME_SLOTS 64 /* Power of 2 */
+/* Don't judge a name until its entries have been inserted this many times */
+#define HPACK_ADAPTIVE_MIN_INSERTS 8
+/* Stop indexing a name if fewer than 1 in this many insertions get reused */
+#define HPACK_ADAPTIVE_MIN_REUSE_RATIO 8
+/* After skipping a name this many times, forget its counters and give it another chance */
+#define HPACK_ADAPTIVE_RETRY_AFTER_SKIPS 256
+
+struct hpack_adaptive_name_stats {
+    uint64_t name_hash;
+    uint32_t num_inserts;
+    uint32_t num_reuses;
+    uint32_t num_skips;
+};
+
 /* Insertion is backwards, indexing is forwards */
 struct aws_hpack_context {
     struct aws_allocator *allocator;
@@ -216,8 +294,7 @@ struct aws_hpack_context {
     enum aws_http_log_subject log_subject;
     const void *log_id;
 
-    struct aws_huffman_encoder encoder;
-    struct aws_huffman_decoder decoder;
+    struct aws_hpack_huffman_decoder decoder;
 
     struct {
         size_t last_value;
@@ -226,13 +303,25 @@ struct aws_hpack_context {
     } dynamic_table_size_update;
 
     struct {
-        /* Array of headers, pointers to memory we alloced, which needs to be cleaned up whenever we move an entry out
-         */
-        struct aws_http_header *buffer;
-        size_t buffer_capacity; /* Number of http_headers that can fit in buffer */
-
+        /* Ring of entries. The entry with id N is at entries[N % entries_capacity].
+         * Grows on demand, doubling each time. Every entry costs at least 32 bytes [4.1],
+         * so it never needs to grow past max_size / 32. */
+        struct aws_http_header *entries;
+        size_t entries_capacity;
         size_t num_elements;
-        size_t index_0;
+
+        /* Total number of entries ever inserted. Each entry's id is the value of this counter before insertion.
+         * The live entries are ids [num_inserted - num_elements, num_inserted).
+         * The lookup tables map to ids, which don't change as entries come and go, so they never need rewriting. */
+        uint64_t num_inserted;
+
+        /* Byte ring holding each entry's name, immediately followed by its value, in insertion order.
+         * An entry's strings never wrap around the end of the ring. If they don't fit at the end, they go at the start.
+         * Grows on demand, doubling each time. At twice max_size there's always room,
+         * so it never needs to grow past that (see s_dynamic_table_place_strings()) */
+        uint8_t *strings;
+        size_t strings_capacity;
+        size_t strings_head; /* Where the next entry's strings go */
 
         /* Size in bytes, according to [4.1] */
         size_t size;
@@ -240,12 +329,22 @@ struct aws_hpack_context {
 
         /* SETTINGS_HEADER_TABLE_SIZE from http2 */
         size_t protocol_max_size_setting;
-        /* aws_http_header * -> size_t */
+
+        /* aws_http_header * -> size_t id */
         struct aws_hash_table reverse_lookup;
-        /* aws_byte_cursor * -> size_t */
+        /* aws_byte_cursor * -> size_t id */
         struct aws_hash_table reverse_lookup_name_only;
     } dynamic_table;
 
+    struct {
+        struct hpack_encoder_cache_slot slots[HPACK_ENCODER_CACHE_SLOTS];
+    } encoder_cache;
+
+    enum aws_http2_hpack_indexing_policy indexing_policy;
+    struct hpack_adaptive_name_stats adaptive_names[HPACK_ADAPTIVE_NAME_SLOTS];
+
+    struct aws_hpack_encoder_stats encoder_stats;
+
     /* PRO TIP: Don't union these, since string_decode calls integer_decode */
     struct hpack_progress_integer {
         enum {
@@ -321,33 +420,22 @@ struct aws_hpack_context *aws_hpack_context_new(
     context->log_subject = log_subject;
     context->log_id = log_id;
 
-    /* Initialize the huffman coders */
-    struct aws_huffman_symbol_coder *hpack_coder = hpack_get_coder();
-    aws_huffman_encoder_init(&context->encoder, hpack_coder);
-    aws_huffman_decoder_init(&context->decoder, hpack_coder);
-    aws_huffman_decoder_allow_growth(&context->decoder, true);
-
-    /* #TODO Rewrite to be based on octet-size instead of list-size */
+    /* Initialize the huffman decoder */
+    aws_hpack_huffman_decoder_reset(&context->decoder);
 
     /* Initialize dynamic table */
-    context->dynamic_table.max_size = s_hpack_dynamic_table_initial_size;
     /* Initial header table size for http2 setting is the same as initial size for dynamic table */
     context->dynamic_table.protocol_max_size_setting = s_hpack_dynamic_table_initial_size;
-    context->dynamic_table.buffer_capacity = s_hpack_dynamic_table_initial_elements;
-    context->dynamic_table.buffer =
-        aws_mem_calloc(allocator, context->dynamic_table.buffer_capacity, sizeof(struct aws_http_header));
-    if (!context->dynamic_table.buffer) {
-        goto dynamic_table_buffer_failed;
-    }
 
     context->dynamic_table_size_update.pending = false;
     context->dynamic_table_size_update.last_value = SIZE_MAX;
     context->dynamic_table_size_update.smallest_value = SIZE_MAX;
 
+    const size_t initial_max_elements = s_hpack_dynamic_table_initial_size / HPACK_DYNAMIC_TABLE_ENTRY_OVERHEAD;
     if (aws_hash_table_init(
             &context->dynamic_table.reverse_lookup,
             allocator,
-            s_hpack_dynamic_table_initial_elements,
+            initial_max_elements,
             s_header_hash,
             s_header_eq,
             NULL,
@@ -358,7 +446,7 @@ struct aws_hpack_context *aws_hpack_context_new(
     if (aws_hash_table_init(
             &context->dynamic_table.reverse_lookup_name_only,
             allocator,
-            s_hpack_dynamic_table_initial_elements,
+            initial_max_elements,
             aws_hash_byte_cursor_ptr,
             (aws_hash_callback_eq_fn *)aws_byte_cursor_eq,
             NULL,
@@ -366,6 +454,9 @@ struct aws_hpack_context *aws_hpack_context_new(
         goto name_only_failed;
     }
 
+    /* Storage is allocated as entries are inserted */
+    context->dynamic_table.max_size = s_hpack_dynamic_table_initial_size;
+
     if (aws_byte_buf_init(&context->progress_entry.scratch, allocator, s_hpack_decoder_scratch_initial_size)) {
         goto scratch_failed;
     }
@@ -379,45 +470,137 @@ name_only_failed:
     aws_hash_table_clean_up(&context->dynamic_table.reverse_lookup);
 
 reverse_lookup_failed:
-    if (context->dynamic_table.buffer) {
-        aws_mem_release(allocator, context->dynamic_table.buffer);
-    }
-
-dynamic_table_buffer_failed:
     aws_mem_release(allocator, context);
 
     return NULL;
 }
 
-static struct aws_http_header *s_dynamic_table_get(const struct aws_hpack_context *context, size_t index);
-
-static void s_clean_up_dynamic_table_buffer(struct aws_hpack_context *context) {
-    while (context->dynamic_table.num_elements > 0) {
-        struct aws_http_header *back = s_dynamic_table_get(context, context->dynamic_table.num_elements - 1);
-        context->dynamic_table.num_elements -= 1;
-        /* clean-up the memory we allocate for it */
-        aws_mem_release(context->allocator, back->name.ptr);
-    }
-    aws_mem_release(context->allocator, context->dynamic_table.buffer);
-}
-
 void aws_hpack_context_destroy(struct aws_hpack_context *context) {
     if (!context) {
         return;
     }
-    if (context->dynamic_table.buffer) {
-        s_clean_up_dynamic_table_buffer(context);
-    }
+    aws_mem_release(context->allocator, context->dynamic_table.entries);
+    aws_mem_release(context->allocator, context->dynamic_table.strings);
     aws_hash_table_clean_up(&context->dynamic_table.reverse_lookup);
     aws_hash_table_clean_up(&context->dynamic_table.reverse_lookup_name_only);
     aws_byte_buf_clean_up(&context->progress_entry.scratch);
+    for (size_t i = 0; i < HPACK_ENCODER_CACHE_SLOTS; ++i) {
+        aws_byte_buf_clean_up(&context->encoder_cache.slots[i].storage);
+    }
     aws_mem_release(context->allocator, context);
 }
 
+static void s_encoder_cache_clear(struct aws_hpack_context *context) {
+    for (size_t i = 0; i < HPACK_ENCODER_CACHE_SLOTS; ++i) {
+        context->encoder_cache.slots[i].type = HPACK_CACHED_NONE;
+    }
+}
+
 void aws_hpack_set_huffman_mode(struct aws_hpack_context *context, enum aws_hpack_huffman_mode mode) {
+    if (mode != context->huffman_mode) {
+        /* Cached string encodings are no longer valid */
+        s_encoder_cache_clear(context);
+    }
     context->huffman_mode = mode;
 }
 
+int aws_hpack_set_indexing_policy(struct aws_hpack_context *context, enum aws_http2_hpack_indexing_policy policy) {
+    switch (policy) {
+        case AWS_HTTP2_HPACK_INDEXING_ALL:
+        case AWS_HTTP2_HPACK_INDEXING_SELECTIVE:
+        case AWS_HTTP2_HPACK_INDEXING_ADAPTIVE:
+            break;
+        default:
+            HPACK_LOGF(ERROR, context, "Unknown indexing policy %d", (int)policy);
+            return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+
+    if (policy != context->indexing_policy) {
+        /* Cached encodings may have been made under the old policy */
+        s_encoder_cache_clear(context);
+        AWS_ZERO_ARRAY(context->adaptive_names);
+    }
+    context->indexing_policy = policy;
+    return AWS_OP_SUCCESS;
+}
+
+void aws_hpack_get_encoder_stats(const struct aws_hpack_context *context, struct aws_hpack_encoder_stats *out_stats) {
+    *out_stats = context->encoder_stats;
+}
+
+static struct hpack_adaptive_name_stats *s_adaptive_name_stats(
+    struct aws_hpack_context *context,
+    struct aws_byte_cursor name) {
+
+    const uint64_t name_hash = aws_hash_byte_cursor_ptr(&name);
+    struct hpack_adaptive_name_stats *stats =
+        &context->adaptive_names[name_hash & (HPACK_ADAPTIVE_NAME_SLOTS - 1)];
+    if (stats->name_hash != name_hash) {
+        AWS_ZERO_STRUCT(*stats);
+        stats->name_hash = name_hash;
+    }
+    return stats;
+}
+
+/* Returns whether the indexing policy allows this header to be inserted into the dynamic table */
+static bool s_indexing_policy_allows(struct aws_hpack_context *context, const struct aws_http_header *header) {
+    if (context->indexing_policy == AWS_HTTP2_HPACK_INDEXING_ALL) {
+        return true;
+    }
+
+    /* Don't insert anything taking up more than half the table, it would evict everything else */
+    if (aws_hpack_get_header_size(header) > context->dynamic_table.max_size / 2) {
+        return false;
+    }
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(s_never_index_names); ++i) {
+        if (aws_byte_cursor_eq_ignore_case(&header->name, &s_never_index_names[i])) {
+            return false;
+        }
+    }
+
+    if (context->indexing_policy == AWS_HTTP2_HPACK_INDEXING_ADAPTIVE) {
+        struct hpack_adaptive_name_stats *stats = s_adaptive_name_stats(context, header->name);
+        if (stats->num_inserts >= HPACK_ADAPTIVE_MIN_INSERTS &&
+            (uint64_t)stats->num_reuses * HPACK_ADAPTIVE_MIN_REUSE_RATIO < stats->num_inserts) {
+
+            if (++stats->num_skips >= HPACK_ADAPTIVE_RETRY_AFTER_SKIPS) {
+                /* Forget the history, so the name gets indexed again for a while */
+                stats->num_inserts = 0;
+                stats->num_reuses = 0;
+                stats->num_skips = 0;
+            }
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* A dynamic table entry was sent as an index, or a new entry was inserted */
+static void s_indexing_policy_on_dynamic_entry_used(
+    struct aws_hpack_context *context,
+    struct aws_byte_cursor name,
+    bool inserted) {
+
+    if (context->indexing_policy != AWS_HTTP2_HPACK_INDEXING_ADAPTIVE) {
+        return;
+    }
+
+    struct hpack_adaptive_name_stats *stats = s_adaptive_name_stats(context, name);
+    if (inserted) {
+        stats->num_inserts++;
+    } else {
+        stats->num_reuses++;
+    }
+
+    /* Halve the counters before they overflow, which also makes recent history count more */
+    if (stats->num_inserts == UINT32_MAX || stats->num_reuses == UINT32_MAX) {
+        stats->num_inserts /= 2;
+        stats->num_reuses /= 2;
+    }
+}
+
 size_t aws_hpack_get_header_size(const struct aws_http_header *header) {
     return header->name.len + header->value.len + 32;
 }
@@ -426,16 +609,16 @@ size_t aws_hpack_get_dynamic_table_num_elements(const struct aws_hpack_context *
     return context->dynamic_table.num_elements;
 }
 
-/*
- * Gets the header from the dynamic table.
- * NOTE: This function only bounds checks on the buffer size, not the number of elements.
- */
+static struct aws_http_header *s_dynamic_table_entry(const struct aws_hpack_context *context, uint64_t id) {
+    return &context->dynamic_table.entries[id % context->dynamic_table.entries_capacity];
+}
+
+/* Gets the header from the dynamic table, where index 0 is the newest entry */
 static struct aws_http_header *s_dynamic_table_get(const struct aws_hpack_context *context, size_t index) {
 
-    AWS_ASSERT(index < context->dynamic_table.buffer_capacity);
+    AWS_ASSERT(index < context->dynamic_table.num_elements);
 
-    return &context->dynamic_table
-                .buffer[(context->dynamic_table.index_0 + index) % context->dynamic_table.buffer_capacity];
+    return s_dynamic_table_entry(context, context->dynamic_table.num_inserted - 1 - index);
 }
 
 const struct aws_http_header *aws_hpack_get_header(const struct aws_hpack_context *context, size_t index) {
@@ -471,14 +654,23 @@ size_t aws_hpack_find_index(
 
     *found_value = false;
 
+    /* Hash the name just once for the static table */
+    const size_t static_name_index =
+        s_static_table_find_name(&header->name, aws_hash_byte_cursor_ptr(&header->name));
+
     struct aws_hash_element *elem = NULL;
     if (search_value) {
-        /* Check name-and-value first in static table */
-        aws_hash_table_find(&s_static_header_reverse_lookup, header, &elem);
-        if (elem) {
-            /* If an element was found, check if it has a value */
-            *found_value = ((const struct aws_http_header *)elem->key)->value.len;
-            return (size_t)elem->value;
+        /* Check name-and-value first in static table, entries with the same name are adjacent */
+        if (static_name_index) {
+            for (size_t i = static_name_index;
+                 i < s_static_header_table_size && aws_byte_cursor_eq(&s_static_header_table[i].name, &header->name);
+                 ++i) {
+                if (aws_byte_cursor_eq(&s_static_header_table[i].value, &header->value)) {
+                    /* If an element was found, check if it has a value */
+                    *found_value = s_static_header_table[i].value.len;
+                    return i;
+                }
+            }
         }
         /* Check name-and-value in dynamic table */
         aws_hash_table_find(&context->dynamic_table.reverse_lookup, header, &elem);
@@ -489,9 +681,8 @@ size_t aws_hpack_find_index(
     }
     /* Check the name-only table. Note, even if we search for value, when we fail in searching for name-and-value, we
      * should also check the name only table */
-    aws_hash_table_find(&s_static_header_reverse_lookup_name_only, &header->name, &elem);
-    if (elem) {
-        return (size_t)elem->value;
+    if (static_name_index) {
+        return static_name_index;
     }
     aws_hash_table_find(&context->dynamic_table.reverse_lookup_name_only, &header->name, &elem);
     if (elem) {
@@ -501,46 +692,41 @@ size_t aws_hpack_find_index(
 
 trans_index_from_dynamic_table:
     AWS_ASSERT(elem);
-    size_t index;
-    const size_t absolute_index = (size_t)elem->value;
-    if (absolute_index >= context->dynamic_table.index_0) {
-        index = absolute_index - context->dynamic_table.index_0;
-    } else {
-        index = (context->dynamic_table.buffer_capacity - context->dynamic_table.index_0) + absolute_index;
-    }
-    /* Need to add the static table size to re-base indicies */
-    index += s_static_header_table_size;
-    return index;
+    /* Lookup tables store the entry's id (truncated to size_t, but live ids are never that far apart).
+     * Newest entry is index 0 of the dynamic table, and we need to add the static table size to re-base indices */
+    const size_t newest_id = (size_t)(context->dynamic_table.num_inserted - 1);
+    return s_static_header_table_size + (newest_id - (size_t)elem->value);
 }
 
 /* Remove elements from the dynamic table until it fits in max_size bytes */
 static int s_dynamic_table_shrink(struct aws_hpack_context *context, size_t max_size) {
     while (context->dynamic_table.size > max_size && context->dynamic_table.num_elements > 0) {
-        struct aws_http_header *back = s_dynamic_table_get(context, context->dynamic_table.num_elements - 1);
+        const uint64_t id = context->dynamic_table.num_inserted - context->dynamic_table.num_elements;
+        struct aws_http_header *back = s_dynamic_table_entry(context, id);
 
-        /* "Remove" the header from the table */
+        /* "Remove" the header from the table. Its strings in the ring are now free to be overwritten. */
         context->dynamic_table.size -= aws_hpack_get_header_size(back);
         context->dynamic_table.num_elements -= 1;
 
-        /* Remove old header from hash tables */
-        if (aws_hash_table_remove(&context->dynamic_table.reverse_lookup, back, NULL, NULL)) {
-            HPACK_LOG(ERROR, context, "Failed to remove header from the reverse lookup table");
-            goto error;
+        /* Remove old header from hash tables.
+         * If the lookup is pointing to a newer entry with the same contents, leave it alone. */
+        struct aws_hash_element *elem = NULL;
+        aws_hash_table_find(&context->dynamic_table.reverse_lookup, back, &elem);
+        if (elem && (size_t)elem->value == (size_t)id) {
+            if (aws_hash_table_remove_element(&context->dynamic_table.reverse_lookup, elem)) {
+                HPACK_LOG(ERROR, context, "Failed to remove header from the reverse lookup table");
+                goto error;
+            }
         }
 
-        /* If the name-only lookup is pointing to the element we're removing, it needs to go.
-         * If not, it's pointing to a younger, sexier element. */
-        struct aws_hash_element *elem = NULL;
+        elem = NULL;
         aws_hash_table_find(&context->dynamic_table.reverse_lookup_name_only, &back->name, &elem);
-        if (elem && elem->key == back) {
+        if (elem && (size_t)elem->value == (size_t)id) {
             if (aws_hash_table_remove_element(&context->dynamic_table.reverse_lookup_name_only, elem)) {
                 HPACK_LOG(ERROR, context, "Failed to remove header from the reverse lookup (name-only) table");
                 goto error;
             }
         }
-
-        /* clean up the memory we allocated to hold the name and value string*/
-        aws_mem_release(context->allocator, back->name.ptr);
     }
 
     return AWS_OP_SUCCESS;
@@ -549,99 +735,177 @@ error:
     return AWS_OP_ERR;
 }
 
+/* Copy header's strings to dst, and point the entry at them */
+static void s_dynamic_table_copy_strings(
+    struct aws_http_header *entry,
+    const struct aws_http_header *src,
+    uint8_t *dst) {
+    *entry = *src;
+    entry->name.ptr = dst;
+    entry->value.ptr = dst + src->name.len;
+    if (src->name.len) {
+        memcpy(entry->name.ptr, src->name.ptr, src->name.len);
+    }
+    if (src->value.len) {
+        memcpy(entry->value.ptr, src->value.ptr, src->value.len);
+    }
+}
+
+/* Most entries a table of max_size could ever hold */
+static size_t s_dynamic_table_max_entries_capacity(size_t max_size) {
+    return max_size / HPACK_DYNAMIC_TABLE_ENTRY_OVERHEAD;
+}
+
+/* Biggest the string ring ever needs to be for a table of max_size.
+ * Can't overflow, max_size is limited to s_hpack_dynamic_table_max_size */
+static size_t s_dynamic_table_max_strings_capacity(size_t max_size) {
+    return max_size * 2;
+}
+
+/* Total length of the strings of every entry in the table */
+static size_t s_dynamic_table_strings_len(const struct aws_hpack_context *context) {
+    /* Every entry's size is its strings plus the fixed overhead [4.1] */
+    return context->dynamic_table.size - context->dynamic_table.num_elements * HPACK_DYNAMIC_TABLE_ENTRY_OVERHEAD;
+}
+
 /*
- * Resizes the dynamic table storage buffer to new_max_elements.
- * Useful when inserting over capacity, or when downsizing.
- * Do shrink first, if you want to remove elements, or memory leak will happen.
+ * (Re)allocate storage with the given capacities, keeping the current entries, which must already fit.
+ * The strings are packed at the start of the new ring, and the lookup tables are rebuilt since entries moved.
+ * This happens when the table grows into its max_size, or shrinks to a smaller max_size.
  */
-static int s_dynamic_table_resize_buffer(struct aws_hpack_context *context, size_t new_max_elements) {
+static int s_dynamic_table_set_capacity(
+    struct aws_hpack_context *context,
+    size_t new_entries_capacity,
+    size_t new_strings_capacity) {
 
-    /* Clear the old hash tables */
-    aws_hash_table_clear(&context->dynamic_table.reverse_lookup);
-    aws_hash_table_clear(&context->dynamic_table.reverse_lookup_name_only);
+    AWS_ASSERT(context->dynamic_table.num_elements <= new_entries_capacity);
+    AWS_ASSERT(s_dynamic_table_strings_len(context) <= new_strings_capacity);
 
-    struct aws_http_header *new_buffer = NULL;
+    struct aws_http_header *new_entries = NULL;
+    uint8_t *new_strings = NULL;
 
-    if (AWS_UNLIKELY(new_max_elements == 0)) {
-        /* If new buffer is of size 0, don't both initializing, just clean up the old one. */
-        goto cleanup_old_buffer;
+    if (new_entries_capacity > 0) {
+        new_entries = aws_mem_calloc(context->allocator, new_entries_capacity, sizeof(struct aws_http_header));
+        if (!new_entries) {
+            return AWS_OP_ERR;
+        }
     }
-
-    /* Allocate the new buffer */
-    new_buffer = aws_mem_calloc(context->allocator, new_max_elements, sizeof(struct aws_http_header));
-    if (!new_buffer) {
-        return AWS_OP_ERR;
+    if (new_strings_capacity > 0) {
+        new_strings = aws_mem_acquire(context->allocator, new_strings_capacity);
+        if (!new_strings) {
+            aws_mem_release(context->allocator, new_entries);
+            return AWS_OP_ERR;
+        }
     }
 
-    /* Don't bother copying data if old buffer was of size 0 */
-    if (AWS_UNLIKELY(context->dynamic_table.num_elements == 0)) {
-        goto reset_dyn_table_state;
+    /* Copy entries over, oldest first */
+    const uint64_t oldest_id = context->dynamic_table.num_inserted - context->dynamic_table.num_elements;
+    size_t strings_head = 0;
+    for (uint64_t id = oldest_id; id < context->dynamic_table.num_inserted; ++id) {
+        const struct aws_http_header *old_entry = s_dynamic_table_entry(context, id);
+        struct aws_http_header *new_entry = &new_entries[id % new_entries_capacity];
+        s_dynamic_table_copy_strings(new_entry, old_entry, new_strings + strings_head);
+        strings_head += old_entry->name.len + old_entry->value.len;
     }
 
-    /*
-     * Take a buffer that looks like this:
-     *
-     *               Index 0
-     *               ^
-     * +---------------------------+
-     * | Below Block | Above Block |
-     * +---------------------------+
-     * And make it look like this:
-     *
-     * Index 0
-     * ^
-     * +-------------+-------------+
-     * | Above Block | Below Block |
-     * +-------------+-------------+
-     */
+    aws_mem_release(context->allocator, context->dynamic_table.entries);
+    aws_mem_release(context->allocator, context->dynamic_table.strings);
+    context->dynamic_table.entries = new_entries;
+    context->dynamic_table.entries_capacity = new_entries_capacity;
+    context->dynamic_table.strings = new_strings;
+    context->dynamic_table.strings_capacity = new_strings_capacity;
+    context->dynamic_table.strings_head = strings_head;
 
-    /* Copy as much the above block as possible */
-    size_t above_block_size = context->dynamic_table.buffer_capacity - context->dynamic_table.index_0;
-    if (above_block_size > new_max_elements) {
-        above_block_size = new_max_elements;
+    /* Re-insert all of the reverse lookup elements */
+    aws_hash_table_clear(&context->dynamic_table.reverse_lookup);
+    aws_hash_table_clear(&context->dynamic_table.reverse_lookup_name_only);
+    for (uint64_t id = oldest_id; id < context->dynamic_table.num_inserted; ++id) {
+        struct aws_http_header *entry = s_dynamic_table_entry(context, id);
+        if (aws_hash_table_put(&context->dynamic_table.reverse_lookup, entry, (void *)(size_t)id, NULL)) {
+            return AWS_OP_ERR;
+        }
+        if (aws_hash_table_put(
+                &context->dynamic_table.reverse_lookup_name_only, &entry->name, (void *)(size_t)id, NULL)) {
+            return AWS_OP_ERR;
+        }
     }
-    memcpy(
-        new_buffer,
-        context->dynamic_table.buffer + context->dynamic_table.index_0,
-        above_block_size * sizeof(struct aws_http_header));
 
-    /* Copy as much of below block as possible */
-    const size_t free_blocks_available = new_max_elements - above_block_size;
-    const size_t old_blocks_to_copy = context->dynamic_table.buffer_capacity - above_block_size;
-    const size_t below_block_size = aws_min_size(free_blocks_available, old_blocks_to_copy);
-    if (below_block_size) {
-        memcpy(
-            new_buffer + above_block_size,
-            context->dynamic_table.buffer,
-            below_block_size * sizeof(struct aws_http_header));
+    return AWS_OP_SUCCESS;
+}
+
+/*
+ * Finds the offset in the string ring where the next entry's strings go, returning false if there's no room.
+ * Entries must already have been evicted to make room for the new entry [4.4].
+ *
+ * Once the ring is 2 * max_size there's always room: after eviction, live strings take less than
+ * (max_size - len) bytes. If the ring has wrapped, the space skipped at the end is less than max_size bytes,
+ * so the free space between head and tail is at least len.
+ * If the ring hasn't wrapped, the free space is in 2 pieces (after head, and before tail)
+ * totalling at least (max_size + len) bytes, so if len doesn't fit after head it must fit before tail.
+ */
+static bool s_dynamic_table_place_strings(const struct aws_hpack_context *context, size_t len, size_t *out_offset) {
+    *out_offset = 0;
+    if (context->dynamic_table.num_elements == 0) {
+        return context->dynamic_table.strings_capacity >= len;
     }
 
-    /* Free the old memory */
-cleanup_old_buffer:
-    aws_mem_release(context->allocator, context->dynamic_table.buffer);
+    const struct aws_http_header *oldest =
+        s_dynamic_table_entry(context, context->dynamic_table.num_inserted - context->dynamic_table.num_elements);
+    const size_t tail = (size_t)(oldest->name.ptr - context->dynamic_table.strings);
+    const size_t head = context->dynamic_table.strings_head;
 
-    /* Reset state */
-reset_dyn_table_state:
-    if (context->dynamic_table.num_elements > new_max_elements) {
-        context->dynamic_table.num_elements = new_max_elements;
+    /* If head caught up with tail, the ring is either completely full (it wrapped, and the newest strings
+     * ended exactly where the oldest begin) or holds no string bytes at all. Only live bytes tell them apart. */
+    if (head == tail && s_dynamic_table_strings_len(context) > 0) {
+        return false;
     }
-    context->dynamic_table.buffer_capacity = new_max_elements;
-    context->dynamic_table.index_0 = 0;
-    context->dynamic_table.buffer = new_buffer;
 
-    /* Re-insert all of the reverse lookup elements */
-    for (size_t i = 0; i < context->dynamic_table.num_elements; ++i) {
-        if (aws_hash_table_put(
-                &context->dynamic_table.reverse_lookup, &context->dynamic_table.buffer[i], (void *)i, NULL)) {
-            return AWS_OP_ERR;
+    if (head >= tail) {
+        if (context->dynamic_table.strings_capacity - head >= len) {
+            *out_offset = head;
+            return true;
         }
-        if (aws_hash_table_put(
-                &context->dynamic_table.reverse_lookup_name_only,
-                &context->dynamic_table.buffer[i].name,
-                (void *)i,
-                NULL)) {
+        return tail >= len;
+    }
+
+    *out_offset = head;
+    return tail - head >= len;
+}
+
+/*
+ * Make sure there's storage for one more entry, with strings of len, growing the rings if necessary.
+ * Entries must already have been evicted to make room for the new entry [4.4].
+ * Returns the offset in the string ring where the entry's strings go.
+ */
+static int s_dynamic_table_reserve_entry(struct aws_hpack_context *context, size_t len, size_t *out_strings_offset) {
+    const size_t max_size = context->dynamic_table.max_size;
+    size_t new_entries_capacity = context->dynamic_table.entries_capacity;
+    size_t new_strings_capacity = context->dynamic_table.strings_capacity;
+
+    if (context->dynamic_table.num_elements == new_entries_capacity) {
+        new_entries_capacity = aws_min_size(
+            s_dynamic_table_max_entries_capacity(max_size),
+            aws_max_size(HPACK_DYNAMIC_TABLE_INITIAL_ENTRIES_CAPACITY, new_entries_capacity * 2));
+        AWS_FATAL_ASSERT(new_entries_capacity > context->dynamic_table.num_elements);
+    }
+
+    bool strings_fit = s_dynamic_table_place_strings(context, len, out_strings_offset);
+    if (!strings_fit) {
+        /* After repacking, everything needs to fit at the start of the ring */
+        const size_t needed = s_dynamic_table_strings_len(context) + len;
+        new_strings_capacity = aws_max_size(HPACK_DYNAMIC_TABLE_INITIAL_STRINGS_CAPACITY, new_strings_capacity * 2);
+        new_strings_capacity = aws_max_size(needed, new_strings_capacity);
+        new_strings_capacity = aws_min_size(s_dynamic_table_max_strings_capacity(max_size), new_strings_capacity);
+        AWS_FATAL_ASSERT(new_strings_capacity >= needed);
+    }
+
+    if (new_entries_capacity != context->dynamic_table.entries_capacity || !strings_fit) {
+        if (s_dynamic_table_set_capacity(context, new_entries_capacity, new_strings_capacity)) {
             return AWS_OP_ERR;
         }
+
+        strings_fit = s_dynamic_table_place_strings(context, len, out_strings_offset);
+        AWS_FATAL_ASSERT(strings_fit);
     }
 
     return AWS_OP_SUCCESS;
@@ -668,66 +932,28 @@ int aws_hpack_insert_header(struct aws_hpack_context *context, const struct aws_
         goto error;
     }
 
-    /* If we're out of space in the buffer, grow it */
-    if (context->dynamic_table.num_elements == context->dynamic_table.buffer_capacity) {
-        /* If the buffer is currently of 0 size, reset it back to its initial size */
-        const size_t new_size =
-            context->dynamic_table.buffer_capacity
-                ? (size_t)(context->dynamic_table.buffer_capacity * s_hpack_dynamic_table_buffer_growth_rate)
-                : s_hpack_dynamic_table_initial_elements;
-
-        if (s_dynamic_table_resize_buffer(context, new_size)) {
-            goto error;
-        }
-    }
-
-    /* Decrement index 0, wrapping if necessary */
-    if (context->dynamic_table.index_0 == 0) {
-        context->dynamic_table.index_0 = context->dynamic_table.buffer_capacity - 1;
-    } else {
-        context->dynamic_table.index_0--;
+    /* Copy the strings into the ring, and the header into the newest entry */
+    const size_t strings_len = header->name.len + header->value.len;
+    size_t strings_offset = 0;
+    if (s_dynamic_table_reserve_entry(context, strings_len, &strings_offset)) {
+        goto error;
     }
+    const uint64_t id = context->dynamic_table.num_inserted;
+    struct aws_http_header *table_header = s_dynamic_table_entry(context, id);
+    s_dynamic_table_copy_strings(table_header, header, context->dynamic_table.strings + strings_offset);
 
-    /* Increment num_elements */
+    context->dynamic_table.strings_head = strings_offset + strings_len;
+    context->dynamic_table.num_inserted++;
     context->dynamic_table.num_elements++;
-    /* Increment the size */
     context->dynamic_table.size += header_size;
 
-    /* Put the header at the "front" of the table */
-    struct aws_http_header *table_header = s_dynamic_table_get(context, 0);
-
-    /* TODO:: We can optimize this with ring buffer. */
-    /* allocate memory for the name and value, which will be deallocated whenever the entry is evicted from the table or
-     * the table is cleaned up. We keep the pointer in the name pointer of each entry */
-    const size_t buf_memory_size = header->name.len + header->value.len;
-
-    if (buf_memory_size) {
-        uint8_t *buf_memory = aws_mem_acquire(context->allocator, buf_memory_size);
-        if (!buf_memory) {
-            return AWS_OP_ERR;
-        }
-        struct aws_byte_buf buf = aws_byte_buf_from_empty_array(buf_memory, buf_memory_size);
-        /* Copy header, then backup strings into our own allocation */
-        *table_header = *header;
-        aws_byte_buf_append_and_update(&buf, &table_header->name);
-        aws_byte_buf_append_and_update(&buf, &table_header->value);
-    } else {
-        /* if buf_memory_size is 0, no memory needed, we will insert the empty header into dynamic table */
-        *table_header = *header;
-        table_header->name.ptr = NULL;
-        table_header->value.ptr = NULL;
-    }
     /* Write the new header to the look up tables */
-    if (aws_hash_table_put(
-            &context->dynamic_table.reverse_lookup, table_header, (void *)context->dynamic_table.index_0, NULL)) {
+    if (aws_hash_table_put(&context->dynamic_table.reverse_lookup, table_header, (void *)(size_t)id, NULL)) {
         goto error;
     }
     /* Note that we can just blindly put here, we want to overwrite any older entry so it isn't accidentally removed. */
     if (aws_hash_table_put(
-            &context->dynamic_table.reverse_lookup_name_only,
-            &table_header->name,
-            (void *)context->dynamic_table.index_0,
-            NULL)) {
+            &context->dynamic_table.reverse_lookup_name_only, &table_header->name, (void *)(size_t)id, NULL)) {
         goto error;
     }
 
@@ -762,14 +988,27 @@ int aws_hpack_resize_dynamic_table(struct aws_hpack_context *context, size_t new
         goto error;
     }
 
-    /* Resize the buffer to the current size */
-    if (s_dynamic_table_resize_buffer(context, context->dynamic_table.num_elements)) {
-        goto error;
+    /* Storage grows as entries are inserted, so there's nothing to allocate now.
+     * If downsizing, give back whatever storage the smaller table can't use. */
+    const size_t max_entries_capacity = s_dynamic_table_max_entries_capacity(new_max_size);
+    const size_t max_strings_capacity = s_dynamic_table_max_strings_capacity(new_max_size);
+    if (context->dynamic_table.entries_capacity > max_entries_capacity ||
+        context->dynamic_table.strings_capacity > max_strings_capacity) {
+
+        if (s_dynamic_table_set_capacity(
+                context,
+                aws_min_size(max_entries_capacity, context->dynamic_table.entries_capacity),
+                aws_min_size(max_strings_capacity, context->dynamic_table.strings_capacity))) {
+            goto error;
+        }
     }
 
     /* Update the max size */
     context->dynamic_table.max_size = new_max_size;
 
+    /* Cached encodings were chosen for the old size (ex: whether a header was too big to index) */
+    s_encoder_cache_clear(context);
+
     return AWS_OP_SUCCESS;
 
 error:
@@ -865,6 +1104,79 @@ handle_complete:
     return AWS_OP_SUCCESS;
 }
 
+/* Returns encoded length in bytes, or stops counting and returns SIZE_MAX once the length exceeds max_len */
+static size_t s_huffman_get_encoded_length(struct aws_byte_cursor to_encode, size_t max_len) {
+    /* Counting bits in 64-bit can't overflow, and bailing at max_bits ensures the byte count fits in size_t */
+    uint64_t num_bits = 0;
+    uint64_t max_bits = aws_mul_u64_saturating(max_len, 8);
+    for (size_t i = 0; i < to_encode.len; ++i) {
+        num_bits += s_huffman_codes[to_encode.ptr[i]].num_bits;
+        if (num_bits > max_bits) {
+            return SIZE_MAX;
+        }
+    }
+    return (size_t)((num_bits + 7) / 8);
+}
+
+/* Output must have encoded_len bytes of space available */
+static void s_huffman_encode(struct aws_byte_cursor to_encode, size_t encoded_len, struct aws_byte_buf *output) {
+    AWS_ASSERT(output->capacity - output->len >= encoded_len);
+    (void)encoded_len;
+
+    uint8_t *dst = output->buffer + output->len;
+
+    /* Codes are shifted into the bottom of the accumulator, and flushed from the top 32 bits at a time.
+     * Fewer than 32 bits are pending before a code is added, and codes are at most 30 bits, so it never overflows. */
+    uint64_t bits = 0;
+    size_t num_bits = 0;
+    for (size_t i = 0; i < to_encode.len; ++i) {
+        const struct hpack_huffman_code *code = &s_huffman_codes[to_encode.ptr[i]];
+        bits = (bits << code->num_bits) | code->pattern;
+        num_bits += code->num_bits;
+
+        if (num_bits >= 32) {
+            num_bits -= 32;
+            const uint32_t out = (uint32_t)(bits >> num_bits);
+            dst[0] = (uint8_t)(out >> 24);
+            dst[1] = (uint8_t)(out >> 16);
+            dst[2] = (uint8_t)(out >> 8);
+            dst[3] = (uint8_t)out;
+            dst += 4;
+        }
+    }
+
+    while (num_bits >= 8) {
+        num_bits -= 8;
+        *dst++ = (uint8_t)(bits >> num_bits);
+    }
+
+    /* Pad final byte with the most significant bits of EOS (all 1's) [5.2] */
+    if (num_bits > 0) {
+        *dst++ = (uint8_t)((bits << (8 - num_bits)) | (0xFF >> num_bits));
+    }
+
+    AWS_ASSERT((size_t)(dst - (output->buffer + output->len)) == encoded_len);
+    output->len = (size_t)(dst - output->buffer);
+}
+
+size_t aws_hpack_huffman_get_encoded_length(struct aws_byte_cursor to_encode) {
+    AWS_PRECONDITION(aws_byte_cursor_is_valid(&to_encode));
+    return s_huffman_get_encoded_length(to_encode, SIZE_MAX);
+}
+
+int aws_hpack_huffman_encode(struct aws_byte_cursor to_encode, struct aws_byte_buf *output) {
+    AWS_PRECONDITION(aws_byte_cursor_is_valid(&to_encode));
+    AWS_PRECONDITION(aws_byte_buf_is_valid(output));
+
+    const size_t encoded_len = s_huffman_get_encoded_length(to_encode, SIZE_MAX);
+    if (s_ensure_space(output, encoded_len)) {
+        return AWS_OP_ERR;
+    }
+
+    s_huffman_encode(to_encode, encoded_len, output);
+    return AWS_OP_SUCCESS;
+}
+
 int aws_hpack_encode_string(
     struct aws_hpack_context *context,
     struct aws_byte_cursor to_encode,
@@ -887,11 +1199,12 @@ int aws_hpack_encode_string(
 
         case AWS_HPACK_HUFFMAN_ALWAYS:
             use_huffman = 1;
-            str_length = aws_huffman_get_encoded_length(&context->encoder, to_encode);
+            str_length = s_huffman_get_encoded_length(to_encode, SIZE_MAX);
             break;
 
         case AWS_HPACK_HUFFMAN_SMALLEST:
-            str_length = aws_huffman_get_encoded_length(&context->encoder, to_encode);
+            /* Stop counting as soon as Huffman can't win */
+            str_length = s_huffman_get_encoded_length(to_encode, to_encode.len);
             if (str_length < to_encode.len) {
                 use_huffman = 1;
             } else {
@@ -927,15 +1240,11 @@ int aws_hpack_encode_string(
     /* Encode string data */
     if (str_length > 0) {
         if (use_huffman) {
-            /* Huffman encoder doesn't grow buffer, so we ensure it's big enough here */
             if (s_ensure_space(output, str_length)) {
                 goto error;
             }
 
-            if (aws_huffman_encode(&context->encoder, &to_encode, output)) {
-                HPACK_LOGF(ERROR, context, "Error from Huffman encoder: %s", aws_error_name(aws_last_error()));
-                goto error;
-            }
+            s_huffman_encode(to_encode, str_length, output);
 
         } else {
             if (aws_byte_buf_append_dynamic(output, &to_encode)) {
@@ -948,10 +1257,78 @@ int aws_hpack_encode_string(
 
 error:
     output->len = original_len;
-    aws_huffman_encoder_reset(&context->encoder);
     return AWS_OP_ERR;
 }
 
+void aws_hpack_huffman_decoder_reset(struct aws_hpack_huffman_decoder *decoder) {
+    AWS_PRECONDITION(decoder);
+    decoder->state = 0;
+    decoder->accept = true;
+}
+
+int aws_hpack_huffman_decode(
+    struct aws_hpack_huffman_decoder *decoder,
+    struct aws_byte_cursor *to_decode,
+    struct aws_byte_buf *output) {
+
+    AWS_PRECONDITION(decoder);
+    AWS_PRECONDITION(aws_byte_cursor_is_valid(to_decode));
+    AWS_PRECONDITION(aws_byte_buf_is_valid(output));
+
+    /* Each transition emits at most 1 symbol, so each input byte emits at most 2 */
+    size_t max_output;
+    if (aws_mul_size_checked(to_decode->len, 2, &max_output)) {
+        return AWS_OP_ERR;
+    }
+    if (s_ensure_space(output, max_output)) {
+        return AWS_OP_ERR;
+    }
+
+    uint8_t state = decoder->state;
+    bool accept = decoder->accept;
+    uint8_t *dst = output->buffer + output->len;
+    const uint8_t *src = to_decode->ptr;
+    const uint8_t *src_end = src + to_decode->len;
+
+    for (; src != src_end; ++src) {
+        const struct aws_hpack_huffman_decode_transition *t = &aws_hpack_huffman_decode_table[state][*src >> 4];
+        if (t->flags & AWS_HPACK_HUFFMAN_DECODE_F_FAIL) {
+            goto eos_error;
+        }
+        if (t->flags & AWS_HPACK_HUFFMAN_DECODE_F_SYMBOL) {
+            *dst++ = t->symbol;
+        }
+
+        t = &aws_hpack_huffman_decode_table[t->state][*src & 0x0F];
+        if (t->flags & AWS_HPACK_HUFFMAN_DECODE_F_FAIL) {
+            goto eos_error;
+        }
+        if (t->flags & AWS_HPACK_HUFFMAN_DECODE_F_SYMBOL) {
+            *dst++ = t->symbol;
+        }
+
+        state = t->state;
+        accept = t->flags & AWS_HPACK_HUFFMAN_DECODE_F_ACCEPT;
+    }
+
+    output->len = (size_t)(dst - output->buffer);
+    aws_byte_cursor_advance(to_decode, to_decode->len);
+    decoder->state = state;
+    decoder->accept = accept;
+    return AWS_OP_SUCCESS;
+
+eos_error:
+    return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+}
+
+int aws_hpack_huffman_decoder_finish(const struct aws_hpack_huffman_decoder *decoder) {
+    AWS_PRECONDITION(decoder);
+    if (!decoder->accept) {
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    return AWS_OP_SUCCESS;
+}
+
 int aws_hpack_decode_string(
     struct aws_hpack_context *context,
     struct aws_byte_cursor *to_decode,
@@ -971,7 +1348,7 @@ int aws_hpack_decode_string(
                 /* Do init stuff */
                 progress->state = HPACK_STRING_STATE_LENGTH;
                 progress->use_huffman = *to_decode->ptr >> 7;
-                aws_huffman_decoder_reset(&context->decoder);
+                aws_hpack_huffman_decoder_reset(&context->decoder);
                 /* fallthrough, since we didn't consume any data */
             }
             /* FALLTHRU */
@@ -1004,17 +1381,11 @@ int aws_hpack_decode_string(
                 struct aws_byte_cursor chunk = aws_byte_cursor_advance(to_decode, to_process);
 
                 if (progress->use_huffman) {
-                    if (aws_huffman_decode(&context->decoder, &chunk, output)) {
+                    /* HPACK says to treat EOS (end-of-string) symbol as error */
+                    if (aws_hpack_huffman_decode(&context->decoder, &chunk, output)) {
                         HPACK_LOGF(ERROR, context, "Error from Huffman decoder: %s", aws_error_name(aws_last_error()));
                         return AWS_OP_ERR;
                     }
-
-                    /* Decoder should consume all bytes we feed it.
-                     * EOS (end-of-string) symbol could stop it early, but HPACK says to treat EOS as error. */
-                    if (chunk.len != 0) {
-                        HPACK_LOG(ERROR, context, "Huffman encoded end-of-string symbol is illegal");
-                        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
-                    }
                 } else {
                     if (aws_byte_buf_append_dynamic(output, &chunk)) {
                         return AWS_OP_ERR;
@@ -1023,9 +1394,12 @@ int aws_hpack_decode_string(
 
                 /* If whole length consumed, we're done */
                 if (progress->length == 0) {
-                    /* #TODO Validate any padding bits left over in final byte of string.
-                     * "A padding not corresponding to the most significant bits of the
+                    /* "A padding not corresponding to the most significant bits of the
                      * code for the EOS symbol MUST be treated as a decoding error" */
+                    if (progress->use_huffman && aws_hpack_huffman_decoder_finish(&context->decoder)) {
+                        HPACK_LOG(ERROR, context, "Huffman encoded string has invalid padding");
+                        return AWS_OP_ERR;
+                    }
 
                     /* #TODO impose limits on string length */
 
@@ -1324,16 +1698,20 @@ static int s_convert_http_compression_to_literal_entry_type(
     return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
 }
 
+/* Encode a header field. Also reports how the encoder cache could replay this encoding in the future. */
 static int s_encode_header_field(
     struct aws_hpack_context *context,
     const struct aws_http_header *header,
-    struct aws_byte_buf *output) {
+    struct aws_byte_buf *output,
+    enum hpack_cached_representation *out_cached_type,
+    uint64_t *out_dynamic_entry_id) {
 
     AWS_PRECONDITION(context);
     AWS_PRECONDITION(header);
     AWS_PRECONDITION(output);
 
     size_t original_len = output->len;
+    *out_cached_type = HPACK_CACHED_NONE;
 
     /* Search for header-field in tables */
     bool found_indexed_value;
@@ -1355,6 +1733,15 @@ static int s_encode_header_field(
             goto error;
         }
 
+        context->encoder_stats.num_indexed++;
+        if (header_index < s_static_header_table_size) {
+            *out_cached_type = HPACK_CACHED_BYTES;
+        } else {
+            *out_cached_type = HPACK_CACHED_DYNAMIC_INDEXED;
+            *out_dynamic_entry_id =
+                context->dynamic_table.num_inserted - 1 - (header_index - s_static_header_table_size);
+            s_indexing_policy_on_dynamic_entry_used(context, header->name, false /*inserted*/);
+        }
         return AWS_OP_SUCCESS;
     }
 
@@ -1366,6 +1753,16 @@ static int s_encode_header_field(
         goto error;
     }
 
+    /* The policy's answer can change (ex: ADAPTIVE retries names, or the table is resized),
+     * so a header it demoted is never cached, and gets asked about again every time */
+    bool demoted_by_policy = false;
+    if (literal_entry_type == AWS_HPACK_ENTRY_LITERAL_HEADER_FIELD_WITH_INCREMENTAL_INDEXING &&
+        !s_indexing_policy_allows(context, header)) {
+        literal_entry_type = AWS_HPACK_ENTRY_LITERAL_HEADER_FIELD_WITHOUT_INDEXING;
+        context->encoder_stats.num_skipped_by_policy++;
+        demoted_by_policy = true;
+    }
+
     /* the entry type makes up the first few bits of the next integer we encode */
     uint8_t starting_bit_pattern = s_hpack_entry_starting_bit_pattern[literal_entry_type];
     uint8_t num_prefix_bits = s_hpack_entry_num_prefix_bits[literal_entry_type];
@@ -1398,9 +1795,21 @@ static int s_encode_header_field(
 
     /* if "incremental indexing" type, insert header into the dynamic table. */
     if (AWS_HPACK_ENTRY_LITERAL_HEADER_FIELD_WITH_INCREMENTAL_INDEXING == literal_entry_type) {
+        const uint64_t prev_num_inserted = context->dynamic_table.num_inserted;
         if (aws_hpack_insert_header(context, header)) {
             goto error;
         }
+
+        /* Next time, the header can be sent as an index to the entry we just inserted */
+        if (context->dynamic_table.num_inserted != prev_num_inserted) {
+            *out_cached_type = HPACK_CACHED_DYNAMIC_INDEXED;
+            *out_dynamic_entry_id = prev_num_inserted;
+            context->encoder_stats.num_inserted++;
+            s_indexing_policy_on_dynamic_entry_used(context, header->name, true /*inserted*/);
+        }
+    } else if (header_index < s_static_header_table_size && !demoted_by_policy) {
+        /* Literal with literal name, or static table name, doesn't depend on the dynamic table */
+        *out_cached_type = HPACK_CACHED_BYTES;
     }
 
     return AWS_OP_SUCCESS;
@@ -1409,11 +1818,121 @@ error:
     return AWS_OP_ERR;
 }
 
+static bool s_encoder_cache_slot_matches(
+    const struct hpack_encoder_cache_slot *slot,
+    const struct aws_http_header *header) {
+
+    return slot->type != HPACK_CACHED_NONE && slot->compression == header->compression &&
+           slot->name_len == header->name.len && slot->value_len == header->value.len &&
+           (header->name.len == 0 || memcmp(slot->storage.buffer, header->name.ptr, header->name.len) == 0) &&
+           (header->value.len == 0 ||
+            memcmp(slot->storage.buffer + slot->name_len, header->value.ptr, header->value.len) == 0);
+}
+
+/* Write the slot's cached representation. Sets *replayed false if the cache turned out to be stale. */
+static int s_encoder_cache_replay(
+    struct aws_hpack_context *context,
+    struct hpack_encoder_cache_slot *slot,
+    const struct aws_http_header *header,
+    struct aws_byte_buf *output,
+    bool *replayed) {
+
+    *replayed = false;
+
+    switch (slot->type) {
+        case HPACK_CACHED_BYTES: {
+            struct aws_byte_cursor encoded = aws_byte_cursor_from_buf(&slot->storage);
+            aws_byte_cursor_advance(&encoded, slot->name_len + slot->value_len);
+            if (aws_byte_buf_append_dynamic(output, &encoded)) {
+                return AWS_OP_ERR;
+            }
+            /* Static table indexes are cached as bytes too. Only the indexed representation has the top bit set. */
+            if (encoded.ptr[0] & s_hpack_entry_starting_bit_pattern[AWS_HPACK_ENTRY_INDEXED_HEADER_FIELD]) {
+                context->encoder_stats.num_indexed++;
+            }
+        } break;
+
+        case HPACK_CACHED_DYNAMIC_INDEXED: {
+            /* Check whether the entry has been evicted since we last used it */
+            const uint64_t oldest_live_id = context->dynamic_table.num_inserted - context->dynamic_table.num_elements;
+            if (slot->dynamic_entry_id < oldest_live_id) {
+                slot->type = HPACK_CACHED_NONE;
+                return AWS_OP_SUCCESS;
+            }
+
+            const uint64_t index =
+                s_static_header_table_size + (context->dynamic_table.num_inserted - 1 - slot->dynamic_entry_id);
+            const enum aws_hpack_entry_type entry_type = AWS_HPACK_ENTRY_INDEXED_HEADER_FIELD;
+            uint8_t starting_bit_pattern = s_hpack_entry_starting_bit_pattern[entry_type];
+            uint8_t num_prefix_bits = s_hpack_entry_num_prefix_bits[entry_type];
+            if (aws_hpack_encode_integer(index, starting_bit_pattern, num_prefix_bits, output)) {
+                return AWS_OP_ERR;
+            }
+            context->encoder_stats.num_indexed++;
+            s_indexing_policy_on_dynamic_entry_used(context, header->name, false /*inserted*/);
+        } break;
+
+        default:
+            AWS_ASSERT(0);
+            return AWS_OP_SUCCESS;
+    }
+
+    *replayed = true;
+    return AWS_OP_SUCCESS;
+}
+
+/* Remember how a header was encoded. Failure isn't an error, the slot is simply left empty. */
+static void s_encoder_cache_store(
+    struct aws_hpack_context *context,
+    struct hpack_encoder_cache_slot *slot,
+    const struct aws_http_header *header,
+    enum hpack_cached_representation type,
+    uint64_t dynamic_entry_id,
+    struct aws_byte_cursor encoded) {
+
+    slot->type = HPACK_CACHED_NONE;
+
+    if (type == HPACK_CACHED_NONE) {
+        return;
+    }
+
+    const size_t header_len = header->name.len + header->value.len;
+    if (header_len > HPACK_ENCODER_CACHE_MAX_HEADER_LEN) {
+        return;
+    }
+
+    const size_t storage_len = header_len + (type == HPACK_CACHED_BYTES ? encoded.len : 0);
+    if (slot->storage.allocator == NULL) {
+        if (aws_byte_buf_init(&slot->storage, context->allocator, storage_len)) {
+            return;
+        }
+    } else {
+        aws_byte_buf_reset(&slot->storage, false);
+        if (aws_byte_buf_reserve(&slot->storage, storage_len)) {
+            return;
+        }
+    }
+
+    aws_byte_buf_write_from_whole_cursor(&slot->storage, header->name);
+    aws_byte_buf_write_from_whole_cursor(&slot->storage, header->value);
+    if (type == HPACK_CACHED_BYTES) {
+        aws_byte_buf_write_from_whole_cursor(&slot->storage, encoded);
+    }
+
+    slot->type = type;
+    slot->compression = header->compression;
+    slot->name_len = header->name.len;
+    slot->value_len = header->value.len;
+    slot->dynamic_entry_id = dynamic_entry_id;
+}
+
 int aws_hpack_encode_header_block(
     struct aws_hpack_context *context,
     const struct aws_http_headers *headers,
     struct aws_byte_buf *output) {
 
+    const size_t output_start_len = output->len;
+
     /* Encode a dynamic table size update at the beginning of the first header-block
      * following the change to the dynamic table size RFC-7541 4.2 */
     if (context->dynamic_table_size_update.pending) {
@@ -1459,10 +1978,35 @@ int aws_hpack_encode_header_block(
     for (size_t i = 0; i < num_headers; ++i) {
         struct aws_http_header header;
         aws_http_headers_get_index(headers, i, &header);
-        if (s_encode_header_field(context, &header, output)) {
+        context->encoder_stats.uncompressed_bytes += header.name.len + header.value.len;
+
+        struct hpack_encoder_cache_slot *slot = i < HPACK_ENCODER_CACHE_SLOTS ? &context->encoder_cache.slots[i] : NULL;
+
+        if (slot && s_encoder_cache_slot_matches(slot, &header)) {
+            bool replayed;
+            if (s_encoder_cache_replay(context, slot, &header, output, &replayed)) {
+                return AWS_OP_ERR;
+            }
+            if (replayed) {
+                continue;
+            }
+        }
+
+        const size_t field_start = output->len;
+        enum hpack_cached_representation cached_type;
+        uint64_t dynamic_entry_id = 0;
+        if (s_encode_header_field(context, &header, output, &cached_type, &dynamic_entry_id)) {
             return AWS_OP_ERR;
         }
+
+        if (slot) {
+            struct aws_byte_cursor encoded =
+                aws_byte_cursor_from_array(output->buffer + field_start, output->len - field_start);
+            s_encoder_cache_store(context, slot, &header, cached_type, dynamic_entry_id, encoded);
+        }
     }
 
+    context->encoder_stats.num_headers += num_headers;
+    context->encoder_stats.encoded_bytes += output->len - output_start_len;
     return AWS_OP_SUCCESS;
 }
@@ -0,0 +1,1815 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+/* WARNING: THIS FILE WAS AUTOMATICALLY GENERATED BY scripts/generate_hpack_huffman_decode_table.py
+ * DO NOT EDIT. */
+/* clang-format off */
+
+#include <aws/http/private/hpack.h>
+
+#define S AWS_HPACK_HUFFMAN_DECODE_F_SYMBOL
+#define A AWS_HPACK_HUFFMAN_DECODE_F_ACCEPT
+#define F AWS_HPACK_HUFFMAN_DECODE_F_FAIL
+
+/* {next_state, flags, symbol} */
+const struct aws_hpack_huffman_decode_transition
+    aws_hpack_huffman_decode_table[AWS_HPACK_HUFFMAN_DECODE_STATE_COUNT][16] = {
+    /* state 0: "" */
+    {
+        { 15, 0    ,   0}, { 16, 0    ,   0}, { 17, 0    ,   0}, { 18, 0    ,   0},
+        { 19, 0    ,   0}, { 20, 0    ,   0}, { 21, 0    ,   0}, { 22, 0    ,   0},
+        { 23, 0    ,   0}, { 24, 0    ,   0}, { 25, 0    ,   0}, { 26, 0    ,   0},
+        { 27, 0    ,   0}, { 28, 0    ,   0}, { 29, 0    ,   0}, { 30, A    ,   0},
+    },
+    /* state 1: "0" */
+    {
+        {  0, S|A  ,  48}, {  0, S|A  ,  49}, {  0, S|A  ,  50}, {  0, S|A  ,  97},
+        {  0, S|A  ,  99}, {  0, S|A  , 101}, {  0, S|A  , 105}, {  0, S|A  , 111},
+        {  0, S|A  , 115}, {  0, S|A  , 116}, { 31, 0    ,   0}, { 32, 0    ,   0},
+        { 33, 0    ,   0}, { 34, 0    ,   0}, { 35, 0    ,   0}, { 36, 0    ,   0},
+    },
+    /* state 2: "1" */
+    {
+        { 37, 0    ,   0}, { 38, 0    ,   0}, { 39, 0    ,   0}, { 40, 0    ,   0},
+        { 41, 0    ,   0}, { 42, 0    ,   0}, { 43, 0    ,   0}, { 44, 0    ,   0},
+        { 45, 0    ,   0}, { 46, 0    ,   0}, { 47, 0    ,   0}, { 48, 0    ,   0},
+        { 49, 0    ,   0}, { 50, 0    ,   0}, { 51, 0    ,   0}, { 52, A    ,   0},
+    },
+    /* state 3: "00" */
+    {
+        {  1, S    ,  48}, {  2, S|A  ,  48}, {  1, S    ,  49}, {  2, S|A  ,  49},
+        {  1, S    ,  50}, {  2, S|A  ,  50}, {  1, S    ,  97}, {  2, S|A  ,  97},
+        {  1, S    ,  99}, {  2, S|A  ,  99}, {  1, S    , 101}, {  2, S|A  , 101},
+        {  1, S    , 105}, {  2, S|A  , 105}, {  1, S    , 111}, {  2, S|A  , 111},
+    },
+    /* state 4: "01" */
+    {
+        {  1, S    , 115}, {  2, S|A  , 115}, {  1, S    , 116}, {  2, S|A  , 116},
+        {  0, S|A  ,  32}, {  0, S|A  ,  37}, {  0, S|A  ,  45}, {  0, S|A  ,  46},
+        {  0, S|A  ,  47}, {  0, S|A  ,  51}, {  0, S|A  ,  52}, {  0, S|A  ,  53},
+        {  0, S|A  ,  54}, {  0, S|A  ,  55}, {  0, S|A  ,  56}, {  0, S|A  ,  57},
+    },
+    /* state 5: "10" */
+    {
+        {  0, S|A  ,  61}, {  0, S|A  ,  65}, {  0, S|A  ,  95}, {  0, S|A  ,  98},
+        {  0, S|A  , 100}, {  0, S|A  , 102}, {  0, S|A  , 103}, {  0, S|A  , 104},
+        {  0, S|A  , 108}, {  0, S|A  , 109}, {  0, S|A  , 110}, {  0, S|A  , 112},
+        {  0, S|A  , 114}, {  0, S|A  , 117}, { 53, 0    ,   0}, { 54, 0    ,   0},
+    },
+    /* state 6: "11" */
+    {
+        { 55, 0    ,   0}, { 56, 0    ,   0}, { 57, 0    ,   0}, { 58, 0    ,   0},
+        { 59, 0    ,   0}, { 60, 0    ,   0}, { 61, 0    ,   0}, { 62, 0    ,   0},
+        { 63, 0    ,   0}, { 64, 0    ,   0}, { 65, 0    ,   0}, { 66, 0    ,   0},
+        { 67, 0    ,   0}, { 68, 0    ,   0}, { 69, 0    ,   0}, { 70, A    ,   0},
+    },
+    /* state 7: "000" */
+    {
+        {  3, S    ,  48}, {  4, S    ,  48}, {  5, S    ,  48}, {  6, S|A  ,  48},
+        {  3, S    ,  49}, {  4, S    ,  49}, {  5, S    ,  49}, {  6, S|A  ,  49},
+        {  3, S    ,  50}, {  4, S    ,  50}, {  5, S    ,  50}, {  6, S|A  ,  50},
+        {  3, S    ,  97}, {  4, S    ,  97}, {  5, S    ,  97}, {  6, S|A  ,  97},
+    },
+    /* state 8: "001" */
+    {
+        {  3, S    ,  99}, {  4, S    ,  99}, {  5, S    ,  99}, {  6, S|A  ,  99},
+        {  3, S    , 101}, {  4, S    , 101}, {  5, S    , 101}, {  6, S|A  , 101},
+        {  3, S    , 105}, {  4, S    , 105}, {  5, S    , 105}, {  6, S|A  , 105},
+        {  3, S    , 111}, {  4, S    , 111}, {  5, S    , 111}, {  6, S|A  , 111},
+    },
+    /* state 9: "010" */
+    {
+        {  3, S    , 115}, {  4, S    , 115}, {  5, S    , 115}, {  6, S|A  , 115},
+        {  3, S    , 116}, {  4, S    , 116}, {  5, S    , 116}, {  6, S|A  , 116},
+        {  1, S    ,  32}, {  2, S|A  ,  32}, {  1, S    ,  37}, {  2, S|A  ,  37},
+        {  1, S    ,  45}, {  2, S|A  ,  45}, {  1, S    ,  46}, {  2, S|A  ,  46},
+    },
+    /* state 10: "011" */
+    {
+        {  1, S    ,  47}, {  2, S|A  ,  47}, {  1, S    ,  51}, {  2, S|A  ,  51},
+        {  1, S    ,  52}, {  2, S|A  ,  52}, {  1, S    ,  53}, {  2, S|A  ,  53},
+        {  1, S    ,  54}, {  2, S|A  ,  54}, {  1, S    ,  55}, {  2, S|A  ,  55},
+        {  1, S    ,  56}, {  2, S|A  ,  56}, {  1, S    ,  57}, {  2, S|A  ,  57},
+    },
+    /* state 11: "100" */
+    {
+        {  1, S    ,  61}, {  2, S|A  ,  61}, {  1, S    ,  65}, {  2, S|A  ,  65},
+        {  1, S    ,  95}, {  2, S|A  ,  95}, {  1, S    ,  98}, {  2, S|A  ,  98},
+        {  1, S    , 100}, {  2, S|A  , 100}, {  1, S    , 102}, {  2, S|A  , 102},
+        {  1, S    , 103}, {  2, S|A  , 103}, {  1, S    , 104}, {  2, S|A  , 104},
+    },
+    /* state 12: "101" */
+    {
+        {  1, S    , 108}, {  2, S|A  , 108}, {  1, S    , 109}, {  2, S|A  , 109},
+        {  1, S    , 110}, {  2, S|A  , 110}, {  1, S    , 112}, {  2, S|A  , 112},
+        {  1, S    , 114}, {  2, S|A  , 114}, {  1, S    , 117}, {  2, S|A  , 117},
+        {  0, S|A  ,  58}, {  0, S|A  ,  66}, {  0, S|A  ,  67}, {  0, S|A  ,  68},
+    },
+    /* state 13: "110" */
+    {
+        {  0, S|A  ,  69}, {  0, S|A  ,  70}, {  0, S|A  ,  71}, {  0, S|A  ,  72},
+        {  0, S|A  ,  73}, {  0, S|A  ,  74}, {  0, S|A  ,  75}, {  0, S|A  ,  76},
+        {  0, S|A  ,  77}, {  0, S|A  ,  78}, {  0, S|A  ,  79}, {  0, S|A  ,  80},
+        {  0, S|A  ,  81}, {  0, S|A  ,  82}, {  0, S|A  ,  83}, {  0, S|A  ,  84},
+    },
+    /* state 14: "111" */
+    {
+        {  0, S|A  ,  85}, {  0, S|A  ,  86}, {  0, S|A  ,  87}, {  0, S|A  ,  89},
+        {  0, S|A  , 106}, {  0, S|A  , 107}, {  0, S|A  , 113}, {  0, S|A  , 118},
+        {  0, S|A  , 119}, {  0, S|A  , 120}, {  0, S|A  , 121}, {  0, S|A  , 122},
+        { 71, 0    ,   0}, { 72, 0    ,   0}, { 73, 0    ,   0}, { 74, A    ,   0},
+    },
+    /* state 15: "0000" */
+    {
+        {  7, S    ,  48}, {  8, S    ,  48}, {  9, S    ,  48}, { 10, S    ,  48},
+        { 11, S    ,  48}, { 12, S    ,  48}, { 13, S    ,  48}, { 14, S|A  ,  48},
+        {  7, S    ,  49}, {  8, S    ,  49}, {  9, S    ,  49}, { 10, S    ,  49},
+        { 11, S    ,  49}, { 12, S    ,  49}, { 13, S    ,  49}, { 14, S|A  ,  49},
+    },
+    /* state 16: "0001" */
+    {
+        {  7, S    ,  50}, {  8, S    ,  50}, {  9, S    ,  50}, { 10, S    ,  50},
+        { 11, S    ,  50}, { 12, S    ,  50}, { 13, S    ,  50}, { 14, S|A  ,  50},
+        {  7, S    ,  97}, {  8, S    ,  97}, {  9, S    ,  97}, { 10, S    ,  97},
+        { 11, S    ,  97}, { 12, S    ,  97}, { 13, S    ,  97}, { 14, S|A  ,  97},
+    },
+    /* state 17: "0010" */
+    {
+        {  7, S    ,  99}, {  8, S    ,  99}, {  9, S    ,  99}, { 10, S    ,  99},
+        { 11, S    ,  99}, { 12, S    ,  99}, { 13, S    ,  99}, { 14, S|A  ,  99},
+        {  7, S    , 101}, {  8, S    , 101}, {  9, S    , 101}, { 10, S    , 101},
+        { 11, S    , 101}, { 12, S    , 101}, { 13, S    , 101}, { 14, S|A  , 101},
+    },
+    /* state 18: "0011" */
+    {
+        {  7, S    , 105}, {  8, S    , 105}, {  9, S    , 105}, { 10, S    , 105},
+        { 11, S    , 105}, { 12, S    , 105}, { 13, S    , 105}, { 14, S|A  , 105},
+        {  7, S    , 111}, {  8, S    , 111}, {  9, S    , 111}, { 10, S    , 111},
+        { 11, S    , 111}, { 12, S    , 111}, { 13, S    , 111}, { 14, S|A  , 111},
+    },
+    /* state 19: "0100" */
+    {
+        {  7, S    , 115}, {  8, S    , 115}, {  9, S    , 115}, { 10, S    , 115},
+        { 11, S    , 115}, { 12, S    , 115}, { 13, S    , 115}, { 14, S|A  , 115},
+        {  7, S    , 116}, {  8, S    , 116}, {  9, S    , 116}, { 10, S    , 116},
+        { 11, S    , 116}, { 12, S    , 116}, { 13, S    , 116}, { 14, S|A  , 116},
+    },
+    /* state 20: "0101" */
+    {
+        {  3, S    ,  32}, {  4, S    ,  32}, {  5, S    ,  32}, {  6, S|A  ,  32},
+        {  3, S    ,  37}, {  4, S    ,  37}, {  5, S    ,  37}, {  6, S|A  ,  37},
+        {  3, S    ,  45}, {  4, S    ,  45}, {  5, S    ,  45}, {  6, S|A  ,  45},
+        {  3, S    ,  46}, {  4, S    ,  46}, {  5, S    ,  46}, {  6, S|A  ,  46},
+    },
+    /* state 21: "0110" */
+    {
+        {  3, S    ,  47}, {  4, S    ,  47}, {  5, S    ,  47}, {  6, S|A  ,  47},
+        {  3, S    ,  51}, {  4, S    ,  51}, {  5, S    ,  51}, {  6, S|A  ,  51},
+        {  3, S    ,  52}, {  4, S    ,  52}, {  5, S    ,  52}, {  6, S|A  ,  52},
+        {  3, S    ,  53}, {  4, S    ,  53}, {  5, S    ,  53}, {  6, S|A  ,  53},
+    },
+    /* state 22: "0111" */
+    {
+        {  3, S    ,  54}, {  4, S    ,  54}, {  5, S    ,  54}, {  6, S|A  ,  54},
+        {  3, S    ,  55}, {  4, S    ,  55}, {  5, S    ,  55}, {  6, S|A  ,  55},
+        {  3, S    ,  56}, {  4, S    ,  56}, {  5, S    ,  56}, {  6, S|A  ,  56},
+        {  3, S    ,  57}, {  4, S    ,  57}, {  5, S    ,  57}, {  6, S|A  ,  57},
+    },
+    /* state 23: "1000" */
+    {
+        {  3, S    ,  61}, {  4, S    ,  61}, {  5, S    ,  61}, {  6, S|A  ,  61},
+        {  3, S    ,  65}, {  4, S    ,  65}, {  5, S    ,  65}, {  6, S|A  ,  65},
+        {  3, S    ,  95}, {  4, S    ,  95}, {  5, S    ,  95}, {  6, S|A  ,  95},
+        {  3, S    ,  98}, {  4, S    ,  98}, {  5, S    ,  98}, {  6, S|A  ,  98},
+    },
+    /* state 24: "1001" */
+    {
+        {  3, S    , 100}, {  4, S    , 100}, {  5, S    , 100}, {  6, S|A  , 100},
+        {  3, S    , 102}, {  4, S    , 102}, {  5, S    , 102}, {  6, S|A  , 102},
+        {  3, S    , 103}, {  4, S    , 103}, {  5, S    , 103}, {  6, S|A  , 103},
+        {  3, S    , 104}, {  4, S    , 104}, {  5, S    , 104}, {  6, S|A  , 104},
+    },
+    /* state 25: "1010" */
+    {
+        {  3, S    , 108}, {  4, S    , 108}, {  5, S    , 108}, {  6, S|A  , 108},
+        {  3, S    , 109}, {  4, S    , 109}, {  5, S    , 109}, {  6, S|A  , 109},
+        {  3, S    , 110}, {  4, S    , 110}, {  5, S    , 110}, {  6, S|A  , 110},
+        {  3, S    , 112}, {  4, S    , 112}, {  5, S    , 112}, {  6, S|A  , 112},
+    },
+    /* state 26: "1011" */
+    {
+        {  3, S    , 114}, {  4, S    , 114}, {  5, S    , 114}, {  6, S|A  , 114},
+        {  3, S    , 117}, {  4, S    , 117}, {  5, S    , 117}, {  6, S|A  , 117},
+        {  1, S    ,  58}, {  2, S|A  ,  58}, {  1, S    ,  66}, {  2, S|A  ,  66},
+        {  1, S    ,  67}, {  2, S|A  ,  67}, {  1, S    ,  68}, {  2, S|A  ,  68},
+    },
+    /* state 27: "1100" */
+    {
+        {  1, S    ,  69}, {  2, S|A  ,  69}, {  1, S    ,  70}, {  2, S|A  ,  70},
+        {  1, S    ,  71}, {  2, S|A  ,  71}, {  1, S    ,  72}, {  2, S|A  ,  72},
+        {  1, S    ,  73}, {  2, S|A  ,  73}, {  1, S    ,  74}, {  2, S|A  ,  74},
+        {  1, S    ,  75}, {  2, S|A  ,  75}, {  1, S    ,  76}, {  2, S|A  ,  76},
+    },
+    /* state 28: "1101" */
+    {
+        {  1, S    ,  77}, {  2, S|A  ,  77}, {  1, S    ,  78}, {  2, S|A  ,  78},
+        {  1, S    ,  79}, {  2, S|A  ,  79}, {  1, S    ,  80}, {  2, S|A  ,  80},
+        {  1, S    ,  81}, {  2, S|A  ,  81}, {  1, S    ,  82}, {  2, S|A  ,  82},
+        {  1, S    ,  83}, {  2, S|A  ,  83}, {  1, S    ,  84}, {  2, S|A  ,  84},
+    },
+    /* state 29: "1110" */
+    {
+        {  1, S    ,  85}, {  2, S|A  ,  85}, {  1, S    ,  86}, {  2, S|A  ,  86},
+        {  1, S    ,  87}, {  2, S|A  ,  87}, {  1, S    ,  89}, {  2, S|A  ,  89},
+        {  1, S    , 106}, {  2, S|A  , 106}, {  1, S    , 107}, {  2, S|A  , 107},
+        {  1, S    , 113}, {  2, S|A  , 113}, {  1, S    , 118}, {  2, S|A  , 118},
+    },
+    /* state 30: "1111" */
+    {
+        {  1, S    , 119}, {  2, S|A  , 119}, {  1, S    , 120}, {  2, S|A  , 120},
+        {  1, S    , 121}, {  2, S|A  , 121}, {  1, S    , 122}, {  2, S|A  , 122},
+        {  0, S|A  ,  38}, {  0, S|A  ,  42}, {  0, S|A  ,  44}, {  0, S|A  ,  59},
+        {  0, S|A  ,  88}, {  0, S|A  ,  90}, { 75, 0    ,   0}, { 76, 0    ,   0},
+    },
+    /* state 31: "01010" */
+    {
+        {  7, S    ,  32}, {  8, S    ,  32}, {  9, S    ,  32}, { 10, S    ,  32},
+        { 11, S    ,  32}, { 12, S    ,  32}, { 13, S    ,  32}, { 14, S|A  ,  32},
+        {  7, S    ,  37}, {  8, S    ,  37}, {  9, S    ,  37}, { 10, S    ,  37},
+        { 11, S    ,  37}, { 12, S    ,  37}, { 13, S    ,  37}, { 14, S|A  ,  37},
+    },
+    /* state 32: "01011" */
+    {
+        {  7, S    ,  45}, {  8, S    ,  45}, {  9, S    ,  45}, { 10, S    ,  45},
+        { 11, S    ,  45}, { 12, S    ,  45}, { 13, S    ,  45}, { 14, S|A  ,  45},
+        {  7, S    ,  46}, {  8, S    ,  46}, {  9, S    ,  46}, { 10, S    ,  46},
+        { 11, S    ,  46}, { 12, S    ,  46}, { 13, S    ,  46}, { 14, S|A  ,  46},
+    },
+    /* state 33: "01100" */
+    {
+        {  7, S    ,  47}, {  8, S    ,  47}, {  9, S    ,  47}, { 10, S    ,  47},
+        { 11, S    ,  47}, { 12, S    ,  47}, { 13, S    ,  47}, { 14, S|A  ,  47},
+        {  7, S    ,  51}, {  8, S    ,  51}, {  9, S    ,  51}, { 10, S    ,  51},
+        { 11, S    ,  51}, { 12, S    ,  51}, { 13, S    ,  51}, { 14, S|A  ,  51},
+    },
+    /* state 34: "01101" */
+    {
+        {  7, S    ,  52}, {  8, S    ,  52}, {  9, S    ,  52}, { 10, S    ,  52},
+        { 11, S    ,  52}, { 12, S    ,  52}, { 13, S    ,  52}, { 14, S|A  ,  52},
+        {  7, S    ,  53}, {  8, S    ,  53}, {  9, S    ,  53}, { 10, S    ,  53},
+        { 11, S    ,  53}, { 12, S    ,  53}, { 13, S    ,  53}, { 14, S|A  ,  53},
+    },
+    /* state 35: "01110" */
+    {
+        {  7, S    ,  54}, {  8, S    ,  54}, {  9, S    ,  54}, { 10, S    ,  54},
+        { 11, S    ,  54}, { 12, S    ,  54}, { 13, S    ,  54}, { 14, S|A  ,  54},
+        {  7, S    ,  55}, {  8, S    ,  55}, {  9, S    ,  55}, { 10, S    ,  55},
+        { 11, S    ,  55}, { 12, S    ,  55}, { 13, S    ,  55}, { 14, S|A  ,  55},
+    },
+    /* state 36: "01111" */
+    {
+        {  7, S    ,  56}, {  8, S    ,  56}, {  9, S    ,  56}, { 10, S    ,  56},
+        { 11, S    ,  56}, { 12, S    ,  56}, { 13, S    ,  56}, { 14, S|A  ,  56},
+        {  7, S    ,  57}, {  8, S    ,  57}, {  9, S    ,  57}, { 10, S    ,  57},
+        { 11, S    ,  57}, { 12, S    ,  57}, { 13, S    ,  57}, { 14, S|A  ,  57},
+    },
+    /* state 37: "10000" */
+    {
+        {  7, S    ,  61}, {  8, S    ,  61}, {  9, S    ,  61}, { 10, S    ,  61},
+        { 11, S    ,  61}, { 12, S    ,  61}, { 13, S    ,  61}, { 14, S|A  ,  61},
+        {  7, S    ,  65}, {  8, S    ,  65}, {  9, S    ,  65}, { 10, S    ,  65},
+        { 11, S    ,  65}, { 12, S    ,  65}, { 13, S    ,  65}, { 14, S|A  ,  65},
+    },
+    /* state 38: "10001" */
+    {
+        {  7, S    ,  95}, {  8, S    ,  95}, {  9, S    ,  95}, { 10, S    ,  95},
+        { 11, S    ,  95}, { 12, S    ,  95}, { 13, S    ,  95}, { 14, S|A  ,  95},
+        {  7, S    ,  98}, {  8, S    ,  98}, {  9, S    ,  98}, { 10, S    ,  98},
+        { 11, S    ,  98}, { 12, S    ,  98}, { 13, S    ,  98}, { 14, S|A  ,  98},
+    },
+    /* state 39: "10010" */
+    {
+        {  7, S    , 100}, {  8, S    , 100}, {  9, S    , 100}, { 10, S    , 100},
+        { 11, S    , 100}, { 12, S    , 100}, { 13, S    , 100}, { 14, S|A  , 100},
+        {  7, S    , 102}, {  8, S    , 102}, {  9, S    , 102}, { 10, S    , 102},
+        { 11, S    , 102}, { 12, S    , 102}, { 13, S    , 102}, { 14, S|A  , 102},
+    },
+    /* state 40: "10011" */
+    {
+        {  7, S    , 103}, {  8, S    , 103}, {  9, S    , 103}, { 10, S    , 103},
+        { 11, S    , 103}, { 12, S    , 103}, { 13, S    , 103}, { 14, S|A  , 103},
+        {  7, S    , 104}, {  8, S    , 104}, {  9, S    , 104}, { 10, S    , 104},
+        { 11, S    , 104}, { 12, S    , 104}, { 13, S    , 104}, { 14, S|A  , 104},
+    },
+    /* state 41: "10100" */
+    {
+        {  7, S    , 108}, {  8, S    , 108}, {  9, S    , 108}, { 10, S    , 108},
+        { 11, S    , 108}, { 12, S    , 108}, { 13, S    , 108}, { 14, S|A  , 108},
+        {  7, S    , 109}, {  8, S    , 109}, {  9, S    , 109}, { 10, S    , 109},
+        { 11, S    , 109}, { 12, S    , 109}, { 13, S    , 109}, { 14, S|A  , 109},
+    },
+    /* state 42: "10101" */
+    {
+        {  7, S    , 110}, {  8, S    , 110}, {  9, S    , 110}, { 10, S    , 110},
+        { 11, S    , 110}, { 12, S    , 110}, { 13, S    , 110}, { 14, S|A  , 110},
+        {  7, S    , 112}, {  8, S    , 112}, {  9, S    , 112}, { 10, S    , 112},
+        { 11, S    , 112}, { 12, S    , 112}, { 13, S    , 112}, { 14, S|A  , 112},
+    },
+    /* state 43: "10110" */
+    {
+        {  7, S    , 114}, {  8, S    , 114}, {  9, S    , 114}, { 10, S    , 114},
+        { 11, S    , 114}, { 12, S    , 114}, { 13, S    , 114}, { 14, S|A  , 114},
+        {  7, S    , 117}, {  8, S    , 117}, {  9, S    , 117}, { 10, S    , 117},
+        { 11, S    , 117}, { 12, S    , 117}, { 13, S    , 117}, { 14, S|A  , 117},
+    },
+    /* state 44: "10111" */
+    {
+        {  3, S    ,  58}, {  4, S    ,  58}, {  5, S    ,  58}, {  6, S|A  ,  58},
+        {  3, S    ,  66}, {  4, S    ,  66}, {  5, S    ,  66}, {  6, S|A  ,  66},
+        {  3, S    ,  67}, {  4, S    ,  67}, {  5, S    ,  67}, {  6, S|A  ,  67},
+        {  3, S    ,  68}, {  4, S    ,  68}, {  5, S    ,  68}, {  6, S|A  ,  68},
+    },
+    /* state 45: "11000" */
+    {
+        {  3, S    ,  69}, {  4, S    ,  69}, {  5, S    ,  69}, {  6, S|A  ,  69},
+        {  3, S    ,  70}, {  4, S    ,  70}, {  5, S    ,  70}, {  6, S|A  ,  70},
+        {  3, S    ,  71}, {  4, S    ,  71}, {  5, S    ,  71}, {  6, S|A  ,  71},
+        {  3, S    ,  72}, {  4, S    ,  72}, {  5, S    ,  72}, {  6, S|A  ,  72},
+    },
+    /* state 46: "11001" */
+    {
+        {  3, S    ,  73}, {  4, S    ,  73}, {  5, S    ,  73}, {  6, S|A  ,  73},
+        {  3, S    ,  74}, {  4, S    ,  74}, {  5, S    ,  74}, {  6, S|A  ,  74},
+        {  3, S    ,  75}, {  4, S    ,  75}, {  5, S    ,  75}, {  6, S|A  ,  75},
+        {  3, S    ,  76}, {  4, S    ,  76}, {  5, S    ,  76}, {  6, S|A  ,  76},
+    },
+    /* state 47: "11010" */
+    {
+        {  3, S    ,  77}, {  4, S    ,  77}, {  5, S    ,  77}, {  6, S|A  ,  77},
+        {  3, S    ,  78}, {  4, S    ,  78}, {  5, S    ,  78}, {  6, S|A  ,  78},
+        {  3, S    ,  79}, {  4, S    ,  79}, {  5, S    ,  79}, {  6, S|A  ,  79},
+        {  3, S    ,  80}, {  4, S    ,  80}, {  5, S    ,  80}, {  6, S|A  ,  80},
+    },
+    /* state 48: "11011" */
+    {
+        {  3, S    ,  81}, {  4, S    ,  81}, {  5, S    ,  81}, {  6, S|A  ,  81},
+        {  3, S    ,  82}, {  4, S    ,  82}, {  5, S    ,  82}, {  6, S|A  ,  82},
+        {  3, S    ,  83}, {  4, S    ,  83}, {  5, S    ,  83}, {  6, S|A  ,  83},
+        {  3, S    ,  84}, {  4, S    ,  84}, {  5, S    ,  84}, {  6, S|A  ,  84},
+    },
+    /* state 49: "11100" */
+    {
+        {  3, S    ,  85}, {  4, S    ,  85}, {  5, S    ,  85}, {  6, S|A  ,  85},
+        {  3, S    ,  86}, {  4, S    ,  86}, {  5, S    ,  86}, {  6, S|A  ,  86},
+        {  3, S    ,  87}, {  4, S    ,  87}, {  5, S    ,  87}, {  6, S|A  ,  87},
+        {  3, S    ,  89}, {  4, S    ,  89}, {  5, S    ,  89}, {  6, S|A  ,  89},
+    },
+    /* state 50: "11101" */
+    {
+        {  3, S    , 106}, {  4, S    , 106}, {  5, S    , 106}, {  6, S|A  , 106},
+        {  3, S    , 107}, {  4, S    , 107}, {  5, S    , 107}, {  6, S|A  , 107},
+        {  3, S    , 113}, {  4, S    , 113}, {  5, S    , 113}, {  6, S|A  , 113},
+        {  3, S    , 118}, {  4, S    , 118}, {  5, S    , 118}, {  6, S|A  , 118},
+    },
+    /* state 51: "11110" */
+    {
+        {  3, S    , 119}, {  4, S    , 119}, {  5, S    , 119}, {  6, S|A  , 119},
+        {  3, S    , 120}, {  4, S    , 120}, {  5, S    , 120}, {  6, S|A  , 120},
+        {  3, S    , 121}, {  4, S    , 121}, {  5, S    , 121}, {  6, S|A  , 121},
+        {  3, S    , 122}, {  4, S    , 122}, {  5, S    , 122}, {  6, S|A  , 122},
+    },
+    /* state 52: "11111" */
+    {
+        {  1, S    ,  38}, {  2, S|A  ,  38}, {  1, S    ,  42}, {  2, S|A  ,  42},
+        {  1, S    ,  44}, {  2, S|A  ,  44}, {  1, S    ,  59}, {  2, S|A  ,  59},
+        {  1, S    ,  88}, {  2, S|A  ,  88}, {  1, S    ,  90}, {  2, S|A  ,  90},
+        { 77, 0    ,   0}, { 78, 0    ,   0}, { 79, 0    ,   0}, { 80, 0    ,   0},
+    },
+    /* state 53: "101110" */
+    {
+        {  7, S    ,  58}, {  8, S    ,  58}, {  9, S    ,  58}, { 10, S    ,  58},
+        { 11, S    ,  58}, { 12, S    ,  58}, { 13, S    ,  58}, { 14, S|A  ,  58},
+        {  7, S    ,  66}, {  8, S    ,  66}, {  9, S    ,  66}, { 10, S    ,  66},
+        { 11, S    ,  66}, { 12, S    ,  66}, { 13, S    ,  66}, { 14, S|A  ,  66},
+    },
+    /* state 54: "101111" */
+    {
+        {  7, S    ,  67}, {  8, S    ,  67}, {  9, S    ,  67}, { 10, S    ,  67},
+        { 11, S    ,  67}, { 12, S    ,  67}, { 13, S    ,  67}, { 14, S|A  ,  67},
+        {  7, S    ,  68}, {  8, S    ,  68}, {  9, S    ,  68}, { 10, S    ,  68},
+        { 11, S    ,  68}, { 12, S    ,  68}, { 13, S    ,  68}, { 14, S|A  ,  68},
+    },
+    /* state 55: "110000" */
+    {
+        {  7, S    ,  69}, {  8, S    ,  69}, {  9, S    ,  69}, { 10, S    ,  69},
+        { 11, S    ,  69}, { 12, S    ,  69}, { 13, S    ,  69}, { 14, S|A  ,  69},
+        {  7, S    ,  70}, {  8, S    ,  70}, {  9, S    ,  70}, { 10, S    ,  70},
+        { 11, S    ,  70}, { 12, S    ,  70}, { 13, S    ,  70}, { 14, S|A  ,  70},
+    },
+    /* state 56: "110001" */
+    {
+        {  7, S    ,  71}, {  8, S    ,  71}, {  9, S    ,  71}, { 10, S    ,  71},
+        { 11, S    ,  71}, { 12, S    ,  71}, { 13, S    ,  71}, { 14, S|A  ,  71},
+        {  7, S    ,  72}, {  8, S    ,  72}, {  9, S    ,  72}, { 10, S    ,  72},
+        { 11, S    ,  72}, { 12, S    ,  72}, { 13, S    ,  72}, { 14, S|A  ,  72},
+    },
+    /* state 57: "110010" */
+    {
+        {  7, S    ,  73}, {  8, S    ,  73}, {  9, S    ,  73}, { 10, S    ,  73},
+        { 11, S    ,  73}, { 12, S    ,  73}, { 13, S    ,  73}, { 14, S|A  ,  73},
+        {  7, S    ,  74}, {  8, S    ,  74}, {  9, S    ,  74}, { 10, S    ,  74},
+        { 11, S    ,  74}, { 12, S    ,  74}, { 13, S    ,  74}, { 14, S|A  ,  74},
+    },
+    /* state 58: "110011" */
+    {
+        {  7, S    ,  75}, {  8, S    ,  75}, {  9, S    ,  75}, { 10, S    ,  75},
+        { 11, S    ,  75}, { 12, S    ,  75}, { 13, S    ,  75}, { 14, S|A  ,  75},
+        {  7, S    ,  76}, {  8, S    ,  76}, {  9, S    ,  76}, { 10, S    ,  76},
+        { 11, S    ,  76}, { 12, S    ,  76}, { 13, S    ,  76}, { 14, S|A  ,  76},
+    },
+    /* state 59: "110100" */
+    {
+        {  7, S    ,  77}, {  8, S    ,  77}, {  9, S    ,  77}, { 10, S    ,  77},
+        { 11, S    ,  77}, { 12, S    ,  77}, { 13, S    ,  77}, { 14, S|A  ,  77},
+        {  7, S    ,  78}, {  8, S    ,  78}, {  9, S    ,  78}, { 10, S    ,  78},
+        { 11, S    ,  78}, { 12, S    ,  78}, { 13, S    ,  78}, { 14, S|A  ,  78},
+    },
+    /* state 60: "110101" */
+    {
+        {  7, S    ,  79}, {  8, S    ,  79}, {  9, S    ,  79}, { 10, S    ,  79},
+        { 11, S    ,  79}, { 12, S    ,  79}, { 13, S    ,  79}, { 14, S|A  ,  79},
+        {  7, S    ,  80}, {  8, S    ,  80}, {  9, S    ,  80}, { 10, S    ,  80},
+        { 11, S    ,  80}, { 12, S    ,  80}, { 13, S    ,  80}, { 14, S|A  ,  80},
+    },
+    /* state 61: "110110" */
+    {
+        {  7, S    ,  81}, {  8, S    ,  81}, {  9, S    ,  81}, { 10, S    ,  81},
+        { 11, S    ,  81}, { 12, S    ,  81}, { 13, S    ,  81}, { 14, S|A  ,  81},
+        {  7, S    ,  82}, {  8, S    ,  82}, {  9, S    ,  82}, { 10, S    ,  82},
+        { 11, S    ,  82}, { 12, S    ,  82}, { 13, S    ,  82}, { 14, S|A  ,  82},
+    },
+    /* state 62: "110111" */
+    {
+        {  7, S    ,  83}, {  8, S    ,  83}, {  9, S    ,  83}, { 10, S    ,  83},
+        { 11, S    ,  83}, { 12, S    ,  83}, { 13, S    ,  83}, { 14, S|A  ,  83},
+        {  7, S    ,  84}, {  8, S    ,  84}, {  9, S    ,  84}, { 10, S    ,  84},
+        { 11, S    ,  84}, { 12, S    ,  84}, { 13, S    ,  84}, { 14, S|A  ,  84},
+    },
+    /* state 63: "111000" */
+    {
+        {  7, S    ,  85}, {  8, S    ,  85}, {  9, S    ,  85}, { 10, S    ,  85},
+        { 11, S    ,  85}, { 12, S    ,  85}, { 13, S    ,  85}, { 14, S|A  ,  85},
+        {  7, S    ,  86}, {  8, S    ,  86}, {  9, S    ,  86}, { 10, S    ,  86},
+        { 11, S    ,  86}, { 12, S    ,  86}, { 13, S    ,  86}, { 14, S|A  ,  86},
+    },
+    /* state 64: "111001" */
+    {
+        {  7, S    ,  87}, {  8, S    ,  87}, {  9, S    ,  87}, { 10, S    ,  87},
+        { 11, S    ,  87}, { 12, S    ,  87}, { 13, S    ,  87}, { 14, S|A  ,  87},
+        {  7, S    ,  89}, {  8, S    ,  89}, {  9, S    ,  89}, { 10, S    ,  89},
+        { 11, S    ,  89}, { 12, S    ,  89}, { 13, S    ,  89}, { 14, S|A  ,  89},
+    },
+    /* state 65: "111010" */
+    {
+        {  7, S    , 106}, {  8, S    , 106}, {  9, S    , 106}, { 10, S    , 106},
+        { 11, S    , 106}, { 12, S    , 106}, { 13, S    , 106}, { 14, S|A  , 106},
+        {  7, S    , 107}, {  8, S    , 107}, {  9, S    , 107}, { 10, S    , 107},
+        { 11, S    , 107}, { 12, S    , 107}, { 13, S    , 107}, { 14, S|A  , 107},
+    },
+    /* state 66: "111011" */
+    {
+        {  7, S    , 113}, {  8, S    , 113}, {  9, S    , 113}, { 10, S    , 113},
+        { 11, S    , 113}, { 12, S    , 113}, { 13, S    , 113}, { 14, S|A  , 113},
+        {  7, S    , 118}, {  8, S    , 118}, {  9, S    , 118}, { 10, S    , 118},
+        { 11, S    , 118}, { 12, S    , 118}, { 13, S    , 118}, { 14, S|A  , 118},
+    },
+    /* state 67: "111100" */
+    {
+        {  7, S    , 119}, {  8, S    , 119}, {  9, S    , 119}, { 10, S    , 119},
+        { 11, S    , 119}, { 12, S    , 119}, { 13, S    , 119}, { 14, S|A  , 119},
+        {  7, S    , 120}, {  8, S    , 120}, {  9, S    , 120}, { 10, S    , 120},
+        { 11, S    , 120}, { 12, S    , 120}, { 13, S    , 120}, { 14, S|A  , 120},
+    },
+    /* state 68: "111101" */
+    {
+        {  7, S    , 121}, {  8, S    , 121}, {  9, S    , 121}, { 10, S    , 121},
+        { 11, S    , 121}, { 12, S    , 121}, { 13, S    , 121}, { 14, S|A  , 121},
+        {  7, S    , 122}, {  8, S    , 122}, {  9, S    , 122}, { 10, S    , 122},
+        { 11, S    , 122}, { 12, S    , 122}, { 13, S    , 122}, { 14, S|A  , 122},
+    },
+    /* state 69: "111110" */
+    {
+        {  3, S    ,  38}, {  4, S    ,  38}, {  5, S    ,  38}, {  6, S|A  ,  38},
+        {  3, S    ,  42}, {  4, S    ,  42}, {  5, S    ,  42}, {  6, S|A  ,  42},
+        {  3, S    ,  44}, {  4, S    ,  44}, {  5, S    ,  44}, {  6, S|A  ,  44},
+        {  3, S    ,  59}, {  4, S    ,  59}, {  5, S    ,  59}, {  6, S|A  ,  59},
+    },
+    /* state 70: "111111" */
+    {
+        {  3, S    ,  88}, {  4, S    ,  88}, {  5, S    ,  88}, {  6, S|A  ,  88},
+        {  3, S    ,  90}, {  4, S    ,  90}, {  5, S    ,  90}, {  6, S|A  ,  90},
+        {  0, S|A  ,  33}, {  0, S|A  ,  34}, {  0, S|A  ,  40}, {  0, S|A  ,  41},
+        {  0, S|A  ,  63}, { 81, 0    ,   0}, { 82, 0    ,   0}, { 83, 0    ,   0},
+    },
+    /* state 71: "1111100" */
+    {
+        {  7, S    ,  38}, {  8, S    ,  38}, {  9, S    ,  38}, { 10, S    ,  38},
+        { 11, S    ,  38}, { 12, S    ,  38}, { 13, S    ,  38}, { 14, S|A  ,  38},
+        {  7, S    ,  42}, {  8, S    ,  42}, {  9, S    ,  42}, { 10, S    ,  42},
+        { 11, S    ,  42}, { 12, S    ,  42}, { 13, S    ,  42}, { 14, S|A  ,  42},
+    },
+    /* state 72: "1111101" */
+    {
+        {  7, S    ,  44}, {  8, S    ,  44}, {  9, S    ,  44}, { 10, S    ,  44},
+        { 11, S    ,  44}, { 12, S    ,  44}, { 13, S    ,  44}, { 14, S|A  ,  44},
+        {  7, S    ,  59}, {  8, S    ,  59}, {  9, S    ,  59}, { 10, S    ,  59},
+        { 11, S    ,  59}, { 12, S    ,  59}, { 13, S    ,  59}, { 14, S|A  ,  59},
+    },
+    /* state 73: "1111110" */
+    {
+        {  7, S    ,  88}, {  8, S    ,  88}, {  9, S    ,  88}, { 10, S    ,  88},
+        { 11, S    ,  88}, { 12, S    ,  88}, { 13, S    ,  88}, { 14, S|A  ,  88},
+        {  7, S    ,  90}, {  8, S    ,  90}, {  9, S    ,  90}, { 10, S    ,  90},
+        { 11, S    ,  90}, { 12, S    ,  90}, { 13, S    ,  90}, { 14, S|A  ,  90},
+    },
+    /* state 74: "1111111" */
+    {
+        {  1, S    ,  33}, {  2, S|A  ,  33}, {  1, S    ,  34}, {  2, S|A  ,  34},
+        {  1, S    ,  40}, {  2, S|A  ,  40}, {  1, S    ,  41}, {  2, S|A  ,  41},
+        {  1, S    ,  63}, {  2, S|A  ,  63}, {  0, S|A  ,  39}, {  0, S|A  ,  43},
+        {  0, S|A  , 124}, { 84, 0    ,   0}, { 85, 0    ,   0}, { 86, 0    ,   0},
+    },
+    /* state 75: "11111110" */
+    {
+        {  3, S    ,  33}, {  4, S    ,  33}, {  5, S    ,  33}, {  6, S|A  ,  33},
+        {  3, S    ,  34}, {  4, S    ,  34}, {  5, S    ,  34}, {  6, S|A  ,  34},
+        {  3, S    ,  40}, {  4, S    ,  40}, {  5, S    ,  40}, {  6, S|A  ,  40},
+        {  3, S    ,  41}, {  4, S    ,  41}, {  5, S    ,  41}, {  6, S|A  ,  41},
+    },
+    /* state 76: "11111111" */
+    {
+        {  3, S    ,  63}, {  4, S    ,  63}, {  5, S    ,  63}, {  6, S|A  ,  63},
+        {  1, S    ,  39}, {  2, S|A  ,  39}, {  1, S    ,  43}, {  2, S|A  ,  43},
+        {  1, S    , 124}, {  2, S|A  , 124}, {  0, S|A  ,  35}, {  0, S|A  ,  62},
+        { 87, 0    ,   0}, { 88, 0    ,   0}, { 89, 0    ,   0}, { 90, 0    ,   0},
+    },
+    /* state 77: "111111100" */
+    {
+        {  7, S    ,  33}, {  8, S    ,  33}, {  9, S    ,  33}, { 10, S    ,  33},
+        { 11, S    ,  33}, { 12, S    ,  33}, { 13, S    ,  33}, { 14, S|A  ,  33},
+        {  7, S    ,  34}, {  8, S    ,  34}, {  9, S    ,  34}, { 10, S    ,  34},
+        { 11, S    ,  34}, { 12, S    ,  34}, { 13, S    ,  34}, { 14, S|A  ,  34},
+    },
+    /* state 78: "111111101" */
+    {
+        {  7, S    ,  40}, {  8, S    ,  40}, {  9, S    ,  40}, { 10, S    ,  40},
+        { 11, S    ,  40}, { 12, S    ,  40}, { 13, S    ,  40}, { 14, S|A  ,  40},
+        {  7, S    ,  41}, {  8, S    ,  41}, {  9, S    ,  41}, { 10, S    ,  41},
+        { 11, S    ,  41}, { 12, S    ,  41}, { 13, S    ,  41}, { 14, S|A  ,  41},
+    },
+    /* state 79: "111111110" */
+    {
+        {  7, S    ,  63}, {  8, S    ,  63}, {  9, S    ,  63}, { 10, S    ,  63},
+        { 11, S    ,  63}, { 12, S    ,  63}, { 13, S    ,  63}, { 14, S|A  ,  63},
+        {  3, S    ,  39}, {  4, S    ,  39}, {  5, S    ,  39}, {  6, S|A  ,  39},
+        {  3, S    ,  43}, {  4, S    ,  43}, {  5, S    ,  43}, {  6, S|A  ,  43},
+    },
+    /* state 80: "111111111" */
+    {
+        {  3, S    , 124}, {  4, S    , 124}, {  5, S    , 124}, {  6, S|A  , 124},
+        {  1, S    ,  35}, {  2, S|A  ,  35}, {  1, S    ,  62}, {  2, S|A  ,  62},
+        {  0, S|A  ,   0}, {  0, S|A  ,  36}, {  0, S|A  ,  64}, {  0, S|A  ,  91},
+        {  0, S|A  ,  93}, {  0, S|A  , 126}, { 91, 0    ,   0}, { 92, 0    ,   0},
+    },
+    /* state 81: "1111111101" */
+    {
+        {  7, S    ,  39}, {  8, S    ,  39}, {  9, S    ,  39}, { 10, S    ,  39},
+        { 11, S    ,  39}, { 12, S    ,  39}, { 13, S    ,  39}, { 14, S|A  ,  39},
+        {  7, S    ,  43}, {  8, S    ,  43}, {  9, S    ,  43}, { 10, S    ,  43},
+        { 11, S    ,  43}, { 12, S    ,  43}, { 13, S    ,  43}, { 14, S|A  ,  43},
+    },
+    /* state 82: "1111111110" */
+    {
+        {  7, S    , 124}, {  8, S    , 124}, {  9, S    , 124}, { 10, S    , 124},
+        { 11, S    , 124}, { 12, S    , 124}, { 13, S    , 124}, { 14, S|A  , 124},
+        {  3, S    ,  35}, {  4, S    ,  35}, {  5, S    ,  35}, {  6, S|A  ,  35},
+        {  3, S    ,  62}, {  4, S    ,  62}, {  5, S    ,  62}, {  6, S|A  ,  62},
+    },
+    /* state 83: "1111111111" */
+    {
+        {  1, S    ,   0}, {  2, S|A  ,   0}, {  1, S    ,  36}, {  2, S|A  ,  36},
+        {  1, S    ,  64}, {  2, S|A  ,  64}, {  1, S    ,  91}, {  2, S|A  ,  91},
+        {  1, S    ,  93}, {  2, S|A  ,  93}, {  1, S    , 126}, {  2, S|A  , 126},
+        {  0, S|A  ,  94}, {  0, S|A  , 125}, { 93, 0    ,   0}, { 94, 0    ,   0},
+    },
+    /* state 84: "11111111101" */
+    {
+        {  7, S    ,  35}, {  8, S    ,  35}, {  9, S    ,  35}, { 10, S    ,  35},
+        { 11, S    ,  35}, { 12, S    ,  35}, { 13, S    ,  35}, { 14, S|A  ,  35},
+        {  7, S    ,  62}, {  8, S    ,  62}, {  9, S    ,  62}, { 10, S    ,  62},
+        { 11, S    ,  62}, { 12, S    ,  62}, { 13, S    ,  62}, { 14, S|A  ,  62},
+    },
+    /* state 85: "11111111110" */
+    {
+        {  3, S    ,   0}, {  4, S    ,   0}, {  5, S    ,   0}, {  6, S|A  ,   0},
+        {  3, S    ,  36}, {  4, S    ,  36}, {  5, S    ,  36}, {  6, S|A  ,  36},
+        {  3, S    ,  64}, {  4, S    ,  64}, {  5, S    ,  64}, {  6, S|A  ,  64},
+        {  3, S    ,  91}, {  4, S    ,  91}, {  5, S    ,  91}, {  6, S|A  ,  91},
+    },
+    /* state 86: "11111111111" */
+    {
+        {  3, S    ,  93}, {  4, S    ,  93}, {  5, S    ,  93}, {  6, S|A  ,  93},
+        {  3, S    , 126}, {  4, S    , 126}, {  5, S    , 126}, {  6, S|A  , 126},
+        {  1, S    ,  94}, {  2, S|A  ,  94}, {  1, S    , 125}, {  2, S|A  , 125},
+        {  0, S|A  ,  60}, {  0, S|A  ,  96}, {  0, S|A  , 123}, { 95, 0    ,   0},
+    },
+    /* state 87: "111111111100" */
+    {
+        {  7, S    ,   0}, {  8, S    ,   0}, {  9, S    ,   0}, { 10, S    ,   0},
+        { 11, S    ,   0}, { 12, S    ,   0}, { 13, S    ,   0}, { 14, S|A  ,   0},
+        {  7, S    ,  36}, {  8, S    ,  36}, {  9, S    ,  36}, { 10, S    ,  36},
+        { 11, S    ,  36}, { 12, S    ,  36}, { 13, S    ,  36}, { 14, S|A  ,  36},
+    },
+    /* state 88: "111111111101" */
+    {
+        {  7, S    ,  64}, {  8, S    ,  64}, {  9, S    ,  64}, { 10, S    ,  64},
+        { 11, S    ,  64}, { 12, S    ,  64}, { 13, S    ,  64}, { 14, S|A  ,  64},
+        {  7, S    ,  91}, {  8, S    ,  91}, {  9, S    ,  91}, { 10, S    ,  91},
+        { 11, S    ,  91}, { 12, S    ,  91}, { 13, S    ,  91}, { 14, S|A  ,  91},
+    },
+    /* state 89: "111111111110" */
+    {
+        {  7, S    ,  93}, {  8, S    ,  93}, {  9, S    ,  93}, { 10, S    ,  93},
+        { 11, S    ,  93}, { 12, S    ,  93}, { 13, S    ,  93}, { 14, S|A  ,  93},
+        {  7, S    , 126}, {  8, S    , 126}, {  9, S    , 126}, { 10, S    , 126},
+        { 11, S    , 126}, { 12, S    , 126}, { 13, S    , 126}, { 14, S|A  , 126},
+    },
+    /* state 90: "111111111111" */
+    {
+        {  3, S    ,  94}, {  4, S    ,  94}, {  5, S    ,  94}, {  6, S|A  ,  94},
+        {  3, S    , 125}, {  4, S    , 125}, {  5, S    , 125}, {  6, S|A  , 125},
+        {  1, S    ,  60}, {  2, S|A  ,  60}, {  1, S    ,  96}, {  2, S|A  ,  96},
+        {  1, S    , 123}, {  2, S|A  , 123}, { 96, 0    ,   0}, { 97, 0    ,   0},
+    },
+    /* state 91: "1111111111110" */
+    {
+        {  7, S    ,  94}, {  8, S    ,  94}, {  9, S    ,  94}, { 10, S    ,  94},
+        { 11, S    ,  94}, { 12, S    ,  94}, { 13, S    ,  94}, { 14, S|A  ,  94},
+        {  7, S    , 125}, {  8, S    , 125}, {  9, S    , 125}, { 10, S    , 125},
+        { 11, S    , 125}, { 12, S    , 125}, { 13, S    , 125}, { 14, S|A  , 125},
+    },
+    /* state 92: "1111111111111" */
+    {
+        {  3, S    ,  60}, {  4, S    ,  60}, {  5, S    ,  60}, {  6, S|A  ,  60},
+        {  3, S    ,  96}, {  4, S    ,  96}, {  5, S    ,  96}, {  6, S|A  ,  96},
+        {  3, S    , 123}, {  4, S    , 123}, {  5, S    , 123}, {  6, S|A  , 123},
+        { 98, 0    ,   0}, { 99, 0    ,   0}, {100, 0    ,   0}, {101, 0    ,   0},
+    },
+    /* state 93: "11111111111110" */
+    {
+        {  7, S    ,  60}, {  8, S    ,  60}, {  9, S    ,  60}, { 10, S    ,  60},
+        { 11, S    ,  60}, { 12, S    ,  60}, { 13, S    ,  60}, { 14, S|A  ,  60},
+        {  7, S    ,  96}, {  8, S    ,  96}, {  9, S    ,  96}, { 10, S    ,  96},
+        { 11, S    ,  96}, { 12, S    ,  96}, { 13, S    ,  96}, { 14, S|A  ,  96},
+    },
+    /* state 94: "11111111111111" */
+    {
+        {  7, S    , 123}, {  8, S    , 123}, {  9, S    , 123}, { 10, S    , 123},
+        { 11, S    , 123}, { 12, S    , 123}, { 13, S    , 123}, { 14, S|A  , 123},
+        {102, 0    ,   0}, {103, 0    ,   0}, {104, 0    ,   0}, {105, 0    ,   0},
+        {106, 0    ,   0}, {107, 0    ,   0}, {108, 0    ,   0}, {109, 0    ,   0},
+    },
+    /* state 95: "111111111111111" */
+    {
+        {  0, S|A  ,  92}, {  0, S|A  , 195}, {  0, S|A  , 208}, {110, 0    ,   0},
+        {111, 0    ,   0}, {112, 0    ,   0}, {113, 0    ,   0}, {114, 0    ,   0},
+        {115, 0    ,   0}, {116, 0    ,   0}, {117, 0    ,   0}, {118, 0    ,   0},
+        {119, 0    ,   0}, {120, 0    ,   0}, {121, 0    ,   0}, {122, 0    ,   0},
+    },
+    /* state 96: "1111111111111110" */
+    {
+        {  1, S    ,  92}, {  2, S|A  ,  92}, {  1, S    , 195}, {  2, S|A  , 195},
+        {  1, S    , 208}, {  2, S|A  , 208}, {  0, S|A  , 128}, {  0, S|A  , 130},
+        {  0, S|A  , 131}, {  0, S|A  , 162}, {  0, S|A  , 184}, {  0, S|A  , 194},
+        {  0, S|A  , 224}, {  0, S|A  , 226}, {123, 0    ,   0}, {124, 0    ,   0},
+    },
+    /* state 97: "1111111111111111" */
+    {
+        {125, 0    ,   0}, {126, 0    ,   0}, {127, 0    ,   0}, {128, 0    ,   0},
+        {129, 0    ,   0}, {130, 0    ,   0}, {131, 0    ,   0}, {132, 0    ,   0},
+        {133, 0    ,   0}, {134, 0    ,   0}, {135, 0    ,   0}, {136, 0    ,   0},
+        {137, 0    ,   0}, {138, 0    ,   0}, {139, 0    ,   0}, {140, 0    ,   0},
+    },
+    /* state 98: "11111111111111100" */
+    {
+        {  3, S    ,  92}, {  4, S    ,  92}, {  5, S    ,  92}, {  6, S|A  ,  92},
+        {  3, S    , 195}, {  4, S    , 195}, {  5, S    , 195}, {  6, S|A  , 195},
+        {  3, S    , 208}, {  4, S    , 208}, {  5, S    , 208}, {  6, S|A  , 208},
+        {  1, S    , 128}, {  2, S|A  , 128}, {  1, S    , 130}, {  2, S|A  , 130},
+    },
+    /* state 99: "11111111111111101" */
+    {
+        {  1, S    , 131}, {  2, S|A  , 131}, {  1, S    , 162}, {  2, S|A  , 162},
+        {  1, S    , 184}, {  2, S|A  , 184}, {  1, S    , 194}, {  2, S|A  , 194},
+        {  1, S    , 224}, {  2, S|A  , 224}, {  1, S    , 226}, {  2, S|A  , 226},
+        {  0, S|A  , 153}, {  0, S|A  , 161}, {  0, S|A  , 167}, {  0, S|A  , 172},
+    },
+    /* state 100: "11111111111111110" */
+    {
+        {  0, S|A  , 176}, {  0, S|A  , 177}, {  0, S|A  , 179}, {  0, S|A  , 209},
+        {  0, S|A  , 216}, {  0, S|A  , 217}, {  0, S|A  , 227}, {  0, S|A  , 229},
+        {  0, S|A  , 230}, {141, 0    ,   0}, {142, 0    ,   0}, {143, 0    ,   0},
+        {144, 0    ,   0}, {145, 0    ,   0}, {146, 0    ,   0}, {147, 0    ,   0},
+    },
+    /* state 101: "11111111111111111" */
+    {
+        {148, 0    ,   0}, {149, 0    ,   0}, {150, 0    ,   0}, {151, 0    ,   0},
+        {152, 0    ,   0}, {153, 0    ,   0}, {154, 0    ,   0}, {155, 0    ,   0},
+        {156, 0    ,   0}, {157, 0    ,   0}, {158, 0    ,   0}, {159, 0    ,   0},
+        {160, 0    ,   0}, {161, 0    ,   0}, {162, 0    ,   0}, {163, 0    ,   0},
+    },
+    /* state 102: "111111111111111000" */
+    {
+        {  7, S    ,  92}, {  8, S    ,  92}, {  9, S    ,  92}, { 10, S    ,  92},
+        { 11, S    ,  92}, { 12, S    ,  92}, { 13, S    ,  92}, { 14, S|A  ,  92},
+        {  7, S    , 195}, {  8, S    , 195}, {  9, S    , 195}, { 10, S    , 195},
+        { 11, S    , 195}, { 12, S    , 195}, { 13, S    , 195}, { 14, S|A  , 195},
+    },
+    /* state 103: "111111111111111001" */
+    {
+        {  7, S    , 208}, {  8, S    , 208}, {  9, S    , 208}, { 10, S    , 208},
+        { 11, S    , 208}, { 12, S    , 208}, { 13, S    , 208}, { 14, S|A  , 208},
+        {  3, S    , 128}, {  4, S    , 128}, {  5, S    , 128}, {  6, S|A  , 128},
+        {  3, S    , 130}, {  4, S    , 130}, {  5, S    , 130}, {  6, S|A  , 130},
+    },
+    /* state 104: "111111111111111010" */
+    {
+        {  3, S    , 131}, {  4, S    , 131}, {  5, S    , 131}, {  6, S|A  , 131},
+        {  3, S    , 162}, {  4, S    , 162}, {  5, S    , 162}, {  6, S|A  , 162},
+        {  3, S    , 184}, {  4, S    , 184}, {  5, S    , 184}, {  6, S|A  , 184},
+        {  3, S    , 194}, {  4, S    , 194}, {  5, S    , 194}, {  6, S|A  , 194},
+    },
+    /* state 105: "111111111111111011" */
+    {
+        {  3, S    , 224}, {  4, S    , 224}, {  5, S    , 224}, {  6, S|A  , 224},
+        {  3, S    , 226}, {  4, S    , 226}, {  5, S    , 226}, {  6, S|A  , 226},
+        {  1, S    , 153}, {  2, S|A  , 153}, {  1, S    , 161}, {  2, S|A  , 161},
+        {  1, S    , 167}, {  2, S|A  , 167}, {  1, S    , 172}, {  2, S|A  , 172},
+    },
+    /* state 106: "111111111111111100" */
+    {
+        {  1, S    , 176}, {  2, S|A  , 176}, {  1, S    , 177}, {  2, S|A  , 177},
+        {  1, S    , 179}, {  2, S|A  , 179}, {  1, S    , 209}, {  2, S|A  , 209},
+        {  1, S    , 216}, {  2, S|A  , 216}, {  1, S    , 217}, {  2, S|A  , 217},
+        {  1, S    , 227}, {  2, S|A  , 227}, {  1, S    , 229}, {  2, S|A  , 229},
+    },
+    /* state 107: "111111111111111101" */
+    {
+        {  1, S    , 230}, {  2, S|A  , 230}, {  0, S|A  , 129}, {  0, S|A  , 132},
+        {  0, S|A  , 133}, {  0, S|A  , 134}, {  0, S|A  , 136}, {  0, S|A  , 146},
+        {  0, S|A  , 154}, {  0, S|A  , 156}, {  0, S|A  , 160}, {  0, S|A  , 163},
+        {  0, S|A  , 164}, {  0, S|A  , 169}, {  0, S|A  , 170}, {  0, S|A  , 173},
+    },
+    /* state 108: "111111111111111110" */
+    {
+        {  0, S|A  , 178}, {  0, S|A  , 181}, {  0, S|A  , 185}, {  0, S|A  , 186},
+        {  0, S|A  , 187}, {  0, S|A  , 189}, {  0, S|A  , 190}, {  0, S|A  , 196},
+        {  0, S|A  , 198}, {  0, S|A  , 228}, {  0, S|A  , 232}, {  0, S|A  , 233},
+        {164, 0    ,   0}, {165, 0    ,   0}, {166, 0    ,   0}, {167, 0    ,   0},
+    },
+    /* state 109: "111111111111111111" */
+    {
+        {168, 0    ,   0}, {169, 0    ,   0}, {170, 0    ,   0}, {171, 0    ,   0},
+        {172, 0    ,   0}, {173, 0    ,   0}, {174, 0    ,   0}, {175, 0    ,   0},
+        {176, 0    ,   0}, {177, 0    ,   0}, {178, 0    ,   0}, {179, 0    ,   0},
+        {180, 0    ,   0}, {181, 0    ,   0}, {182, 0    ,   0}, {183, 0    ,   0},
+    },
+    /* state 110: "1111111111111110011" */
+    {
+        {  7, S    , 128}, {  8, S    , 128}, {  9, S    , 128}, { 10, S    , 128},
+        { 11, S    , 128}, { 12, S    , 128}, { 13, S    , 128}, { 14, S|A  , 128},
+        {  7, S    , 130}, {  8, S    , 130}, {  9, S    , 130}, { 10, S    , 130},
+        { 11, S    , 130}, { 12, S    , 130}, { 13, S    , 130}, { 14, S|A  , 130},
+    },
+    /* state 111: "1111111111111110100" */
+    {
+        {  7, S    , 131}, {  8, S    , 131}, {  9, S    , 131}, { 10, S    , 131},
+        { 11, S    , 131}, { 12, S    , 131}, { 13, S    , 131}, { 14, S|A  , 131},
+        {  7, S    , 162}, {  8, S    , 162}, {  9, S    , 162}, { 10, S    , 162},
+        { 11, S    , 162}, { 12, S    , 162}, { 13, S    , 162}, { 14, S|A  , 162},
+    },
+    /* state 112: "1111111111111110101" */
+    {
+        {  7, S    , 184}, {  8, S    , 184}, {  9, S    , 184}, { 10, S    , 184},
+        { 11, S    , 184}, { 12, S    , 184}, { 13, S    , 184}, { 14, S|A  , 184},
+        {  7, S    , 194}, {  8, S    , 194}, {  9, S    , 194}, { 10, S    , 194},
+        { 11, S    , 194}, { 12, S    , 194}, { 13, S    , 194}, { 14, S|A  , 194},
+    },
+    /* state 113: "1111111111111110110" */
+    {
+        {  7, S    , 224}, {  8, S    , 224}, {  9, S    , 224}, { 10, S    , 224},
+        { 11, S    , 224}, { 12, S    , 224}, { 13, S    , 224}, { 14, S|A  , 224},
+        {  7, S    , 226}, {  8, S    , 226}, {  9, S    , 226}, { 10, S    , 226},
+        { 11, S    , 226}, { 12, S    , 226}, { 13, S    , 226}, { 14, S|A  , 226},
+    },
+    /* state 114: "1111111111111110111" */
+    {
+        {  3, S    , 153}, {  4, S    , 153}, {  5, S    , 153}, {  6, S|A  , 153},
+        {  3, S    , 161}, {  4, S    , 161}, {  5, S    , 161}, {  6, S|A  , 161},
+        {  3, S    , 167}, {  4, S    , 167}, {  5, S    , 167}, {  6, S|A  , 167},
+        {  3, S    , 172}, {  4, S    , 172}, {  5, S    , 172}, {  6, S|A  , 172},
+    },
+    /* state 115: "1111111111111111000" */
+    {
+        {  3, S    , 176}, {  4, S    , 176}, {  5, S    , 176}, {  6, S|A  , 176},
+        {  3, S    , 177}, {  4, S    , 177}, {  5, S    , 177}, {  6, S|A  , 177},
+        {  3, S    , 179}, {  4, S    , 179}, {  5, S    , 179}, {  6, S|A  , 179},
+        {  3, S    , 209}, {  4, S    , 209}, {  5, S    , 209}, {  6, S|A  , 209},
+    },
+    /* state 116: "1111111111111111001" */
+    {
+        {  3, S    , 216}, {  4, S    , 216}, {  5, S    , 216}, {  6, S|A  , 216},
+        {  3, S    , 217}, {  4, S    , 217}, {  5, S    , 217}, {  6, S|A  , 217},
+        {  3, S    , 227}, {  4, S    , 227}, {  5, S    , 227}, {  6, S|A  , 227},
+        {  3, S    , 229}, {  4, S    , 229}, {  5, S    , 229}, {  6, S|A  , 229},
+    },
+    /* state 117: "1111111111111111010" */
+    {
+        {  3, S    , 230}, {  4, S    , 230}, {  5, S    , 230}, {  6, S|A  , 230},
+        {  1, S    , 129}, {  2, S|A  , 129}, {  1, S    , 132}, {  2, S|A  , 132},
+        {  1, S    , 133}, {  2, S|A  , 133}, {  1, S    , 134}, {  2, S|A  , 134},
+        {  1, S    , 136}, {  2, S|A  , 136}, {  1, S    , 146}, {  2, S|A  , 146},
+    },
+    /* state 118: "1111111111111111011" */
+    {
+        {  1, S    , 154}, {  2, S|A  , 154}, {  1, S    , 156}, {  2, S|A  , 156},
+        {  1, S    , 160}, {  2, S|A  , 160}, {  1, S    , 163}, {  2, S|A  , 163},
+        {  1, S    , 164}, {  2, S|A  , 164}, {  1, S    , 169}, {  2, S|A  , 169},
+        {  1, S    , 170}, {  2, S|A  , 170}, {  1, S    , 173}, {  2, S|A  , 173},
+    },
+    /* state 119: "1111111111111111100" */
+    {
+        {  1, S    , 178}, {  2, S|A  , 178}, {  1, S    , 181}, {  2, S|A  , 181},
+        {  1, S    , 185}, {  2, S|A  , 185}, {  1, S    , 186}, {  2, S|A  , 186},
+        {  1, S    , 187}, {  2, S|A  , 187}, {  1, S    , 189}, {  2, S|A  , 189},
+        {  1, S    , 190}, {  2, S|A  , 190}, {  1, S    , 196}, {  2, S|A  , 196},
+    },
+    /* state 120: "1111111111111111101" */
+    {
+        {  1, S    , 198}, {  2, S|A  , 198}, {  1, S    , 228}, {  2, S|A  , 228},
+        {  1, S    , 232}, {  2, S|A  , 232}, {  1, S    , 233}, {  2, S|A  , 233},
+        {  0, S|A  ,   1}, {  0, S|A  , 135}, {  0, S|A  , 137}, {  0, S|A  , 138},
+        {  0, S|A  , 139}, {  0, S|A  , 140}, {  0, S|A  , 141}, {  0, S|A  , 143},
+    },
+    /* state 121: "1111111111111111110" */
+    {
+        {  0, S|A  , 147}, {  0, S|A  , 149}, {  0, S|A  , 150}, {  0, S|A  , 151},
+        {  0, S|A  , 152}, {  0, S|A  , 155}, {  0, S|A  , 157}, {  0, S|A  , 158},
+        {  0, S|A  , 165}, {  0, S|A  , 166}, {  0, S|A  , 168}, {  0, S|A  , 174},
+        {  0, S|A  , 175}, {  0, S|A  , 180}, {  0, S|A  , 182}, {  0, S|A  , 183},
+    },
+    /* state 122: "1111111111111111111" */
+    {
+        {  0, S|A  , 188}, {  0, S|A  , 191}, {  0, S|A  , 197}, {  0, S|A  , 231},
+        {  0, S|A  , 239}, {184, 0    ,   0}, {185, 0    ,   0}, {186, 0    ,   0},
+        {187, 0    ,   0}, {188, 0    ,   0}, {189, 0    ,   0}, {190, 0    ,   0},
+        {191, 0    ,   0}, {192, 0    ,   0}, {193, 0    ,   0}, {194, 0    ,   0},
+    },
+    /* state 123: "11111111111111101110" */
+    {
+        {  7, S    , 153}, {  8, S    , 153}, {  9, S    , 153}, { 10, S    , 153},
+        { 11, S    , 153}, { 12, S    , 153}, { 13, S    , 153}, { 14, S|A  , 153},
+        {  7, S    , 161}, {  8, S    , 161}, {  9, S    , 161}, { 10, S    , 161},
+        { 11, S    , 161}, { 12, S    , 161}, { 13, S    , 161}, { 14, S|A  , 161},
+    },
+    /* state 124: "11111111111111101111" */
+    {
+        {  7, S    , 167}, {  8, S    , 167}, {  9, S    , 167}, { 10, S    , 167},
+        { 11, S    , 167}, { 12, S    , 167}, { 13, S    , 167}, { 14, S|A  , 167},
+        {  7, S    , 172}, {  8, S    , 172}, {  9, S    , 172}, { 10, S    , 172},
+        { 11, S    , 172}, { 12, S    , 172}, { 13, S    , 172}, { 14, S|A  , 172},
+    },
+    /* state 125: "11111111111111110000" */
+    {
+        {  7, S    , 176}, {  8, S    , 176}, {  9, S    , 176}, { 10, S    , 176},
+        { 11, S    , 176}, { 12, S    , 176}, { 13, S    , 176}, { 14, S|A  , 176},
+        {  7, S    , 177}, {  8, S    , 177}, {  9, S    , 177}, { 10, S    , 177},
+        { 11, S    , 177}, { 12, S    , 177}, { 13, S    , 177}, { 14, S|A  , 177},
+    },
+    /* state 126: "11111111111111110001" */
+    {
+        {  7, S    , 179}, {  8, S    , 179}, {  9, S    , 179}, { 10, S    , 179},
+        { 11, S    , 179}, { 12, S    , 179}, { 13, S    , 179}, { 14, S|A  , 179},
+        {  7, S    , 209}, {  8, S    , 209}, {  9, S    , 209}, { 10, S    , 209},
+        { 11, S    , 209}, { 12, S    , 209}, { 13, S    , 209}, { 14, S|A  , 209},
+    },
+    /* state 127: "11111111111111110010" */
+    {
+        {  7, S    , 216}, {  8, S    , 216}, {  9, S    , 216}, { 10, S    , 216},
+        { 11, S    , 216}, { 12, S    , 216}, { 13, S    , 216}, { 14, S|A  , 216},
+        {  7, S    , 217}, {  8, S    , 217}, {  9, S    , 217}, { 10, S    , 217},
+        { 11, S    , 217}, { 12, S    , 217}, { 13, S    , 217}, { 14, S|A  , 217},
+    },
+    /* state 128: "11111111111111110011" */
+    {
+        {  7, S    , 227}, {  8, S    , 227}, {  9, S    , 227}, { 10, S    , 227},
+        { 11, S    , 227}, { 12, S    , 227}, { 13, S    , 227}, { 14, S|A  , 227},
+        {  7, S    , 229}, {  8, S    , 229}, {  9, S    , 229}, { 10, S    , 229},
+        { 11, S    , 229}, { 12, S    , 229}, { 13, S    , 229}, { 14, S|A  , 229},
+    },
+    /* state 129: "11111111111111110100" */
+    {
+        {  7, S    , 230}, {  8, S    , 230}, {  9, S    , 230}, { 10, S    , 230},
+        { 11, S    , 230}, { 12, S    , 230}, { 13, S    , 230}, { 14, S|A  , 230},
+        {  3, S    , 129}, {  4, S    , 129}, {  5, S    , 129}, {  6, S|A  , 129},
+        {  3, S    , 132}, {  4, S    , 132}, {  5, S    , 132}, {  6, S|A  , 132},
+    },
+    /* state 130: "11111111111111110101" */
+    {
+        {  3, S    , 133}, {  4, S    , 133}, {  5, S    , 133}, {  6, S|A  , 133},
+        {  3, S    , 134}, {  4, S    , 134}, {  5, S    , 134}, {  6, S|A  , 134},
+        {  3, S    , 136}, {  4, S    , 136}, {  5, S    , 136}, {  6, S|A  , 136},
+        {  3, S    , 146}, {  4, S    , 146}, {  5, S    , 146}, {  6, S|A  , 146},
+    },
+    /* state 131: "11111111111111110110" */
+    {
+        {  3, S    , 154}, {  4, S    , 154}, {  5, S    , 154}, {  6, S|A  , 154},
+        {  3, S    , 156}, {  4, S    , 156}, {  5, S    , 156}, {  6, S|A  , 156},
+        {  3, S    , 160}, {  4, S    , 160}, {  5, S    , 160}, {  6, S|A  , 160},
+        {  3, S    , 163}, {  4, S    , 163}, {  5, S    , 163}, {  6, S|A  , 163},
+    },
+    /* state 132: "11111111111111110111" */
+    {
+        {  3, S    , 164}, {  4, S    , 164}, {  5, S    , 164}, {  6, S|A  , 164},
+        {  3, S    , 169}, {  4, S    , 169}, {  5, S    , 169}, {  6, S|A  , 169},
+        {  3, S    , 170}, {  4, S    , 170}, {  5, S    , 170}, {  6, S|A  , 170},
+        {  3, S    , 173}, {  4, S    , 173}, {  5, S    , 173}, {  6, S|A  , 173},
+    },
+    /* state 133: "11111111111111111000" */
+    {
+        {  3, S    , 178}, {  4, S    , 178}, {  5, S    , 178}, {  6, S|A  , 178},
+        {  3, S    , 181}, {  4, S    , 181}, {  5, S    , 181}, {  6, S|A  , 181},
+        {  3, S    , 185}, {  4, S    , 185}, {  5, S    , 185}, {  6, S|A  , 185},
+        {  3, S    , 186}, {  4, S    , 186}, {  5, S    , 186}, {  6, S|A  , 186},
+    },
+    /* state 134: "11111111111111111001" */
+    {
+        {  3, S    , 187}, {  4, S    , 187}, {  5, S    , 187}, {  6, S|A  , 187},
+        {  3, S    , 189}, {  4, S    , 189}, {  5, S    , 189}, {  6, S|A  , 189},
+        {  3, S    , 190}, {  4, S    , 190}, {  5, S    , 190}, {  6, S|A  , 190},
+        {  3, S    , 196}, {  4, S    , 196}, {  5, S    , 196}, {  6, S|A  , 196},
+    },
+    /* state 135: "11111111111111111010" */
+    {
+        {  3, S    , 198}, {  4, S    , 198}, {  5, S    , 198}, {  6, S|A  , 198},
+        {  3, S    , 228}, {  4, S    , 228}, {  5, S    , 228}, {  6, S|A  , 228},
+        {  3, S    , 232}, {  4, S    , 232}, {  5, S    , 232}, {  6, S|A  , 232},
+        {  3, S    , 233}, {  4, S    , 233}, {  5, S    , 233}, {  6, S|A  , 233},
+    },
+    /* state 136: "11111111111111111011" */
+    {
+        {  1, S    ,   1}, {  2, S|A  ,   1}, {  1, S    , 135}, {  2, S|A  , 135},
+        {  1, S    , 137}, {  2, S|A  , 137}, {  1, S    , 138}, {  2, S|A  , 138},
+        {  1, S    , 139}, {  2, S|A  , 139}, {  1, S    , 140}, {  2, S|A  , 140},
+        {  1, S    , 141}, {  2, S|A  , 141}, {  1, S    , 143}, {  2, S|A  , 143},
+    },
+    /* state 137: "11111111111111111100" */
+    {
+        {  1, S    , 147}, {  2, S|A  , 147}, {  1, S    , 149}, {  2, S|A  , 149},
+        {  1, S    , 150}, {  2, S|A  , 150}, {  1, S    , 151}, {  2, S|A  , 151},
+        {  1, S    , 152}, {  2, S|A  , 152}, {  1, S    , 155}, {  2, S|A  , 155},
+        {  1, S    , 157}, {  2, S|A  , 157}, {  1, S    , 158}, {  2, S|A  , 158},
+    },
+    /* state 138: "11111111111111111101" */
+    {
+        {  1, S    , 165}, {  2, S|A  , 165}, {  1, S    , 166}, {  2, S|A  , 166},
+        {  1, S    , 168}, {  2, S|A  , 168}, {  1, S    , 174}, {  2, S|A  , 174},
+        {  1, S    , 175}, {  2, S|A  , 175}, {  1, S    , 180}, {  2, S|A  , 180},
+        {  1, S    , 182}, {  2, S|A  , 182}, {  1, S    , 183}, {  2, S|A  , 183},
+    },
+    /* state 139: "11111111111111111110" */
+    {
+        {  1, S    , 188}, {  2, S|A  , 188}, {  1, S    , 191}, {  2, S|A  , 191},
+        {  1, S    , 197}, {  2, S|A  , 197}, {  1, S    , 231}, {  2, S|A  , 231},
+        {  1, S    , 239}, {  2, S|A  , 239}, {  0, S|A  ,   9}, {  0, S|A  , 142},
+        {  0, S|A  , 144}, {  0, S|A  , 145}, {  0, S|A  , 148}, {  0, S|A  , 159},
+    },
+    /* state 140: "11111111111111111111" */
+    {
+        {  0, S|A  , 171}, {  0, S|A  , 206}, {  0, S|A  , 215}, {  0, S|A  , 225},
+        {  0, S|A  , 236}, {  0, S|A  , 237}, {195, 0    ,   0}, {196, 0    ,   0},
+        {197, 0    ,   0}, {198, 0    ,   0}, {199, 0    ,   0}, {200, 0    ,   0},
+        {201, 0    ,   0}, {202, 0    ,   0}, {203, 0    ,   0}, {204, 0    ,   0},
+    },
+    /* state 141: "111111111111111101001" */
+    {
+        {  7, S    , 129}, {  8, S    , 129}, {  9, S    , 129}, { 10, S    , 129},
+        { 11, S    , 129}, { 12, S    , 129}, { 13, S    , 129}, { 14, S|A  , 129},
+        {  7, S    , 132}, {  8, S    , 132}, {  9, S    , 132}, { 10, S    , 132},
+        { 11, S    , 132}, { 12, S    , 132}, { 13, S    , 132}, { 14, S|A  , 132},
+    },
+    /* state 142: "111111111111111101010" */
+    {
+        {  7, S    , 133}, {  8, S    , 133}, {  9, S    , 133}, { 10, S    , 133},
+        { 11, S    , 133}, { 12, S    , 133}, { 13, S    , 133}, { 14, S|A  , 133},
+        {  7, S    , 134}, {  8, S    , 134}, {  9, S    , 134}, { 10, S    , 134},
+        { 11, S    , 134}, { 12, S    , 134}, { 13, S    , 134}, { 14, S|A  , 134},
+    },
+    /* state 143: "111111111111111101011" */
+    {
+        {  7, S    , 136}, {  8, S    , 136}, {  9, S    , 136}, { 10, S    , 136},
+        { 11, S    , 136}, { 12, S    , 136}, { 13, S    , 136}, { 14, S|A  , 136},
+        {  7, S    , 146}, {  8, S    , 146}, {  9, S    , 146}, { 10, S    , 146},
+        { 11, S    , 146}, { 12, S    , 146}, { 13, S    , 146}, { 14, S|A  , 146},
+    },
+    /* state 144: "111111111111111101100" */
+    {
+        {  7, S    , 154}, {  8, S    , 154}, {  9, S    , 154}, { 10, S    , 154},
+        { 11, S    , 154}, { 12, S    , 154}, { 13, S    , 154}, { 14, S|A  , 154},
+        {  7, S    , 156}, {  8, S    , 156}, {  9, S    , 156}, { 10, S    , 156},
+        { 11, S    , 156}, { 12, S    , 156}, { 13, S    , 156}, { 14, S|A  , 156},
+    },
+    /* state 145: "111111111111111101101" */
+    {
+        {  7, S    , 160}, {  8, S    , 160}, {  9, S    , 160}, { 10, S    , 160},
+        { 11, S    , 160}, { 12, S    , 160}, { 13, S    , 160}, { 14, S|A  , 160},
+        {  7, S    , 163}, {  8, S    , 163}, {  9, S    , 163}, { 10, S    , 163},
+        { 11, S    , 163}, { 12, S    , 163}, { 13, S    , 163}, { 14, S|A  , 163},
+    },
+    /* state 146: "111111111111111101110" */
+    {
+        {  7, S    , 164}, {  8, S    , 164}, {  9, S    , 164}, { 10, S    , 164},
+        { 11, S    , 164}, { 12, S    , 164}, { 13, S    , 164}, { 14, S|A  , 164},
+        {  7, S    , 169}, {  8, S    , 169}, {  9, S    , 169}, { 10, S    , 169},
+        { 11, S    , 169}, { 12, S    , 169}, { 13, S    , 169}, { 14, S|A  , 169},
+    },
+    /* state 147: "111111111111111101111" */
+    {
+        {  7, S    , 170}, {  8, S    , 170}, {  9, S    , 170}, { 10, S    , 170},
+        { 11, S    , 170}, { 12, S    , 170}, { 13, S    , 170}, { 14, S|A  , 170},
+        {  7, S    , 173}, {  8, S    , 173}, {  9, S    , 173}, { 10, S    , 173},
+        { 11, S    , 173}, { 12, S    , 173}, { 13, S    , 173}, { 14, S|A  , 173},
+    },
+    /* state 148: "111111111111111110000" */
+    {
+        {  7, S    , 178}, {  8, S    , 178}, {  9, S    , 178}, { 10, S    , 178},
+        { 11, S    , 178}, { 12, S    , 178}, { 13, S    , 178}, { 14, S|A  , 178},
+        {  7, S    , 181}, {  8, S    , 181}, {  9, S    , 181}, { 10, S    , 181},
+        { 11, S    , 181}, { 12, S    , 181}, { 13, S    , 181}, { 14, S|A  , 181},
+    },
+    /* state 149: "111111111111111110001" */
+    {
+        {  7, S    , 185}, {  8, S    , 185}, {  9, S    , 185}, { 10, S    , 185},
+        { 11, S    , 185}, { 12, S    , 185}, { 13, S    , 185}, { 14, S|A  , 185},
+        {  7, S    , 186}, {  8, S    , 186}, {  9, S    , 186}, { 10, S    , 186},
+        { 11, S    , 186}, { 12, S    , 186}, { 13, S    , 186}, { 14, S|A  , 186},
+    },
+    /* state 150: "111111111111111110010" */
+    {
+        {  7, S    , 187}, {  8, S    , 187}, {  9, S    , 187}, { 10, S    , 187},
+        { 11, S    , 187}, { 12, S    , 187}, { 13, S    , 187}, { 14, S|A  , 187},
+        {  7, S    , 189}, {  8, S    , 189}, {  9, S    , 189}, { 10, S    , 189},
+        { 11, S    , 189}, { 12, S    , 189}, { 13, S    , 189}, { 14, S|A  , 189},
+    },
+    /* state 151: "111111111111111110011" */
+    {
+        {  7, S    , 190}, {  8, S    , 190}, {  9, S    , 190}, { 10, S    , 190},
+        { 11, S    , 190}, { 12, S    , 190}, { 13, S    , 190}, { 14, S|A  , 190},
+        {  7, S    , 196}, {  8, S    , 196}, {  9, S    , 196}, { 10, S    , 196},
+        { 11, S    , 196}, { 12, S    , 196}, { 13, S    , 196}, { 14, S|A  , 196},
+    },
+    /* state 152: "111111111111111110100" */
+    {
+        {  7, S    , 198}, {  8, S    , 198}, {  9, S    , 198}, { 10, S    , 198},
+        { 11, S    , 198}, { 12, S    , 198}, { 13, S    , 198}, { 14, S|A  , 198},
+        {  7, S    , 228}, {  8, S    , 228}, {  9, S    , 228}, { 10, S    , 228},
+        { 11, S    , 228}, { 12, S    , 228}, { 13, S    , 228}, { 14, S|A  , 228},
+    },
+    /* state 153: "111111111111111110101" */
+    {
+        {  7, S    , 232}, {  8, S    , 232}, {  9, S    , 232}, { 10, S    , 232},
+        { 11, S    , 232}, { 12, S    , 232}, { 13, S    , 232}, { 14, S|A  , 232},
+        {  7, S    , 233}, {  8, S    , 233}, {  9, S    , 233}, { 10, S    , 233},
+        { 11, S    , 233}, { 12, S    , 233}, { 13, S    , 233}, { 14, S|A  , 233},
+    },
+    /* state 154: "111111111111111110110" */
+    {
+        {  3, S    ,   1}, {  4, S    ,   1}, {  5, S    ,   1}, {  6, S|A  ,   1},
+        {  3, S    , 135}, {  4, S    , 135}, {  5, S    , 135}, {  6, S|A  , 135},
+        {  3, S    , 137}, {  4, S    , 137}, {  5, S    , 137}, {  6, S|A  , 137},
+        {  3, S    , 138}, {  4, S    , 138}, {  5, S    , 138}, {  6, S|A  , 138},
+    },
+    /* state 155: "111111111111111110111" */
+    {
+        {  3, S    , 139}, {  4, S    , 139}, {  5, S    , 139}, {  6, S|A  , 139},
+        {  3, S    , 140}, {  4, S    , 140}, {  5, S    , 140}, {  6, S|A  , 140},
+        {  3, S    , 141}, {  4, S    , 141}, {  5, S    , 141}, {  6, S|A  , 141},
+        {  3, S    , 143}, {  4, S    , 143}, {  5, S    , 143}, {  6, S|A  , 143},
+    },
+    /* state 156: "111111111111111111000" */
+    {
+        {  3, S    , 147}, {  4, S    , 147}, {  5, S    , 147}, {  6, S|A  , 147},
+        {  3, S    , 149}, {  4, S    , 149}, {  5, S    , 149}, {  6, S|A  , 149},
+        {  3, S    , 150}, {  4, S    , 150}, {  5, S    , 150}, {  6, S|A  , 150},
+        {  3, S    , 151}, {  4, S    , 151}, {  5, S    , 151}, {  6, S|A  , 151},
+    },
+    /* state 157: "111111111111111111001" */
+    {
+        {  3, S    , 152}, {  4, S    , 152}, {  5, S    , 152}, {  6, S|A  , 152},
+        {  3, S    , 155}, {  4, S    , 155}, {  5, S    , 155}, {  6, S|A  , 155},
+        {  3, S    , 157}, {  4, S    , 157}, {  5, S    , 157}, {  6, S|A  , 157},
+        {  3, S    , 158}, {  4, S    , 158}, {  5, S    , 158}, {  6, S|A  , 158},
+    },
+    /* state 158: "111111111111111111010" */
+    {
+        {  3, S    , 165}, {  4, S    , 165}, {  5, S    , 165}, {  6, S|A  , 165},
+        {  3, S    , 166}, {  4, S    , 166}, {  5, S    , 166}, {  6, S|A  , 166},
+        {  3, S    , 168}, {  4, S    , 168}, {  5, S    , 168}, {  6, S|A  , 168},
+        {  3, S    , 174}, {  4, S    , 174}, {  5, S    , 174}, {  6, S|A  , 174},
+    },
+    /* state 159: "111111111111111111011" */
+    {
+        {  3, S    , 175}, {  4, S    , 175}, {  5, S    , 175}, {  6, S|A  , 175},
+        {  3, S    , 180}, {  4, S    , 180}, {  5, S    , 180}, {  6, S|A  , 180},
+        {  3, S    , 182}, {  4, S    , 182}, {  5, S    , 182}, {  6, S|A  , 182},
+        {  3, S    , 183}, {  4, S    , 183}, {  5, S    , 183}, {  6, S|A  , 183},
+    },
+    /* state 160: "111111111111111111100" */
+    {
+        {  3, S    , 188}, {  4, S    , 188}, {  5, S    , 188}, {  6, S|A  , 188},
+        {  3, S    , 191}, {  4, S    , 191}, {  5, S    , 191}, {  6, S|A  , 191},
+        {  3, S    , 197}, {  4, S    , 197}, {  5, S    , 197}, {  6, S|A  , 197},
+        {  3, S    , 231}, {  4, S    , 231}, {  5, S    , 231}, {  6, S|A  , 231},
+    },
+    /* state 161: "111111111111111111101" */
+    {
+        {  3, S    , 239}, {  4, S    , 239}, {  5, S    , 239}, {  6, S|A  , 239},
+        {  1, S    ,   9}, {  2, S|A  ,   9}, {  1, S    , 142}, {  2, S|A  , 142},
+        {  1, S    , 144}, {  2, S|A  , 144}, {  1, S    , 145}, {  2, S|A  , 145},
+        {  1, S    , 148}, {  2, S|A  , 148}, {  1, S    , 159}, {  2, S|A  , 159},
+    },
+    /* state 162: "111111111111111111110" */
+    {
+        {  1, S    , 171}, {  2, S|A  , 171}, {  1, S    , 206}, {  2, S|A  , 206},
+        {  1, S    , 215}, {  2, S|A  , 215}, {  1, S    , 225}, {  2, S|A  , 225},
+        {  1, S    , 236}, {  2, S|A  , 236}, {  1, S    , 237}, {  2, S|A  , 237},
+        {  0, S|A  , 199}, {  0, S|A  , 207}, {  0, S|A  , 234}, {  0, S|A  , 235},
+    },
+    /* state 163: "111111111111111111111" */
+    {
+        {205, 0    ,   0}, {206, 0    ,   0}, {207, 0    ,   0}, {208, 0    ,   0},
+        {209, 0    ,   0}, {210, 0    ,   0}, {211, 0    ,   0}, {212, 0    ,   0},
+        {213, 0    ,   0}, {214, 0    ,   0}, {215, 0    ,   0}, {216, 0    ,   0},
+        {217, 0    ,   0}, {218, 0    ,   0}, {219, 0    ,   0}, {220, 0    ,   0},
+    },
+    /* state 164: "1111111111111111101100" */
+    {
+        {  7, S    ,   1}, {  8, S    ,   1}, {  9, S    ,   1}, { 10, S    ,   1},
+        { 11, S    ,   1}, { 12, S    ,   1}, { 13, S    ,   1}, { 14, S|A  ,   1},
+        {  7, S    , 135}, {  8, S    , 135}, {  9, S    , 135}, { 10, S    , 135},
+        { 11, S    , 135}, { 12, S    , 135}, { 13, S    , 135}, { 14, S|A  , 135},
+    },
+    /* state 165: "1111111111111111101101" */
+    {
+        {  7, S    , 137}, {  8, S    , 137}, {  9, S    , 137}, { 10, S    , 137},
+        { 11, S    , 137}, { 12, S    , 137}, { 13, S    , 137}, { 14, S|A  , 137},
+        {  7, S    , 138}, {  8, S    , 138}, {  9, S    , 138}, { 10, S    , 138},
+        { 11, S    , 138}, { 12, S    , 138}, { 13, S    , 138}, { 14, S|A  , 138},
+    },
+    /* state 166: "1111111111111111101110" */
+    {
+        {  7, S    , 139}, {  8, S    , 139}, {  9, S    , 139}, { 10, S    , 139},
+        { 11, S    , 139}, { 12, S    , 139}, { 13, S    , 139}, { 14, S|A  , 139},
+        {  7, S    , 140}, {  8, S    , 140}, {  9, S    , 140}, { 10, S    , 140},
+        { 11, S    , 140}, { 12, S    , 140}, { 13, S    , 140}, { 14, S|A  , 140},
+    },
+    /* state 167: "1111111111111111101111" */
+    {
+        {  7, S    , 141}, {  8, S    , 141}, {  9, S    , 141}, { 10, S    , 141},
+        { 11, S    , 141}, { 12, S    , 141}, { 13, S    , 141}, { 14, S|A  , 141},
+        {  7, S    , 143}, {  8, S    , 143}, {  9, S    , 143}, { 10, S    , 143},
+        { 11, S    , 143}, { 12, S    , 143}, { 13, S    , 143}, { 14, S|A  , 143},
+    },
+    /* state 168: "1111111111111111110000" */
+    {
+        {  7, S    , 147}, {  8, S    , 147}, {  9, S    , 147}, { 10, S    , 147},
+        { 11, S    , 147}, { 12, S    , 147}, { 13, S    , 147}, { 14, S|A  , 147},
+        {  7, S    , 149}, {  8, S    , 149}, {  9, S    , 149}, { 10, S    , 149},
+        { 11, S    , 149}, { 12, S    , 149}, { 13, S    , 149}, { 14, S|A  , 149},
+    },
+    /* state 169: "1111111111111111110001" */
+    {
+        {  7, S    , 150}, {  8, S    , 150}, {  9, S    , 150}, { 10, S    , 150},
+        { 11, S    , 150}, { 12, S    , 150}, { 13, S    , 150}, { 14, S|A  , 150},
+        {  7, S    , 151}, {  8, S    , 151}, {  9, S    , 151}, { 10, S    , 151},
+        { 11, S    , 151}, { 12, S    , 151}, { 13, S    , 151}, { 14, S|A  , 151},
+    },
+    /* state 170: "1111111111111111110010" */
+    {
+        {  7, S    , 152}, {  8, S    , 152}, {  9, S    , 152}, { 10, S    , 152},
+        { 11, S    , 152}, { 12, S    , 152}, { 13, S    , 152}, { 14, S|A  , 152},
+        {  7, S    , 155}, {  8, S    , 155}, {  9, S    , 155}, { 10, S    , 155},
+        { 11, S    , 155}, { 12, S    , 155}, { 13, S    , 155}, { 14, S|A  , 155},
+    },
+    /* state 171: "1111111111111111110011" */
+    {
+        {  7, S    , 157}, {  8, S    , 157}, {  9, S    , 157}, { 10, S    , 157},
+        { 11, S    , 157}, { 12, S    , 157}, { 13, S    , 157}, { 14, S|A  , 157},
+        {  7, S    , 158}, {  8, S    , 158}, {  9, S    , 158}, { 10, S    , 158},
+        { 11, S    , 158}, { 12, S    , 158}, { 13, S    , 158}, { 14, S|A  , 158},
+    },
+    /* state 172: "1111111111111111110100" */
+    {
+        {  7, S    , 165}, {  8, S    , 165}, {  9, S    , 165}, { 10, S    , 165},
+        { 11, S    , 165}, { 12, S    , 165}, { 13, S    , 165}, { 14, S|A  , 165},
+        {  7, S    , 166}, {  8, S    , 166}, {  9, S    , 166}, { 10, S    , 166},
+        { 11, S    , 166}, { 12, S    , 166}, { 13, S    , 166}, { 14, S|A  , 166},
+    },
+    /* state 173: "1111111111111111110101" */
+    {
+        {  7, S    , 168}, {  8, S    , 168}, {  9, S    , 168}, { 10, S    , 168},
+        { 11, S    , 168}, { 12, S    , 168}, { 13, S    , 168}, { 14, S|A  , 168},
+        {  7, S    , 174}, {  8, S    , 174}, {  9, S    , 174}, { 10, S    , 174},
+        { 11, S    , 174}, { 12, S    , 174}, { 13, S    , 174}, { 14, S|A  , 174},
+    },
+    /* state 174: "1111111111111111110110" */
+    {
+        {  7, S    , 175}, {  8, S    , 175}, {  9, S    , 175}, { 10, S    , 175},
+        { 11, S    , 175}, { 12, S    , 175}, { 13, S    , 175}, { 14, S|A  , 175},
+        {  7, S    , 180}, {  8, S    , 180}, {  9, S    , 180}, { 10, S    , 180},
+        { 11, S    , 180}, { 12, S    , 180}, { 13, S    , 180}, { 14, S|A  , 180},
+    },
+    /* state 175: "1111111111111111110111" */
+    {
+        {  7, S    , 182}, {  8, S    , 182}, {  9, S    , 182}, { 10, S    , 182},
+        { 11, S    , 182}, { 12, S    , 182}, { 13, S    , 182}, { 14, S|A  , 182},
+        {  7, S    , 183}, {  8, S    , 183}, {  9, S    , 183}, { 10, S    , 183},
+        { 11, S    , 183}, { 12, S    , 183}, { 13, S    , 183}, { 14, S|A  , 183},
+    },
+    /* state 176: "1111111111111111111000" */
+    {
+        {  7, S    , 188}, {  8, S    , 188}, {  9, S    , 188}, { 10, S    , 188},
+        { 11, S    , 188}, { 12, S    , 188}, { 13, S    , 188}, { 14, S|A  , 188},
+        {  7, S    , 191}, {  8, S    , 191}, {  9, S    , 191}, { 10, S    , 191},
+        { 11, S    , 191}, { 12, S    , 191}, { 13, S    , 191}, { 14, S|A  , 191},
+    },
+    /* state 177: "1111111111111111111001" */
+    {
+        {  7, S    , 197}, {  8, S    , 197}, {  9, S    , 197}, { 10, S    , 197},
+        { 11, S    , 197}, { 12, S    , 197}, { 13, S    , 197}, { 14, S|A  , 197},
+        {  7, S    , 231}, {  8, S    , 231}, {  9, S    , 231}, { 10, S    , 231},
+        { 11, S    , 231}, { 12, S    , 231}, { 13, S    , 231}, { 14, S|A  , 231},
+    },
+    /* state 178: "1111111111111111111010" */
+    {
+        {  7, S    , 239}, {  8, S    , 239}, {  9, S    , 239}, { 10, S    , 239},
+        { 11, S    , 239}, { 12, S    , 239}, { 13, S    , 239}, { 14, S|A  , 239},
+        {  3, S    ,   9}, {  4, S    ,   9}, {  5, S    ,   9}, {  6, S|A  ,   9},
+        {  3, S    , 142}, {  4, S    , 142}, {  5, S    , 142}, {  6, S|A  , 142},
+    },
+    /* state 179: "1111111111111111111011" */
+    {
+        {  3, S    , 144}, {  4, S    , 144}, {  5, S    , 144}, {  6, S|A  , 144},
+        {  3, S    , 145}, {  4, S    , 145}, {  5, S    , 145}, {  6, S|A  , 145},
+        {  3, S    , 148}, {  4, S    , 148}, {  5, S    , 148}, {  6, S|A  , 148},
+        {  3, S    , 159}, {  4, S    , 159}, {  5, S    , 159}, {  6, S|A  , 159},
+    },
+    /* state 180: "1111111111111111111100" */
+    {
+        {  3, S    , 171}, {  4, S    , 171}, {  5, S    , 171}, {  6, S|A  , 171},
+        {  3, S    , 206}, {  4, S    , 206}, {  5, S    , 206}, {  6, S|A  , 206},
+        {  3, S    , 215}, {  4, S    , 215}, {  5, S    , 215}, {  6, S|A  , 215},
+        {  3, S    , 225}, {  4, S    , 225}, {  5, S    , 225}, {  6, S|A  , 225},
+    },
+    /* state 181: "1111111111111111111101" */
+    {
+        {  3, S    , 236}, {  4, S    , 236}, {  5, S    , 236}, {  6, S|A  , 236},
+        {  3, S    , 237}, {  4, S    , 237}, {  5, S    , 237}, {  6, S|A  , 237},
+        {  1, S    , 199}, {  2, S|A  , 199}, {  1, S    , 207}, {  2, S|A  , 207},
+        {  1, S    , 234}, {  2, S|A  , 234}, {  1, S    , 235}, {  2, S|A  , 235},
+    },
+    /* state 182: "1111111111111111111110" */
+    {
+        {  0, S|A  , 192}, {  0, S|A  , 193}, {  0, S|A  , 200}, {  0, S|A  , 201},
+        {  0, S|A  , 202}, {  0, S|A  , 205}, {  0, S|A  , 210}, {  0, S|A  , 213},
+        {  0, S|A  , 218}, {  0, S|A  , 219}, {  0, S|A  , 238}, {  0, S|A  , 240},
+        {  0, S|A  , 242}, {  0, S|A  , 243}, {  0, S|A  , 255}, {221, 0    ,   0},
+    },
+    /* state 183: "1111111111111111111111" */
+    {
+        {222, 0    ,   0}, {223, 0    ,   0}, {224, 0    ,   0}, {225, 0    ,   0},
+        {226, 0    ,   0}, {227, 0    ,   0}, {228, 0    ,   0}, {229, 0    ,   0},
+        {230, 0    ,   0}, {231, 0    ,   0}, {232, 0    ,   0}, {233, 0    ,   0},
+        {234, 0    ,   0}, {235, 0    ,   0}, {236, 0    ,   0}, {237, 0    ,   0},
+    },
+    /* state 184: "11111111111111111110101" */
+    {
+        {  7, S    ,   9}, {  8, S    ,   9}, {  9, S    ,   9}, { 10, S    ,   9},
+        { 11, S    ,   9}, { 12, S    ,   9}, { 13, S    ,   9}, { 14, S|A  ,   9},
+        {  7, S    , 142}, {  8, S    , 142}, {  9, S    , 142}, { 10, S    , 142},
+        { 11, S    , 142}, { 12, S    , 142}, { 13, S    , 142}, { 14, S|A  , 142},
+    },
+    /* state 185: "11111111111111111110110" */
+    {
+        {  7, S    , 144}, {  8, S    , 144}, {  9, S    , 144}, { 10, S    , 144},
+        { 11, S    , 144}, { 12, S    , 144}, { 13, S    , 144}, { 14, S|A  , 144},
+        {  7, S    , 145}, {  8, S    , 145}, {  9, S    , 145}, { 10, S    , 145},
+        { 11, S    , 145}, { 12, S    , 145}, { 13, S    , 145}, { 14, S|A  , 145},
+    },
+    /* state 186: "11111111111111111110111" */
+    {
+        {  7, S    , 148}, {  8, S    , 148}, {  9, S    , 148}, { 10, S    , 148},
+        { 11, S    , 148}, { 12, S    , 148}, { 13, S    , 148}, { 14, S|A  , 148},
+        {  7, S    , 159}, {  8, S    , 159}, {  9, S    , 159}, { 10, S    , 159},
+        { 11, S    , 159}, { 12, S    , 159}, { 13, S    , 159}, { 14, S|A  , 159},
+    },
+    /* state 187: "11111111111111111111000" */
+    {
+        {  7, S    , 171}, {  8, S    , 171}, {  9, S    , 171}, { 10, S    , 171},
+        { 11, S    , 171}, { 12, S    , 171}, { 13, S    , 171}, { 14, S|A  , 171},
+        {  7, S    , 206}, {  8, S    , 206}, {  9, S    , 206}, { 10, S    , 206},
+        { 11, S    , 206}, { 12, S    , 206}, { 13, S    , 206}, { 14, S|A  , 206},
+    },
+    /* state 188: "11111111111111111111001" */
+    {
+        {  7, S    , 215}, {  8, S    , 215}, {  9, S    , 215}, { 10, S    , 215},
+        { 11, S    , 215}, { 12, S    , 215}, { 13, S    , 215}, { 14, S|A  , 215},
+        {  7, S    , 225}, {  8, S    , 225}, {  9, S    , 225}, { 10, S    , 225},
+        { 11, S    , 225}, { 12, S    , 225}, { 13, S    , 225}, { 14, S|A  , 225},
+    },
+    /* state 189: "11111111111111111111010" */
+    {
+        {  7, S    , 236}, {  8, S    , 236}, {  9, S    , 236}, { 10, S    , 236},
+        { 11, S    , 236}, { 12, S    , 236}, { 13, S    , 236}, { 14, S|A  , 236},
+        {  7, S    , 237}, {  8, S    , 237}, {  9, S    , 237}, { 10, S    , 237},
+        { 11, S    , 237}, { 12, S    , 237}, { 13, S    , 237}, { 14, S|A  , 237},
+    },
+    /* state 190: "11111111111111111111011" */
+    {
+        {  3, S    , 199}, {  4, S    , 199}, {  5, S    , 199}, {  6, S|A  , 199},
+        {  3, S    , 207}, {  4, S    , 207}, {  5, S    , 207}, {  6, S|A  , 207},
+        {  3, S    , 234}, {  4, S    , 234}, {  5, S    , 234}, {  6, S|A  , 234},
+        {  3, S    , 235}, {  4, S    , 235}, {  5, S    , 235}, {  6, S|A  , 235},
+    },
+    /* state 191: "11111111111111111111100" */
+    {
+        {  1, S    , 192}, {  2, S|A  , 192}, {  1, S    , 193}, {  2, S|A  , 193},
+        {  1, S    , 200}, {  2, S|A  , 200}, {  1, S    , 201}, {  2, S|A  , 201},
+        {  1, S    , 202}, {  2, S|A  , 202}, {  1, S    , 205}, {  2, S|A  , 205},
+        {  1, S    , 210}, {  2, S|A  , 210}, {  1, S    , 213}, {  2, S|A  , 213},
+    },
+    /* state 192: "11111111111111111111101" */
+    {
+        {  1, S    , 218}, {  2, S|A  , 218}, {  1, S    , 219}, {  2, S|A  , 219},
+        {  1, S    , 238}, {  2, S|A  , 238}, {  1, S    , 240}, {  2, S|A  , 240},
+        {  1, S    , 242}, {  2, S|A  , 242}, {  1, S    , 243}, {  2, S|A  , 243},
+        {  1, S    , 255}, {  2, S|A  , 255}, {  0, S|A  , 203}, {  0, S|A  , 204},
+    },
+    /* state 193: "11111111111111111111110" */
+    {
+        {  0, S|A  , 211}, {  0, S|A  , 212}, {  0, S|A  , 214}, {  0, S|A  , 221},
+        {  0, S|A  , 222}, {  0, S|A  , 223}, {  0, S|A  , 241}, {  0, S|A  , 244},
+        {  0, S|A  , 245}, {  0, S|A  , 246}, {  0, S|A  , 247}, {  0, S|A  , 248},
+        {  0, S|A  , 250}, {  0, S|A  , 251}, {  0, S|A  , 252}, {  0, S|A  , 253},
+    },
+    /* state 194: "11111111111111111111111" */
+    {
+        {  0, S|A  , 254}, {238, 0    ,   0}, {239, 0    ,   0}, {240, 0    ,   0},
+        {241, 0    ,   0}, {242, 0    ,   0}, {243, 0    ,   0}, {244, 0    ,   0},
+        {245, 0    ,   0}, {246, 0    ,   0}, {247, 0    ,   0}, {248, 0    ,   0},
+        {249, 0    ,   0}, {250, 0    ,   0}, {251, 0    ,   0}, {252, 0    ,   0},
+    },
+    /* state 195: "111111111111111111110110" */
+    {
+        {  7, S    , 199}, {  8, S    , 199}, {  9, S    , 199}, { 10, S    , 199},
+        { 11, S    , 199}, { 12, S    , 199}, { 13, S    , 199}, { 14, S|A  , 199},
+        {  7, S    , 207}, {  8, S    , 207}, {  9, S    , 207}, { 10, S    , 207},
+        { 11, S    , 207}, { 12, S    , 207}, { 13, S    , 207}, { 14, S|A  , 207},
+    },
+    /* state 196: "111111111111111111110111" */
+    {
+        {  7, S    , 234}, {  8, S    , 234}, {  9, S    , 234}, { 10, S    , 234},
+        { 11, S    , 234}, { 12, S    , 234}, { 13, S    , 234}, { 14, S|A  , 234},
+        {  7, S    , 235}, {  8, S    , 235}, {  9, S    , 235}, { 10, S    , 235},
+        { 11, S    , 235}, { 12, S    , 235}, { 13, S    , 235}, { 14, S|A  , 235},
+    },
+    /* state 197: "111111111111111111111000" */
+    {
+        {  3, S    , 192}, {  4, S    , 192}, {  5, S    , 192}, {  6, S|A  , 192},
+        {  3, S    , 193}, {  4, S    , 193}, {  5, S    , 193}, {  6, S|A  , 193},
+        {  3, S    , 200}, {  4, S    , 200}, {  5, S    , 200}, {  6, S|A  , 200},
+        {  3, S    , 201}, {  4, S    , 201}, {  5, S    , 201}, {  6, S|A  , 201},
+    },
+    /* state 198: "111111111111111111111001" */
+    {
+        {  3, S    , 202}, {  4, S    , 202}, {  5, S    , 202}, {  6, S|A  , 202},
+        {  3, S    , 205}, {  4, S    , 205}, {  5, S    , 205}, {  6, S|A  , 205},
+        {  3, S    , 210}, {  4, S    , 210}, {  5, S    , 210}, {  6, S|A  , 210},
+        {  3, S    , 213}, {  4, S    , 213}, {  5, S    , 213}, {  6, S|A  , 213},
+    },
+    /* state 199: "111111111111111111111010" */
+    {
+        {  3, S    , 218}, {  4, S    , 218}, {  5, S    , 218}, {  6, S|A  , 218},
+        {  3, S    , 219}, {  4, S    , 219}, {  5, S    , 219}, {  6, S|A  , 219},
+        {  3, S    , 238}, {  4, S    , 238}, {  5, S    , 238}, {  6, S|A  , 238},
+        {  3, S    , 240}, {  4, S    , 240}, {  5, S    , 240}, {  6, S|A  , 240},
+    },
+    /* state 200: "111111111111111111111011" */
+    {
+        {  3, S    , 242}, {  4, S    , 242}, {  5, S    , 242}, {  6, S|A  , 242},
+        {  3, S    , 243}, {  4, S    , 243}, {  5, S    , 243}, {  6, S|A  , 243},
+        {  3, S    , 255}, {  4, S    , 255}, {  5, S    , 255}, {  6, S|A  , 255},
+        {  1, S    , 203}, {  2, S|A  , 203}, {  1, S    , 204}, {  2, S|A  , 204},
+    },
+    /* state 201: "111111111111111111111100" */
+    {
+        {  1, S    , 211}, {  2, S|A  , 211}, {  1, S    , 212}, {  2, S|A  , 212},
+        {  1, S    , 214}, {  2, S|A  , 214}, {  1, S    , 221}, {  2, S|A  , 221},
+        {  1, S    , 222}, {  2, S|A  , 222}, {  1, S    , 223}, {  2, S|A  , 223},
+        {  1, S    , 241}, {  2, S|A  , 241}, {  1, S    , 244}, {  2, S|A  , 244},
+    },
+    /* state 202: "111111111111111111111101" */
+    {
+        {  1, S    , 245}, {  2, S|A  , 245}, {  1, S    , 246}, {  2, S|A  , 246},
+        {  1, S    , 247}, {  2, S|A  , 247}, {  1, S    , 248}, {  2, S|A  , 248},
+        {  1, S    , 250}, {  2, S|A  , 250}, {  1, S    , 251}, {  2, S|A  , 251},
+        {  1, S    , 252}, {  2, S|A  , 252}, {  1, S    , 253}, {  2, S|A  , 253},
+    },
+    /* state 203: "111111111111111111111110" */
+    {
+        {  1, S    , 254}, {  2, S|A  , 254}, {  0, S|A  ,   2}, {  0, S|A  ,   3},
+        {  0, S|A  ,   4}, {  0, S|A  ,   5}, {  0, S|A  ,   6}, {  0, S|A  ,   7},
+        {  0, S|A  ,   8}, {  0, S|A  ,  11}, {  0, S|A  ,  12}, {  0, S|A  ,  14},
+        {  0, S|A  ,  15}, {  0, S|A  ,  16}, {  0, S|A  ,  17}, {  0, S|A  ,  18},
+    },
+    /* state 204: "111111111111111111111111" */
+    {
+        {  0, S|A  ,  19}, {  0, S|A  ,  20}, {  0, S|A  ,  21}, {  0, S|A  ,  23},
+        {  0, S|A  ,  24}, {  0, S|A  ,  25}, {  0, S|A  ,  26}, {  0, S|A  ,  27},
+        {  0, S|A  ,  28}, {  0, S|A  ,  29}, {  0, S|A  ,  30}, {  0, S|A  ,  31},
+        {  0, S|A  , 127}, {  0, S|A  , 220}, {  0, S|A  , 249}, {253, 0    ,   0},
+    },
+    /* state 205: "1111111111111111111110000" */
+    {
+        {  7, S    , 192}, {  8, S    , 192}, {  9, S    , 192}, { 10, S    , 192},
+        { 11, S    , 192}, { 12, S    , 192}, { 13, S    , 192}, { 14, S|A  , 192},
+        {  7, S    , 193}, {  8, S    , 193}, {  9, S    , 193}, { 10, S    , 193},
+        { 11, S    , 193}, { 12, S    , 193}, { 13, S    , 193}, { 14, S|A  , 193},
+    },
+    /* state 206: "1111111111111111111110001" */
+    {
+        {  7, S    , 200}, {  8, S    , 200}, {  9, S    , 200}, { 10, S    , 200},
+        { 11, S    , 200}, { 12, S    , 200}, { 13, S    , 200}, { 14, S|A  , 200},
+        {  7, S    , 201}, {  8, S    , 201}, {  9, S    , 201}, { 10, S    , 201},
+        { 11, S    , 201}, { 12, S    , 201}, { 13, S    , 201}, { 14, S|A  , 201},
+    },
+    /* state 207: "1111111111111111111110010" */
+    {
+        {  7, S    , 202}, {  8, S    , 202}, {  9, S    , 202}, { 10, S    , 202},
+        { 11, S    , 202}, { 12, S    , 202}, { 13, S    , 202}, { 14, S|A  , 202},
+        {  7, S    , 205}, {  8, S    , 205}, {  9, S    , 205}, { 10, S    , 205},
+        { 11, S    , 205}, { 12, S    , 205}, { 13, S    , 205}, { 14, S|A  , 205},
+    },
+    /* state 208: "1111111111111111111110011" */
+    {
+        {  7, S    , 210}, {  8, S    , 210}, {  9, S    , 210}, { 10, S    , 210},
+        { 11, S    , 210}, { 12, S    , 210}, { 13, S    , 210}, { 14, S|A  , 210},
+        {  7, S    , 213}, {  8, S    , 213}, {  9, S    , 213}, { 10, S    , 213},
+        { 11, S    , 213}, { 12, S    , 213}, { 13, S    , 213}, { 14, S|A  , 213},
+    },
+    /* state 209: "1111111111111111111110100" */
+    {
+        {  7, S    , 218}, {  8, S    , 218}, {  9, S    , 218}, { 10, S    , 218},
+        { 11, S    , 218}, { 12, S    , 218}, { 13, S    , 218}, { 14, S|A  , 218},
+        {  7, S    , 219}, {  8, S    , 219}, {  9, S    , 219}, { 10, S    , 219},
+        { 11, S    , 219}, { 12, S    , 219}, { 13, S    , 219}, { 14, S|A  , 219},
+    },
+    /* state 210: "1111111111111111111110101" */
+    {
+        {  7, S    , 238}, {  8, S    , 238}, {  9, S    , 238}, { 10, S    , 238},
+        { 11, S    , 238}, { 12, S    , 238}, { 13, S    , 238}, { 14, S|A  , 238},
+        {  7, S    , 240}, {  8, S    , 240}, {  9, S    , 240}, { 10, S    , 240},
+        { 11, S    , 240}, { 12, S    , 240}, { 13, S    , 240}, { 14, S|A  , 240},
+    },
+    /* state 211: "1111111111111111111110110" */
+    {
+        {  7, S    , 242}, {  8, S    , 242}, {  9, S    , 242}, { 10, S    , 242},
+        { 11, S    , 242}, { 12, S    , 242}, { 13, S    , 242}, { 14, S|A  , 242},
+        {  7, S    , 243}, {  8, S    , 243}, {  9, S    , 243}, { 10, S    , 243},
+        { 11, S    , 243}, { 12, S    , 243}, { 13, S    , 243}, { 14, S|A  , 243},
+    },
+    /* state 212: "1111111111111111111110111" */
+    {
+        {  7, S    , 255}, {  8, S    , 255}, {  9, S    , 255}, { 10, S    , 255},
+        { 11, S    , 255}, { 12, S    , 255}, { 13, S    , 255}, { 14, S|A  , 255},
+        {  3, S    , 203}, {  4, S    , 203}, {  5, S    , 203}, {  6, S|A  , 203},
+        {  3, S    , 204}, {  4, S    , 204}, {  5, S    , 204}, {  6, S|A  , 204},
+    },
+    /* state 213: "1111111111111111111111000" */
+    {
+        {  3, S    , 211}, {  4, S    , 211}, {  5, S    , 211}, {  6, S|A  , 211},
+        {  3, S    , 212}, {  4, S    , 212}, {  5, S    , 212}, {  6, S|A  , 212},
+        {  3, S    , 214}, {  4, S    , 214}, {  5, S    , 214}, {  6, S|A  , 214},
+        {  3, S    , 221}, {  4, S    , 221}, {  5, S    , 221}, {  6, S|A  , 221},
+    },
+    /* state 214: "1111111111111111111111001" */
+    {
+        {  3, S    , 222}, {  4, S    , 222}, {  5, S    , 222}, {  6, S|A  , 222},
+        {  3, S    , 223}, {  4, S    , 223}, {  5, S    , 223}, {  6, S|A  , 223},
+        {  3, S    , 241}, {  4, S    , 241}, {  5, S    , 241}, {  6, S|A  , 241},
+        {  3, S    , 244}, {  4, S    , 244}, {  5, S    , 244}, {  6, S|A  , 244},
+    },
+    /* state 215: "1111111111111111111111010" */
+    {
+        {  3, S    , 245}, {  4, S    , 245}, {  5, S    , 245}, {  6, S|A  , 245},
+        {  3, S    , 246}, {  4, S    , 246}, {  5, S    , 246}, {  6, S|A  , 246},
+        {  3, S    , 247}, {  4, S    , 247}, {  5, S    , 247}, {  6, S|A  , 247},
+        {  3, S    , 248}, {  4, S    , 248}, {  5, S    , 248}, {  6, S|A  , 248},
+    },
+    /* state 216: "1111111111111111111111011" */
+    {
+        {  3, S    , 250}, {  4, S    , 250}, {  5, S    , 250}, {  6, S|A  , 250},
+        {  3, S    , 251}, {  4, S    , 251}, {  5, S    , 251}, {  6, S|A  , 251},
+        {  3, S    , 252}, {  4, S    , 252}, {  5, S    , 252}, {  6, S|A  , 252},
+        {  3, S    , 253}, {  4, S    , 253}, {  5, S    , 253}, {  6, S|A  , 253},
+    },
+    /* state 217: "1111111111111111111111100" */
+    {
+        {  3, S    , 254}, {  4, S    , 254}, {  5, S    , 254}, {  6, S|A  , 254},
+        {  1, S    ,   2}, {  2, S|A  ,   2}, {  1, S    ,   3}, {  2, S|A  ,   3},
+        {  1, S    ,   4}, {  2, S|A  ,   4}, {  1, S    ,   5}, {  2, S|A  ,   5},
+        {  1, S    ,   6}, {  2, S|A  ,   6}, {  1, S    ,   7}, {  2, S|A  ,   7},
+    },
+    /* state 218: "1111111111111111111111101" */
+    {
+        {  1, S    ,   8}, {  2, S|A  ,   8}, {  1, S    ,  11}, {  2, S|A  ,  11},
+        {  1, S    ,  12}, {  2, S|A  ,  12}, {  1, S    ,  14}, {  2, S|A  ,  14},
+        {  1, S    ,  15}, {  2, S|A  ,  15}, {  1, S    ,  16}, {  2, S|A  ,  16},
+        {  1, S    ,  17}, {  2, S|A  ,  17}, {  1, S    ,  18}, {  2, S|A  ,  18},
+    },
+    /* state 219: "1111111111111111111111110" */
+    {
+        {  1, S    ,  19}, {  2, S|A  ,  19}, {  1, S    ,  20}, {  2, S|A  ,  20},
+        {  1, S    ,  21}, {  2, S|A  ,  21}, {  1, S    ,  23}, {  2, S|A  ,  23},
+        {  1, S    ,  24}, {  2, S|A  ,  24}, {  1, S    ,  25}, {  2, S|A  ,  25},
+        {  1, S    ,  26}, {  2, S|A  ,  26}, {  1, S    ,  27}, {  2, S|A  ,  27},
+    },
+    /* state 220: "1111111111111111111111111" */
+    {
+        {  1, S    ,  28}, {  2, S|A  ,  28}, {  1, S    ,  29}, {  2, S|A  ,  29},
+        {  1, S    ,  30}, {  2, S|A  ,  30}, {  1, S    ,  31}, {  2, S|A  ,  31},
+        {  1, S    , 127}, {  2, S|A  , 127}, {  1, S    , 220}, {  2, S|A  , 220},
+        {  1, S    , 249}, {  2, S|A  , 249}, {254, 0    ,   0}, {255, 0    ,   0},
+    },
+    /* state 221: "11111111111111111111101111" */
+    {
+        {  7, S    , 203}, {  8, S    , 203}, {  9, S    , 203}, { 10, S    , 203},
+        { 11, S    , 203}, { 12, S    , 203}, { 13, S    , 203}, { 14, S|A  , 203},
+        {  7, S    , 204}, {  8, S    , 204}, {  9, S    , 204}, { 10, S    , 204},
+        { 11, S    , 204}, { 12, S    , 204}, { 13, S    , 204}, { 14, S|A  , 204},
+    },
+    /* state 222: "11111111111111111111110000" */
+    {
+        {  7, S    , 211}, {  8, S    , 211}, {  9, S    , 211}, { 10, S    , 211},
+        { 11, S    , 211}, { 12, S    , 211}, { 13, S    , 211}, { 14, S|A  , 211},
+        {  7, S    , 212}, {  8, S    , 212}, {  9, S    , 212}, { 10, S    , 212},
+        { 11, S    , 212}, { 12, S    , 212}, { 13, S    , 212}, { 14, S|A  , 212},
+    },
+    /* state 223: "11111111111111111111110001" */
+    {
+        {  7, S    , 214}, {  8, S    , 214}, {  9, S    , 214}, { 10, S    , 214},
+        { 11, S    , 214}, { 12, S    , 214}, { 13, S    , 214}, { 14, S|A  , 214},
+        {  7, S    , 221}, {  8, S    , 221}, {  9, S    , 221}, { 10, S    , 221},
+        { 11, S    , 221}, { 12, S    , 221}, { 13, S    , 221}, { 14, S|A  , 221},
+    },
+    /* state 224: "11111111111111111111110010" */
+    {
+        {  7, S    , 222}, {  8, S    , 222}, {  9, S    , 222}, { 10, S    , 222},
+        { 11, S    , 222}, { 12, S    , 222}, { 13, S    , 222}, { 14, S|A  , 222},
+        {  7, S    , 223}, {  8, S    , 223}, {  9, S    , 223}, { 10, S    , 223},
+        { 11, S    , 223}, { 12, S    , 223}, { 13, S    , 223}, { 14, S|A  , 223},
+    },
+    /* state 225: "11111111111111111111110011" */
+    {
+        {  7, S    , 241}, {  8, S    , 241}, {  9, S    , 241}, { 10, S    , 241},
+        { 11, S    , 241}, { 12, S    , 241}, { 13, S    , 241}, { 14, S|A  , 241},
+        {  7, S    , 244}, {  8, S    , 244}, {  9, S    , 244}, { 10, S    , 244},
+        { 11, S    , 244}, { 12, S    , 244}, { 13, S    , 244}, { 14, S|A  , 244},
+    },
+    /* state 226: "11111111111111111111110100" */
+    {
+        {  7, S    , 245}, {  8, S    , 245}, {  9, S    , 245}, { 10, S    , 245},
+        { 11, S    , 245}, { 12, S    , 245}, { 13, S    , 245}, { 14, S|A  , 245},
+        {  7, S    , 246}, {  8, S    , 246}, {  9, S    , 246}, { 10, S    , 246},
+        { 11, S    , 246}, { 12, S    , 246}, { 13, S    , 246}, { 14, S|A  , 246},
+    },
+    /* state 227: "11111111111111111111110101" */
+    {
+        {  7, S    , 247}, {  8, S    , 247}, {  9, S    , 247}, { 10, S    , 247},
+        { 11, S    , 247}, { 12, S    , 247}, { 13, S    , 247}, { 14, S|A  , 247},
+        {  7, S    , 248}, {  8, S    , 248}, {  9, S    , 248}, { 10, S    , 248},
+        { 11, S    , 248}, { 12, S    , 248}, { 13, S    , 248}, { 14, S|A  , 248},
+    },
+    /* state 228: "11111111111111111111110110" */
+    {
+        {  7, S    , 250}, {  8, S    , 250}, {  9, S    , 250}, { 10, S    , 250},
+        { 11, S    , 250}, { 12, S    , 250}, { 13, S    , 250}, { 14, S|A  , 250},
+        {  7, S    , 251}, {  8, S    , 251}, {  9, S    , 251}, { 10, S    , 251},
+        { 11, S    , 251}, { 12, S    , 251}, { 13, S    , 251}, { 14, S|A  , 251},
+    },
+    /* state 229: "11111111111111111111110111" */
+    {
+        {  7, S    , 252}, {  8, S    , 252}, {  9, S    , 252}, { 10, S    , 252},
+        { 11, S    , 252}, { 12, S    , 252}, { 13, S    , 252}, { 14, S|A  , 252},
+        {  7, S    , 253}, {  8, S    , 253}, {  9, S    , 253}, { 10, S    , 253},
+        { 11, S    , 253}, { 12, S    , 253}, { 13, S    , 253}, { 14, S|A  , 253},
+    },
+    /* state 230: "11111111111111111111111000" */
+    {
+        {  7, S    , 254}, {  8, S    , 254}, {  9, S    , 254}, { 10, S    , 254},
+        { 11, S    , 254}, { 12, S    , 254}, { 13, S    , 254}, { 14, S|A  , 254},
+        {  3, S    ,   2}, {  4, S    ,   2}, {  5, S    ,   2}, {  6, S|A  ,   2},
+        {  3, S    ,   3}, {  4, S    ,   3}, {  5, S    ,   3}, {  6, S|A  ,   3},
+    },
+    /* state 231: "11111111111111111111111001" */
+    {
+        {  3, S    ,   4}, {  4, S    ,   4}, {  5, S    ,   4}, {  6, S|A  ,   4},
+        {  3, S    ,   5}, {  4, S    ,   5}, {  5, S    ,   5}, {  6, S|A  ,   5},
+        {  3, S    ,   6}, {  4, S    ,   6}, {  5, S    ,   6}, {  6, S|A  ,   6},
+        {  3, S    ,   7}, {  4, S    ,   7}, {  5, S    ,   7}, {  6, S|A  ,   7},
+    },
+    /* state 232: "11111111111111111111111010" */
+    {
+        {  3, S    ,   8}, {  4, S    ,   8}, {  5, S    ,   8}, {  6, S|A  ,   8},
+        {  3, S    ,  11}, {  4, S    ,  11}, {  5, S    ,  11}, {  6, S|A  ,  11},
+        {  3, S    ,  12}, {  4, S    ,  12}, {  5, S    ,  12}, {  6, S|A  ,  12},
+        {  3, S    ,  14}, {  4, S    ,  14}, {  5, S    ,  14}, {  6, S|A  ,  14},
+    },
+    /* state 233: "11111111111111111111111011" */
+    {
+        {  3, S    ,  15}, {  4, S    ,  15}, {  5, S    ,  15}, {  6, S|A  ,  15},
+        {  3, S    ,  16}, {  4, S    ,  16}, {  5, S    ,  16}, {  6, S|A  ,  16},
+        {  3, S    ,  17}, {  4, S    ,  17}, {  5, S    ,  17}, {  6, S|A  ,  17},
+        {  3, S    ,  18}, {  4, S    ,  18}, {  5, S    ,  18}, {  6, S|A  ,  18},
+    },
+    /* state 234: "11111111111111111111111100" */
+    {
+        {  3, S    ,  19}, {  4, S    ,  19}, {  5, S    ,  19}, {  6, S|A  ,  19},
+        {  3, S    ,  20}, {  4, S    ,  20}, {  5, S    ,  20}, {  6, S|A  ,  20},
+        {  3, S    ,  21}, {  4, S    ,  21}, {  5, S    ,  21}, {  6, S|A  ,  21},
+        {  3, S    ,  23}, {  4, S    ,  23}, {  5, S    ,  23}, {  6, S|A  ,  23},
+    },
+    /* state 235: "11111111111111111111111101" */
+    {
+        {  3, S    ,  24}, {  4, S    ,  24}, {  5, S    ,  24}, {  6, S|A  ,  24},
+        {  3, S    ,  25}, {  4, S    ,  25}, {  5, S    ,  25}, {  6, S|A  ,  25},
+        {  3, S    ,  26}, {  4, S    ,  26}, {  5, S    ,  26}, {  6, S|A  ,  26},
+        {  3, S    ,  27}, {  4, S    ,  27}, {  5, S    ,  27}, {  6, S|A  ,  27},
+    },
+    /* state 236: "11111111111111111111111110" */
+    {
+        {  3, S    ,  28}, {  4, S    ,  28}, {  5, S    ,  28}, {  6, S|A  ,  28},
+        {  3, S    ,  29}, {  4, S    ,  29}, {  5, S    ,  29}, {  6, S|A  ,  29},
+        {  3, S    ,  30}, {  4, S    ,  30}, {  5, S    ,  30}, {  6, S|A  ,  30},
+        {  3, S    ,  31}, {  4, S    ,  31}, {  5, S    ,  31}, {  6, S|A  ,  31},
+    },
+    /* state 237: "11111111111111111111111111" */
+    {
+        {  3, S    , 127}, {  4, S    , 127}, {  5, S    , 127}, {  6, S|A  , 127},
+        {  3, S    , 220}, {  4, S    , 220}, {  5, S    , 220}, {  6, S|A  , 220},
+        {  3, S    , 249}, {  4, S    , 249}, {  5, S    , 249}, {  6, S|A  , 249},
+        {  0, S|A  ,  10}, {  0, S|A  ,  13}, {  0, S|A  ,  22}, {  0, F    ,   0},
+    },
+    /* state 238: "111111111111111111111110001" */
+    {
+        {  7, S    ,   2}, {  8, S    ,   2}, {  9, S    ,   2}, { 10, S    ,   2},
+        { 11, S    ,   2}, { 12, S    ,   2}, { 13, S    ,   2}, { 14, S|A  ,   2},
+        {  7, S    ,   3}, {  8, S    ,   3}, {  9, S    ,   3}, { 10, S    ,   3},
+        { 11, S    ,   3}, { 12, S    ,   3}, { 13, S    ,   3}, { 14, S|A  ,   3},
+    },
+    /* state 239: "111111111111111111111110010" */
+    {
+        {  7, S    ,   4}, {  8, S    ,   4}, {  9, S    ,   4}, { 10, S    ,   4},
+        { 11, S    ,   4}, { 12, S    ,   4}, { 13, S    ,   4}, { 14, S|A  ,   4},
+        {  7, S    ,   5}, {  8, S    ,   5}, {  9, S    ,   5}, { 10, S    ,   5},
+        { 11, S    ,   5}, { 12, S    ,   5}, { 13, S    ,   5}, { 14, S|A  ,   5},
+    },
+    /* state 240: "111111111111111111111110011" */
+    {
+        {  7, S    ,   6}, {  8, S    ,   6}, {  9, S    ,   6}, { 10, S    ,   6},
+        { 11, S    ,   6}, { 12, S    ,   6}, { 13, S    ,   6}, { 14, S|A  ,   6},
+        {  7, S    ,   7}, {  8, S    ,   7}, {  9, S    ,   7}, { 10, S    ,   7},
+        { 11, S    ,   7}, { 12, S    ,   7}, { 13, S    ,   7}, { 14, S|A  ,   7},
+    },
+    /* state 241: "111111111111111111111110100" */
+    {
+        {  7, S    ,   8}, {  8, S    ,   8}, {  9, S    ,   8}, { 10, S    ,   8},
+        { 11, S    ,   8}, { 12, S    ,   8}, { 13, S    ,   8}, { 14, S|A  ,   8},
+        {  7, S    ,  11}, {  8, S    ,  11}, {  9, S    ,  11}, { 10, S    ,  11},
+        { 11, S    ,  11}, { 12, S    ,  11}, { 13, S    ,  11}, { 14, S|A  ,  11},
+    },
+    /* state 242: "111111111111111111111110101" */
+    {
+        {  7, S    ,  12}, {  8, S    ,  12}, {  9, S    ,  12}, { 10, S    ,  12},
+        { 11, S    ,  12}, { 12, S    ,  12}, { 13, S    ,  12}, { 14, S|A  ,  12},
+        {  7, S    ,  14}, {  8, S    ,  14}, {  9, S    ,  14}, { 10, S    ,  14},
+        { 11, S    ,  14}, { 12, S    ,  14}, { 13, S    ,  14}, { 14, S|A  ,  14},
+    },
+    /* state 243: "111111111111111111111110110" */
+    {
+        {  7, S    ,  15}, {  8, S    ,  15}, {  9, S    ,  15}, { 10, S    ,  15},
+        { 11, S    ,  15}, { 12, S    ,  15}, { 13, S    ,  15}, { 14, S|A  ,  15},
+        {  7, S    ,  16}, {  8, S    ,  16}, {  9, S    ,  16}, { 10, S    ,  16},
+        { 11, S    ,  16}, { 12, S    ,  16}, { 13, S    ,  16}, { 14, S|A  ,  16},
+    },
+    /* state 244: "111111111111111111111110111" */
+    {
+        {  7, S    ,  17}, {  8, S    ,  17}, {  9, S    ,  17}, { 10, S    ,  17},
+        { 11, S    ,  17}, { 12, S    ,  17}, { 13, S    ,  17}, { 14, S|A  ,  17},
+        {  7, S    ,  18}, {  8, S    ,  18}, {  9, S    ,  18}, { 10, S    ,  18},
+        { 11, S    ,  18}, { 12, S    ,  18}, { 13, S    ,  18}, { 14, S|A  ,  18},
+    },
+    /* state 245: "111111111111111111111111000" */
+    {
+        {  7, S    ,  19}, {  8, S    ,  19}, {  9, S    ,  19}, { 10, S    ,  19},
+        { 11, S    ,  19}, { 12, S    ,  19}, { 13, S    ,  19}, { 14, S|A  ,  19},
+        {  7, S    ,  20}, {  8, S    ,  20}, {  9, S    ,  20}, { 10, S    ,  20},
+        { 11, S    ,  20}, { 12, S    ,  20}, { 13, S    ,  20}, { 14, S|A  ,  20},
+    },
+    /* state 246: "111111111111111111111111001" */
+    {
+        {  7, S    ,  21}, {  8, S    ,  21}, {  9, S    ,  21}, { 10, S    ,  21},
+        { 11, S    ,  21}, { 12, S    ,  21}, { 13, S    ,  21}, { 14, S|A  ,  21},
+        {  7, S    ,  23}, {  8, S    ,  23}, {  9, S    ,  23}, { 10, S    ,  23},
+        { 11, S    ,  23}, { 12, S    ,  23}, { 13, S    ,  23}, { 14, S|A  ,  23},
+    },
+    /* state 247: "111111111111111111111111010" */
+    {
+        {  7, S    ,  24}, {  8, S    ,  24}, {  9, S    ,  24}, { 10, S    ,  24},
+        { 11, S    ,  24}, { 12, S    ,  24}, { 13, S    ,  24}, { 14, S|A  ,  24},
+        {  7, S    ,  25}, {  8, S    ,  25}, {  9, S    ,  25}, { 10, S    ,  25},
+        { 11, S    ,  25}, { 12, S    ,  25}, { 13, S    ,  25}, { 14, S|A  ,  25},
+    },
+    /* state 248: "111111111111111111111111011" */
+    {
+        {  7, S    ,  26}, {  8, S    ,  26}, {  9, S    ,  26}, { 10, S    ,  26},
+        { 11, S    ,  26}, { 12, S    ,  26}, { 13, S    ,  26}, { 14, S|A  ,  26},
+        {  7, S    ,  27}, {  8, S    ,  27}, {  9, S    ,  27}, { 10, S    ,  27},
+        { 11, S    ,  27}, { 12, S    ,  27}, { 13, S    ,  27}, { 14, S|A  ,  27},
+    },
+    /* state 249: "111111111111111111111111100" */
+    {
+        {  7, S    ,  28}, {  8, S    ,  28}, {  9, S    ,  28}, { 10, S    ,  28},
+        { 11, S    ,  28}, { 12, S    ,  28}, { 13, S    ,  28}, { 14, S|A  ,  28},
+        {  7, S    ,  29}, {  8, S    ,  29}, {  9, S    ,  29}, { 10, S    ,  29},
+        { 11, S    ,  29}, { 12, S    ,  29}, { 13, S    ,  29}, { 14, S|A  ,  29},
+    },
+    /* state 250: "111111111111111111111111101" */
+    {
+        {  7, S    ,  30}, {  8, S    ,  30}, {  9, S    ,  30}, { 10, S    ,  30},
+        { 11, S    ,  30}, { 12, S    ,  30}, { 13, S    ,  30}, { 14, S|A  ,  30},
+        {  7, S    ,  31}, {  8, S    ,  31}, {  9, S    ,  31}, { 10, S    ,  31},
+        { 11, S    ,  31}, { 12, S    ,  31}, { 13, S    ,  31}, { 14, S|A  ,  31},
+    },
+    /* state 251: "111111111111111111111111110" */
+    {
+        {  7, S    , 127}, {  8, S    , 127}, {  9, S    , 127}, { 10, S    , 127},
+        { 11, S    , 127}, { 12, S    , 127}, { 13, S    , 127}, { 14, S|A  , 127},
+        {  7, S    , 220}, {  8, S    , 220}, {  9, S    , 220}, { 10, S    , 220},
+        { 11, S    , 220}, { 12, S    , 220}, { 13, S    , 220}, { 14, S|A  , 220},
+    },
+    /* state 252: "111111111111111111111111111" */
+    {
+        {  7, S    , 249}, {  8, S    , 249}, {  9, S    , 249}, { 10, S    , 249},
+        { 11, S    , 249}, { 12, S    , 249}, { 13, S    , 249}, { 14, S|A  , 249},
+        {  1, S    ,  10}, {  2, S|A  ,  10}, {  1, S    ,  13}, {  2, S|A  ,  13},
+        {  1, S    ,  22}, {  2, S|A  ,  22}, {  0, F    ,   0}, {  0, F    ,   0},
+    },
+    /* state 253: "1111111111111111111111111111" */
+    {
+        {  3, S    ,  10}, {  4, S    ,  10}, {  5, S    ,  10}, {  6, S|A  ,  10},
+        {  3, S    ,  13}, {  4, S    ,  13}, {  5, S    ,  13}, {  6, S|A  ,  13},
+        {  3, S    ,  22}, {  4, S    ,  22}, {  5, S    ,  22}, {  6, S|A  ,  22},
+        {  0, F    ,   0}, {  0, F    ,   0}, {  0, F    ,   0}, {  0, F    ,   0},
+    },
+    /* state 254: "11111111111111111111111111110" */
+    {
+        {  7, S    ,  10}, {  8, S    ,  10}, {  9, S    ,  10}, { 10, S    ,  10},
+        { 11, S    ,  10}, { 12, S    ,  10}, { 13, S    ,  10}, { 14, S|A  ,  10},
+        {  7, S    ,  13}, {  8, S    ,  13}, {  9, S    ,  13}, { 10, S    ,  13},
+        { 11, S    ,  13}, { 12, S    ,  13}, { 13, S    ,  13}, { 14, S|A  ,  13},
+    },
+    /* state 255: "11111111111111111111111111111" */
+    {
+        {  7, S    ,  22}, {  8, S    ,  22}, {  9, S    ,  22}, { 10, S    ,  22},
+        { 11, S    ,  22}, { 12, S    ,  22}, { 13, S    ,  22}, { 14, S|A  ,  22},
+        {  0, F    ,   0}, {  0, F    ,   0}, {  0, F    ,   0}, {  0, F    ,   0},
+        {  0, F    ,   0}, {  0, F    ,   0}, {  0, F    ,   0}, {  0, F    ,   0},
+    },
+};
+
+#undef S
+#undef A
+#undef F
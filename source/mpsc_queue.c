@@ -0,0 +1,82 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/http/private/mpsc_queue.h>
+
+/* Address of this node marks a sealed queue. It is never linked into anything. */
+static struct aws_linked_list_node s_sealed_sentinel;
+
+void aws_mpsc_queue_init(struct aws_mpsc_queue *queue) {
+    AWS_PRECONDITION(queue);
+    aws_atomic_init_ptr(&queue->head, NULL);
+}
+
+int aws_mpsc_queue_push(struct aws_mpsc_queue *queue, struct aws_linked_list_node *node, bool *out_was_empty) {
+    AWS_PRECONDITION(queue);
+    AWS_PRECONDITION(node);
+
+    /* Classic lock-free stack push. There's no ABA hazard because the consumer never pops single nodes,
+     * it only ever swaps out the whole chain. */
+    void *head = aws_atomic_load_ptr(&queue->head);
+    do {
+        if (head == &s_sealed_sentinel) {
+            return aws_raise_error(AWS_ERROR_INVALID_STATE);
+        }
+        node->next = head;
+        node->prev = NULL;
+    } while (!aws_atomic_compare_exchange_ptr(&queue->head, &head, node));
+
+    if (out_was_empty) {
+        *out_was_empty = (head == NULL);
+    }
+    return AWS_OP_SUCCESS;
+}
+
+/* The chain runs newest to oldest, so reverse it before appending, to preserve push order */
+static void s_append_chain(struct aws_linked_list_node *newest, struct aws_linked_list *out_list) {
+    struct aws_linked_list_node *oldest = NULL;
+    while (newest) {
+        struct aws_linked_list_node *next = newest->next;
+        newest->next = oldest;
+        oldest = newest;
+        newest = next;
+    }
+
+    while (oldest) {
+        struct aws_linked_list_node *next = oldest->next;
+        aws_linked_list_push_back(out_list, oldest);
+        oldest = next;
+    }
+}
+
+void aws_mpsc_queue_pop_all(struct aws_mpsc_queue *queue, struct aws_linked_list *out_list) {
+    AWS_PRECONDITION(queue);
+    AWS_PRECONDITION(out_list);
+
+    void *head = aws_atomic_load_ptr(&queue->head);
+    do {
+        if (head == NULL || head == &s_sealed_sentinel) {
+            return;
+        }
+    } while (!aws_atomic_compare_exchange_ptr(&queue->head, &head, NULL));
+
+    s_append_chain(head, out_list);
+}
+
+void aws_mpsc_queue_seal(struct aws_mpsc_queue *queue, struct aws_linked_list *out_list) {
+    AWS_PRECONDITION(queue);
+    AWS_PRECONDITION(out_list);
+
+    void *head = aws_atomic_exchange_ptr(&queue->head, &s_sealed_sentinel);
+    if (head != &s_sealed_sentinel) {
+        s_append_chain(head, out_list);
+    }
+}
+
+bool aws_mpsc_queue_is_empty(const struct aws_mpsc_queue *queue) {
+    AWS_PRECONDITION(queue);
+
+    void *head = aws_atomic_load_ptr(&queue->head);
+    return head == NULL || head == &s_sealed_sentinel;
+}
@@ -21,6 +21,10 @@
 enum {
     /* Initial capacity for the aws_http_message.headers array_list. */
     AWS_HTTP_REQUEST_NUM_RESERVED_HEADERS = 16,
+
+    /* Default block size for aws_http_headers_new_arena().
+     * Roomy enough to hold all the strings of a typical signed request in one block. */
+    AWS_HTTP_HEADERS_DEFAULT_ARENA_BLOCK_SIZE = 2048,
 };
 
 bool aws_http_header_name_eq(struct aws_byte_cursor name_a, struct aws_byte_cursor name_b) {
@@ -34,16 +38,165 @@ bool aws_http_header_name_eq(struct aws_byte_cursor name_a, struct aws_byte_curs
  * The API has been designed so we can swap out the implementation later if desired.
  *
  * -- String Storage Notes --
- * We use a single allocation to hold the name and value of each aws_http_header.
- * We could optimize storage by using something like a string pool. If we do this, be sure to maintain
- * the address of existing strings when adding new strings (a dynamic aws_byte_buf would not suffice).
+ * By default, we use a single allocation to hold the name and value of each aws_http_header.
+ *
+ * Headers created with aws_http_headers_new_arena() instead bump-allocate the strings out of a few large blocks.
+ * Adding a header never moves existing strings, since a full block is never resized, a new one is started.
+ * Erasing a header just marks its bytes dead (tombstones them), and a block is freed once nothing in it is live.
+ * If dead bytes come to dominate, a compaction pass copies the live strings into one fresh block.
  */
 struct aws_http_headers {
     struct aws_allocator *alloc;
     struct aws_array_list array_list; /* Contains aws_http_header */
     struct aws_atomic_var refcount;
+
+    /* Only used by headers created via aws_http_headers_new_arena() */
+    struct {
+        bool enabled;
+        size_t block_size;
+
+        /* List of aws_http_headers_block. Strings are allocated from the back block. */
+        struct aws_linked_list blocks;
+    } arena;
+};
+
+struct aws_http_headers_block {
+    struct aws_linked_list_node node;
+    uint8_t *data; /* Points just past the end of this struct, in the same allocation */
+    size_t capacity;
+    size_t used;
+
+    /* Bytes of strings in this block that still belong to a header.
+     * The other (used - live_bytes) bytes belong to erased headers. */
+    size_t live_bytes;
 };
 
+static struct aws_http_headers_block *s_headers_block_new(struct aws_allocator *alloc, size_t capacity) {
+    size_t alloc_size;
+    if (aws_add_size_checked(sizeof(struct aws_http_headers_block), capacity, &alloc_size)) {
+        return NULL;
+    }
+
+    struct aws_http_headers_block *block = aws_mem_acquire(alloc, alloc_size);
+    if (!block) {
+        return NULL;
+    }
+
+    AWS_ZERO_STRUCT(*block);
+    block->data = (uint8_t *)(block + 1);
+    block->capacity = capacity;
+    return block;
+}
+
+/* Get memory to store a header's strings */
+static uint8_t *s_headers_acquire_strmem(struct aws_http_headers *headers, size_t len) {
+    if (!headers->arena.enabled) {
+        return aws_mem_acquire(headers->alloc, len);
+    }
+
+    struct aws_http_headers_block *block = NULL;
+    if (!aws_linked_list_empty(&headers->arena.blocks)) {
+        block = AWS_CONTAINER_OF(aws_linked_list_back(&headers->arena.blocks), struct aws_http_headers_block, node);
+    }
+
+    if (!block || (block->capacity - block->used) < len) {
+        block = s_headers_block_new(headers->alloc, aws_max_size(headers->arena.block_size, len));
+        if (!block) {
+            return NULL;
+        }
+        aws_linked_list_push_back(&headers->arena.blocks, &block->node);
+    }
+
+    uint8_t *strmem = block->data + block->used;
+    block->used += len;
+    block->live_bytes += len;
+    return strmem;
+}
+
+/* Give back the memory holding a header's strings */
+static void s_headers_release_strmem(struct aws_http_headers *headers, uint8_t *strmem, size_t len) {
+    if (!headers->arena.enabled) {
+        aws_mem_release(headers->alloc, strmem);
+        return;
+    }
+
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&headers->arena.blocks);
+         node != aws_linked_list_end(&headers->arena.blocks);
+         node = aws_linked_list_next(node)) {
+
+        struct aws_http_headers_block *block = AWS_CONTAINER_OF(node, struct aws_http_headers_block, node);
+        if (strmem < block->data || strmem >= block->data + block->used) {
+            continue;
+        }
+
+        AWS_ASSERT(block->live_bytes >= len);
+        block->live_bytes -= len;
+        if (block->live_bytes == 0) {
+            if (node == aws_linked_list_back(&headers->arena.blocks)) {
+                /* Keep the block strings are currently allocated from, just start it over */
+                block->used = 0;
+            } else {
+                aws_linked_list_remove(node);
+                aws_mem_release(headers->alloc, block);
+            }
+        }
+        return;
+    }
+
+    AWS_FATAL_ASSERT(0 && "header strings not found in any block");
+}
+
+/* If most of the arena is dead bytes, copy the live strings into one new block and free the rest */
+static void s_headers_maybe_compact(struct aws_http_headers *headers) {
+    if (!headers->arena.enabled) {
+        return;
+    }
+
+    size_t live_bytes = 0;
+    size_t dead_bytes = 0;
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(&headers->arena.blocks);
+         node != aws_linked_list_end(&headers->arena.blocks);
+         node = aws_linked_list_next(node)) {
+
+        struct aws_http_headers_block *block = AWS_CONTAINER_OF(node, struct aws_http_headers_block, node);
+        live_bytes += block->live_bytes;
+        dead_bytes += block->used - block->live_bytes;
+    }
+
+    if (dead_bytes <= live_bytes || dead_bytes < headers->arena.block_size) {
+        return;
+    }
+
+    struct aws_http_headers_block *new_block =
+        s_headers_block_new(headers->alloc, aws_max_size(headers->arena.block_size, live_bytes));
+    if (!new_block) {
+        /* Not a problem, everything is still valid, just not as compact as it could be */
+        return;
+    }
+
+    struct aws_http_header *header = NULL;
+    const size_t count = aws_http_headers_count(headers);
+    for (size_t i = 0; i < count; ++i) {
+        aws_array_list_get_at_ptr(&headers->array_list, (void **)&header, i);
+        AWS_ASSUME(header);
+
+        /* Name and value are contiguous */
+        const size_t len = header->name.len + header->value.len;
+        uint8_t *strmem = new_block->data + new_block->used;
+        memcpy(strmem, header->name.ptr, len);
+        header->name.ptr = strmem;
+        header->value.ptr = strmem + header->name.len;
+        new_block->used += len;
+    }
+    new_block->live_bytes = new_block->used;
+
+    while (!aws_linked_list_empty(&headers->arena.blocks)) {
+        struct aws_linked_list_node *node = aws_linked_list_pop_front(&headers->arena.blocks);
+        aws_mem_release(headers->alloc, AWS_CONTAINER_OF(node, struct aws_http_headers_block, node));
+    }
+    aws_linked_list_push_back(&headers->arena.blocks, &new_block->node);
+}
+
 struct aws_http_headers *aws_http_headers_new(struct aws_allocator *allocator) {
     AWS_PRECONDITION(allocator);
 
@@ -54,6 +207,7 @@ struct aws_http_headers *aws_http_headers_new(struct aws_allocator *allocator) {
 
     headers->alloc = allocator;
     aws_atomic_init_int(&headers->refcount, 1);
+    aws_linked_list_init(&headers->arena.blocks);
 
     if (aws_array_list_init_dynamic(
             &headers->array_list, allocator, AWS_HTTP_REQUEST_NUM_RESERVED_HEADERS, sizeof(struct aws_http_header))) {
@@ -68,6 +222,17 @@ alloc_failed:
     return NULL;
 }
 
+struct aws_http_headers *aws_http_headers_new_arena(struct aws_allocator *allocator, size_t block_size) {
+    struct aws_http_headers *headers = aws_http_headers_new(allocator);
+    if (!headers) {
+        return NULL;
+    }
+
+    headers->arena.enabled = true;
+    headers->arena.block_size = block_size ? block_size : AWS_HTTP_HEADERS_DEFAULT_ARENA_BLOCK_SIZE;
+    return headers;
+}
+
 void aws_http_headers_release(struct aws_http_headers *headers) {
     AWS_PRECONDITION(!headers || headers->alloc);
     if (!headers) {
@@ -77,6 +242,10 @@ void aws_http_headers_release(struct aws_http_headers *headers) {
     size_t prev_refcount = aws_atomic_fetch_sub(&headers->refcount, 1);
     if (prev_refcount == 1) {
         aws_http_headers_clear(headers);
+        while (!aws_linked_list_empty(&headers->arena.blocks)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&headers->arena.blocks);
+            aws_mem_release(headers->alloc, AWS_CONTAINER_OF(node, struct aws_http_headers_block, node));
+        }
         aws_array_list_clean_up(&headers->array_list);
         aws_mem_release(headers->alloc, headers);
     } else {
@@ -106,7 +275,7 @@ int aws_http_headers_add_header(struct aws_http_headers *headers, const struct a
     struct aws_http_header header_copy = *header;
     /* Store our own copy of the strings.
      * We put the name and value into the same allocation. */
-    uint8_t *strmem = aws_mem_acquire(headers->alloc, total_len);
+    uint8_t *strmem = s_headers_acquire_strmem(headers, total_len);
     if (!strmem) {
         return AWS_OP_ERR;
     }
@@ -122,7 +291,7 @@ int aws_http_headers_add_header(struct aws_http_headers *headers, const struct a
     return AWS_OP_SUCCESS;
 
 error:
-    aws_mem_release(headers->alloc, strmem);
+    s_headers_release_strmem(headers, strmem, total_len);
     return AWS_OP_ERR;
 }
 
@@ -134,6 +303,24 @@ int aws_http_headers_add(struct aws_http_headers *headers, struct aws_byte_curso
 void aws_http_headers_clear(struct aws_http_headers *headers) {
     AWS_PRECONDITION(headers);
 
+    if (headers->arena.enabled) {
+        /* Everything is dead, so keep one block to start over with and free the rest */
+        while (!aws_linked_list_empty(&headers->arena.blocks)) {
+            struct aws_linked_list_node *node = aws_linked_list_pop_front(&headers->arena.blocks);
+            struct aws_http_headers_block *block = AWS_CONTAINER_OF(node, struct aws_http_headers_block, node);
+            if (aws_linked_list_empty(&headers->arena.blocks)) {
+                block->used = 0;
+                block->live_bytes = 0;
+                aws_linked_list_push_back(&headers->arena.blocks, node);
+                break;
+            }
+            aws_mem_release(headers->alloc, block);
+        }
+
+        aws_array_list_clear(&headers->array_list);
+        return;
+    }
+
     struct aws_http_header *header = NULL;
     const size_t count = aws_http_headers_count(headers);
     for (size_t i = 0; i < count; ++i) {
@@ -154,7 +341,7 @@ static void s_http_headers_erase_index(struct aws_http_headers *headers, size_t
     AWS_ASSUME(header);
 
     /* Storage for name & value is in the same allocation */
-    aws_mem_release(headers->alloc, header->name.ptr);
+    s_headers_release_strmem(headers, header->name.ptr, header->name.len + header->value.len);
 
     aws_array_list_erase(&headers->array_list, index);
 }
@@ -167,6 +354,7 @@ int aws_http_headers_erase_index(struct aws_http_headers *headers, size_t index)
     }
 
     s_http_headers_erase_index(headers, index);
+    s_headers_maybe_compact(headers);
     return AWS_OP_SUCCESS;
 }
 
@@ -192,6 +380,7 @@ static int s_http_headers_erase(struct aws_http_headers *headers, struct aws_byt
         return aws_raise_error(AWS_ERROR_HTTP_HEADER_NOT_FOUND);
     }
 
+    s_headers_maybe_compact(headers);
     return AWS_OP_SUCCESS;
 }
 
@@ -218,6 +407,7 @@ int aws_http_headers_erase_value(
 
         if (aws_http_header_name_eq(header->name, name) && aws_byte_cursor_eq(&header->value, &value)) {
             s_http_headers_erase_index(headers, i);
+            s_headers_maybe_compact(headers);
             return AWS_OP_SUCCESS;
         }
     }
@@ -705,6 +895,31 @@ struct aws_http_connection *aws_http_stream_get_connection(const struct aws_http
     return stream->owning_connection;
 }
 
+int aws_http_body_slice_acquire(const struct aws_http_body_slice *slice) {
+    AWS_PRECONDITION(slice);
+
+    if (!slice->owner) {
+        return aws_raise_error(AWS_ERROR_UNSUPPORTED_OPERATION);
+    }
+
+    aws_atomic_fetch_add(&slice->owner->refcount, 1);
+    return AWS_OP_SUCCESS;
+}
+
+void aws_http_body_slice_release(struct aws_http_body_slice *slice) {
+    if (!slice || !slice->owner) {
+        return;
+    }
+
+    size_t prev_refcount = aws_atomic_fetch_sub(&slice->owner->refcount, 1);
+    AWS_ASSERT(prev_refcount != 0);
+    if (prev_refcount == 1) {
+        slice->owner->destroy(slice->owner);
+    }
+
+    AWS_ZERO_STRUCT(*slice);
+}
+
 int aws_http_stream_get_incoming_response_status(const struct aws_http_stream *stream, int *out_status) {
     AWS_ASSERT(stream && stream->client_data);
 
@@ -764,6 +979,32 @@ int aws_http2_stream_reset(struct aws_http_stream *http2_stream, uint32_t http2_
     return http2_stream->vtable->http2_reset_stream(http2_stream, http2_error);
 }
 
+int aws_http2_stream_set_priority(
+    struct aws_http_stream *http2_stream,
+    const struct aws_http2_stream_priority *priority) {
+    AWS_PRECONDITION(http2_stream);
+    AWS_PRECONDITION(http2_stream->vtable);
+    AWS_PRECONDITION(priority);
+    if (!http2_stream->vtable->http2_set_priority) {
+        AWS_LOGF_TRACE(
+            AWS_LS_HTTP_STREAM,
+            "id=%p: HTTP/2 stream only function invoked on other stream, ignoring call.",
+            (void *)http2_stream);
+        return aws_raise_error(AWS_ERROR_INVALID_STATE);
+    }
+    if (priority->urgency > AWS_HTTP2_STREAM_PRIORITY_MAX_URGENCY || priority->weight == 0 ||
+        priority->weight > AWS_HTTP2_STREAM_PRIORITY_MAX_WEIGHT) {
+        AWS_LOGF_ERROR(
+            AWS_LS_HTTP_STREAM,
+            "id=%p: Invalid HTTP/2 stream priority, urgency=%u weight=%u",
+            (void *)http2_stream,
+            (unsigned)priority->urgency,
+            (unsigned)priority->weight);
+        return aws_raise_error(AWS_ERROR_INVALID_ARGUMENT);
+    }
+    return http2_stream->vtable->http2_set_priority(http2_stream, priority);
+}
+
 int aws_http2_stream_get_received_reset_error_code(struct aws_http_stream *http2_stream, uint32_t *out_http2_error) {
     AWS_PRECONDITION(http2_stream);
     AWS_PRECONDITION(http2_stream->vtable);
@@ -791,3 +1032,167 @@ int aws_http2_stream_get_sent_reset_error_code(struct aws_http_stream *http2_str
     }
     return http2_stream->vtable->http2_get_sent_error_code(http2_stream, out_http2_error);
 }
+
+/* Body stream reading from a list of memory slices */
+struct memory_slices_stream {
+    struct aws_input_stream base;
+    struct aws_byte_cursor *slices;
+    size_t num_slices;
+    uint64_t total_length;
+
+    /* Current read position */
+    size_t slice_index;
+    size_t slice_offset;
+};
+
+static struct aws_input_stream_vtable s_memory_slices_stream_vtable;
+
+static void s_memory_slices_stream_normalize(struct memory_slices_stream *impl) {
+    /* Step over finished (or empty) slices, so slice_index always refers to a slice with data left to read */
+    while (impl->slice_index < impl->num_slices && impl->slice_offset == impl->slices[impl->slice_index].len) {
+        impl->slice_index++;
+        impl->slice_offset = 0;
+    }
+}
+
+static int s_memory_slices_stream_seek(
+    struct aws_input_stream *stream,
+    aws_off_t offset,
+    enum aws_stream_seek_basis basis) {
+
+    struct memory_slices_stream *impl = stream->impl;
+
+    /* Convert to an offset from the beginning */
+    uint64_t position;
+    if (basis == AWS_SSB_BEGIN) {
+        if (offset < 0 || (uint64_t)offset > impl->total_length) {
+            return aws_raise_error(AWS_IO_STREAM_INVALID_SEEK_POSITION);
+        }
+        position = (uint64_t)offset;
+    } else {
+        /* Offset from the end must be zero or negative */
+        const uint64_t from_end = (uint64_t)0 - (uint64_t)offset;
+        if (offset > 0 || from_end > impl->total_length) {
+            return aws_raise_error(AWS_IO_STREAM_INVALID_SEEK_POSITION);
+        }
+        position = impl->total_length - from_end;
+    }
+
+    impl->slice_index = 0;
+    impl->slice_offset = 0;
+    while (impl->slice_index < impl->num_slices && position >= impl->slices[impl->slice_index].len) {
+        position -= impl->slices[impl->slice_index].len;
+        impl->slice_index++;
+    }
+    impl->slice_offset = (size_t)position;
+    s_memory_slices_stream_normalize(impl);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_memory_slices_stream_read(struct aws_input_stream *stream, struct aws_byte_buf *dest) {
+    struct memory_slices_stream *impl = stream->impl;
+
+    while (impl->slice_index < impl->num_slices && dest->len < dest->capacity) {
+        struct aws_byte_cursor remaining = impl->slices[impl->slice_index];
+        aws_byte_cursor_advance(&remaining, impl->slice_offset);
+
+        struct aws_byte_cursor written = aws_byte_buf_write_to_capacity(dest, &remaining);
+        impl->slice_offset += written.len;
+        s_memory_slices_stream_normalize(impl);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_memory_slices_stream_get_status(struct aws_input_stream *stream, struct aws_stream_status *status) {
+    struct memory_slices_stream *impl = stream->impl;
+    status->is_end_of_stream = impl->slice_index == impl->num_slices;
+    status->is_valid = true;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_memory_slices_stream_get_length(struct aws_input_stream *stream, int64_t *out_length) {
+    struct memory_slices_stream *impl = stream->impl;
+    *out_length = (int64_t)impl->total_length;
+    return AWS_OP_SUCCESS;
+}
+
+static void s_memory_slices_stream_destroy(struct aws_input_stream *stream) {
+    /* Slices array was allocated along with the stream */
+    aws_mem_release(stream->allocator, stream);
+}
+
+static struct aws_input_stream_vtable s_memory_slices_stream_vtable = {
+    .seek = s_memory_slices_stream_seek,
+    .read = s_memory_slices_stream_read,
+    .get_status = s_memory_slices_stream_get_status,
+    .get_length = s_memory_slices_stream_get_length,
+    .destroy = s_memory_slices_stream_destroy,
+};
+
+struct aws_input_stream *aws_http_body_stream_new_from_memory_slices(
+    struct aws_allocator *allocator,
+    const struct aws_byte_cursor *slices,
+    size_t num_slices) {
+
+    AWS_PRECONDITION(allocator);
+    AWS_PRECONDITION(slices || num_slices == 0);
+
+    uint64_t total_length = 0;
+    for (size_t i = 0; i < num_slices; ++i) {
+        if (aws_add_u64_checked(total_length, slices[i].len, &total_length) || total_length > INT64_MAX) {
+            aws_raise_error(AWS_ERROR_OVERFLOW_DETECTED);
+            return NULL;
+        }
+    }
+
+    struct memory_slices_stream *impl = NULL;
+    struct aws_byte_cursor *slices_copy = NULL;
+    if (!aws_mem_acquire_many(
+            allocator,
+            2,
+            &impl,
+            sizeof(struct memory_slices_stream),
+            &slices_copy,
+            sizeof(struct aws_byte_cursor) * aws_max_size(num_slices, 1))) {
+        return NULL;
+    }
+
+    AWS_ZERO_STRUCT(*impl);
+    impl->base.allocator = allocator;
+    impl->base.impl = impl;
+    impl->base.vtable = &s_memory_slices_stream_vtable;
+    if (num_slices) {
+        memcpy(slices_copy, slices, sizeof(struct aws_byte_cursor) * num_slices);
+    }
+    impl->slices = slices_copy;
+    impl->num_slices = num_slices;
+    impl->total_length = total_length;
+    s_memory_slices_stream_normalize(impl);
+
+    return &impl->base;
+}
+
+bool aws_http_body_stream_peek_memory_slice(struct aws_input_stream *body_stream, struct aws_byte_cursor *out_data) {
+    if (!body_stream || body_stream->vtable != &s_memory_slices_stream_vtable) {
+        return false;
+    }
+
+    struct memory_slices_stream *impl = body_stream->impl;
+    AWS_ZERO_STRUCT(*out_data);
+    if (impl->slice_index < impl->num_slices) {
+        *out_data = impl->slices[impl->slice_index];
+        aws_byte_cursor_advance(out_data, impl->slice_offset);
+    }
+    return true;
+}
+
+void aws_http_body_stream_skip_memory_slice(struct aws_input_stream *body_stream, size_t len) {
+    AWS_PRECONDITION(body_stream->vtable == &s_memory_slices_stream_vtable);
+
+    struct memory_slices_stream *impl = body_stream->impl;
+    AWS_FATAL_ASSERT(len == 0 || impl->slice_index < impl->num_slices);
+    AWS_FATAL_ASSERT(len == 0 || len <= impl->slices[impl->slice_index].len - impl->slice_offset);
+    impl->slice_offset += len;
+    s_memory_slices_stream_normalize(impl);
+}
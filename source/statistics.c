@@ -21,4 +21,30 @@ void aws_crt_statistics_http1_channel_reset(struct aws_crt_statistics_http1_chan
     stats->pending_incoming_stream_ms = 0;
     stats->current_outgoing_stream_id = 0;
     stats->current_incoming_stream_id = 0;
+    stats->num_outgoing_messages = 0;
+    stats->num_outgoing_streams_done = 0;
+}
+
+int aws_crt_statistics_http2_channel_init(struct aws_crt_statistics_http2_channel *stats) {
+    AWS_ZERO_STRUCT(*stats);
+    stats->category = AWSCRT_STAT_CAT_HTTP2_CHANNEL;
+
+    return AWS_OP_SUCCESS;
+}
+
+void aws_crt_statistics_http2_channel_cleanup(struct aws_crt_statistics_http2_channel *stats) {
+    (void)stats;
+}
+
+void aws_crt_statistics_http2_channel_reset(struct aws_crt_statistics_http2_channel *stats) {
+    stats->pending_outgoing_stream_ms = 0;
+    stats->pending_incoming_stream_ms = 0;
+    stats->connection_window_stalled_ms = 0;
+    stats->stream_window_stalled_ms = 0;
+    stats->num_active_streams = 0;
+    stats->was_inactive = false;
+    AWS_ZERO_ARRAY(stats->frame_bytes_sent);
+    AWS_ZERO_ARRAY(stats->frame_bytes_received);
+    stats->header_bytes_uncompressed = 0;
+    stats->header_bytes_compressed = 0;
 }
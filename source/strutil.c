@@ -132,6 +132,18 @@ static bool s_is_token(struct aws_byte_cursor token, const bool token_table[256]
     return true;
 }
 
+size_t aws_strutil_http_token_span(struct aws_byte_cursor cursor) {
+    size_t i;
+    for (i = 0; i < cursor.len; ++i) {
+        const uint8_t c = cursor.ptr[i];
+        if (s_http_token_table[c] == false) {
+            break;
+        }
+    }
+
+    return i;
+}
+
 bool aws_strutil_is_http_token(struct aws_byte_cursor token) {
     return s_is_token(token, s_http_token_table);
 }
@@ -225,6 +225,50 @@ bool aws_websocket_is_data_frame(uint8_t opcode) {
     return !(opcode & 0x08);
 }
 
+void aws_websocket_apply_masking_key(
+    const uint8_t masking_key[4],
+    uint64_t mask_offset,
+    uint8_t *data,
+    size_t data_len) {
+
+    uint8_t *current_byte = data;
+    uint8_t *end_byte = data + data_len;
+
+    /* Process 1 byte at a time until data is aligned for word-sized access */
+    size_t mask_index = (size_t)(mask_offset % 4);
+    while ((current_byte != end_byte) && ((uintptr_t)current_byte % sizeof(uint64_t) != 0)) {
+        *current_byte++ ^= masking_key[mask_index];
+        mask_index = (mask_index + 1) % 4;
+    }
+
+    /* Process 8 bytes at a time, using the masking-key rotated to line up with the current position.
+     * Building the word via memcpy keeps this correct regardless of endianness. */
+    if ((size_t)(end_byte - current_byte) >= sizeof(uint64_t)) {
+        uint8_t word_mask_bytes[sizeof(uint64_t)];
+        for (size_t i = 0; i < sizeof(word_mask_bytes); ++i) {
+            word_mask_bytes[i] = masking_key[(mask_index + i) % 4];
+        }
+
+        uint64_t word_mask;
+        memcpy(&word_mask, word_mask_bytes, sizeof(word_mask));
+
+        do {
+            uint64_t word;
+            memcpy(&word, current_byte, sizeof(word));
+            word ^= word_mask;
+            memcpy(current_byte, &word, sizeof(word));
+            current_byte += sizeof(word);
+        } while ((size_t)(end_byte - current_byte) >= sizeof(uint64_t));
+        /* 8 is a multiple of 4, so mask_index is unchanged */
+    }
+
+    /* Process any remaining bytes */
+    while (current_byte != end_byte) {
+        *current_byte++ ^= masking_key[mask_index];
+        mask_index = (mask_index + 1) % 4;
+    }
+}
+
 static void s_lock_synced_data(struct aws_websocket *websocket) {
     int err = aws_mutex_lock(&websocket->synced_data.lock);
     AWS_ASSERT(!err);
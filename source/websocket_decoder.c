@@ -247,14 +247,8 @@ static int s_state_payload(struct aws_websocket_decoder *decoder, struct aws_byt
      * RFC-6455 Section 5.3 Client-to-Server Masking
      * Each byte of payload is XOR against a byte of the masking-key */
     if (decoder->current_frame.masked) {
-        uint64_t mask_index = decoder->state_bytes_processed;
-
-        /* Optimization idea: don't do this 1 byte at a time */
-        uint8_t *current_byte = payload.ptr;
-        uint8_t *end_byte = payload.ptr + payload.len;
-        while (current_byte != end_byte) {
-            *current_byte++ ^= decoder->current_frame.masking_key[mask_index++ % 4];
-        }
+        aws_websocket_apply_masking_key(
+            decoder->current_frame.masking_key, decoder->state_bytes_processed, payload.ptr, payload.len);
     }
 
     /* TODO: validate utf-8 */
@@ -18,6 +18,7 @@
 #include <aws/io/socket.h>
 #include <aws/io/tls_channel_handler.h>
 #include <aws/testing/aws_test_harness.h>
+#include <aws/testing/io_testing_channel.h>
 
 #if _MSC_VER
 #    pragma warning(disable : 4204) /* non-constant aggregate initializer */
@@ -588,3 +589,308 @@ static int s_test_connection_server_shutting_down_new_connection_setup_fail(
 AWS_TEST_CASE(
     connection_server_shutting_down_new_connection_setup_fail,
     s_test_connection_server_shutting_down_new_connection_setup_fail);
+
+/*
+ * Connect racing tests.
+ * Host resolution and socket channels are mocked. The race runs on a testing channel's event loop,
+ * whose clock is mocked, and each attempt that connects gets its own testing channel.
+ */
+
+enum {
+    CONNECT_RACE_MAX_ATTEMPTS = 8,
+    CONNECT_RACE_PORT = 443,
+};
+
+struct connect_race_address {
+    const char *address;
+    enum aws_address_record_type record_type;
+};
+
+struct connect_race_attempt {
+    char address[AWS_ADDRESS_MAX_LEN];
+    enum aws_socket_domain domain;
+    aws_client_bootstrap_on_channel_event_fn *setup_callback;
+    aws_client_bootstrap_on_channel_event_fn *shutdown_callback;
+    void *user_data;
+    struct testing_channel *testing_channel;
+};
+
+static struct connect_race_tester {
+    struct aws_allocator *alloc;
+    uint64_t mock_time;
+    struct testing_channel loop_channel;
+
+    const struct connect_race_address *addresses;
+    size_t address_count;
+
+    struct connect_race_attempt attempts[CONNECT_RACE_MAX_ATTEMPTS];
+    size_t attempt_count;
+
+    int setup_count;
+    int setup_error_code;
+    struct aws_http_connection *connection;
+    int shutdown_count;
+} s_race_tester;
+
+static int s_connect_race_mock_clock(uint64_t *timestamp) {
+    *timestamp = s_race_tester.mock_time;
+    return AWS_OP_SUCCESS;
+}
+
+static int s_connect_race_mock_resolve_host(
+    struct aws_client_bootstrap *bootstrap,
+    const struct aws_string *host_name,
+    aws_on_host_resolved_result_fn *on_host_resolved,
+    void *user_data) {
+
+    (void)bootstrap;
+
+    struct aws_host_address host_addresses[CONNECT_RACE_MAX_ATTEMPTS];
+    AWS_ZERO_ARRAY(host_addresses);
+    AWS_FATAL_ASSERT(s_race_tester.address_count <= CONNECT_RACE_MAX_ATTEMPTS);
+
+    for (size_t i = 0; i < s_race_tester.address_count; ++i) {
+        host_addresses[i].allocator = s_race_tester.alloc;
+        host_addresses[i].host = host_name;
+        host_addresses[i].address = aws_string_new_from_c_str(s_race_tester.alloc, s_race_tester.addresses[i].address);
+        host_addresses[i].record_type = s_race_tester.addresses[i].record_type;
+    }
+
+    struct aws_array_list host_address_list;
+    aws_array_list_init_static(
+        &host_address_list, host_addresses, s_race_tester.address_count, sizeof(struct aws_host_address));
+    host_address_list.length = s_race_tester.address_count;
+
+    on_host_resolved(NULL, host_name, AWS_ERROR_SUCCESS, &host_address_list, user_data);
+
+    for (size_t i = 0; i < s_race_tester.address_count; ++i) {
+        aws_string_destroy((struct aws_string *)host_addresses[i].address);
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_connect_race_mock_new_socket_channel(struct aws_socket_channel_bootstrap_options *channel_options) {
+    AWS_FATAL_ASSERT(s_race_tester.attempt_count < CONNECT_RACE_MAX_ATTEMPTS);
+    AWS_FATAL_ASSERT(channel_options->requested_event_loop == s_race_tester.loop_channel.loop);
+    AWS_FATAL_ASSERT(channel_options->port == CONNECT_RACE_PORT);
+
+    struct connect_race_attempt *attempt = &s_race_tester.attempts[s_race_tester.attempt_count++];
+    snprintf(attempt->address, sizeof(attempt->address), "%s", channel_options->host_name);
+    attempt->domain = channel_options->socket_options->domain;
+    attempt->setup_callback = channel_options->setup_callback;
+    attempt->shutdown_callback = channel_options->shutdown_callback;
+    attempt->user_data = channel_options->user_data;
+    return AWS_OP_SUCCESS;
+}
+
+static struct aws_http_connection_system_vtable s_connect_race_system_vtable = {
+    .new_socket_channel = s_connect_race_mock_new_socket_channel,
+    .resolve_host = s_connect_race_mock_resolve_host,
+};
+
+static void s_connect_race_on_setup(struct aws_http_connection *connection, int error_code, void *user_data) {
+    (void)user_data;
+    ++s_race_tester.setup_count;
+    s_race_tester.setup_error_code = error_code;
+    s_race_tester.connection = connection;
+}
+
+static void s_connect_race_on_shutdown(struct aws_http_connection *connection, int error_code, void *user_data) {
+    (void)connection;
+    (void)error_code;
+    (void)user_data;
+    ++s_race_tester.shutdown_count;
+}
+
+/* What the bootstrap would do once an attempt's channel finishes shutting down */
+static void s_connect_race_on_testing_channel_shutdown(int error_code, void *user_data) {
+    struct connect_race_attempt *attempt = user_data;
+    attempt->shutdown_callback(NULL, error_code, attempt->testing_channel->channel, attempt->user_data);
+}
+
+static int s_connect_race_tester_init(
+    struct aws_allocator *alloc,
+    const struct connect_race_address *addresses,
+    size_t address_count) {
+
+    aws_http_library_init(alloc);
+
+    AWS_ZERO_STRUCT(s_race_tester);
+    s_race_tester.alloc = alloc;
+    s_race_tester.addresses = addresses;
+    s_race_tester.address_count = address_count;
+
+    struct aws_testing_channel_options testing_channel_options = {.clock_fn = s_connect_race_mock_clock};
+    ASSERT_SUCCESS(testing_channel_init(&s_race_tester.loop_channel, alloc, &testing_channel_options));
+
+    aws_http_connection_set_system_vtable(&s_connect_race_system_vtable);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_connect_race_tester_clean_up(void) {
+    for (size_t i = 0; i < s_race_tester.attempt_count; ++i) {
+        struct testing_channel *testing_channel = s_race_tester.attempts[i].testing_channel;
+        if (testing_channel) {
+            ASSERT_SUCCESS(testing_channel_clean_up(testing_channel));
+            aws_mem_release(s_race_tester.alloc, testing_channel);
+        }
+    }
+
+    ASSERT_SUCCESS(testing_channel_clean_up(&s_race_tester.loop_channel));
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+static int s_connect_race_connect(uint32_t attempt_delay_ms, size_t max_attempts) {
+    struct aws_socket_options socket_options = {
+        .type = AWS_SOCKET_STREAM,
+        .domain = AWS_SOCKET_IPV4,
+        .connect_timeout_ms = 1000,
+    };
+
+    struct aws_http_connect_racing_options racing_options = {
+        .attempt_delay_ms = attempt_delay_ms,
+        .max_attempts = max_attempts,
+    };
+
+    struct aws_http_client_connection_options client_options = AWS_HTTP_CLIENT_CONNECTION_OPTIONS_INIT;
+    client_options.allocator = s_race_tester.alloc;
+    client_options.host_name = aws_byte_cursor_from_c_str("example.com");
+    client_options.port = CONNECT_RACE_PORT;
+    client_options.socket_options = &socket_options;
+    client_options.on_setup = s_connect_race_on_setup;
+    client_options.on_shutdown = s_connect_race_on_shutdown;
+    client_options.requested_event_loop = s_race_tester.loop_channel.loop;
+    client_options.racing_options = &racing_options;
+
+    ASSERT_SUCCESS(aws_http_client_connect(&client_options));
+
+    /* Host resolution completes on the event loop */
+    testing_channel_run_currently_queued_tasks(&s_race_tester.loop_channel);
+    return AWS_OP_SUCCESS;
+}
+
+static void s_connect_race_advance_time(uint64_t millis) {
+    s_race_tester.mock_time += aws_timestamp_convert(millis, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+    testing_channel_run_currently_queued_tasks(&s_race_tester.loop_channel);
+}
+
+static void s_connect_race_fail_attempt(size_t index, int error_code) {
+    struct connect_race_attempt *attempt = &s_race_tester.attempts[index];
+    attempt->setup_callback(NULL, error_code, NULL, attempt->user_data);
+}
+
+static int s_connect_race_connect_attempt(size_t index) {
+    struct connect_race_attempt *attempt = &s_race_tester.attempts[index];
+
+    attempt->testing_channel = aws_mem_calloc(s_race_tester.alloc, 1, sizeof(struct testing_channel));
+    ASSERT_NOT_NULL(attempt->testing_channel);
+
+    struct aws_testing_channel_options testing_channel_options = {.clock_fn = s_connect_race_mock_clock};
+    ASSERT_SUCCESS(testing_channel_init(attempt->testing_channel, s_race_tester.alloc, &testing_channel_options));
+    attempt->testing_channel->channel_shutdown = s_connect_race_on_testing_channel_shutdown;
+    attempt->testing_channel->channel_shutdown_user_data = attempt;
+
+    attempt->setup_callback(NULL, AWS_ERROR_SUCCESS, attempt->testing_channel->channel, attempt->user_data);
+    testing_channel_drain_queued_tasks(attempt->testing_channel);
+    return AWS_OP_SUCCESS;
+}
+
+/* Attempts alternate address families and start one delay apart, a failure starts the next one early,
+ * and whichever connects first wins */
+static int s_test_connection_connect_race(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    static const struct connect_race_address s_addresses[] = {
+        {"2001:db8::1", AWS_ADDRESS_RECORD_TYPE_AAAA},
+        {"2001:db8::2", AWS_ADDRESS_RECORD_TYPE_AAAA},
+        {"192.0.2.1", AWS_ADDRESS_RECORD_TYPE_A},
+    };
+
+    ASSERT_SUCCESS(s_connect_race_tester_init(allocator, s_addresses, AWS_ARRAY_SIZE(s_addresses)));
+    ASSERT_SUCCESS(s_connect_race_connect(250 /*attempt_delay_ms*/, 0 /*max_attempts*/));
+
+    ASSERT_UINT_EQUALS(1, s_race_tester.attempt_count);
+    ASSERT_STR_EQUALS("2001:db8::1", s_race_tester.attempts[0].address);
+    ASSERT_INT_EQUALS(AWS_SOCKET_IPV6, s_race_tester.attempts[0].domain);
+
+    /* The next attempt waits out the delay */
+    s_connect_race_advance_time(249);
+    ASSERT_UINT_EQUALS(1, s_race_tester.attempt_count);
+
+    s_connect_race_advance_time(1);
+    ASSERT_UINT_EQUALS(2, s_race_tester.attempt_count);
+    ASSERT_STR_EQUALS("192.0.2.1", s_race_tester.attempts[1].address);
+    ASSERT_INT_EQUALS(AWS_SOCKET_IPV4, s_race_tester.attempts[1].domain);
+
+    /* A failed attempt starts the next one right away */
+    s_connect_race_fail_attempt(0, AWS_IO_SOCKET_CONNECTION_REFUSED);
+    ASSERT_UINT_EQUALS(3, s_race_tester.attempt_count);
+    ASSERT_STR_EQUALS("2001:db8::2", s_race_tester.attempts[2].address);
+    ASSERT_INT_EQUALS(0, s_race_tester.setup_count);
+
+    /* First to connect wins */
+    ASSERT_SUCCESS(s_connect_race_connect_attempt(1));
+    ASSERT_INT_EQUALS(1, s_race_tester.setup_count);
+    ASSERT_INT_EQUALS(AWS_ERROR_SUCCESS, s_race_tester.setup_error_code);
+    ASSERT_NOT_NULL(s_race_tester.connection);
+
+    const struct aws_socket_endpoint *remote_endpoint =
+        aws_http_connection_get_remote_endpoint(s_race_tester.connection);
+    ASSERT_NOT_NULL(remote_endpoint);
+    ASSERT_STR_EQUALS("192.0.2.1", remote_endpoint->address);
+    ASSERT_UINT_EQUALS(CONNECT_RACE_PORT, remote_endpoint->port);
+
+    /* The loser connects later, and is closed without the user hearing about it */
+    ASSERT_SUCCESS(s_connect_race_connect_attempt(2));
+    ASSERT_TRUE(testing_channel_is_shutdown_completed(s_race_tester.attempts[2].testing_channel));
+    ASSERT_INT_EQUALS(1, s_race_tester.setup_count);
+    ASSERT_INT_EQUALS(0, s_race_tester.shutdown_count);
+
+    /* No more attempts once there's a winner */
+    s_connect_race_advance_time(1000);
+    ASSERT_UINT_EQUALS(3, s_race_tester.attempt_count);
+
+    aws_http_connection_release(s_race_tester.connection);
+    testing_channel_drain_queued_tasks(s_race_tester.attempts[1].testing_channel);
+    ASSERT_INT_EQUALS(1, s_race_tester.shutdown_count);
+
+    ASSERT_SUCCESS(s_connect_race_tester_clean_up());
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(connection_connect_race, s_test_connection_connect_race);
+
+/* If every attempt fails, the user gets the last attempt's error */
+static int s_test_connection_connect_race_all_attempts_fail(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    static const struct connect_race_address s_addresses[] = {
+        {"192.0.2.1", AWS_ADDRESS_RECORD_TYPE_A},
+        {"192.0.2.2", AWS_ADDRESS_RECORD_TYPE_A},
+        {"192.0.2.3", AWS_ADDRESS_RECORD_TYPE_A},
+    };
+
+    ASSERT_SUCCESS(s_connect_race_tester_init(allocator, s_addresses, AWS_ARRAY_SIZE(s_addresses)));
+    ASSERT_SUCCESS(s_connect_race_connect(250 /*attempt_delay_ms*/, 2 /*max_attempts*/));
+
+    s_connect_race_advance_time(250);
+    ASSERT_UINT_EQUALS(2, s_race_tester.attempt_count);
+
+    s_connect_race_fail_attempt(1, AWS_IO_SOCKET_TIMEOUT);
+    ASSERT_INT_EQUALS(0, s_race_tester.setup_count);
+
+    /* max_attempts is respected */
+    s_connect_race_fail_attempt(0, AWS_IO_SOCKET_CONNECTION_REFUSED);
+    ASSERT_UINT_EQUALS(2, s_race_tester.attempt_count);
+    ASSERT_INT_EQUALS(1, s_race_tester.setup_count);
+    ASSERT_INT_EQUALS(AWS_IO_SOCKET_CONNECTION_REFUSED, s_race_tester.setup_error_code);
+    ASSERT_NULL(s_race_tester.connection);
+
+    s_connect_race_advance_time(1000);
+    ASSERT_UINT_EQUALS(2, s_race_tester.attempt_count);
+
+    ASSERT_SUCCESS(s_connect_race_tester_clean_up());
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(connection_connect_race_all_attempts_fail, s_test_connection_connect_race_all_attempts_fail);
@@ -6,6 +6,7 @@
 #include <aws/testing/aws_test_harness.h>
 
 #include <aws/common/array_list.h>
+#include <aws/common/atomics.h>
 #include <aws/common/clock.h>
 #include <aws/common/condition_variable.h>
 #include <aws/common/logging.h>
@@ -21,11 +22,15 @@
 #include <aws/io/socket.h>
 #include <aws/io/tls_channel_handler.h>
 
+#include <inttypes.h>
+
 enum new_connection_result_type { AWS_NCRT_SUCCESS, AWS_NCRT_ERROR_VIA_CALLBACK, AWS_NCRT_ERROR_FROM_CREATE };
 
 struct mock_connection {
     enum new_connection_result_type result;
     bool is_closed_on_release;
+    bool is_http2;
+    struct aws_event_loop *event_loop;
 };
 
 struct cm_tester_options {
@@ -35,6 +40,15 @@ struct cm_tester_options {
     size_t max_connections;
     uint64_t max_connection_idle_in_ms;
     uint64_t starting_mock_time;
+    bool enable_http2_multiplexing;
+    size_t max_streams_per_connection;
+    size_t max_pipelined_requests_per_connection;
+    size_t num_event_loops;
+    size_t min_idle_connections;
+    enum aws_http_connection_manager_idle_connection_policy idle_connection_policy;
+
+    /* Mock connections available before the manager is created, for it to prewarm with */
+    size_t initial_mock_connections;
 };
 
 struct cm_tester {
@@ -66,6 +80,7 @@ struct cm_tester {
     struct aws_atomic_var next_connection_id;
     struct aws_array_list mock_connections;
     aws_http_on_client_connection_shutdown_fn *release_connection_fn;
+    aws_http2_on_goaway_received_fn *goaway_received_fn;
 
     struct aws_mutex mock_time_lock;
     uint64_t mock_time;
@@ -106,6 +121,20 @@ static struct aws_event_loop *s_new_event_loop(
     return aws_event_loop_new_default(alloc, clock);
 }
 
+static void s_add_mock_connections(size_t count, enum new_connection_result_type result, bool closed_on_release) {
+    struct cm_tester *tester = &s_tester;
+
+    for (size_t i = 0; i < count; ++i) {
+        struct mock_connection *mock = aws_mem_acquire(tester->allocator, sizeof(struct mock_connection));
+        AWS_ZERO_STRUCT(*mock);
+
+        mock->result = result;
+        mock->is_closed_on_release = closed_on_release;
+
+        aws_array_list_push_back(&tester->mock_connections, &mock);
+    }
+}
+
 static int s_cm_tester_init(struct cm_tester_options *options) {
     struct cm_tester *tester = &s_tester;
 
@@ -129,7 +158,9 @@ static int s_cm_tester_init(struct cm_tester_options *options) {
         clock_fn = options->mock_table->get_monotonic_time;
     }
 
-    tester->event_loop_group = aws_event_loop_group_new(tester->allocator, clock_fn, 1, s_new_event_loop, NULL, NULL);
+    uint16_t num_event_loops = options->num_event_loops ? (uint16_t)options->num_event_loops : 1;
+    tester->event_loop_group =
+        aws_event_loop_group_new(tester->allocator, clock_fn, num_event_loops, s_new_event_loop, NULL, NULL);
     tester->host_resolver = aws_host_resolver_new_default(tester->allocator, 8, tester->event_loop_group, NULL);
     struct aws_client_bootstrap_options bootstrap_options = {
         .event_loop_group = tester->event_loop_group,
@@ -165,12 +196,23 @@ static int s_cm_tester_init(struct cm_tester_options *options) {
         .shutdown_complete_user_data = tester,
         .shutdown_complete_callback = s_cm_tester_on_cm_shutdown_complete,
         .max_connection_idle_in_milliseconds = options->max_connection_idle_in_ms,
+        .enable_http2_multiplexing = options->enable_http2_multiplexing,
+        .max_streams_per_connection = options->max_streams_per_connection,
+        .max_pipelined_requests_per_connection = options->max_pipelined_requests_per_connection,
+        .min_idle_connections = options->min_idle_connections,
+        .idle_connection_policy = options->idle_connection_policy,
     };
 
     if (options->mock_table) {
         g_aws_http_connection_manager_default_system_vtable_ptr = options->mock_table;
     }
 
+    aws_atomic_store_int(&tester->next_connection_id, 0);
+
+    ASSERT_SUCCESS(aws_array_list_init_dynamic(
+        &tester->mock_connections, tester->allocator, 10, sizeof(struct mock_connection *)));
+    s_add_mock_connections(options->initial_mock_connections, AWS_NCRT_SUCCESS, false);
+
     tester->connection_manager = aws_http_connection_manager_new(tester->allocator, &cm_options);
     ASSERT_NOT_NULL(tester->connection_manager);
 
@@ -180,28 +222,9 @@ static int s_cm_tester_init(struct cm_tester_options *options) {
 
     tester->mock_table = options->mock_table;
 
-    aws_atomic_store_int(&tester->next_connection_id, 0);
-
-    ASSERT_SUCCESS(aws_array_list_init_dynamic(
-        &tester->mock_connections, tester->allocator, 10, sizeof(struct mock_connection *)));
-
     return AWS_OP_SUCCESS;
 }
 
-static void s_add_mock_connections(size_t count, enum new_connection_result_type result, bool closed_on_release) {
-    struct cm_tester *tester = &s_tester;
-
-    for (size_t i = 0; i < count; ++i) {
-        struct mock_connection *mock = aws_mem_acquire(tester->allocator, sizeof(struct mock_connection));
-        AWS_ZERO_STRUCT(*mock);
-
-        mock->result = result;
-        mock->is_closed_on_release = closed_on_release;
-
-        aws_array_list_push_back(&tester->mock_connections, &mock);
-    }
-}
-
 static int s_release_connections(size_t count, bool close_first) {
 
     struct cm_tester *tester = &s_tester;
@@ -518,6 +541,9 @@ static int s_aws_http_connection_manager_create_connection_sync_mock(
 
     ASSERT_SUCCESS(aws_mutex_lock(&tester->lock));
     tester->release_connection_fn = options->on_shutdown;
+    if (options->http2_options != NULL) {
+        tester->goaway_received_fn = options->http2_options->on_goaway_received;
+    }
     ASSERT_SUCCESS(aws_mutex_unlock(&tester->lock));
 
     /* Verify that any proxy options have been propagated to the connection attempt */
@@ -940,3 +966,621 @@ static int s_test_connection_manager_idle_culling_mixture(struct aws_allocator *
     return AWS_OP_SUCCESS;
 }
 AWS_TEST_CASE(test_connection_manager_idle_culling_mixture, s_test_connection_manager_idle_culling_mixture);
+
+static enum aws_http_version s_aws_http_connection_manager_connection_get_version_sync_mock(
+    const struct aws_http_connection *connection) {
+
+    struct mock_connection *proxy = (struct mock_connection *)(void *)connection;
+
+    return proxy->is_http2 ? AWS_HTTP_VERSION_2 : AWS_HTTP_VERSION_1_1;
+}
+
+static struct aws_http_connection_manager_system_vtable s_http2_mocks = {
+    .create_connection = s_aws_http_connection_manager_create_connection_sync_mock,
+    .release_connection = s_aws_http_connection_manager_release_connection_sync_mock,
+    .close_connection = s_aws_http_connection_manager_close_connection_sync_mock,
+    .is_connection_available = s_aws_http_connection_manager_is_connection_available_sync_mock,
+    .get_monotonic_time = aws_high_res_clock_get_ticks,
+    .connection_get_channel = s_aws_http_connection_manager_connection_get_channel_sync_mock,
+    .is_callers_thread = s_aws_http_connection_manager_is_callers_thread_sync_mock,
+    .connection_get_version = s_aws_http_connection_manager_connection_get_version_sync_mock,
+};
+
+static void s_add_mock_http2_connections(size_t count) {
+    struct cm_tester *tester = &s_tester;
+
+    size_t first_new = aws_array_list_length(&tester->mock_connections);
+    s_add_mock_connections(count, AWS_NCRT_SUCCESS, false);
+
+    for (size_t i = first_new; i < aws_array_list_length(&tester->mock_connections); ++i) {
+        struct mock_connection *mock = NULL;
+        aws_array_list_get_at(&tester->mock_connections, &mock, i);
+        mock->is_http2 = true;
+    }
+}
+
+static struct aws_http_connection *s_get_acquired_connection(size_t index) {
+    struct cm_tester *tester = &s_tester;
+
+    struct aws_http_connection *connection = NULL;
+    aws_mutex_lock(&tester->lock);
+    aws_array_list_get_at(&tester->connections, &connection, index);
+    aws_mutex_unlock(&tester->lock);
+
+    return connection;
+}
+
+static int s_test_connection_manager_http2_multiplexing(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct cm_tester_options options = {
+        .allocator = allocator,
+        .max_connections = 5,
+        .mock_table = &s_http2_mocks,
+        .enable_http2_multiplexing = true,
+        .max_streams_per_connection = 5,
+    };
+
+    ASSERT_SUCCESS(s_cm_tester_init(&options));
+
+    s_add_mock_http2_connections(5);
+
+    /* The first connection is shared by the first 5 acquisitions, the 6th spills onto a second connection */
+    s_acquire_connections(6);
+
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(6));
+
+    ASSERT_UINT_EQUALS(0, s_tester.connection_errors);
+    ASSERT_UINT_EQUALS(2, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    struct aws_http_connection *first_connection = s_get_acquired_connection(0);
+    for (size_t i = 1; i < 5; ++i) {
+        ASSERT_PTR_EQUALS(first_connection, s_get_acquired_connection(i));
+    }
+    ASSERT_TRUE(first_connection != s_get_acquired_connection(5));
+
+    /* Releasing a lease makes room on the shared connection without making a new one */
+    ASSERT_SUCCESS(s_release_connections(1, false));
+    s_acquire_connections(1);
+
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(7));
+    ASSERT_UINT_EQUALS(2, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    ASSERT_SUCCESS(s_cm_tester_clean_up());
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_connection_manager_http2_multiplexing, s_test_connection_manager_http2_multiplexing);
+
+static int s_test_connection_manager_http2_goaway_drains(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct cm_tester_options options = {
+        .allocator = allocator,
+        .max_connections = 5,
+        .mock_table = &s_http2_mocks,
+        .enable_http2_multiplexing = true,
+    };
+
+    ASSERT_SUCCESS(s_cm_tester_init(&options));
+
+    s_add_mock_http2_connections(2);
+
+    s_acquire_connections(1);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(1));
+
+    struct aws_http_connection *first_connection = s_get_acquired_connection(0);
+    ASSERT_NOT_NULL(s_tester.goaway_received_fn);
+    s_tester.goaway_received_fn(first_connection, 0, 0, s_tester.connection_manager);
+
+    /* A connection that received GOAWAY must not be handed out again */
+    s_acquire_connections(1);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(2));
+
+    ASSERT_UINT_EQUALS(0, s_tester.connection_errors);
+    ASSERT_UINT_EQUALS(2, aws_atomic_load_int(&s_tester.next_connection_id));
+    ASSERT_TRUE(first_connection != s_get_acquired_connection(1));
+
+    ASSERT_SUCCESS(s_cm_tester_clean_up());
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_connection_manager_http2_goaway_drains, s_test_connection_manager_http2_goaway_drains);
+
+/* Like the synchronous mock, but the connection lives on the requested event loop */
+static int s_aws_http_connection_manager_create_connection_event_loop_mock(
+    const struct aws_http_client_connection_options *options) {
+    struct cm_tester *tester = &s_tester;
+
+    size_t next_connection_id = aws_atomic_load_int(&tester->next_connection_id);
+    if (next_connection_id < aws_array_list_length(&tester->mock_connections)) {
+        struct mock_connection *mock = NULL;
+        aws_array_list_get_at(&tester->mock_connections, &mock, next_connection_id);
+        mock->event_loop = options->requested_event_loop;
+    }
+
+    return s_aws_http_connection_manager_create_connection_sync_mock(options);
+}
+
+static struct aws_event_loop *s_aws_http_connection_manager_connection_get_event_loop_mock(
+    struct aws_http_connection *connection) {
+
+    struct mock_connection *proxy = (struct mock_connection *)(void *)connection;
+
+    return proxy->event_loop;
+}
+
+static struct aws_http_connection_manager_system_vtable s_event_loop_mocks = {
+    .create_connection = s_aws_http_connection_manager_create_connection_event_loop_mock,
+    .release_connection = s_aws_http_connection_manager_release_connection_sync_mock,
+    .close_connection = s_aws_http_connection_manager_close_connection_sync_mock,
+    .is_connection_available = s_aws_http_connection_manager_is_connection_available_sync_mock,
+    .get_monotonic_time = aws_high_res_clock_get_ticks,
+    .connection_get_channel = s_aws_http_connection_manager_connection_get_channel_sync_mock,
+    .is_callers_thread = s_aws_http_connection_manager_is_callers_thread_sync_mock,
+    .connection_get_event_loop = s_aws_http_connection_manager_connection_get_event_loop_mock,
+};
+
+static void s_acquire_connection_on_event_loop(
+    struct aws_event_loop *event_loop,
+    enum aws_http_connection_manager_event_loop_affinity affinity) {
+
+    struct aws_http_connection_manager_acquire_options acquire_options = {
+        .callback = s_on_acquire_connection,
+        .user_data = &s_tester,
+        .event_loop = event_loop,
+        .event_loop_affinity = affinity,
+    };
+
+    aws_http_connection_manager_acquire_connection_with_options(s_tester.connection_manager, &acquire_options);
+}
+
+static struct aws_event_loop *s_get_acquired_connection_event_loop(size_t index) {
+    struct mock_connection *mock = (struct mock_connection *)(void *)s_get_acquired_connection(index);
+    return mock->event_loop;
+}
+
+static int s_test_connection_manager_event_loop_affinity(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct cm_tester_options options = {
+        .allocator = allocator,
+        .max_connections = 2,
+        .mock_table = &s_event_loop_mocks,
+        .num_event_loops = 2,
+    };
+
+    ASSERT_SUCCESS(s_cm_tester_init(&options));
+
+    struct aws_event_loop *loop_0 = aws_event_loop_group_get_loop_at(s_tester.event_loop_group, 0);
+    struct aws_event_loop *loop_1 = aws_event_loop_group_get_loop_at(s_tester.event_loop_group, 1);
+
+    s_add_mock_connections(3, AWS_NCRT_SUCCESS, false);
+
+    /* New connections are made on the required event loop */
+    s_acquire_connection_on_event_loop(loop_0, AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_REQUIRED);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(1));
+    ASSERT_PTR_EQUALS(loop_0, s_get_acquired_connection_event_loop(0));
+
+    s_acquire_connection_on_event_loop(loop_1, AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_REQUIRED);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(2));
+    ASSERT_PTR_EQUALS(loop_1, s_get_acquired_connection_event_loop(1));
+
+    ASSERT_UINT_EQUALS(2, aws_atomic_load_int(&s_tester.next_connection_id));
+    ASSERT_SUCCESS(s_release_connections(2, false));
+
+    /* An idle connection on the preferred event loop is used first, then one on any other loop */
+    s_acquire_connection_on_event_loop(loop_1, AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_PREFERRED);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(3));
+    ASSERT_PTR_EQUALS(loop_1, s_get_acquired_connection_event_loop(0));
+
+    s_acquire_connection_on_event_loop(loop_1, AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_PREFERRED);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(4));
+    ASSERT_PTR_EQUALS(loop_0, s_get_acquired_connection_event_loop(1));
+
+    ASSERT_UINT_EQUALS(2, aws_atomic_load_int(&s_tester.next_connection_id));
+    ASSERT_SUCCESS(s_release_connections(2, false));
+
+    /* At max_connections, an idle connection on the wrong event loop is closed to make room */
+    s_acquire_connection_on_event_loop(loop_1, AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_REQUIRED);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(5));
+    ASSERT_PTR_EQUALS(loop_1, s_get_acquired_connection_event_loop(0));
+
+    s_acquire_connection_on_event_loop(loop_1, AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_REQUIRED);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(6));
+    ASSERT_PTR_EQUALS(loop_1, s_get_acquired_connection_event_loop(1));
+
+    ASSERT_UINT_EQUALS(3, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    /* This thread isn't an event loop, so it has no loop of its own to require */
+    ASSERT_UINT_EQUALS(0, s_tester.connection_errors);
+    s_acquire_connection_on_event_loop(NULL, AWS_HTTP_CONNECTION_MANAGER_EVENT_LOOP_AFFINITY_REQUIRED);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(7));
+    ASSERT_UINT_EQUALS(1, s_tester.connection_errors);
+
+    ASSERT_SUCCESS(s_cm_tester_clean_up());
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_connection_manager_event_loop_affinity, s_test_connection_manager_event_loop_affinity);
+
+static struct mock_connection *s_get_mock_connection(size_t index) {
+    struct mock_connection *mock = NULL;
+    aws_array_list_get_at(&s_tester.mock_connections, &mock, index);
+    return mock;
+}
+
+static int s_test_connection_manager_idle_connection_policy_fifo(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct cm_tester_options options = {
+        .allocator = allocator,
+        .max_connections = 2,
+        .mock_table = &s_synchronous_mocks,
+        .idle_connection_policy = AWS_HTTP_CONNECTION_MANAGER_IDLE_CONNECTION_POLICY_FIFO,
+    };
+
+    ASSERT_SUCCESS(s_cm_tester_init(&options));
+
+    s_add_mock_connections(2, AWS_NCRT_SUCCESS, false);
+
+    s_acquire_connections(2);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(2));
+
+    /* Releases the second connection, then the first */
+    ASSERT_SUCCESS(s_release_connections(2, false));
+
+    /* The connection that has been idle longest is reused first */
+    s_acquire_connections(1);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(3));
+    ASSERT_PTR_EQUALS(s_get_mock_connection(1), s_get_acquired_connection(0));
+
+    s_acquire_connections(1);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(4));
+    ASSERT_PTR_EQUALS(s_get_mock_connection(0), s_get_acquired_connection(1));
+
+    ASSERT_UINT_EQUALS(2, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    ASSERT_SUCCESS(s_cm_tester_clean_up());
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(
+    test_connection_manager_idle_connection_policy_fifo,
+    s_test_connection_manager_idle_connection_policy_fifo);
+
+enum {
+    PREWARM_CONNECTION_COUNT = 4,
+};
+
+/*
+ * Create a manager, then complete its first acquisitions.
+ * Reports how many connects were made at startup, and how many the acquisitions had to wait on.
+ */
+static int s_count_first_acquisition_connects(
+    struct aws_allocator *allocator,
+    size_t min_idle_connections,
+    size_t *out_startup_connects,
+    size_t *out_acquisition_connects) {
+
+    struct cm_tester_options options = {
+        .allocator = allocator,
+        .max_connections = PREWARM_CONNECTION_COUNT,
+        .mock_table = &s_synchronous_mocks,
+        .min_idle_connections = min_idle_connections,
+        .initial_mock_connections = PREWARM_CONNECTION_COUNT,
+    };
+
+    ASSERT_SUCCESS(s_cm_tester_init(&options));
+
+    *out_startup_connects = aws_atomic_load_int(&s_tester.next_connection_id);
+
+    s_acquire_connections(PREWARM_CONNECTION_COUNT);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(PREWARM_CONNECTION_COUNT));
+
+    *out_acquisition_connects = aws_atomic_load_int(&s_tester.next_connection_id) - *out_startup_connects;
+
+    ASSERT_UINT_EQUALS(0, s_tester.connection_errors);
+    ASSERT_SUCCESS(s_cm_tester_clean_up());
+
+    return AWS_OP_SUCCESS;
+}
+
+/* Compare the first acquisitions of a cold manager and a prewarmed one */
+static int s_test_connection_manager_prewarm(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    size_t cold_startup_connects = 0;
+    size_t cold_acquisition_connects = 0;
+    ASSERT_SUCCESS(
+        s_count_first_acquisition_connects(allocator, 0, &cold_startup_connects, &cold_acquisition_connects));
+
+    ASSERT_UINT_EQUALS(0, cold_startup_connects);
+    ASSERT_UINT_EQUALS(PREWARM_CONNECTION_COUNT, cold_acquisition_connects);
+
+    size_t warm_startup_connects = 0;
+    size_t warm_acquisition_connects = 0;
+    ASSERT_SUCCESS(s_count_first_acquisition_connects(
+        allocator, PREWARM_CONNECTION_COUNT, &warm_startup_connects, &warm_acquisition_connects));
+
+    /* Every connection was made at startup, none of the acquisitions had to wait on a connect */
+    ASSERT_UINT_EQUALS(PREWARM_CONNECTION_COUNT, warm_startup_connects);
+    ASSERT_UINT_EQUALS(0, warm_acquisition_connects);
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_connection_manager_prewarm, s_test_connection_manager_prewarm);
+
+static int s_test_connection_manager_idle_culling_keeps_min_idle(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct aws_array_list seen_connections;
+    AWS_ZERO_STRUCT(seen_connections);
+    ASSERT_SUCCESS(aws_array_list_init_dynamic(&seen_connections, allocator, 10, sizeof(struct aws_http_connection *)));
+
+    uint64_t now = 0;
+
+    struct cm_tester_options options = {
+        .allocator = allocator,
+        .max_connections = 3,
+        .mock_table = &s_idle_mocks,
+        .max_connection_idle_in_ms = 1000,
+        .starting_mock_time = now,
+        .min_idle_connections = 1,
+        .initial_mock_connections = 4,
+    };
+
+    ASSERT_SUCCESS(s_cm_tester_init(&options));
+    ASSERT_UINT_EQUALS(1, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    /* The prewarmed connection is used, and the pool is topped up as connections are made for the others */
+    s_acquire_connections(3);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(3));
+    ASSERT_UINT_EQUALS(3, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    s_register_acquired_connections(&seen_connections);
+    ASSERT_SUCCESS(s_release_connections(3, false));
+
+    /* advance fake time enough to cause the connections to be culled, and give the cull task a chance to run */
+    uint64_t one_sec_in_nanos = aws_timestamp_convert(1, AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL);
+    s_tester_set_mock_time(now + one_sec_in_nanos);
+    aws_thread_current_sleep(2 * one_sec_in_nanos);
+
+    /* One connection survived the cull, and is still good to use */
+    s_acquire_connections(1);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(4));
+    ASSERT_UINT_EQUALS(1, s_get_acquired_connections_seen_count(&seen_connections));
+    ASSERT_UINT_EQUALS(3, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    ASSERT_SUCCESS(s_cm_tester_clean_up());
+
+    aws_array_list_clean_up(&seen_connections);
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(
+    test_connection_manager_idle_culling_keeps_min_idle,
+    s_test_connection_manager_idle_culling_keeps_min_idle);
+
+static int s_test_connection_manager_idle_culling_on_release(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    uint64_t now = 0;
+
+    /* The cull task is first scheduled one idle interval after the manager's creation.  Create the manager at a
+     * later time than the test then runs at, so the cull task is never due and only a release can cull. */
+    uint64_t hundred_secs_in_nanos = aws_timestamp_convert(100, AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL);
+
+    struct cm_tester_options options = {
+        .allocator = allocator,
+        .max_connections = 2,
+        .mock_table = &s_idle_mocks,
+        .max_connection_idle_in_ms = 1000,
+        .starting_mock_time = now + hundred_secs_in_nanos,
+        .idle_connection_policy = AWS_HTTP_CONNECTION_MANAGER_IDLE_CONNECTION_POLICY_FIFO,
+    };
+
+    ASSERT_SUCCESS(s_cm_tester_init(&options));
+    s_tester_set_mock_time(now);
+
+    s_add_mock_connections(2, AWS_NCRT_SUCCESS, false);
+
+    s_acquire_connections(2);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(2));
+
+    /* Release the second connection, and let it expire */
+    ASSERT_SUCCESS(s_release_connections(1, false));
+
+    uint64_t two_secs_in_nanos = aws_timestamp_convert(2, AWS_TIMESTAMP_SECS, AWS_TIMESTAMP_NANOS, NULL);
+    s_tester_set_mock_time(now + two_secs_in_nanos);
+
+    /* Releasing the first connection culls the expired one, without waiting on the cull task */
+    ASSERT_SUCCESS(s_release_connections(1, false));
+
+    /* Under FIFO, the expired connection would be next, but only the fresh one is left */
+    s_acquire_connections(1);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(3));
+    ASSERT_PTR_EQUALS(s_get_mock_connection(0), s_get_acquired_connection(0));
+    ASSERT_UINT_EQUALS(2, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    struct aws_http_connection_manager_cull_metrics metrics;
+    aws_http_connection_manager_get_cull_metrics(s_tester.connection_manager, &metrics);
+
+    ASSERT_UINT_EQUALS(1, metrics.lazily_culled_count);
+    ASSERT_UINT_EQUALS(0, metrics.cull_task_run_count);
+    ASSERT_UINT_EQUALS(0, metrics.cull_task_culled_count);
+
+    ASSERT_SUCCESS(s_cm_tester_clean_up());
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_connection_manager_idle_culling_on_release, s_test_connection_manager_idle_culling_on_release);
+
+static int s_test_connection_manager_http1_pipelining(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    struct cm_tester_options options = {
+        .allocator = allocator,
+        .max_connections = 5,
+        .mock_table = &s_http2_mocks,
+        .max_pipelined_requests_per_connection = 3,
+    };
+
+    ASSERT_SUCCESS(s_cm_tester_init(&options));
+
+    s_add_mock_connections(5, AWS_NCRT_SUCCESS, false);
+
+    /* The first HTTP/1.1 connection is shared by the first 3 acquisitions, the 4th spills onto a second connection */
+    s_acquire_connections(4);
+
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(4));
+
+    ASSERT_UINT_EQUALS(0, s_tester.connection_errors);
+    ASSERT_UINT_EQUALS(2, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    struct aws_http_connection *first_connection = s_get_acquired_connection(0);
+    ASSERT_PTR_EQUALS(first_connection, s_get_acquired_connection(1));
+    ASSERT_PTR_EQUALS(first_connection, s_get_acquired_connection(2));
+    struct aws_http_connection *second_connection = s_get_acquired_connection(3);
+    ASSERT_TRUE(first_connection != second_connection);
+
+    /* Leaves 2 requests on the first connection and none on the second */
+    ASSERT_SUCCESS(s_release_connections(2, false));
+
+    /* The next acquisition goes to the least busy connection, rather than queueing behind the first's requests */
+    s_acquire_connections(1);
+
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(5));
+    ASSERT_UINT_EQUALS(2, aws_atomic_load_int(&s_tester.next_connection_id));
+    ASSERT_PTR_EQUALS(second_connection, s_get_acquired_connection(2));
+
+    ASSERT_SUCCESS(s_cm_tester_clean_up());
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_connection_manager_http1_pipelining, s_test_connection_manager_http1_pipelining);
+
+enum {
+    BENCHMARK_THREAD_COUNT = 8,
+};
+
+struct cm_benchmark_thread {
+    struct aws_thread thread;
+    struct aws_atomic_var acquired_connection;
+    size_t iterations;
+    size_t error_count;
+};
+
+static void s_on_benchmark_acquire(struct aws_http_connection *connection, int error_code, void *user_data) {
+    (void)error_code;
+    struct cm_benchmark_thread *benchmark_thread = user_data;
+    AWS_FATAL_ASSERT(connection != NULL);
+    aws_atomic_store_ptr(&benchmark_thread->acquired_connection, connection);
+}
+
+static void s_benchmark_thread_run(void *user_data) {
+    struct cm_benchmark_thread *benchmark_thread = user_data;
+
+    for (size_t i = 0; i < benchmark_thread->iterations; ++i) {
+        aws_http_connection_manager_acquire_connection(
+            s_tester.connection_manager, s_on_benchmark_acquire, benchmark_thread);
+
+        /* If the acquisition had to wait, the callback comes from whichever thread releases a connection */
+        struct aws_http_connection *connection = NULL;
+        while ((connection = aws_atomic_load_ptr(&benchmark_thread->acquired_connection)) == NULL) {
+            aws_thread_current_sleep(0);
+        }
+        aws_atomic_store_ptr(&benchmark_thread->acquired_connection, NULL);
+
+        if (aws_http_connection_manager_release_connection(s_tester.connection_manager, connection)) {
+            ++benchmark_thread->error_count;
+        }
+    }
+}
+
+/*
+ * Many threads acquire and release pooled connections as fast as they can, iterations times each.
+ * Reports the time taken through out_ns.
+ */
+static int s_run_multithreaded_acquire_release(struct aws_allocator *allocator, size_t iterations, uint64_t *out_ns) {
+    struct cm_tester_options options = {
+        .allocator = allocator,
+        .max_connections = BENCHMARK_THREAD_COUNT,
+        .mock_table = &s_synchronous_mocks,
+        .num_event_loops = 4,
+    };
+
+    ASSERT_SUCCESS(s_cm_tester_init(&options));
+
+    /* Fill the pool */
+    s_add_mock_connections(BENCHMARK_THREAD_COUNT, AWS_NCRT_SUCCESS, false);
+    s_acquire_connections(BENCHMARK_THREAD_COUNT);
+    ASSERT_SUCCESS(s_wait_on_connection_reply_count(BENCHMARK_THREAD_COUNT));
+    ASSERT_SUCCESS(s_release_connections(BENCHMARK_THREAD_COUNT, false));
+
+    struct cm_benchmark_thread threads[BENCHMARK_THREAD_COUNT];
+    AWS_ZERO_ARRAY(threads);
+    for (size_t i = 0; i < BENCHMARK_THREAD_COUNT; ++i) {
+        aws_atomic_init_ptr(&threads[i].acquired_connection, NULL);
+        threads[i].iterations = iterations;
+        ASSERT_SUCCESS(aws_thread_init(&threads[i].thread, allocator));
+    }
+
+    uint64_t start_ns = 0;
+    uint64_t end_ns = 0;
+    ASSERT_SUCCESS(aws_high_res_clock_get_ticks(&start_ns));
+
+    for (size_t i = 0; i < BENCHMARK_THREAD_COUNT; ++i) {
+        ASSERT_SUCCESS(aws_thread_launch(&threads[i].thread, s_benchmark_thread_run, &threads[i], NULL));
+    }
+
+    for (size_t i = 0; i < BENCHMARK_THREAD_COUNT; ++i) {
+        ASSERT_SUCCESS(aws_thread_join(&threads[i].thread));
+        aws_thread_clean_up(&threads[i].thread);
+        ASSERT_UINT_EQUALS(0, threads[i].error_count);
+    }
+
+    ASSERT_SUCCESS(aws_high_res_clock_get_ticks(&end_ns));
+    *out_ns = end_ns - start_ns;
+
+    /* Every acquisition was served from the pool */
+    ASSERT_UINT_EQUALS(0, s_tester.connection_errors);
+    ASSERT_UINT_EQUALS(BENCHMARK_THREAD_COUNT, aws_atomic_load_int(&s_tester.next_connection_id));
+
+    ASSERT_SUCCESS(s_cm_tester_clean_up());
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_test_connection_manager_multithreaded_acquire_release(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    uint64_t elapsed_ns = 0;
+    ASSERT_SUCCESS(s_run_multithreaded_acquire_release(allocator, 500, &elapsed_ns));
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(
+    test_connection_manager_multithreaded_acquire_release,
+    s_test_connection_manager_multithreaded_acquire_release);
+
+/* Not a pass/fail test, logs how long a lot of acquire/release cycles take.  Only run with ENABLE_PERFORMANCE_TESTS */
+static int s_test_connection_manager_multithreaded_acquire_release_timing(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    const size_t iterations = 20000;
+    uint64_t elapsed_ns = 0;
+    ASSERT_SUCCESS(s_run_multithreaded_acquire_release(allocator, iterations, &elapsed_ns));
+
+    AWS_LOGF_INFO(
+        AWS_LS_HTTP_CONNECTION_MANAGER,
+        "%d threads did %zu acquire/release cycles each in %" PRIu64 "ns",
+        (int)BENCHMARK_THREAD_COUNT,
+        iterations,
+        elapsed_ns);
+
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(
+    test_connection_manager_multithreaded_acquire_release_timing,
+    s_test_connection_manager_multithreaded_acquire_release_timing);
@@ -916,6 +916,104 @@ static int s_test_http_connection_monitor_shutdown(struct aws_allocator *allocat
 }
 AWS_TEST_CASE(test_http_connection_monitor_shutdown, s_test_http_connection_monitor_shutdown);
 
+/*
+ * HTTP/2 connections report a different stats category.
+ * Throughput is only checked for intervals in which the connection had active streams the whole time.
+ */
+struct http2_monitor_test_interval {
+    uint64_t bytes_read;
+    uint64_t pending_incoming_stream_ms;
+    bool was_inactive;
+    uint64_t expected_throughput;
+    uint64_t expected_consecutive_failure_time_ms;
+    bool expect_shutdown;
+};
+
+static struct http2_monitor_test_interval s_test_http2_intervals[] = {
+    /* Idle connection, throughput isn't checked */
+    {
+        .bytes_read = 10,
+        .pending_incoming_stream_ms = 100,
+        .was_inactive = true,
+        .expected_throughput = 100,
+        .expected_consecutive_failure_time_ms = 0,
+    },
+    /* Busy and fast */
+    {
+        .bytes_read = 5000,
+        .pending_incoming_stream_ms = AWS_TIMESTAMP_MILLIS,
+        .expected_throughput = 5000,
+        .expected_consecutive_failure_time_ms = 0,
+    },
+    /* Busy and slow */
+    {
+        .bytes_read = 100,
+        .pending_incoming_stream_ms = AWS_TIMESTAMP_MILLIS,
+        .expected_throughput = 100,
+        .expected_consecutive_failure_time_ms = 1000,
+    },
+    /* Still slow, exceeds the allowable failure interval */
+    {
+        .bytes_read = 100,
+        .pending_incoming_stream_ms = AWS_TIMESTAMP_MILLIS,
+        .expected_throughput = 100,
+        .expected_consecutive_failure_time_ms = 2000,
+        .expect_shutdown = true,
+    },
+};
+
+static int s_test_http2_connection_monitor_shutdown(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    aws_http_library_init(allocator);
+
+    struct testing_channel test_channel;
+    struct aws_testing_channel_options test_channel_options = {.clock_fn = s_mock_clock};
+    ASSERT_SUCCESS(testing_channel_init(&test_channel, allocator, &test_channel_options));
+    test_channel.channel_shutdown = s_testing_channel_shutdown_callback;
+
+    struct aws_crt_statistics_handler *monitor =
+        aws_crt_statistics_handler_new_http_connection_monitor(allocator, &s_test_options);
+    ASSERT_NOT_NULL(monitor);
+    struct aws_statistics_handler_http_connection_monitor_impl *monitor_impl = monitor->impl;
+
+    struct aws_array_list stats_list;
+    ASSERT_SUCCESS(aws_array_list_init_dynamic(&stats_list, allocator, 2, sizeof(void *)));
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(s_test_http2_intervals); ++i) {
+        struct http2_monitor_test_interval *interval = &s_test_http2_intervals[i];
+
+        struct aws_crt_statistics_socket socket_stats = {
+            .category = AWSCRT_STAT_CAT_SOCKET,
+            .bytes_read = interval->bytes_read,
+        };
+
+        struct aws_crt_statistics_http2_channel http2_stats;
+        aws_crt_statistics_http2_channel_init(&http2_stats);
+        http2_stats.pending_incoming_stream_ms = interval->pending_incoming_stream_ms;
+        http2_stats.was_inactive = interval->was_inactive;
+
+        aws_array_list_clear(&stats_list);
+        void *stats_base = &socket_stats;
+        ASSERT_SUCCESS(aws_array_list_push_back(&stats_list, &stats_base));
+        stats_base = &http2_stats;
+        ASSERT_SUCCESS(aws_array_list_push_back(&stats_list, &stats_base));
+
+        monitor->vtable->process_statistics(monitor, NULL, &stats_list, test_channel.channel);
+        testing_channel_drain_queued_tasks(&test_channel);
+
+        ASSERT_UINT_EQUALS(interval->expected_throughput, monitor_impl->last_measured_throughput);
+        ASSERT_UINT_EQUALS(interval->expected_consecutive_failure_time_ms, monitor_impl->throughput_failure_time_ms);
+        ASSERT_INT_EQUALS(interval->expect_shutdown, testing_channel_is_shutdown_completed(&test_channel));
+    }
+
+    aws_array_list_clean_up(&stats_list);
+    aws_crt_statistics_handler_destroy(monitor);
+    ASSERT_SUCCESS(testing_channel_clean_up(&test_channel));
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+AWS_TEST_CASE(test_http2_connection_monitor_shutdown, s_test_http2_connection_monitor_shutdown);
+
 /*
 
  Pattern 2 (http statistics verification)
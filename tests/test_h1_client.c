@@ -4,6 +4,7 @@
  */
 
 #include "stream_test_helper.h"
+#include <aws/common/thread.h>
 #include <aws/common/uuid.h>
 #include <aws/http/private/h1_connection.h>
 #include <aws/http/request_response.h>
@@ -94,6 +95,10 @@ struct tester_options {
     bool manual_window_management;
     size_t initial_stream_window_size;
     size_t read_buffer_capacity;
+    uint64_t write_coalescing_delay_ns;
+    struct aws_http_read_buffer_budget *read_buffer_budget;
+    size_t read_buffer_min_capacity;
+    aws_io_clock_fn *clock_fn;
 };
 
 static int s_tester_init_ex(struct tester *tester, struct aws_allocator *alloc, const struct tester_options *options) {
@@ -110,11 +115,16 @@ static int s_tester_init_ex(struct tester *tester, struct aws_allocator *alloc,
     ASSERT_SUCCESS(aws_logger_init_standard(&tester->logger, tester->alloc, &logger_options));
     aws_logger_set(&tester->logger);
 
-    struct aws_testing_channel_options test_channel_options = {.clock_fn = aws_high_res_clock_get_ticks};
+    struct aws_testing_channel_options test_channel_options = {
+        .clock_fn = options->clock_fn ? options->clock_fn : aws_high_res_clock_get_ticks,
+    };
     ASSERT_SUCCESS(testing_channel_init(&tester->testing_channel, alloc, &test_channel_options));
 
     struct aws_http1_connection_options http1_options = AWS_HTTP1_CONNECTION_OPTIONS_INIT;
     http1_options.read_buffer_capacity = options->read_buffer_capacity;
+    http1_options.write_coalescing_delay_ns = options->write_coalescing_delay_ns;
+    http1_options.read_buffer_budget = options->read_buffer_budget;
+    http1_options.read_buffer_min_capacity = options->read_buffer_min_capacity;
 
     tester->connection = aws_http_connection_new_http1_1_client(
         alloc, options->manual_window_management, options->initial_stream_window_size, &http1_options);
@@ -1216,6 +1226,196 @@ H1_CLIENT_TEST_CASE(h1_client_request_send_multiple) {
     return AWS_OP_SUCCESS;
 }
 
+static size_t s_count_written_messages(struct tester *tester) {
+    struct aws_linked_list *written_msgs = testing_channel_get_written_message_queue(&tester->testing_channel);
+    size_t count = 0;
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(written_msgs);
+         node != aws_linked_list_end(written_msgs);
+         node = aws_linked_list_next(node)) {
+        ++count;
+    }
+    return count;
+}
+
+/* Check that small pipelined requests are packed into a single aws_io_message */
+H1_CLIENT_TEST_CASE(h1_client_request_send_multiple_coalesced) {
+    (void)ctx;
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init(&tester, allocator));
+
+    struct aws_http_make_request_options opt = {
+        .self_size = sizeof(opt),
+        .request = s_new_default_get_request(allocator),
+    };
+
+    struct aws_http_stream *streams[3];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        streams[i] = aws_http_connection_make_request(tester.connection, &opt);
+        ASSERT_NOT_NULL(streams[i]);
+        ASSERT_SUCCESS(aws_http_stream_activate(streams[i]));
+    }
+
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+    aws_http_message_destroy(opt.request);
+
+    ASSERT_UINT_EQUALS(1, s_count_written_messages(&tester));
+    struct aws_crt_statistics_http1_channel *stats = aws_h1_connection_get_statistics(tester.connection);
+    ASSERT_UINT_EQUALS(1, stats->num_outgoing_messages);
+    ASSERT_UINT_EQUALS(3, stats->num_outgoing_streams_done);
+
+    const char *expected = "GET / HTTP/1.1\r\n"
+                           "\r\n"
+                           "GET / HTTP/1.1\r\n"
+                           "\r\n"
+                           "GET / HTTP/1.1\r\n"
+                           "\r\n";
+    ASSERT_SUCCESS(testing_channel_check_written_messages_str(&tester.testing_channel, allocator, expected));
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        aws_http_stream_release(streams[i]);
+    }
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
+/* Check that requests made during the write coalescing delay are sent together */
+H1_CLIENT_TEST_CASE(h1_client_request_write_coalescing_delay) {
+    (void)ctx;
+    struct tester tester;
+    const uint64_t delay_ns = aws_timestamp_convert(50, AWS_TIMESTAMP_MILLIS, AWS_TIMESTAMP_NANOS, NULL);
+    struct tester_options options = {
+        .write_coalescing_delay_ns = delay_ns,
+    };
+    ASSERT_SUCCESS(s_tester_init_ex(&tester, allocator, &options));
+
+    struct aws_http_make_request_options opt = {
+        .self_size = sizeof(opt),
+        .request = s_new_default_get_request(allocator),
+    };
+
+    /* Requests arrive one at a time, but nothing is written until the delay passes */
+    struct aws_http_stream *streams[3];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        streams[i] = aws_http_connection_make_request(tester.connection, &opt);
+        ASSERT_NOT_NULL(streams[i]);
+        ASSERT_SUCCESS(aws_http_stream_activate(streams[i]));
+        testing_channel_drain_queued_tasks(&tester.testing_channel);
+    }
+    ASSERT_UINT_EQUALS(0, s_count_written_messages(&tester));
+
+    aws_thread_current_sleep(delay_ns);
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+    aws_http_message_destroy(opt.request);
+
+    ASSERT_UINT_EQUALS(1, s_count_written_messages(&tester));
+    const char *expected = "GET / HTTP/1.1\r\n"
+                           "\r\n"
+                           "GET / HTTP/1.1\r\n"
+                           "\r\n"
+                           "GET / HTTP/1.1\r\n"
+                           "\r\n";
+    ASSERT_SUCCESS(testing_channel_check_written_messages_str(&tester.testing_channel, allocator, expected));
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        aws_http_stream_release(streams[i]);
+    }
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
+/* Check that a large body in memory is sent from that memory, rather than copied into channel messages */
+H1_CLIENT_TEST_CASE(h1_client_request_send_body_zero_copy) {
+    (void)ctx;
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init(&tester, allocator));
+
+    /* A small slice, which gets copied along with the head, then a large one */
+    struct aws_byte_buf large_buf;
+    ASSERT_SUCCESS(aws_byte_buf_init(&large_buf, allocator, 64 * 1024));
+    while (large_buf.len < large_buf.capacity) {
+        aws_byte_buf_write_u8(&large_buf, (uint8_t)('a' + large_buf.len % 26));
+    }
+    struct aws_byte_cursor slices[] = {
+        aws_byte_cursor_from_c_str("small slice "),
+        aws_byte_cursor_from_buf(&large_buf),
+    };
+    struct aws_input_stream *body_stream =
+        aws_http_body_stream_new_from_memory_slices(allocator, slices, AWS_ARRAY_SIZE(slices));
+    ASSERT_NOT_NULL(body_stream);
+
+    int64_t body_len = 0;
+    ASSERT_SUCCESS(aws_input_stream_get_length(body_stream, &body_len));
+    ASSERT_UINT_EQUALS(slices[0].len + slices[1].len, (uint64_t)body_len);
+
+    char content_length_str[32];
+    snprintf(content_length_str, sizeof(content_length_str), "%" PRIi64, body_len);
+    struct aws_http_header headers[] = {
+        {
+            .name = aws_byte_cursor_from_c_str("Content-Length"),
+            .value = aws_byte_cursor_from_c_str(content_length_str),
+        },
+    };
+
+    struct aws_http_message *request = aws_http_message_new_request(allocator);
+    ASSERT_NOT_NULL(request);
+    ASSERT_SUCCESS(aws_http_message_set_request_method(request, aws_byte_cursor_from_c_str("PUT")));
+    ASSERT_SUCCESS(aws_http_message_set_request_path(request, aws_byte_cursor_from_c_str("/large.txt")));
+    ASSERT_SUCCESS(aws_http_message_add_header_array(request, headers, AWS_ARRAY_SIZE(headers)));
+    aws_http_message_set_body_stream(request, body_stream);
+
+    struct aws_http_make_request_options opt = {
+        .self_size = sizeof(opt),
+        .request = request,
+    };
+    struct aws_http_stream *stream = aws_http_connection_make_request(tester.connection, &opt);
+    ASSERT_NOT_NULL(stream);
+    ASSERT_SUCCESS(aws_http_stream_activate(stream));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* At least one written message should point straight into the large slice */
+    bool found_zero_copy_message = false;
+    struct aws_linked_list *written_msgs = testing_channel_get_written_message_queue(&tester.testing_channel);
+    for (struct aws_linked_list_node *node = aws_linked_list_begin(written_msgs);
+         node != aws_linked_list_end(written_msgs);
+         node = aws_linked_list_next(node)) {
+        struct aws_io_message *msg = AWS_CONTAINER_OF(node, struct aws_io_message, queueing_handle);
+        if (msg->message_data.buffer >= large_buf.buffer &&
+            msg->message_data.buffer < large_buf.buffer + large_buf.len) {
+            ASSERT_TRUE(msg->message_data.len >= AWS_H1_ENCODER_ZERO_COPY_MIN_SIZE);
+            found_zero_copy_message = true;
+        }
+    }
+    ASSERT_TRUE(found_zero_copy_message);
+
+    struct aws_crt_statistics_http1_channel *stats = aws_h1_connection_get_statistics(tester.connection);
+    ASSERT_UINT_EQUALS(1, stats->num_outgoing_streams_done);
+
+    /* Check the bytes on the wire are just what they'd be if the body had been copied */
+    struct aws_byte_buf expected;
+    ASSERT_SUCCESS(aws_byte_buf_init(&expected, allocator, 256 + (size_t)body_len));
+    const char *expected_head_parts[] = {"PUT /large.txt HTTP/1.1\r\nContent-Length: ", content_length_str, "\r\n\r\n"};
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(expected_head_parts); ++i) {
+        struct aws_byte_cursor part = aws_byte_cursor_from_c_str(expected_head_parts[i]);
+        ASSERT_TRUE(aws_byte_buf_write_from_whole_cursor(&expected, part));
+    }
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(slices); ++i) {
+        ASSERT_TRUE(aws_byte_buf_write_from_whole_cursor(&expected, slices[i]));
+    }
+    ASSERT_SUCCESS(testing_channel_check_written_messages(
+        &tester.testing_channel, allocator, aws_byte_cursor_from_buf(&expected)));
+
+    /* clean up */
+    aws_http_message_destroy(request);
+    aws_http_stream_release(stream);
+    aws_input_stream_destroy(body_stream);
+
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+
+    aws_byte_buf_clean_up(&expected);
+    aws_byte_buf_clean_up(&large_buf);
+    return AWS_OP_SUCCESS;
+}
+
 /* Check that if many requests are made (pipelining) they all get sent */
 H1_CLIENT_TEST_CASE(h1_client_request_send_multiple_chunked_encoding) {
     (void)ctx;
@@ -1655,6 +1855,78 @@ H1_CLIENT_TEST_CASE(h1_client_response_get_multiple_from_1_io_message) {
     return AWS_OP_SUCCESS;
 }
 
+enum {
+    SMALL_RESPONSE_COUNT = 1000,
+};
+
+/* Receive many small pipelined responses, split into aws_io_messages of message_size */
+static int s_receive_many_small_responses(struct aws_allocator *allocator, size_t message_size) {
+    struct tester_options tester_opts = {
+        .manual_window_management = true,
+        .initial_stream_window_size = SIZE_MAX,
+    };
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init_ex(&tester, allocator, &tester_opts));
+
+    struct aws_http_message *request = s_new_default_get_request(allocator);
+    struct client_stream_tester *stream_testers =
+        aws_mem_calloc(allocator, SMALL_RESPONSE_COUNT, sizeof(struct client_stream_tester));
+    ASSERT_NOT_NULL(stream_testers);
+    for (size_t i = 0; i < SMALL_RESPONSE_COUNT; ++i) {
+        ASSERT_SUCCESS(s_stream_tester_init(&stream_testers[i], &tester, request));
+    }
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    struct aws_byte_cursor response = aws_byte_cursor_from_c_str("HTTP/1.1 200 OK\r\n"
+                                                                 "Content-Length: 5\r\n"
+                                                                 "\r\n"
+                                                                 "hello");
+    struct aws_byte_buf responses;
+    ASSERT_SUCCESS(aws_byte_buf_init(&responses, allocator, response.len * SMALL_RESPONSE_COUNT));
+    for (size_t i = 0; i < SMALL_RESPONSE_COUNT; ++i) {
+        ASSERT_SUCCESS(aws_byte_buf_append(&responses, &response));
+    }
+
+    struct aws_byte_cursor responses_cursor = aws_byte_cursor_from_buf(&responses);
+    while (responses_cursor.len > 0) {
+        struct aws_byte_cursor message =
+            aws_byte_cursor_advance(&responses_cursor, aws_min_size(message_size, responses_cursor.len));
+        ASSERT_SUCCESS(testing_channel_push_read_data(&tester.testing_channel, message));
+    }
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    for (size_t i = 0; i < SMALL_RESPONSE_COUNT; ++i) {
+        ASSERT_TRUE(stream_testers[i].complete);
+        ASSERT_INT_EQUALS(AWS_ERROR_SUCCESS, stream_testers[i].on_complete_error_code);
+        ASSERT_TRUE(aws_byte_buf_eq_c_str(&stream_testers[i].response_body, "hello"));
+        client_stream_tester_clean_up(&stream_testers[i]);
+    }
+
+    /* Everything was consumed, so the window was reopened all the way */
+    struct aws_h1_window_stats window_stats = aws_h1_connection_window_stats(tester.connection);
+    ASSERT_UINT_EQUALS(0, window_stats.buffer_pending_bytes);
+    ASSERT_UINT_EQUALS(window_stats.buffer_capacity, window_stats.connection_window);
+
+    /* Each aws_io_message was decoded in one pass, through every response it held */
+    ASSERT_TRUE(window_stats.recent_max_streams_per_batch >= aws_max_size(1, message_size / response.len));
+
+    aws_byte_buf_clean_up(&responses);
+    aws_mem_release(allocator, stream_testers);
+    aws_http_message_release(request);
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
+/* Many small responses, with each aws_io_message holding a few of them, or a piece of one */
+H1_CLIENT_TEST_CASE(h1_client_response_many_small_batched) {
+    (void)ctx;
+    ASSERT_SUCCESS(s_receive_many_small_responses(allocator, 1));
+    ASSERT_SUCCESS(s_receive_many_small_responses(allocator, 16));
+    ASSERT_SUCCESS(s_receive_many_small_responses(allocator, 256));
+    ASSERT_SUCCESS(s_receive_many_small_responses(allocator, 16 * 1024));
+    return AWS_OP_SUCCESS;
+}
+
 H1_CLIENT_TEST_CASE(h1_client_response_with_bad_data_shuts_down_connection) {
     (void)ctx;
     struct tester tester;
@@ -2520,6 +2792,113 @@ H1_CLIENT_TEST_CASE(h1_client_connection_window_with_buffer) {
     return AWS_OP_SUCCESS;
 }
 
+static uint64_t s_adaptive_buffer_mock_time_ns;
+
+static int s_adaptive_buffer_mock_clock(uint64_t *timestamp) {
+    *timestamp = s_adaptive_buffer_mock_time_ns;
+    return AWS_OP_SUCCESS;
+}
+
+/* Test that a read buffer with a budget grows while the peer fills it, within the budget, and shrinks when idle */
+H1_CLIENT_TEST_CASE(h1_client_connection_window_with_adaptive_buffer) {
+    (void)ctx;
+
+    s_adaptive_buffer_mock_time_ns = 0;
+    struct aws_http_read_buffer_budget *budget = aws_http_read_buffer_budget_new(allocator, 300);
+    ASSERT_NOT_NULL(budget);
+
+    struct tester_options tester_opts = {
+        .manual_window_management = true,
+        .initial_stream_window_size = SIZE_MAX,
+        .read_buffer_capacity = 400,
+        .read_buffer_min_capacity = 100,
+        .read_buffer_budget = budget,
+        .clock_fn = s_adaptive_buffer_mock_clock,
+    };
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init_ex(&tester, allocator, &tester_opts));
+
+    struct aws_http_message *request = s_new_default_get_request(allocator);
+    struct client_stream_tester stream_tester;
+    ASSERT_SUCCESS(s_stream_tester_init(&stream_tester, &tester, request));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* Connection starts at its minimum capacity, which it always holds from the budget */
+    struct aws_h1_window_stats window_stats = aws_h1_connection_window_stats(tester.connection);
+    ASSERT_UINT_EQUALS(100, window_stats.buffer_capacity);
+    ASSERT_UINT_EQUALS(100, window_stats.connection_window);
+    ASSERT_UINT_EQUALS(100, aws_http_read_buffer_budget_get_reserved_bytes(budget));
+
+    /* 610 byte response, sent in chunks that fill the connection window */
+    const char *response_head = "HTTP/1.1 200 OK\r\n"
+                                "Content-Length: 570\r\n"
+                                "\r\n";
+    struct aws_byte_buf response;
+    ASSERT_SUCCESS(aws_byte_buf_init(&response, allocator, 610));
+    struct aws_byte_cursor response_head_cursor = aws_byte_cursor_from_c_str(response_head);
+    ASSERT_SUCCESS(aws_byte_buf_append(&response, &response_head_cursor));
+    while (response.len < 610) {
+        ASSERT_TRUE(aws_byte_buf_write_u8(&response, 'x'));
+    }
+    struct aws_byte_cursor response_cursor = aws_byte_cursor_from_buf(&response);
+
+    /* The user keeps up with a full window of data, so capacity doubles */
+    ASSERT_SUCCESS(
+        testing_channel_push_read_data(&tester.testing_channel, aws_byte_cursor_advance(&response_cursor, 100)));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    window_stats = aws_h1_connection_window_stats(tester.connection);
+    ASSERT_UINT_EQUALS(200, window_stats.buffer_capacity);
+    ASSERT_UINT_EQUALS(200, window_stats.connection_window);
+    ASSERT_UINT_EQUALS(200, aws_http_read_buffer_budget_get_reserved_bytes(budget));
+
+    /* It would double again, but the budget only has room for 100 more bytes */
+    ASSERT_SUCCESS(
+        testing_channel_push_read_data(&tester.testing_channel, aws_byte_cursor_advance(&response_cursor, 200)));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    window_stats = aws_h1_connection_window_stats(tester.connection);
+    ASSERT_UINT_EQUALS(300, window_stats.buffer_capacity);
+    ASSERT_UINT_EQUALS(300, window_stats.connection_window);
+    ASSERT_UINT_EQUALS(300, aws_http_read_buffer_budget_get_reserved_bytes(budget));
+
+    /* The budget is exhausted, so capacity stays put */
+    ASSERT_SUCCESS(
+        testing_channel_push_read_data(&tester.testing_channel, aws_byte_cursor_advance(&response_cursor, 300)));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    window_stats = aws_h1_connection_window_stats(tester.connection);
+    ASSERT_UINT_EQUALS(300, window_stats.buffer_capacity);
+    ASSERT_UINT_EQUALS(300, window_stats.connection_window);
+    ASSERT_UINT_EQUALS(300, aws_http_read_buffer_budget_get_reserved_bytes(budget));
+
+    /* A trickle of data over more than a second halves the capacity.
+     * The window already granted can't shrink, so its bytes stay reserved until the peer uses them */
+    s_adaptive_buffer_mock_time_ns += 2 * AWS_TIMESTAMP_NANOS;
+    ASSERT_SUCCESS(testing_channel_push_read_data(&tester.testing_channel, response_cursor));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    ASSERT_TRUE(stream_tester.complete);
+    ASSERT_SUCCESS(stream_tester.on_complete_error_code);
+    ASSERT_UINT_EQUALS(570, stream_tester.response_body.len);
+
+    window_stats = aws_h1_connection_window_stats(tester.connection);
+    ASSERT_UINT_EQUALS(150, window_stats.buffer_capacity);
+    ASSERT_UINT_EQUALS(290, window_stats.connection_window);
+    ASSERT_UINT_EQUALS(290, aws_http_read_buffer_budget_get_reserved_bytes(budget));
+
+    /* clean up */
+    aws_byte_buf_clean_up(&response);
+    client_stream_tester_clean_up(&stream_tester);
+    aws_http_message_release(request);
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+
+    /* Destroyed connection returned everything it held */
+    ASSERT_UINT_EQUALS(0, aws_http_read_buffer_budget_get_reserved_bytes(budget));
+    aws_http_read_buffer_budget_release(budget);
+    return AWS_OP_SUCCESS;
+}
+
 /* Test a connection with read_buffer_capacity < initial_window_size */
 H1_CLIENT_TEST_CASE(h1_client_connection_window_with_small_buffer) {
     (void)ctx;
@@ -2605,6 +2984,155 @@ H1_CLIENT_TEST_CASE(h1_client_connection_window_with_small_buffer) {
     return AWS_OP_SUCCESS;
 }
 
+struct body_slice_tester {
+    struct aws_http_body_slice slices[4];
+    size_t num_slices;
+    bool complete;
+    int on_complete_error_code;
+};
+
+static int s_body_slice_tester_on_body_slice(
+    struct aws_http_stream *stream,
+    const struct aws_http_body_slice *slice,
+    void *user_data) {
+
+    (void)stream;
+    struct body_slice_tester *slice_tester = user_data;
+    AWS_FATAL_ASSERT(slice_tester->num_slices < AWS_ARRAY_SIZE(slice_tester->slices));
+
+    /* Keep every slice, without copying its data */
+    struct aws_http_body_slice *kept = &slice_tester->slices[slice_tester->num_slices++];
+    *kept = *slice;
+    return aws_http_body_slice_acquire(kept);
+}
+
+static void s_body_slice_tester_on_complete(struct aws_http_stream *stream, int error_code, void *user_data) {
+    (void)stream;
+    struct body_slice_tester *slice_tester = user_data;
+    slice_tester->complete = true;
+    slice_tester->on_complete_error_code = error_code;
+}
+
+static struct aws_http_stream *s_make_body_slice_request(
+    struct tester *tester,
+    struct aws_http_message *request,
+    struct body_slice_tester *slice_tester) {
+
+    struct aws_http_make_request_options opt = {
+        .self_size = sizeof(opt),
+        .request = request,
+        .user_data = slice_tester,
+        .on_response_body_slice = s_body_slice_tester_on_body_slice,
+        .on_complete = s_body_slice_tester_on_complete,
+    };
+    struct aws_http_stream *stream = aws_http_connection_make_request(tester->connection, &opt);
+    AWS_FATAL_ASSERT(stream);
+    AWS_FATAL_ASSERT(aws_http_stream_activate(stream) == AWS_OP_SUCCESS);
+    return stream;
+}
+
+/* Body slices lend data from the read buffer, and count against it until released */
+H1_CLIENT_TEST_CASE(h1_client_response_body_slice) {
+    (void)ctx;
+
+    struct tester_options tester_opts = {
+        .manual_window_management = true,
+        .initial_stream_window_size = SIZE_MAX,
+        .read_buffer_capacity = 100,
+    };
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init_ex(&tester, allocator, &tester_opts));
+
+    struct aws_http_message *request = s_new_default_get_request(allocator);
+    struct body_slice_tester slice_tester;
+    AWS_ZERO_STRUCT(slice_tester);
+    struct aws_http_stream *stream = s_make_body_slice_request(&tester, request, &slice_tester);
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* 49 byte response, arriving in 1 message */
+    ASSERT_SUCCESS(testing_channel_push_read_str(
+        &tester.testing_channel,
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Length: 10\r\n"
+        "\r\n"
+        "0123456789"));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    ASSERT_TRUE(slice_tester.complete);
+    ASSERT_SUCCESS(slice_tester.on_complete_error_code);
+    ASSERT_UINT_EQUALS(1, slice_tester.num_slices);
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&slice_tester.slices[0].data, "0123456789"));
+
+    /* The whole message is kept alive by the slice, so the window can't reopen */
+    struct aws_h1_window_stats window_stats = aws_h1_connection_window_stats(tester.connection);
+    ASSERT_UINT_EQUALS(0, window_stats.buffer_pending_bytes);
+    ASSERT_UINT_EQUALS(49, window_stats.buffer_retained_bytes);
+    ASSERT_UINT_EQUALS(51, window_stats.connection_window);
+    ASSERT_UINT_EQUALS(0, window_stats.recent_window_increments);
+
+    /* Data is still good after the stream is gone */
+    aws_http_stream_release(stream);
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&slice_tester.slices[0].data, "0123456789"));
+
+    /* Releasing the slice gives the space back */
+    aws_http_body_slice_release(&slice_tester.slices[0]);
+    ASSERT_NULL(slice_tester.slices[0].owner);
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    window_stats = aws_h1_connection_window_stats(tester.connection);
+    ASSERT_UINT_EQUALS(0, window_stats.buffer_retained_bytes);
+    ASSERT_UINT_EQUALS(100, window_stats.connection_window);
+    ASSERT_UINT_EQUALS(49, window_stats.recent_window_increments);
+
+    /* clean up */
+    aws_http_message_release(request);
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
+/* A slice of a message the connection never finished processing may be held past the connection's destruction */
+H1_CLIENT_TEST_CASE(h1_client_response_body_slice_outlives_connection) {
+    (void)ctx;
+
+    struct tester_options tester_opts = {
+        .manual_window_management = true,
+        .initial_stream_window_size = 5,
+        .read_buffer_capacity = 100,
+    };
+    struct tester tester;
+    ASSERT_SUCCESS(s_tester_init_ex(&tester, allocator, &tester_opts));
+
+    struct aws_http_message *request = s_new_default_get_request(allocator);
+    struct body_slice_tester slice_tester;
+    AWS_ZERO_STRUCT(slice_tester);
+    struct aws_http_stream *stream = s_make_body_slice_request(&tester, request, &slice_tester);
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    /* Stream window only lets half the body through */
+    ASSERT_SUCCESS(testing_channel_push_read_str(
+        &tester.testing_channel,
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Length: 10\r\n"
+        "\r\n"
+        "0123456789"));
+    testing_channel_drain_queued_tasks(&tester.testing_channel);
+
+    ASSERT_FALSE(slice_tester.complete);
+    ASSERT_UINT_EQUALS(1, slice_tester.num_slices);
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&slice_tester.slices[0].data, "01234"));
+
+    /* Tear everything down while still holding the slice */
+    aws_http_stream_release(stream);
+    aws_http_message_release(request);
+    ASSERT_SUCCESS(s_tester_clean_up(&tester));
+    ASSERT_TRUE(slice_tester.complete);
+
+    ASSERT_TRUE(aws_byte_cursor_eq_c_str(&slice_tester.slices[0].data, "01234"));
+    aws_http_body_slice_release(&slice_tester.slices[0]);
+    return AWS_OP_SUCCESS;
+}
+
 static void s_on_complete(struct aws_http_stream *stream, int error_code, void *user_data) {
     (void)stream;
     int *completion_error_code = user_data;
@@ -333,6 +333,97 @@ static int s_h1_test_receive_response_headers(struct aws_allocator *allocator, v
     return AWS_OP_SUCCESS;
 }
 
+/* A realistic S3 GetObject response head, the kind of thing the decoder spends most of its time on */
+static const char *s_s3_response_head = "HTTP/1.1 200 OK\r\n"
+                                        "x-amz-id-2: ef8yU9AS1ed4OpIszj7UDNEHGran\r\n"
+                                        "x-amz-request-id: 318BC8BC143432E5\r\n"
+                                        "Date: Wed, 28 Oct 2009 22:32:00 GMT\r\n"
+                                        "Last-Modified: Wed, 12 Oct 2009 17:50:00 GMT\r\n"
+                                        "ETag: \"fba9dede5f27731c9771645a39863328\"\r\n"
+                                        "x-amz-server-side-encryption:AES256\r\n"
+                                        "x-amz-meta-note: \t value: with colons \t \r\n"
+                                        "x-amz-meta-empty:\r\n"
+                                        "Accept-Ranges: bytes\r\n"
+                                        "Content-Type: application/octet-stream\r\n"
+                                        "Content-Length: 0\r\n"
+                                        "Server: AmazonS3\r\n"
+                                        "\r\n";
+
+static const char *s_s3_response_header_pairs[][2] = {
+    {"x-amz-id-2", "ef8yU9AS1ed4OpIszj7UDNEHGran"},
+    {"x-amz-request-id", "318BC8BC143432E5"},
+    {"Date", "Wed, 28 Oct 2009 22:32:00 GMT"},
+    {"Last-Modified", "Wed, 12 Oct 2009 17:50:00 GMT"},
+    {"ETag", "\"fba9dede5f27731c9771645a39863328\""},
+    {"x-amz-server-side-encryption", "AES256"},
+    {"x-amz-meta-note", "value: with colons"},
+    {"x-amz-meta-empty", ""},
+    {"Accept-Ranges", "bytes"},
+    {"Content-Type", "application/octet-stream"},
+    {"Content-Length", "0"},
+    {"Server", "AmazonS3"},
+};
+
+struct s_header_pair_params {
+    size_t index;
+    bool mismatch;
+    bool done;
+};
+
+static int s_got_header_pair(const struct aws_h1_decoded_header *header, void *user_data) {
+    struct s_header_pair_params *params = user_data;
+    if (params->index >= AWS_ARRAY_SIZE(s_s3_response_header_pairs)) {
+        return aws_raise_error(AWS_ERROR_UNKNOWN);
+    }
+
+    const char **expected = s_s3_response_header_pairs[params->index++];
+    if (!aws_byte_cursor_eq_c_str(&header->name_data, expected[0]) ||
+        !aws_byte_cursor_eq_c_str(&header->value_data, expected[1])) {
+        params->mismatch = true;
+    }
+
+    return AWS_OP_SUCCESS;
+}
+
+static int s_header_pair_on_done(void *user_data) {
+    struct s_header_pair_params *params = user_data;
+    params->done = true;
+    return AWS_OP_SUCCESS;
+}
+
+/* Split the response head at every possible point, so each line gets parsed both in place and from scratch space */
+AWS_TEST_CASE(h1_decode_s3_response_headers, s_h1_decode_s3_response_headers);
+static int s_h1_decode_s3_response_headers(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    s_test_init(allocator);
+
+    const struct aws_byte_cursor head = aws_byte_cursor_from_c_str(s_s3_response_head);
+    for (size_t split = 0; split <= head.len; ++split) {
+        struct s_header_pair_params header_params;
+        AWS_ZERO_STRUCT(header_params);
+
+        struct aws_h1_decoder_params params;
+        s_common_decoder_setup(allocator, 16, &params, s_response, &header_params);
+        params.vtable.on_header = s_got_header_pair;
+        params.vtable.on_done = s_header_pair_on_done;
+        struct aws_h1_decoder *decoder = aws_h1_decoder_new(&params);
+
+        struct aws_byte_cursor first = aws_byte_cursor_from_array(head.ptr, split);
+        struct aws_byte_cursor second = aws_byte_cursor_from_array(head.ptr + split, head.len - split);
+        ASSERT_SUCCESS(aws_h1_decode(decoder, &first));
+        ASSERT_SUCCESS(aws_h1_decode(decoder, &second));
+
+        ASSERT_TRUE(header_params.done);
+        ASSERT_FALSE(header_params.mismatch);
+        ASSERT_UINT_EQUALS(AWS_ARRAY_SIZE(s_s3_response_header_pairs), header_params.index);
+
+        aws_h1_decoder_destroy(decoder);
+    }
+
+    s_test_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
 AWS_TEST_CASE(h1_test_get_transfer_encoding_flags, s_h1_test_get_transfer_encoding_flags);
 static int s_h1_test_get_transfer_encoding_flags(struct aws_allocator *allocator, void *ctx) {
     (void)ctx;
@@ -735,6 +826,18 @@ static int s_h1_decode_bad_responses_and_assert_failure(struct aws_allocator *al
         /* Response code should not be in hex */
         AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("HTTP/1.1 FFF PHRASE\r\n"),
 
+        /* Header name must be a token */
+        AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("HTTP/1.1 200 OK\r\nBad Name: value\r\n"),
+
+        /* Header name must not be empty */
+        AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("HTTP/1.1 200 OK\r\n: value\r\n"),
+
+        /* Header must have a colon */
+        AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("HTTP/1.1 200 OK\r\nNoColon\r\n"),
+
+        /* Whitespace between header name and colon is not allowed (RFC-7230 3.2.4) */
+        AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL("HTTP/1.1 200 OK\r\nName : value\r\n"),
+
         /* Go ahead and add more cases here. */
     };
 
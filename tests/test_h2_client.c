@@ -1491,6 +1491,117 @@ TEST_CASE(h2_client_stream_send_data) {
     return s_tester_clean_up();
 }
 
+static struct aws_crt_statistics_http2_channel *s_gather_h2_statistics(struct aws_array_list *stats_list) {
+    aws_array_list_clear(stats_list);
+    struct aws_channel_handler *handler = &s_tester.connection->channel_handler;
+    handler->vtable->gather_statistics(handler, stats_list);
+    AWS_FATAL_ASSERT(aws_array_list_length(stats_list) == 1);
+
+    struct aws_crt_statistics_http2_channel *stats = NULL;
+    aws_array_list_get_at(stats_list, &stats, 0);
+    return stats;
+}
+
+/* Test that the connection gathers HTTP/2 statistics */
+TEST_CASE(h2_client_statistics) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    struct aws_array_list stats_list;
+    ASSERT_SUCCESS(aws_array_list_init_dynamic(&stats_list, allocator, 1, sizeof(void *)));
+    struct aws_channel_handler *handler = &s_tester.connection->channel_handler;
+
+    /* Nothing happening yet */
+    struct aws_crt_statistics_http2_channel *stats = s_gather_h2_statistics(&stats_list);
+    ASSERT_INT_EQUALS(AWSCRT_STAT_CAT_HTTP2_CHANNEL, stats->category);
+    ASSERT_PTR_EQUALS(aws_h2_connection_get_statistics(s_tester.connection), stats);
+    ASSERT_UINT_EQUALS(0, stats->num_active_streams);
+    ASSERT_TRUE(stats->was_inactive);
+    handler->vtable->reset_statistics(handler);
+
+    /* send request */
+    struct aws_http_message *request = aws_http_message_new_request(allocator);
+    ASSERT_NOT_NULL(request);
+
+    struct aws_http_header request_headers_src[] = {
+        DEFINE_HEADER(":method", "POST"),
+        DEFINE_HEADER(":scheme", "https"),
+        DEFINE_HEADER(":path", "/"),
+    };
+    aws_http_message_add_header_array(request, request_headers_src, AWS_ARRAY_SIZE(request_headers_src));
+
+    const char *body_src = "hello";
+    struct aws_byte_cursor body_cursor = aws_byte_cursor_from_c_str(body_src);
+    struct aws_input_stream *request_body = aws_input_stream_new_from_cursor(allocator, &body_cursor);
+    aws_http_message_set_body_stream(request, request_body);
+
+    struct client_stream_tester stream_tester;
+    ASSERT_SUCCESS(s_stream_tester_init(&stream_tester, request));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    uint32_t stream_id = aws_http_stream_get_id(stream_tester.stream);
+
+    /* Outgoing bytes are counted by frame type */
+    stats = s_gather_h2_statistics(&stats_list);
+    ASSERT_UINT_EQUALS(1, stats->num_active_streams);
+    ASSERT_TRUE(stats->was_inactive);
+    ASSERT_TRUE(stats->frame_bytes_sent[AWS_H2_FRAME_T_HEADERS] > AWS_H2_FRAME_PREFIX_SIZE);
+    ASSERT_UINT_EQUALS(AWS_H2_FRAME_PREFIX_SIZE + strlen(body_src), stats->frame_bytes_sent[AWS_H2_FRAME_T_DATA]);
+
+    /* HPACK compression is measured on the header-block, without the frame header */
+    ASSERT_UINT_EQUALS(strlen(":methodPOST:schemehttps:path/"), stats->header_bytes_uncompressed);
+    ASSERT_UINT_EQUALS(
+        stats->frame_bytes_sent[AWS_H2_FRAME_T_HEADERS] - AWS_H2_FRAME_PREFIX_SIZE, stats->header_bytes_compressed);
+    ASSERT_TRUE(stats->header_bytes_compressed < stats->header_bytes_uncompressed);
+
+    /* Stream is active for the whole next interval */
+    handler->vtable->reset_statistics(handler);
+    stats = s_gather_h2_statistics(&stats_list);
+    ASSERT_UINT_EQUALS(1, stats->num_active_streams);
+    ASSERT_FALSE(stats->was_inactive);
+    ASSERT_UINT_EQUALS(0, stats->frame_bytes_sent[AWS_H2_FRAME_T_DATA]);
+    ASSERT_UINT_EQUALS(0, stats->header_bytes_uncompressed);
+    ASSERT_UINT_EQUALS(0, stats->header_bytes_compressed);
+
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    ASSERT_UINT_EQUALS(3, h2_decode_tester_frame_count(&s_tester.peer.decode));
+
+    /* fake peer sends connection preface and response */
+    ASSERT_SUCCESS(h2_fake_peer_send_connection_preface_default_settings(&s_tester.peer));
+    struct aws_http_header response_headers_src[] = {
+        DEFINE_HEADER(":status", "200"),
+    };
+    struct aws_http_headers *response_headers = aws_http_headers_new(allocator);
+    aws_http_headers_add_array(response_headers, response_headers_src, AWS_ARRAY_SIZE(response_headers_src));
+    struct aws_h2_frame *response_frame =
+        aws_h2_frame_new_headers(allocator, stream_id, response_headers, true /*end_stream*/, 0, NULL);
+    ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, response_frame));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_TRUE(stream_tester.complete);
+
+    /* Incoming bytes are counted by frame type, and stream finishing is noticed */
+    stats = s_gather_h2_statistics(&stats_list);
+    ASSERT_UINT_EQUALS(0, stats->num_active_streams);
+    ASSERT_TRUE(stats->was_inactive);
+    ASSERT_TRUE(stats->frame_bytes_received[AWS_H2_FRAME_T_SETTINGS] >= AWS_H2_FRAME_PREFIX_SIZE);
+    ASSERT_TRUE(stats->frame_bytes_received[AWS_H2_FRAME_T_HEADERS] > AWS_H2_FRAME_PREFIX_SIZE);
+    ASSERT_UINT_EQUALS(0, stats->frame_bytes_received[AWS_H2_FRAME_T_DATA]);
+
+    /* Now nothing is happening */
+    handler->vtable->reset_statistics(handler);
+    stats = s_gather_h2_statistics(&stats_list);
+    ASSERT_TRUE(stats->was_inactive);
+    for (size_t i = 0; i < AWS_CRT_STATISTICS_HTTP2_FRAME_TYPE_COUNT; ++i) {
+        ASSERT_UINT_EQUALS(0, stats->frame_bytes_received[i]);
+    }
+
+    /* clean up */
+    aws_array_list_clean_up(&stats_list);
+    aws_http_headers_release(response_headers);
+    aws_http_message_release(request);
+    client_stream_tester_clean_up(&stream_tester);
+    aws_input_stream_destroy(request_body);
+    return s_tester_clean_up();
+}
+
 /* Test sending multiple requests, each with large bodies that must be sent across multiple DATA frames.
  * The connection should not let one stream hog the connection, the streams should take turns sending DATA.
  * Also, the stream should not send more than one aws_io_message full of frames per event-loop-tick */
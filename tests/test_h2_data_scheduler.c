@@ -0,0 +1,318 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/http/private/h2_data_scheduler.h>
+
+#include <aws/http/private/h2_stream.h>
+
+#include <aws/testing/aws_test_harness.h>
+
+#define TEST_CASE(NAME)                                                                                                \
+    AWS_TEST_CASE(NAME, s_test_##NAME);                                                                                \
+    static int s_test_##NAME(struct aws_allocator *allocator, void *ctx)
+
+/* The scheduler only touches a stream's node and scheduler_data, so tests can use bare structs */
+struct sim_stream {
+    struct aws_h2_stream stream;
+    size_t id;
+    size_t bytes_remaining;
+    size_t bytes_sent;
+};
+
+static void s_sim_stream_init(struct sim_stream *sim, size_t id, uint8_t urgency, uint16_t weight, size_t num_bytes) {
+    AWS_ZERO_STRUCT(*sim);
+    sim->id = id;
+    sim->bytes_remaining = num_bytes;
+    sim->stream.thread_data.scheduler_data.priority.urgency = urgency;
+    sim->stream.thread_data.scheduler_data.priority.weight = weight;
+}
+
+static struct sim_stream *s_pop(struct aws_h2_data_scheduler *scheduler) {
+    struct aws_h2_stream *stream = aws_h2_data_scheduler_pop(scheduler);
+    return stream ? AWS_CONTAINER_OF(stream, struct sim_stream, stream) : NULL;
+}
+
+/* Pop the next stream, have it "send" up to frame_size bytes, and push it back if it has more.
+ * Returns the stream that sent. */
+static struct sim_stream *s_send_one_frame(struct aws_h2_data_scheduler *scheduler, size_t frame_size) {
+    struct sim_stream *sim = s_pop(scheduler);
+    AWS_FATAL_ASSERT(sim);
+
+    size_t num_bytes = aws_min_size(frame_size, sim->bytes_remaining);
+    sim->bytes_remaining -= num_bytes;
+    sim->bytes_sent += num_bytes;
+
+    if (sim->bytes_remaining > 0) {
+        aws_h2_data_scheduler_on_data_sent(scheduler, &sim->stream, num_bytes);
+        aws_h2_data_scheduler_push(scheduler, &sim->stream);
+    }
+    return sim;
+}
+
+static int s_check_push_pop_remove(struct aws_allocator *allocator, enum aws_http2_data_scheduler_type type) {
+    struct aws_h2_data_scheduler *scheduler = aws_h2_data_scheduler_new(allocator, type);
+    ASSERT_NOT_NULL(scheduler);
+    ASSERT_TRUE(aws_h2_data_scheduler_is_empty(scheduler));
+    ASSERT_NULL(aws_h2_data_scheduler_pop(scheduler));
+
+    struct sim_stream streams[3];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        s_sim_stream_init(&streams[i], i, 3, 16, 1);
+        aws_h2_data_scheduler_push(scheduler, &streams[i].stream);
+    }
+    ASSERT_FALSE(aws_h2_data_scheduler_is_empty(scheduler));
+
+    /* Removing pulls a stream out from the middle, removing again is harmless */
+    aws_h2_data_scheduler_remove(scheduler, &streams[1].stream);
+    aws_h2_data_scheduler_remove(scheduler, &streams[1].stream);
+    ASSERT_FALSE(streams[1].stream.thread_data.scheduler_data.is_scheduled);
+    ASSERT_NULL(streams[1].stream.node.next);
+
+    /* Streams of equal priority come out in the order they went in */
+    ASSERT_PTR_EQUALS(&streams[0], s_pop(scheduler));
+    ASSERT_PTR_EQUALS(&streams[2], s_pop(scheduler));
+    ASSERT_TRUE(aws_h2_data_scheduler_is_empty(scheduler));
+    ASSERT_NULL(aws_h2_data_scheduler_pop(scheduler));
+
+    aws_h2_data_scheduler_destroy(scheduler);
+    return AWS_OP_SUCCESS;
+}
+
+TEST_CASE(h2_data_scheduler_push_pop_remove) {
+    (void)ctx;
+    ASSERT_SUCCESS(s_check_push_pop_remove(allocator, AWS_HTTP2_DATA_SCHEDULER_ROUND_ROBIN));
+    ASSERT_SUCCESS(s_check_push_pop_remove(allocator, AWS_HTTP2_DATA_SCHEDULER_WEIGHTED_FAIR));
+    ASSERT_SUCCESS(s_check_push_pop_remove(allocator, AWS_HTTP2_DATA_SCHEDULER_STRICT_PRIORITY));
+
+    ASSERT_NULL(aws_h2_data_scheduler_new(allocator, (enum aws_http2_data_scheduler_type)99));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+    return AWS_OP_SUCCESS;
+}
+
+/* Round-robin ignores priority, every stream sends one frame per turn */
+TEST_CASE(h2_data_scheduler_round_robin) {
+    (void)ctx;
+    struct aws_h2_data_scheduler *scheduler =
+        aws_h2_data_scheduler_new(allocator, AWS_HTTP2_DATA_SCHEDULER_ROUND_ROBIN);
+    ASSERT_NOT_NULL(scheduler);
+
+    struct sim_stream streams[3];
+    s_sim_stream_init(&streams[0], 0, 7 /*urgency*/, 1 /*weight*/, 3 /*bytes*/);
+    s_sim_stream_init(&streams[1], 1, 0 /*urgency*/, 256 /*weight*/, 1 /*bytes*/);
+    s_sim_stream_init(&streams[2], 2, 3 /*urgency*/, 16 /*weight*/, 2 /*bytes*/);
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        aws_h2_data_scheduler_push(scheduler, &streams[i].stream);
+    }
+
+    const size_t expected_order[] = {0, 1, 2, 0, 2, 0};
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(expected_order); ++i) {
+        ASSERT_UINT_EQUALS(expected_order[i], s_send_one_frame(scheduler, 1)->id);
+    }
+    ASSERT_TRUE(aws_h2_data_scheduler_is_empty(scheduler));
+
+    aws_h2_data_scheduler_destroy(scheduler);
+    return AWS_OP_SUCCESS;
+}
+
+/* Strict-priority drains the most urgent streams first, taking turns among equals */
+TEST_CASE(h2_data_scheduler_strict_priority) {
+    (void)ctx;
+    struct aws_h2_data_scheduler *scheduler =
+        aws_h2_data_scheduler_new(allocator, AWS_HTTP2_DATA_SCHEDULER_STRICT_PRIORITY);
+    ASSERT_NOT_NULL(scheduler);
+
+    struct sim_stream streams[4];
+    s_sim_stream_init(&streams[0], 0, 7 /*urgency*/, 16 /*weight*/, 1 /*bytes*/);
+    s_sim_stream_init(&streams[1], 1, 3 /*urgency*/, 16 /*weight*/, 2 /*bytes*/);
+    s_sim_stream_init(&streams[2], 2, 0 /*urgency*/, 16 /*weight*/, 1 /*bytes*/);
+    s_sim_stream_init(&streams[3], 3, 3 /*urgency*/, 16 /*weight*/, 2 /*bytes*/);
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        aws_h2_data_scheduler_push(scheduler, &streams[i].stream);
+    }
+
+    const size_t expected_order[] = {2, 1, 3, 1, 3, 0};
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(expected_order); ++i) {
+        ASSERT_UINT_EQUALS(expected_order[i], s_send_one_frame(scheduler, 1)->id);
+    }
+    ASSERT_TRUE(aws_h2_data_scheduler_is_empty(scheduler));
+
+    aws_h2_data_scheduler_destroy(scheduler);
+    return AWS_OP_SUCCESS;
+}
+
+/* Weighted-fair gives busy streams bandwidth in proportion to their weight */
+TEST_CASE(h2_data_scheduler_weighted_fair) {
+    (void)ctx;
+    struct aws_h2_data_scheduler *scheduler =
+        aws_h2_data_scheduler_new(allocator, AWS_HTTP2_DATA_SCHEDULER_WEIGHTED_FAIR);
+    ASSERT_NOT_NULL(scheduler);
+
+    const size_t frame_size = 4096;
+    struct sim_stream streams[3];
+    s_sim_stream_init(&streams[0], 0, 3 /*urgency*/, 64 /*weight*/, SIZE_MAX);
+    s_sim_stream_init(&streams[1], 1, 3 /*urgency*/, 16 /*weight*/, SIZE_MAX);
+    s_sim_stream_init(&streams[2], 2, 3 /*urgency*/, 1 /*weight*/, SIZE_MAX);
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        aws_h2_data_scheduler_push(scheduler, &streams[i].stream);
+    }
+
+    for (size_t i = 0; i < 10000; ++i) {
+        s_send_one_frame(scheduler, frame_size);
+    }
+
+    /* Each stream overdraws by less than a frame per turn, so allow some slop */
+    const size_t total_weight = 64 + 16 + 1;
+    size_t total_sent = streams[0].bytes_sent + streams[1].bytes_sent + streams[2].bytes_sent;
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        size_t weight = streams[i].stream.thread_data.scheduler_data.priority.weight;
+        double expected = (double)total_sent * (double)weight / (double)total_weight;
+        double actual = (double)streams[i].bytes_sent;
+        ASSERT_TRUE(actual > expected * 0.9 && actual < expected * 1.1 + frame_size);
+    }
+
+    /* Pull the streams out so the scheduler can be destroyed */
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(streams); ++i) {
+        aws_h2_data_scheduler_remove(scheduler, &streams[i].stream);
+    }
+    aws_h2_data_scheduler_destroy(scheduler);
+    return AWS_OP_SUCCESS;
+}
+
+/* Low-weight streams sending max-size frames go many turns into debt.
+ * Each pop() should still go around the line at most once, rather than once per turn owed. */
+TEST_CASE(h2_data_scheduler_weighted_fair_bounded_pop) {
+    (void)ctx;
+    struct aws_h2_data_scheduler *scheduler =
+        aws_h2_data_scheduler_new(allocator, AWS_HTTP2_DATA_SCHEDULER_WEIGHTED_FAIR);
+    ASSERT_NOT_NULL(scheduler);
+
+    enum { STREAM_COUNT = 1000, FRAME_SIZE = 16 * 1024 };
+    struct sim_stream *streams = aws_mem_calloc(allocator, STREAM_COUNT, sizeof(struct sim_stream));
+    ASSERT_NOT_NULL(streams);
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        s_sim_stream_init(&streams[i], i, 3 /*urgency*/, 1 /*weight*/, SIZE_MAX);
+        aws_h2_data_scheduler_push(scheduler, &streams[i].stream);
+    }
+
+    for (size_t i = 0; i < STREAM_COUNT * 20; ++i) {
+        size_t prev_requeues = scheduler->num_requeues;
+        s_send_one_frame(scheduler, FRAME_SIZE);
+        ASSERT_TRUE(scheduler->num_requeues - prev_requeues < STREAM_COUNT);
+    }
+
+    /* Skipping ahead mustn't change who sends: equal weights still get equal turns */
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        ASSERT_UINT_EQUALS(20 * FRAME_SIZE, streams[i].bytes_sent);
+    }
+
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        aws_h2_data_scheduler_remove(scheduler, &streams[i].stream);
+    }
+    aws_mem_release(allocator, streams);
+    aws_h2_data_scheduler_destroy(scheduler);
+    return AWS_OP_SUCCESS;
+}
+
+/* Changing priority takes effect immediately, even while the stream is waiting in the scheduler */
+TEST_CASE(h2_data_scheduler_set_priority) {
+    (void)ctx;
+    struct aws_h2_data_scheduler *scheduler =
+        aws_h2_data_scheduler_new(allocator, AWS_HTTP2_DATA_SCHEDULER_STRICT_PRIORITY);
+    ASSERT_NOT_NULL(scheduler);
+
+    struct sim_stream streams[2];
+    s_sim_stream_init(&streams[0], 0, 3 /*urgency*/, 16 /*weight*/, 1 /*bytes*/);
+    s_sim_stream_init(&streams[1], 1, 3 /*urgency*/, 16 /*weight*/, 1 /*bytes*/);
+    aws_h2_data_scheduler_push(scheduler, &streams[0].stream);
+    aws_h2_data_scheduler_push(scheduler, &streams[1].stream);
+
+    struct aws_http2_stream_priority urgent = {.urgency = 0, .weight = 16};
+    aws_h2_data_scheduler_set_priority(scheduler, &streams[1].stream, &urgent);
+    ASSERT_PTR_EQUALS(&streams[1], s_pop(scheduler));
+
+    /* Setting priority on an unscheduled stream doesn't schedule it */
+    struct aws_http2_stream_priority lazy = {.urgency = 7, .weight = 16};
+    aws_h2_data_scheduler_set_priority(scheduler, &streams[1].stream, &lazy);
+    ASSERT_FALSE(streams[1].stream.thread_data.scheduler_data.is_scheduled);
+    ASSERT_UINT_EQUALS(7, streams[1].stream.thread_data.scheduler_data.priority.urgency);
+
+    ASSERT_PTR_EQUALS(&streams[0], s_pop(scheduler));
+    ASSERT_TRUE(aws_h2_data_scheduler_is_empty(scheduler));
+
+    aws_h2_data_scheduler_destroy(scheduler);
+    return AWS_OP_SUCCESS;
+}
+
+enum {
+    BULK_LOAD_STREAM_COUNT = 32,
+    BULK_LOAD_STREAM_BYTES = 8 * 1024 * 1024,
+    BULK_LOAD_URGENT_BYTES = 64 * 1024,
+    BULK_LOAD_FRAME_SIZE = 16 * 1024,
+};
+
+/* Simulate a small urgent request arriving while many bulk uploads are in progress.
+ * Returns how many bytes the connection wrote before the urgent stream finished. */
+static size_t s_bytes_until_urgent_stream_done(
+    struct aws_allocator *allocator,
+    enum aws_http2_data_scheduler_type type) {
+
+    struct aws_h2_data_scheduler *scheduler = aws_h2_data_scheduler_new(allocator, type);
+    AWS_FATAL_ASSERT(scheduler);
+
+    struct sim_stream *bulk = aws_mem_calloc(allocator, BULK_LOAD_STREAM_COUNT, sizeof(struct sim_stream));
+    AWS_FATAL_ASSERT(bulk);
+    for (size_t i = 0; i < BULK_LOAD_STREAM_COUNT; ++i) {
+        s_sim_stream_init(&bulk[i], i, 3 /*urgency*/, 16 /*weight*/, BULK_LOAD_STREAM_BYTES);
+        aws_h2_data_scheduler_push(scheduler, &bulk[i].stream);
+    }
+
+    /* Let the bulk streams get going */
+    const size_t warmup_frames = BULK_LOAD_STREAM_COUNT * 3 + 1;
+    for (size_t i = 0; i < warmup_frames; ++i) {
+        s_send_one_frame(scheduler, BULK_LOAD_FRAME_SIZE);
+    }
+
+    struct sim_stream urgent;
+    s_sim_stream_init(&urgent, BULK_LOAD_STREAM_COUNT, 0 /*urgency*/, 256 /*weight*/, BULK_LOAD_URGENT_BYTES);
+    aws_h2_data_scheduler_push(scheduler, &urgent.stream);
+
+    while (urgent.bytes_remaining > 0) {
+        s_send_one_frame(scheduler, BULK_LOAD_FRAME_SIZE);
+    }
+
+    size_t bytes_written = urgent.bytes_sent - (warmup_frames * BULK_LOAD_FRAME_SIZE);
+    for (size_t i = 0; i < BULK_LOAD_STREAM_COUNT; ++i) {
+        bytes_written += bulk[i].bytes_sent;
+    }
+
+    for (size_t i = 0; i < BULK_LOAD_STREAM_COUNT; ++i) {
+        aws_h2_data_scheduler_remove(scheduler, &bulk[i].stream);
+    }
+    aws_mem_release(allocator, bulk);
+    aws_h2_data_scheduler_destroy(scheduler);
+    return bytes_written;
+}
+
+/* With many bulk streams competing, an urgent stream should finish after far fewer bytes
+ * (ie: far sooner, on a bandwidth-limited link) with weighted-fair or strict-priority than round-robin. */
+TEST_CASE(h2_data_scheduler_bulk_load_tail_latency) {
+    (void)ctx;
+
+    size_t round_robin = s_bytes_until_urgent_stream_done(allocator, AWS_HTTP2_DATA_SCHEDULER_ROUND_ROBIN);
+    size_t weighted_fair = s_bytes_until_urgent_stream_done(allocator, AWS_HTTP2_DATA_SCHEDULER_WEIGHTED_FAIR);
+    size_t strict_priority = s_bytes_until_urgent_stream_done(allocator, AWS_HTTP2_DATA_SCHEDULER_STRICT_PRIORITY);
+
+    /* Round-robin: urgent stream gets one frame per lap around every bulk stream */
+    size_t urgent_frames = BULK_LOAD_URGENT_BYTES / BULK_LOAD_FRAME_SIZE;
+    ASSERT_TRUE(round_robin >= urgent_frames * BULK_LOAD_STREAM_COUNT * BULK_LOAD_FRAME_SIZE);
+
+    /* Weighted-fair: urgent stream waits for at most one lap, then sends everything in a single turn */
+    ASSERT_TRUE(weighted_fair <= (BULK_LOAD_STREAM_COUNT * BULK_LOAD_FRAME_SIZE) + BULK_LOAD_URGENT_BYTES);
+    ASSERT_TRUE(weighted_fair * 2 < round_robin);
+
+    /* Strict-priority: urgent stream doesn't wait at all */
+    ASSERT_UINT_EQUALS(BULK_LOAD_URGENT_BYTES, strict_priority);
+
+    return AWS_OP_SUCCESS;
+}
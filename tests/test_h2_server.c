@@ -0,0 +1,348 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+
+#include "h2_test_helper.h"
+#include <aws/http/private/h2_connection.h>
+#include <aws/http/request_response.h>
+#include <aws/http/server.h>
+#include <aws/io/stream.h>
+#include <aws/testing/io_testing_channel.h>
+
+#define TEST_CASE(NAME)                                                                                                \
+    AWS_TEST_CASE(NAME, s_test_##NAME);                                                                                \
+    static int s_test_##NAME(struct aws_allocator *allocator, void *ctx)
+
+#define DEFINE_HEADER(NAME, VALUE)                                                                                     \
+    { .name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(NAME), .value = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(VALUE), }
+
+#define MAX_TESTER_REQUESTS 4
+
+struct tester_request {
+    struct aws_http_stream *request_handler;
+    struct aws_byte_cursor method;
+    struct aws_byte_cursor path;
+    struct aws_byte_buf body;
+    bool request_done;
+    size_t on_complete_cb_count;
+    int on_complete_error_code;
+};
+
+/* Singleton used by tests in this file */
+struct tester {
+    struct aws_allocator *alloc;
+    struct aws_http_connection *connection;
+    struct testing_channel testing_channel;
+    struct h2_fake_peer peer;
+
+    struct tester_request requests[MAX_TESTER_REQUESTS];
+    size_t request_num;
+
+    /* If true, on_incoming_request callback fails to create a stream */
+    bool refuse_requests;
+} s_tester;
+
+static int s_tester_on_request_body(
+    struct aws_http_stream *stream,
+    const struct aws_byte_cursor *data,
+    void *user_data) {
+
+    (void)stream;
+    struct tester_request *request = user_data;
+    return aws_byte_buf_append_dynamic(&request->body, data);
+}
+
+static int s_tester_on_request_done(struct aws_http_stream *stream, void *user_data) {
+    struct tester_request *request = user_data;
+
+    AWS_FATAL_ASSERT(!request->request_done);
+    request->request_done = true;
+    AWS_FATAL_ASSERT(!aws_http_stream_get_incoming_request_method(stream, &request->method));
+    AWS_FATAL_ASSERT(!aws_http_stream_get_incoming_request_uri(stream, &request->path));
+    return AWS_OP_SUCCESS;
+}
+
+static void s_tester_on_stream_complete(struct aws_http_stream *stream, int error_code, void *user_data) {
+    (void)stream;
+    struct tester_request *request = user_data;
+    request->on_complete_cb_count++;
+    request->on_complete_error_code = error_code;
+}
+
+static struct aws_http_stream *s_tester_on_incoming_request(struct aws_http_connection *connection, void *user_data) {
+    (void)user_data;
+
+    if (s_tester.refuse_requests) {
+        return NULL;
+    }
+
+    AWS_FATAL_ASSERT(s_tester.request_num < MAX_TESTER_REQUESTS);
+    struct tester_request *request = &s_tester.requests[s_tester.request_num++];
+    AWS_FATAL_ASSERT(!aws_byte_buf_init(&request->body, s_tester.alloc, 128));
+
+    struct aws_http_request_handler_options options = AWS_HTTP_REQUEST_HANDLER_OPTIONS_INIT;
+    options.server_connection = connection;
+    options.user_data = request;
+    options.on_request_body = s_tester_on_request_body;
+    options.on_request_done = s_tester_on_request_done;
+    options.on_complete = s_tester_on_stream_complete;
+
+    request->request_handler = aws_http_stream_new_server_request_handler(&options);
+    AWS_FATAL_ASSERT(request->request_handler);
+    return request->request_handler;
+}
+
+static int s_tester_init(struct aws_allocator *alloc, void *ctx) {
+    (void)ctx;
+    aws_http_library_init(alloc);
+
+    AWS_ZERO_STRUCT(s_tester);
+    s_tester.alloc = alloc;
+
+    struct aws_testing_channel_options options = {.clock_fn = aws_high_res_clock_get_ticks};
+    ASSERT_SUCCESS(testing_channel_init(&s_tester.testing_channel, alloc, &options));
+
+    struct aws_http2_connection_options http2_options = {
+        .max_closed_streams = AWS_HTTP2_DEFAULT_MAX_CLOSED_STREAMS,
+    };
+
+    s_tester.connection =
+        aws_http_connection_new_http2_server(alloc, false /* manual window management */, &http2_options);
+    ASSERT_NOT_NULL(s_tester.connection);
+
+    struct aws_http_server_connection_options server_options = AWS_HTTP_SERVER_CONNECTION_OPTIONS_INIT;
+    server_options.connection_user_data = &s_tester;
+    server_options.on_incoming_request = s_tester_on_incoming_request;
+    ASSERT_SUCCESS(aws_http_connection_configure_server(s_tester.connection, &server_options));
+
+    {
+        /* re-enact marriage vows of http-connection and channel (handled by http-server in real world) */
+        struct aws_channel_slot *slot = aws_channel_slot_new(s_tester.testing_channel.channel);
+        ASSERT_NOT_NULL(slot);
+        ASSERT_SUCCESS(aws_channel_slot_insert_end(s_tester.testing_channel.channel, slot));
+        ASSERT_SUCCESS(aws_channel_slot_set_handler(slot, &s_tester.connection->channel_handler));
+        s_tester.connection->vtable->on_channel_handler_installed(&s_tester.connection->channel_handler, slot);
+    }
+
+    struct h2_fake_peer_options peer_options = {
+        .alloc = alloc,
+        .testing_channel = &s_tester.testing_channel,
+        .is_server = false,
+    };
+    ASSERT_SUCCESS(h2_fake_peer_init(&s_tester.peer, &peer_options));
+
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    /* fake peer sends connection preface */
+    ASSERT_SUCCESS(h2_fake_peer_send_connection_preface_default_settings(&s_tester.peer));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    return AWS_OP_SUCCESS;
+}
+
+static int s_tester_clean_up(void) {
+    for (size_t i = 0; i < s_tester.request_num; ++i) {
+        aws_http_stream_release(s_tester.requests[i].request_handler);
+        aws_byte_buf_clean_up(&s_tester.requests[i].body);
+    }
+    h2_fake_peer_clean_up(&s_tester.peer);
+    aws_http_connection_release(s_tester.connection);
+    ASSERT_SUCCESS(testing_channel_clean_up(&s_tester.testing_channel));
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* fake peer sends request HEADERS to start a new stream */
+static int s_send_request(uint32_t stream_id, const char *method, const char *path, bool end_stream) {
+    struct aws_http_header request_headers_src[] = {
+        {.name = aws_http_header_method, .value = aws_byte_cursor_from_c_str(method)},
+        DEFINE_HEADER(":scheme", "https"),
+        {.name = aws_http_header_path, .value = aws_byte_cursor_from_c_str(path)},
+    };
+
+    struct aws_http_headers *request_headers = aws_http_headers_new(s_tester.alloc);
+    ASSERT_NOT_NULL(request_headers);
+    ASSERT_SUCCESS(
+        aws_http_headers_add_array(request_headers, request_headers_src, AWS_ARRAY_SIZE(request_headers_src)));
+
+    struct aws_h2_frame *request_frame =
+        aws_h2_frame_new_headers(s_tester.alloc, stream_id, request_headers, end_stream, 0, NULL);
+    aws_http_headers_release(request_headers);
+    ASSERT_NOT_NULL(request_frame);
+    ASSERT_SUCCESS(h2_fake_peer_send_frame(&s_tester.peer, request_frame));
+    return AWS_OP_SUCCESS;
+}
+
+/* send a response on request-handler stream, with optional body */
+static int s_send_response(struct tester_request *request, int status, const char *body) {
+    struct aws_http_message *response = aws_http_message_new_response(s_tester.alloc);
+    ASSERT_NOT_NULL(response);
+    ASSERT_SUCCESS(aws_http_message_set_response_status(response, status));
+
+    struct aws_input_stream *body_stream = NULL;
+    if (body) {
+        struct aws_byte_cursor body_cursor = aws_byte_cursor_from_c_str(body);
+        body_stream = aws_input_stream_new_from_cursor(s_tester.alloc, &body_cursor);
+        ASSERT_NOT_NULL(body_stream);
+        aws_http_message_set_body_stream(response, body_stream);
+    }
+
+    ASSERT_SUCCESS(aws_http_stream_send_response(request->request_handler, response));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    aws_http_message_release(response);
+    aws_input_stream_destroy(body_stream);
+    return AWS_OP_SUCCESS;
+}
+
+/* Test the common setup/teardown used by all tests in this file */
+TEST_CASE(h2_server_sanity_check) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+    return s_tester_clean_up();
+}
+
+/* Receive a request, send a response with a body */
+TEST_CASE(h2_server_receive_request_send_response) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    ASSERT_SUCCESS(s_send_request(1, "GET", "/index.html", true /*end_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    ASSERT_UINT_EQUALS(1, s_tester.request_num);
+    struct tester_request *request = &s_tester.requests[0];
+    ASSERT_TRUE(request->request_done);
+    ASSERT_UINT_EQUALS(1, aws_http_stream_get_id(request->request_handler));
+    ASSERT_CURSOR_VALUE_CSTRING_EQUALS(request->method, "GET");
+    ASSERT_CURSOR_VALUE_CSTRING_EQUALS(request->path, "/index.html");
+    ASSERT_UINT_EQUALS(0, request->on_complete_cb_count);
+
+    ASSERT_SUCCESS(s_send_response(request, 200, "hello"));
+
+    /* validate sent response */
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    struct h2_decoded_frame *headers_frame =
+        h2_decode_tester_find_stream_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_HEADERS, 1, 0, NULL);
+    ASSERT_NOT_NULL(headers_frame);
+    ASSERT_FALSE(headers_frame->end_stream);
+    struct aws_byte_cursor status;
+    ASSERT_SUCCESS(aws_http_headers_get(headers_frame->headers, aws_http_header_status, &status));
+    ASSERT_CURSOR_VALUE_CSTRING_EQUALS(status, "200");
+    ASSERT_SUCCESS(h2_decode_tester_check_data_str_across_frames(&s_tester.peer.decode, 1, "hello", true));
+
+    ASSERT_UINT_EQUALS(1, request->on_complete_cb_count);
+    ASSERT_INT_EQUALS(AWS_ERROR_SUCCESS, request->on_complete_error_code);
+    ASSERT_TRUE(aws_http_connection_is_open(s_tester.connection));
+
+    return s_tester_clean_up();
+}
+
+/* Request body arrives after HEADERS, response is sent without a body */
+TEST_CASE(h2_server_receive_request_body) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    ASSERT_SUCCESS(s_send_request(1, "PUT", "/upload", false /*end_stream*/));
+    ASSERT_SUCCESS(h2_fake_peer_send_data_frame_str(&s_tester.peer, 1, "write ", false /*end_stream*/));
+    ASSERT_SUCCESS(h2_fake_peer_send_data_frame_str(&s_tester.peer, 1, "this", true /*end_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    ASSERT_UINT_EQUALS(1, s_tester.request_num);
+    struct tester_request *request = &s_tester.requests[0];
+    ASSERT_TRUE(request->request_done);
+    ASSERT_CURSOR_VALUE_CSTRING_EQUALS(request->method, "PUT");
+    ASSERT_BIN_ARRAYS_EQUALS("write this", 10, request->body.buffer, request->body.len);
+
+    ASSERT_SUCCESS(s_send_response(request, 204, NULL));
+
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    struct h2_decoded_frame *headers_frame =
+        h2_decode_tester_find_stream_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_HEADERS, 1, 0, NULL);
+    ASSERT_NOT_NULL(headers_frame);
+    ASSERT_TRUE(headers_frame->end_stream);
+    ASSERT_UINT_EQUALS(1, request->on_complete_cb_count);
+    ASSERT_INT_EQUALS(AWS_ERROR_SUCCESS, request->on_complete_error_code);
+
+    return s_tester_clean_up();
+}
+
+/* Several requests are in flight on one connection, and responses may be sent in any order */
+TEST_CASE(h2_server_multiplexed_requests) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    ASSERT_SUCCESS(s_send_request(1, "GET", "/a", true /*end_stream*/));
+    ASSERT_SUCCESS(s_send_request(3, "GET", "/b", true /*end_stream*/));
+    ASSERT_SUCCESS(s_send_request(5, "GET", "/c", true /*end_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    ASSERT_UINT_EQUALS(3, s_tester.request_num);
+    ASSERT_CURSOR_VALUE_CSTRING_EQUALS(s_tester.requests[0].path, "/a");
+    ASSERT_CURSOR_VALUE_CSTRING_EQUALS(s_tester.requests[1].path, "/b");
+    ASSERT_CURSOR_VALUE_CSTRING_EQUALS(s_tester.requests[2].path, "/c");
+
+    /* respond out of order */
+    ASSERT_SUCCESS(s_send_response(&s_tester.requests[2], 200, "cee"));
+    ASSERT_SUCCESS(s_send_response(&s_tester.requests[0], 200, "ay"));
+    ASSERT_UINT_EQUALS(0, s_tester.requests[1].on_complete_cb_count);
+    ASSERT_SUCCESS(s_send_response(&s_tester.requests[1], 404, NULL));
+
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    ASSERT_SUCCESS(h2_decode_tester_check_data_str_across_frames(&s_tester.peer.decode, 1, "ay", true));
+    ASSERT_SUCCESS(h2_decode_tester_check_data_str_across_frames(&s_tester.peer.decode, 5, "cee", true));
+    struct h2_decoded_frame *headers_frame =
+        h2_decode_tester_find_stream_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_HEADERS, 3, 0, NULL);
+    ASSERT_NOT_NULL(headers_frame);
+    ASSERT_TRUE(headers_frame->end_stream);
+
+    for (size_t i = 0; i < s_tester.request_num; ++i) {
+        ASSERT_UINT_EQUALS(1, s_tester.requests[i].on_complete_cb_count);
+        ASSERT_INT_EQUALS(AWS_ERROR_SUCCESS, s_tester.requests[i].on_complete_error_code);
+    }
+
+    return s_tester_clean_up();
+}
+
+/* If user doesn't create a request-handler stream, the stream is refused, but the connection carries on */
+TEST_CASE(h2_server_refuse_stream_without_handler) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    s_tester.refuse_requests = true;
+    ASSERT_SUCCESS(s_send_request(1, "GET", "/", true /*end_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    struct h2_decoded_frame *rst_stream_frame =
+        h2_decode_tester_find_stream_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_RST_STREAM, 1, 0, NULL);
+    ASSERT_NOT_NULL(rst_stream_frame);
+    ASSERT_UINT_EQUALS(AWS_HTTP2_ERR_REFUSED_STREAM, rst_stream_frame->error_code);
+
+    /* subsequent streams still work */
+    s_tester.refuse_requests = false;
+    ASSERT_SUCCESS(s_send_request(3, "GET", "/", true /*end_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_UINT_EQUALS(1, s_tester.request_num);
+    ASSERT_SUCCESS(s_send_response(&s_tester.requests[0], 200, NULL));
+    ASSERT_UINT_EQUALS(1, s_tester.requests[0].on_complete_cb_count);
+    ASSERT_TRUE(aws_http_connection_is_open(s_tester.connection));
+
+    return s_tester_clean_up();
+}
+
+/* A response to HEAD never has a body, even if the user provides one */
+TEST_CASE(h2_server_send_response_to_HEAD_request) {
+    ASSERT_SUCCESS(s_tester_init(allocator, ctx));
+
+    ASSERT_SUCCESS(s_send_request(1, "HEAD", "/", true /*end_stream*/));
+    testing_channel_drain_queued_tasks(&s_tester.testing_channel);
+    ASSERT_UINT_EQUALS(1, s_tester.request_num);
+
+    ASSERT_SUCCESS(s_send_response(&s_tester.requests[0], 200, "ignored"));
+
+    ASSERT_SUCCESS(h2_fake_peer_decode_messages_from_testing_channel(&s_tester.peer));
+    struct h2_decoded_frame *headers_frame =
+        h2_decode_tester_find_stream_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_HEADERS, 1, 0, NULL);
+    ASSERT_NOT_NULL(headers_frame);
+    ASSERT_TRUE(headers_frame->end_stream);
+    ASSERT_NULL(h2_decode_tester_find_stream_frame(&s_tester.peer.decode, AWS_H2_FRAME_T_DATA, 1, 0, NULL));
+    ASSERT_UINT_EQUALS(1, s_tester.requests[0].on_complete_cb_count);
+
+    return s_tester_clean_up();
+}
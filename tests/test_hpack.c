@@ -8,6 +8,9 @@
 
 #include <aws/http/request_response.h>
 
+#include <aws/common/clock.h>
+#include <aws/compression/huffman.h>
+
 /* #TODO test that buffer is resized if space is insufficient */
 
 AWS_TEST_CASE(hpack_encode_integer, test_hpack_encode_integer)
@@ -507,6 +510,267 @@ TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_short_buffer) {
     return AWS_OP_SUCCESS;
 }
 
+/* Huffman string containing EOS symbol (30 1's) must fail */
+TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_huffman_eos) {
+    struct decode_fixture *fixture = ctx;
+
+    uint8_t input[] = {0x84, 0xff, 0xff, 0xff, 0xff};
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_array(input, AWS_ARRAY_SIZE(input));
+
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 4));
+    bool complete;
+    ASSERT_FAILS(s_decode_string(fixture, &to_decode, &output, &complete));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    aws_byte_buf_clean_up(&output);
+    return AWS_OP_SUCCESS;
+}
+
+/* Padding longer than 7 bits must fail */
+TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_huffman_padding_too_long) {
+    struct decode_fixture *fixture = ctx;
+
+    /* "a" is 00011, followed by 11 bits of 1's */
+    uint8_t input[] = {0x82, 0x1f, 0xff};
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_array(input, AWS_ARRAY_SIZE(input));
+
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 4));
+    bool complete;
+    ASSERT_FAILS(s_decode_string(fixture, &to_decode, &output, &complete));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    aws_byte_buf_clean_up(&output);
+    return AWS_OP_SUCCESS;
+}
+
+/* Padding that isn't the most significant bits of EOS must fail */
+TEST_DECODE_ONE_BYTE_AT_A_TIME(hpack_decode_string_huffman_padding_not_eos) {
+    struct decode_fixture *fixture = ctx;
+
+    /* "a" is 00011, followed by 000 */
+    uint8_t input[] = {0x81, 0x18};
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_array(input, AWS_ARRAY_SIZE(input));
+
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 4));
+    bool complete;
+    ASSERT_FAILS(s_decode_string(fixture, &to_decode, &output, &complete));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    aws_byte_buf_clean_up(&output);
+    return AWS_OP_SUCCESS;
+}
+
+/* Simple deterministic PRNG, so failures are reproducible */
+static uint32_t s_xorshift32(uint32_t *state) {
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/* Encode with the existing encoder, then check the table-driven decoder gets back the original */
+static int s_check_huffman_round_trip(
+    struct aws_allocator *allocator,
+    struct aws_hpack_context *hpack,
+    struct aws_byte_cursor original) {
+
+    struct aws_byte_buf encoded;
+    ASSERT_SUCCESS(aws_byte_buf_init(&encoded, allocator, 0));
+    ASSERT_SUCCESS(aws_hpack_encode_string(hpack, original, &encoded));
+
+    struct aws_byte_buf decoded;
+    ASSERT_SUCCESS(aws_byte_buf_init(&decoded, allocator, 0)); /* Note buffer is initially too small */
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_buf(&encoded);
+    bool complete;
+    ASSERT_SUCCESS(aws_hpack_decode_string(hpack, &to_decode, &decoded, &complete));
+    ASSERT_TRUE(complete);
+    ASSERT_UINT_EQUALS(0, to_decode.len);
+    ASSERT_BIN_ARRAYS_EQUALS(original.ptr, original.len, decoded.buffer, decoded.len);
+
+    aws_byte_buf_clean_up(&decoded);
+    aws_byte_buf_clean_up(&encoded);
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(hpack_huffman_decode_round_trip, test_hpack_huffman_decode_round_trip)
+static int test_hpack_huffman_decode_round_trip(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    struct aws_hpack_context *hpack = aws_hpack_context_new(allocator, AWS_LS_HTTP_GENERAL, NULL);
+    ASSERT_NOT_NULL(hpack);
+    aws_hpack_set_huffman_mode(hpack, AWS_HPACK_HUFFMAN_ALWAYS);
+
+    /* Every symbol, alone and repeated (repeats exercise every padding length) */
+    uint8_t symbols[8];
+    for (size_t symbol = 0; symbol < 256; ++symbol) {
+        for (size_t len = 1; len <= AWS_ARRAY_SIZE(symbols); ++len) {
+            memset(symbols, (int)symbol, len);
+            ASSERT_SUCCESS(s_check_huffman_round_trip(allocator, hpack, aws_byte_cursor_from_array(symbols, len)));
+        }
+    }
+
+    /* Random strings, biased towards the short codes that real headers use */
+    uint32_t rng = 0x12345678;
+    uint8_t random_str[64];
+    for (size_t i = 0; i < 2000; ++i) {
+        size_t len = s_xorshift32(&rng) % AWS_ARRAY_SIZE(random_str);
+        for (size_t j = 0; j < len; ++j) {
+            uint32_t r = s_xorshift32(&rng);
+            random_str[j] = (r & 0x100) ? (uint8_t)('a' + (r % 26)) : (uint8_t)r;
+        }
+        ASSERT_SUCCESS(s_check_huffman_round_trip(allocator, hpack, aws_byte_cursor_from_array(random_str, len)));
+    }
+
+    aws_hpack_context_destroy(hpack);
+    return AWS_OP_SUCCESS;
+}
+
+/* Defined in hpack_huffman_static.c */
+struct aws_huffman_symbol_coder *hpack_get_coder(void);
+
+/* Compare the table-driven decoder against the previous bit-at-a-time decoder from aws-c-compression.
+ * Results are logged, rather than asserted, since timing in CI is noisy. */
+AWS_TEST_CASE(hpack_huffman_decode_compare_bitwise, test_hpack_huffman_decode_compare_bitwise)
+static int test_hpack_huffman_decode_compare_bitwise(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    enum { ITERATIONS = 200 };
+    const struct aws_byte_cursor plaintext = aws_byte_cursor_from_c_str(
+        "Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/537.36 (KHTML, like Gecko) "
+        "Chrome/119.0.0.0 Safari/537.36; accept-encoding: gzip, deflate, br; "
+        "cookie: session-id=123-4567890-1234567; session-token=\"Zm9vYmFyYmF6cXV4\"; "
+        "x-amz-date: 20231015T120000Z; content-type: application/x-amz-json-1.1");
+
+    struct aws_huffman_symbol_coder *coder = hpack_get_coder();
+    struct aws_huffman_encoder encoder;
+    aws_huffman_encoder_init(&encoder, coder);
+    struct aws_byte_buf encoded;
+    ASSERT_SUCCESS(aws_byte_buf_init(&encoded, allocator, aws_huffman_get_encoded_length(&encoder, plaintext)));
+    struct aws_byte_cursor to_encode = plaintext;
+    ASSERT_SUCCESS(aws_huffman_encode(&encoder, &to_encode, &encoded));
+
+    struct aws_byte_buf decoded;
+    ASSERT_SUCCESS(aws_byte_buf_init(&decoded, allocator, plaintext.len));
+
+    /* Previous bitwise decoder */
+    struct aws_huffman_decoder bitwise_decoder;
+    aws_huffman_decoder_init(&bitwise_decoder, coder);
+    uint64_t start_ns = 0;
+    uint64_t end_ns = 0;
+    ASSERT_SUCCESS(aws_high_res_clock_get_ticks(&start_ns));
+    for (size_t i = 0; i < ITERATIONS; ++i) {
+        aws_byte_buf_reset(&decoded, false);
+        aws_huffman_decoder_reset(&bitwise_decoder);
+        struct aws_byte_cursor to_decode = aws_byte_cursor_from_buf(&encoded);
+        ASSERT_SUCCESS(aws_huffman_decode(&bitwise_decoder, &to_decode, &decoded));
+    }
+    ASSERT_SUCCESS(aws_high_res_clock_get_ticks(&end_ns));
+    const uint64_t bitwise_ns = end_ns - start_ns;
+    ASSERT_BIN_ARRAYS_EQUALS(plaintext.ptr, plaintext.len, decoded.buffer, decoded.len);
+
+    /* Table-driven decoder */
+    struct aws_hpack_huffman_decoder table_decoder;
+    ASSERT_SUCCESS(aws_high_res_clock_get_ticks(&start_ns));
+    for (size_t i = 0; i < ITERATIONS; ++i) {
+        aws_byte_buf_reset(&decoded, false);
+        aws_hpack_huffman_decoder_reset(&table_decoder);
+        struct aws_byte_cursor to_decode = aws_byte_cursor_from_buf(&encoded);
+        ASSERT_SUCCESS(aws_hpack_huffman_decode(&table_decoder, &to_decode, &decoded));
+        ASSERT_SUCCESS(aws_hpack_huffman_decoder_finish(&table_decoder));
+    }
+    ASSERT_SUCCESS(aws_high_res_clock_get_ticks(&end_ns));
+    const uint64_t table_ns = end_ns - start_ns;
+    ASSERT_BIN_ARRAYS_EQUALS(plaintext.ptr, plaintext.len, decoded.buffer, decoded.len);
+
+    AWS_LOGF_INFO(
+        AWS_LS_HTTP_GENERAL,
+        "Huffman decoded %zu bytes x %d: bitwise=%" PRIu64 "ns table=%" PRIu64 "ns",
+        encoded.len,
+        (int)ITERATIONS,
+        bitwise_ns,
+        table_ns);
+
+    aws_byte_buf_clean_up(&decoded);
+    aws_byte_buf_clean_up(&encoded);
+    return AWS_OP_SUCCESS;
+}
+
+AWS_TEST_CASE(hpack_huffman_encode, test_hpack_huffman_encode)
+static int test_hpack_huffman_encode(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    /* RFC-7541 - Request Examples with Huffman Coding - C.4.1. First Request */
+    const uint8_t expected[] = {0xf1, 0xe3, 0xc2, 0xe5, 0xf2, 0x3a, 0x6b, 0xa0, 0xab, 0x90, 0xf4, 0xff};
+    struct aws_byte_cursor plaintext = aws_byte_cursor_from_c_str("www.example.com");
+    ASSERT_UINT_EQUALS(AWS_ARRAY_SIZE(expected), aws_hpack_huffman_get_encoded_length(plaintext));
+
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 1)); /* Note buffer is initially too small */
+    ASSERT_SUCCESS(aws_hpack_huffman_encode(plaintext, &output));
+    ASSERT_BIN_ARRAYS_EQUALS(expected, AWS_ARRAY_SIZE(expected), output.buffer, output.len);
+
+    /* Check random strings against the bitwise encoder from aws-c-compression.
+     * Long strings exercise the accumulator flushing 32 bits at a time. */
+    struct aws_huffman_encoder bitwise_encoder;
+    aws_huffman_encoder_init(&bitwise_encoder, hpack_get_coder());
+    struct aws_byte_buf bitwise_output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&bitwise_output, allocator, 1024));
+
+    uint32_t rng = 0x9e3779b9;
+    uint8_t random_str[256];
+    for (size_t i = 0; i < 2000; ++i) {
+        size_t len = s_xorshift32(&rng) % AWS_ARRAY_SIZE(random_str);
+        for (size_t j = 0; j < len; ++j) {
+            random_str[j] = (uint8_t)s_xorshift32(&rng);
+        }
+        struct aws_byte_cursor to_encode = aws_byte_cursor_from_array(random_str, len);
+
+        aws_byte_buf_reset(&output, false);
+        ASSERT_SUCCESS(aws_hpack_huffman_encode(to_encode, &output));
+        ASSERT_UINT_EQUALS(output.len, aws_hpack_huffman_get_encoded_length(to_encode));
+
+        aws_byte_buf_reset(&bitwise_output, false);
+        aws_huffman_encoder_reset(&bitwise_encoder);
+        ASSERT_SUCCESS(aws_huffman_encode(&bitwise_encoder, &to_encode, &bitwise_output));
+        ASSERT_BIN_ARRAYS_EQUALS(bitwise_output.buffer, bitwise_output.len, output.buffer, output.len);
+    }
+
+    aws_byte_buf_clean_up(&bitwise_output);
+    aws_byte_buf_clean_up(&output);
+    return AWS_OP_SUCCESS;
+}
+
+/* In SMALLEST mode, strings are only Huffman encoded if that makes them shorter */
+AWS_TEST_CASE(hpack_encode_string_huffman_smallest, test_hpack_encode_string_huffman_smallest)
+static int test_hpack_encode_string_huffman_smallest(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+    struct aws_hpack_context *hpack = aws_hpack_context_new(allocator, AWS_LS_HTTP_GENERAL, NULL);
+    ASSERT_NOT_NULL(hpack);
+    aws_hpack_set_huffman_mode(hpack, AWS_HPACK_HUFFMAN_SMALLEST);
+
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 0));
+
+    /* Lowercase compresses well, so it's Huffman encoded */
+    ASSERT_SUCCESS(aws_hpack_encode_string(hpack, aws_byte_cursor_from_c_str("www.example.com"), &output));
+    ASSERT_UINT_EQUALS(0x8c, output.buffer[0]);
+    ASSERT_UINT_EQUALS(13, output.len);
+
+    /* Control characters have long codes, so they're sent raw */
+    const uint8_t control[] = {0x01, 0x02, 0x03};
+    aws_byte_buf_reset(&output, false);
+    ASSERT_SUCCESS(aws_hpack_encode_string(hpack, aws_byte_cursor_from_array(control, sizeof(control)), &output));
+    ASSERT_UINT_EQUALS(0x03, output.buffer[0]);
+    ASSERT_BIN_ARRAYS_EQUALS(control, sizeof(control), output.buffer + 1, output.len - 1);
+
+    aws_byte_buf_clean_up(&output);
+    aws_hpack_context_destroy(hpack);
+    return AWS_OP_SUCCESS;
+}
+
 #define DEFINE_STATIC_HEADER(_name, _header, _value)                                                                   \
     static const struct aws_http_header _name = {                                                                      \
         .name = AWS_BYTE_CUR_INIT_FROM_STRING_LITERAL(_header),                                                        \
@@ -876,3 +1140,712 @@ static int test_hpack_dynamic_table_size_update_from_setting(struct aws_allocato
     aws_http_library_clean_up();
     return AWS_OP_SUCCESS;
 }
+
+/* Encode a header-block, then check that a separate decoder context gets back the same headers */
+static int s_encode_and_check_header_block(
+    struct aws_allocator *allocator,
+    struct aws_hpack_context *encoder,
+    struct aws_hpack_context *decoder,
+    const struct aws_http_headers *headers,
+    size_t *out_encoded_len) {
+
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 0));
+    ASSERT_SUCCESS(aws_hpack_encode_header_block(encoder, headers, &output));
+    *out_encoded_len = output.len;
+
+    struct aws_byte_cursor to_decode = aws_byte_cursor_from_buf(&output);
+    size_t num_decoded = 0;
+    while (to_decode.len) {
+        struct aws_hpack_decode_result result;
+        ASSERT_SUCCESS(aws_hpack_decode(decoder, &to_decode, &result));
+        if (result.type != AWS_HPACK_DECODE_T_HEADER_FIELD) {
+            continue;
+        }
+
+        struct aws_http_header expected;
+        ASSERT_SUCCESS(aws_http_headers_get_index(headers, num_decoded++, &expected));
+        ASSERT_BIN_ARRAYS_EQUALS(
+            expected.name.ptr, expected.name.len, result.data.header_field.name.ptr, result.data.header_field.name.len);
+        ASSERT_BIN_ARRAYS_EQUALS(
+            expected.value.ptr,
+            expected.value.len,
+            result.data.header_field.value.ptr,
+            result.data.header_field.value.len);
+    }
+    ASSERT_UINT_EQUALS(aws_http_headers_count(headers), num_decoded);
+
+    aws_byte_buf_clean_up(&output);
+    return AWS_OP_SUCCESS;
+}
+
+/* A huge SETTINGS_HEADER_TABLE_SIZE from the peer must not make us allocate a huge table up front */
+AWS_TEST_CASE(hpack_dynamic_table_grows_on_demand, test_hpack_dynamic_table_grows_on_demand)
+static int test_hpack_dynamic_table_grows_on_demand(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_allocator *tracer = aws_mem_tracer_new(allocator, NULL, AWS_MEMTRACE_BYTES, 0);
+    ASSERT_NOT_NULL(tracer);
+
+    struct aws_hpack_context *context = aws_hpack_context_new(tracer, AWS_LS_HTTP_ENCODER, NULL);
+    ASSERT_NOT_NULL(context);
+    const size_t empty_bytes = aws_mem_tracer_bytes(tracer);
+
+    /* Peer allows the biggest table we support */
+    aws_hpack_set_max_table_size(context, 16 * 1024 * 1024);
+
+    struct aws_http_headers *headers = aws_http_headers_new(allocator);
+    ASSERT_SUCCESS(aws_http_headers_add(
+        headers, aws_byte_cursor_from_c_str("x-custom-header"), aws_byte_cursor_from_c_str("custom-value")));
+    struct aws_byte_buf output;
+    ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 64));
+    ASSERT_SUCCESS(aws_hpack_encode_header_block(context, headers, &output));
+    ASSERT_UINT_EQUALS(1, aws_hpack_get_dynamic_table_num_elements(context));
+
+    /* Storage is sized to what the table holds, not what it may hold */
+    ASSERT_TRUE(aws_mem_tracer_bytes(tracer) - empty_bytes < 4 * 1024);
+
+    /* The table keeps growing as entries are inserted */
+    char name_buf[32];
+    for (size_t i = 0; i < 1000; ++i) {
+        snprintf(name_buf, sizeof(name_buf), "x-header-%zu", i);
+        struct aws_http_header header = {
+            .name = aws_byte_cursor_from_c_str(name_buf),
+            .value = aws_byte_cursor_from_c_str("value"),
+        };
+        ASSERT_SUCCESS(aws_hpack_insert_header(context, &header));
+    }
+    ASSERT_UINT_EQUALS(1001, aws_hpack_get_dynamic_table_num_elements(context));
+    for (size_t i = 0; i < 1000; ++i) {
+        snprintf(name_buf, sizeof(name_buf), "x-header-%zu", 999 - i);
+        const struct aws_http_header *entry = aws_hpack_get_header(context, 62 + i);
+        ASSERT_NOT_NULL(entry);
+        ASSERT_CURSOR_VALUE_CSTRING_EQUALS(entry->name, name_buf);
+        ASSERT_CURSOR_VALUE_CSTRING_EQUALS(entry->value, "value");
+    }
+    const struct aws_http_header *oldest = aws_hpack_get_header(context, 62 + 1000);
+    ASSERT_NOT_NULL(oldest);
+    ASSERT_CURSOR_VALUE_CSTRING_EQUALS(oldest->name, "x-custom-header");
+    ASSERT_TRUE(aws_mem_tracer_bytes(tracer) - empty_bytes < 1024 * 1024);
+
+    /* Shrinking the table gives back storage it can no longer use */
+    const size_t full_bytes = aws_mem_tracer_bytes(tracer);
+    ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(context, 0));
+    ASSERT_UINT_EQUALS(0, aws_hpack_get_dynamic_table_num_elements(context));
+    ASSERT_TRUE(aws_mem_tracer_bytes(tracer) < full_bytes);
+
+    aws_byte_buf_clean_up(&output);
+    aws_http_headers_release(headers);
+    aws_hpack_context_destroy(context);
+    ASSERT_UINT_EQUALS(0, aws_mem_tracer_bytes(tracer));
+    aws_mem_tracer_destroy(tracer);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* A wrapped insert can end exactly where the oldest live strings begin, filling the string ring.
+ * The next insert must treat the ring as full, rather than empty, and not overwrite live entries. */
+AWS_TEST_CASE(hpack_dynamic_table_full_string_ring, test_hpack_dynamic_table_full_string_ring)
+static int test_hpack_dynamic_table_full_string_ring(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_context *context = aws_hpack_context_new(allocator, AWS_LS_HTTP_DECODER, NULL);
+    ASSERT_NOT_NULL(context);
+    ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(context, 300));
+
+    /* The string ring starts at 256 bytes. The 3rd header evicts the 1st and wraps to the start of the ring,
+     * ending where the 2nd header's strings begin. The 4th header fits in the table without evicting anything. */
+    const size_t strings_lens[] = {100, 64, 100, 40};
+    uint8_t strings[AWS_ARRAY_SIZE(strings_lens)][100];
+    struct aws_http_header headers[AWS_ARRAY_SIZE(strings_lens)];
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(strings_lens); ++i) {
+        const size_t len = strings_lens[i];
+        memset(strings[i], 'a' + (int)i, len);
+        AWS_ZERO_STRUCT(headers[i]);
+        headers[i].name = aws_byte_cursor_from_array(strings[i], len / 2);
+        headers[i].value = aws_byte_cursor_from_array(strings[i] + len / 2, len - len / 2);
+        ASSERT_SUCCESS(aws_hpack_insert_header(context, &headers[i]));
+    }
+
+    /* The 1st header was evicted, the rest are intact, newest first */
+    ASSERT_UINT_EQUALS(3, aws_hpack_get_dynamic_table_num_elements(context));
+    for (size_t i = 0; i < 3; ++i) {
+        const struct aws_http_header *expected = &headers[3 - i];
+        const struct aws_http_header *entry = aws_hpack_get_header(context, 62 + i);
+        ASSERT_NOT_NULL(entry);
+        ASSERT_BIN_ARRAYS_EQUALS(expected->name.ptr, expected->name.len, entry->name.ptr, entry->name.len);
+        ASSERT_BIN_ARRAYS_EQUALS(expected->value.ptr, expected->value.len, entry->value.ptr, entry->value.len);
+
+        bool found_value = false;
+        ASSERT_UINT_EQUALS(62 + i, aws_hpack_find_index(context, expected, true, &found_value));
+        ASSERT_TRUE(found_value);
+    }
+
+    aws_hpack_context_destroy(context);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* Insert headers of random sizes, so entries are evicted and the rings wrap and grow in every way they can.
+ * After each insert, every live entry must be intact and found at its index. */
+AWS_TEST_CASE(hpack_dynamic_table_random_insert_evict, test_hpack_dynamic_table_random_insert_evict)
+static int test_hpack_dynamic_table_random_insert_evict(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+
+    enum { NUM_INSERTS = 2000, MAX_VALUE_LEN = 200 };
+    size_t *value_lens = aws_mem_calloc(allocator, NUM_INSERTS, sizeof(size_t));
+    ASSERT_NOT_NULL(value_lens);
+    uint8_t value_buf[MAX_VALUE_LEN];
+    char name_buf[16];
+
+    const size_t table_sizes[] = {300, 1000, 4096};
+    uint32_t rng = 0xBADF00D;
+    for (size_t t = 0; t < AWS_ARRAY_SIZE(table_sizes); ++t) {
+        struct aws_hpack_context *context = aws_hpack_context_new(allocator, AWS_LS_HTTP_DECODER, NULL);
+        ASSERT_NOT_NULL(context);
+        ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(context, table_sizes[t]));
+
+        size_t oldest = 0;
+        size_t table_size = 0;
+        for (size_t i = 0; i < NUM_INSERTS; ++i) {
+            /* Unique names, so each entry has exactly one index */
+            int name_len = snprintf(name_buf, sizeof(name_buf), "h%zu", i);
+            value_lens[i] = s_xorshift32(&rng) % (MAX_VALUE_LEN + 1);
+            memset(value_buf, 'a' + (int)(i % 26), value_lens[i]);
+            struct aws_http_header header = {
+                .name = aws_byte_cursor_from_array(name_buf, (size_t)name_len),
+                .value = aws_byte_cursor_from_array(value_buf, value_lens[i]),
+            };
+            ASSERT_SUCCESS(aws_hpack_insert_header(context, &header));
+
+            /* Evict our own copy the same way the table does, oldest first */
+            table_size += aws_hpack_get_header_size(&header);
+            while (table_size > table_sizes[t]) {
+                name_len = snprintf(name_buf, sizeof(name_buf), "h%zu", oldest);
+                table_size -= (size_t)name_len + value_lens[oldest] + 32;
+                ++oldest;
+            }
+            ASSERT_UINT_EQUALS(i + 1 - oldest, aws_hpack_get_dynamic_table_num_elements(context));
+
+            for (size_t id = oldest; id <= i; ++id) {
+                const size_t index = 62 + (i - id);
+                const struct aws_http_header *entry = aws_hpack_get_header(context, index);
+                ASSERT_NOT_NULL(entry);
+                snprintf(name_buf, sizeof(name_buf), "h%zu", id);
+                ASSERT_CURSOR_VALUE_CSTRING_EQUALS(entry->name, name_buf);
+                ASSERT_UINT_EQUALS(value_lens[id], entry->value.len);
+                for (size_t b = 0; b < entry->value.len; ++b) {
+                    ASSERT_UINT_EQUALS('a' + (id % 26), entry->value.ptr[b]);
+                }
+
+                bool found_value = false;
+                ASSERT_UINT_EQUALS(index, aws_hpack_find_index(context, entry, true, &found_value));
+                ASSERT_TRUE(found_value);
+            }
+        }
+
+        aws_hpack_context_destroy(context);
+    }
+
+    aws_mem_release(allocator, value_lens);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* Repeated headers should be sent as indexes, even as other headers shift their position in the dynamic table */
+AWS_TEST_CASE(hpack_encoder_cache_repeated_header_blocks, test_hpack_encoder_cache_repeated_header_blocks)
+static int test_hpack_encoder_cache_repeated_header_blocks(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_context *encoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_ENCODER, NULL);
+    ASSERT_NOT_NULL(encoder);
+    struct aws_hpack_context *decoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_DECODER, NULL);
+    ASSERT_NOT_NULL(decoder);
+
+    DEFINE_STATIC_HEADER(method, ":method", "GET");
+    DEFINE_STATIC_HEADER(scheme, ":scheme", "https");
+    DEFINE_STATIC_HEADER(authority, ":authority", "example.com");
+    DEFINE_STATIC_HEADER(user_agent, "user-agent", "aws-c-http");
+    struct aws_http_header authorization = {
+        .name = aws_byte_cursor_from_c_str("authorization"),
+        .value = aws_byte_cursor_from_c_str("secret"),
+        .compression = AWS_HTTP_HEADER_COMPRESSION_NO_FORWARD_CACHE,
+    };
+
+    size_t first_len = 0;
+    size_t prev_len = 0;
+    for (int i = 0; i < 20; ++i) {
+        char path[16];
+        snprintf(path, sizeof(path), "/%d", i);
+
+        struct aws_http_headers *headers = aws_http_headers_new(allocator);
+        ASSERT_SUCCESS(aws_http_headers_add_header(headers, &method));
+        ASSERT_SUCCESS(aws_http_headers_add_header(headers, &scheme));
+        ASSERT_SUCCESS(aws_http_headers_add_header(headers, &authority));
+        /* :path changes every time, and is inserted into the dynamic table, shifting older entries */
+        ASSERT_SUCCESS(
+            aws_http_headers_add(headers, aws_byte_cursor_from_c_str(":path"), aws_byte_cursor_from_c_str(path)));
+        ASSERT_SUCCESS(aws_http_headers_add_header(headers, &user_agent));
+        ASSERT_SUCCESS(aws_http_headers_add_header(headers, &authorization));
+
+        size_t encoded_len = 0;
+        ASSERT_SUCCESS(s_encode_and_check_header_block(allocator, encoder, decoder, headers, &encoded_len));
+        if (i == 0) {
+            first_len = encoded_len;
+        } else {
+            ASSERT_TRUE(encoded_len < first_len);
+            if (i > 1) {
+                /* Once everything is cached, only :path differs */
+                ASSERT_TRUE(encoded_len <= prev_len + 1);
+            }
+        }
+        prev_len = encoded_len;
+
+        aws_http_headers_release(headers);
+    }
+
+    aws_hpack_context_destroy(decoder);
+    aws_hpack_context_destroy(encoder);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* Cached indexes must not be used after their dynamic table entry is evicted */
+AWS_TEST_CASE(hpack_encoder_cache_eviction, test_hpack_encoder_cache_eviction)
+static int test_hpack_encoder_cache_eviction(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_context *encoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_ENCODER, NULL);
+    ASSERT_NOT_NULL(encoder);
+    struct aws_hpack_context *decoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_DECODER, NULL);
+    ASSERT_NOT_NULL(decoder);
+
+    /* Table only has room for 1 of these headers at a time.
+     * So inserting the filler evicts "a: 1", even though "a: 1" is unchanged in its slot */
+    ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(encoder, 100));
+    ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(decoder, 100));
+    DEFINE_STATIC_HEADER(stable, "a", "1");
+
+    for (int i = 0; i < 10; ++i) {
+        char filler[48];
+        snprintf(filler, sizeof(filler), "%040d", i);
+
+        struct aws_http_headers *headers = aws_http_headers_new(allocator);
+        ASSERT_SUCCESS(aws_http_headers_add_header(headers, &stable));
+        ASSERT_SUCCESS(
+            aws_http_headers_add(headers, aws_byte_cursor_from_c_str("filler"), aws_byte_cursor_from_c_str(filler)));
+
+        size_t encoded_len = 0;
+        ASSERT_SUCCESS(s_encode_and_check_header_block(allocator, encoder, decoder, headers, &encoded_len));
+        ASSERT_UINT_EQUALS(1, aws_hpack_get_dynamic_table_num_elements(encoder));
+
+        aws_http_headers_release(headers);
+    }
+
+    aws_hpack_context_destroy(decoder);
+    aws_hpack_context_destroy(encoder);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* Fill headers with a random mix of new, repeated, and empty-value headers */
+static int s_add_churn_headers(struct aws_http_headers *headers, uint32_t *rng, size_t num_headers) {
+    static const char s_value_chars[] = "abcdefghijklmnopqrstuvwxyz0123456789-_/";
+    char name[32];
+    char value[400]; /* Small enough that every header fits in the smallest table tested */
+
+    for (size_t i = 0; i < num_headers; ++i) {
+        /* Small pool of names, so names repeat with different values */
+        snprintf(name, sizeof(name), "x-churn-%u", (unsigned)(s_xorshift32(rng) % 16));
+
+        /* Small pool of seeds for short values, so some headers repeat exactly */
+        size_t value_len = 0;
+        uint32_t value_rng = s_xorshift32(rng);
+        switch (value_rng % 4) {
+            case 0:
+                value_len = 0;
+                break;
+            case 1:
+                value_rng = (value_rng % 8) + 1;
+                value_len = value_rng;
+                break;
+            default:
+                value_len = s_xorshift32(rng) % sizeof(value);
+                break;
+        }
+        for (size_t c = 0; c < value_len; ++c) {
+            value[c] = s_value_chars[s_xorshift32(&value_rng) % (sizeof(s_value_chars) - 1)];
+        }
+
+        ASSERT_SUCCESS(aws_http_headers_add(
+            headers, aws_byte_cursor_from_c_str(name), aws_byte_cursor_from_array(value, value_len)));
+    }
+    return AWS_OP_SUCCESS;
+}
+
+/* Lots of insertions and evictions, encoder and decoder dynamic tables must stay identical */
+AWS_TEST_CASE(hpack_dynamic_table_churn, test_hpack_dynamic_table_churn)
+static int test_hpack_dynamic_table_churn(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+
+    const size_t table_sizes[] = {4096, 64 * 1024, 1000};
+    uint32_t rng = 0xC0FFEE;
+    for (size_t t = 0; t < AWS_ARRAY_SIZE(table_sizes); ++t) {
+        struct aws_hpack_context *encoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_ENCODER, NULL);
+        ASSERT_NOT_NULL(encoder);
+        struct aws_hpack_context *decoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_DECODER, NULL);
+        ASSERT_NOT_NULL(decoder);
+        ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(encoder, table_sizes[t]));
+        ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(decoder, table_sizes[t]));
+
+        for (int block = 0; block < 300; ++block) {
+            struct aws_http_headers *headers = aws_http_headers_new(allocator);
+            ASSERT_SUCCESS(s_add_churn_headers(headers, &rng, 1 + s_xorshift32(&rng) % 12));
+
+            size_t encoded_len = 0;
+            ASSERT_SUCCESS(s_encode_and_check_header_block(allocator, encoder, decoder, headers, &encoded_len));
+
+            /* Every entry should match, from newest to oldest */
+            const size_t num_elements = aws_hpack_get_dynamic_table_num_elements(encoder);
+            ASSERT_UINT_EQUALS(num_elements, aws_hpack_get_dynamic_table_num_elements(decoder));
+            for (size_t i = 0; i < num_elements; ++i) {
+                const struct aws_http_header *encoder_entry = aws_hpack_get_header(encoder, 62 + i);
+                const struct aws_http_header *decoder_entry = aws_hpack_get_header(decoder, 62 + i);
+                ASSERT_NOT_NULL(encoder_entry);
+                ASSERT_NOT_NULL(decoder_entry);
+                ASSERT_TRUE(aws_byte_cursor_eq(&encoder_entry->name, &decoder_entry->name));
+                ASSERT_TRUE(aws_byte_cursor_eq(&encoder_entry->value, &decoder_entry->value));
+
+                /* Reverse lookup must find the entry at this index, or a newer copy of it */
+                bool found_value = false;
+                size_t found_index = aws_hpack_find_index(encoder, encoder_entry, true, &found_value);
+                ASSERT_TRUE(found_index != 0);
+                ASSERT_TRUE(found_index <= 62 + i);
+                const struct aws_http_header *found = aws_hpack_get_header(encoder, found_index);
+                ASSERT_TRUE(aws_byte_cursor_eq(&found->name, &encoder_entry->name));
+            }
+
+            /* Occasionally resize, which repacks the tables */
+            if (block % 100 == 99) {
+                const size_t new_size = (block / 100) % 2 ? table_sizes[t] : table_sizes[t] / 2;
+                ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(encoder, new_size));
+                ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(decoder, new_size));
+            }
+
+            aws_http_headers_release(headers);
+        }
+
+        aws_hpack_context_destroy(decoder);
+        aws_hpack_context_destroy(encoder);
+    }
+
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* Not a pass/fail test, logs how long it takes to encode and decode with a lot of dynamic table churn */
+AWS_TEST_CASE(hpack_dynamic_table_throughput, test_hpack_dynamic_table_throughput)
+static int test_hpack_dynamic_table_throughput(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+
+    enum { BLOCKS = 1000 };
+    const size_t table_sizes[] = {4096, 64 * 1024};
+    for (size_t t = 0; t < AWS_ARRAY_SIZE(table_sizes); ++t) {
+        struct aws_hpack_context *encoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_ENCODER, NULL);
+        ASSERT_NOT_NULL(encoder);
+        struct aws_hpack_context *decoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_DECODER, NULL);
+        ASSERT_NOT_NULL(decoder);
+        ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(encoder, table_sizes[t]));
+        ASSERT_SUCCESS(aws_hpack_resize_dynamic_table(decoder, table_sizes[t]));
+
+        /* Build the header-blocks up front, so only HPACK is timed */
+        uint32_t rng = 0xBEEF;
+        struct aws_http_headers *blocks[BLOCKS];
+        for (size_t i = 0; i < BLOCKS; ++i) {
+            blocks[i] = aws_http_headers_new(allocator);
+            ASSERT_SUCCESS(s_add_churn_headers(blocks[i], &rng, 10));
+        }
+
+        struct aws_byte_buf output;
+        ASSERT_SUCCESS(aws_byte_buf_init(&output, allocator, 0));
+        size_t num_decoded = 0;
+        uint64_t start_ns = 0;
+        uint64_t end_ns = 0;
+        ASSERT_SUCCESS(aws_high_res_clock_get_ticks(&start_ns));
+        for (size_t i = 0; i < BLOCKS; ++i) {
+            aws_byte_buf_reset(&output, false);
+            ASSERT_SUCCESS(aws_hpack_encode_header_block(encoder, blocks[i], &output));
+            struct aws_byte_cursor to_decode = aws_byte_cursor_from_buf(&output);
+            while (to_decode.len) {
+                struct aws_hpack_decode_result result;
+                ASSERT_SUCCESS(aws_hpack_decode(decoder, &to_decode, &result));
+                if (result.type == AWS_HPACK_DECODE_T_HEADER_FIELD) {
+                    num_decoded++;
+                }
+            }
+        }
+        ASSERT_SUCCESS(aws_high_res_clock_get_ticks(&end_ns));
+        ASSERT_UINT_EQUALS(BLOCKS * 10, num_decoded);
+
+        AWS_LOGF_INFO(
+            AWS_LS_HTTP_GENERAL,
+            "HPACK %zu byte dynamic table: encoded and decoded %d header-blocks in %" PRIu64 "ns",
+            table_sizes[t],
+            (int)BLOCKS,
+            end_ns - start_ns);
+
+        aws_byte_buf_clean_up(&output);
+        for (size_t i = 0; i < BLOCKS; ++i) {
+            aws_http_headers_release(blocks[i]);
+        }
+        aws_hpack_context_destroy(decoder);
+        aws_hpack_context_destroy(encoder);
+    }
+
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* SELECTIVE policy doesn't insert known high-entropy headers, or headers too big for the table */
+AWS_TEST_CASE(hpack_indexing_policy_selective, test_hpack_indexing_policy_selective)
+static int test_hpack_indexing_policy_selective(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_context *encoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_ENCODER, NULL);
+    ASSERT_NOT_NULL(encoder);
+    struct aws_hpack_context *decoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_DECODER, NULL);
+    ASSERT_NOT_NULL(decoder);
+    ASSERT_SUCCESS(aws_hpack_set_indexing_policy(encoder, AWS_HTTP2_HPACK_INDEXING_SELECTIVE));
+
+    char big_value[3000];
+    memset(big_value, 'a', sizeof(big_value));
+
+    struct aws_http_headers *headers = aws_http_headers_new(allocator);
+    ASSERT_SUCCESS(aws_http_headers_add(
+        headers, aws_byte_cursor_from_c_str("x-amz-date"), aws_byte_cursor_from_c_str("20231015T120000Z")));
+    ASSERT_SUCCESS(aws_http_headers_add(
+        headers, aws_byte_cursor_from_c_str("Authorization"), aws_byte_cursor_from_c_str("AWS4-HMAC-SHA256 abc")));
+    ASSERT_SUCCESS(aws_http_headers_add(
+        headers, aws_byte_cursor_from_c_str("x-big"), aws_byte_cursor_from_array(big_value, sizeof(big_value))));
+    ASSERT_SUCCESS(
+        aws_http_headers_add(headers, aws_byte_cursor_from_c_str("x-stable"), aws_byte_cursor_from_c_str("yes")));
+
+    size_t encoded_len = 0;
+    ASSERT_SUCCESS(s_encode_and_check_header_block(allocator, encoder, decoder, headers, &encoded_len));
+
+    /* Only x-stable was inserted */
+    ASSERT_UINT_EQUALS(1, aws_hpack_get_dynamic_table_num_elements(encoder));
+    ASSERT_UINT_EQUALS(1, aws_hpack_get_dynamic_table_num_elements(decoder));
+    const struct aws_http_header *entry = aws_hpack_get_header(encoder, 62);
+    ASSERT_CURSOR_VALUE_CSTRING_EQUALS(entry->name, "x-stable");
+
+    struct aws_hpack_encoder_stats stats;
+    aws_hpack_get_encoder_stats(encoder, &stats);
+    ASSERT_UINT_EQUALS(4, stats.num_headers);
+    ASSERT_UINT_EQUALS(1, stats.num_inserted);
+    ASSERT_UINT_EQUALS(3, stats.num_skipped_by_policy);
+    ASSERT_UINT_EQUALS(0, stats.num_indexed);
+    ASSERT_UINT_EQUALS(encoded_len, stats.encoded_bytes);
+
+    /* Unknown policy is rejected */
+    ASSERT_FAILS(aws_hpack_set_indexing_policy(encoder, (enum aws_http2_hpack_indexing_policy)99));
+    ASSERT_INT_EQUALS(AWS_ERROR_INVALID_ARGUMENT, aws_last_error());
+
+    aws_http_headers_release(headers);
+    aws_hpack_context_destroy(decoder);
+    aws_hpack_context_destroy(encoder);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* Encode header-blocks of a single header, with the value chosen by a callback */
+static int s_encode_single_header_blocks(
+    struct aws_allocator *allocator,
+    enum aws_http2_hpack_indexing_policy policy,
+    const char *name,
+    const char *(*get_value)(int i, char *buf, size_t buf_size),
+    int num_blocks,
+    struct aws_hpack_encoder_stats *out_stats) {
+
+    struct aws_hpack_context *encoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_ENCODER, NULL);
+    ASSERT_NOT_NULL(encoder);
+    struct aws_hpack_context *decoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_DECODER, NULL);
+    ASSERT_NOT_NULL(decoder);
+    ASSERT_SUCCESS(aws_hpack_set_indexing_policy(encoder, policy));
+
+    for (int i = 0; i < num_blocks; ++i) {
+        char value_buf[64];
+        const char *value = get_value(i, value_buf, sizeof(value_buf));
+
+        struct aws_http_headers *headers = aws_http_headers_new(allocator);
+        ASSERT_SUCCESS(
+            aws_http_headers_add(headers, aws_byte_cursor_from_c_str(name), aws_byte_cursor_from_c_str(value)));
+
+        size_t encoded_len = 0;
+        ASSERT_SUCCESS(s_encode_and_check_header_block(allocator, encoder, decoder, headers, &encoded_len));
+        aws_http_headers_release(headers);
+    }
+
+    aws_hpack_get_encoder_stats(encoder, out_stats);
+    aws_hpack_context_destroy(decoder);
+    aws_hpack_context_destroy(encoder);
+    return AWS_OP_SUCCESS;
+}
+
+static const char *s_get_unique_value(int i, char *buf, size_t buf_size) {
+    snprintf(buf, buf_size, "%032d-%08d", i * 7919, i);
+    return buf;
+}
+
+/* The encoder cache replays identical headers in the same position, so alternate between 2 values */
+static const char *s_get_repeating_value(int i, char *buf, size_t buf_size) {
+    (void)buf;
+    (void)buf_size;
+    return i % 2 ? "value-one" : "value-two";
+}
+
+/* ADAPTIVE policy stops indexing names whose entries are never reused, but keeps indexing ones that are */
+AWS_TEST_CASE(hpack_indexing_policy_adaptive, test_hpack_indexing_policy_adaptive)
+static int test_hpack_indexing_policy_adaptive(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_encoder_stats stats;
+
+    /* ALL policy indexes every unique value */
+    ASSERT_SUCCESS(s_encode_single_header_blocks(
+        allocator, AWS_HTTP2_HPACK_INDEXING_ALL, "x-request-id", s_get_unique_value, 100, &stats));
+    ASSERT_UINT_EQUALS(100, stats.num_inserted);
+    ASSERT_UINT_EQUALS(0, stats.num_skipped_by_policy);
+
+    /* ADAPTIVE policy gives up once it's seen enough insertions that were never reused */
+    ASSERT_SUCCESS(s_encode_single_header_blocks(
+        allocator, AWS_HTTP2_HPACK_INDEXING_ADAPTIVE, "x-request-id", s_get_unique_value, 100, &stats));
+    ASSERT_TRUE(stats.num_inserted < 100);
+    ASSERT_UINT_EQUALS(100, stats.num_inserted + stats.num_skipped_by_policy);
+
+    /* ADAPTIVE policy keeps indexing a name whose entries get reused */
+    ASSERT_SUCCESS(s_encode_single_header_blocks(
+        allocator, AWS_HTTP2_HPACK_INDEXING_ADAPTIVE, "x-reused", s_get_repeating_value, 100, &stats));
+    ASSERT_UINT_EQUALS(2, stats.num_inserted);
+    ASSERT_UINT_EQUALS(98, stats.num_indexed);
+    ASSERT_UINT_EQUALS(0, stats.num_skipped_by_policy);
+
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
+
+/* Encode the same single-header block num_blocks times */
+static int s_encode_repeated_header_block(
+    struct aws_allocator *allocator,
+    struct aws_hpack_context *encoder,
+    struct aws_hpack_context *decoder,
+    struct aws_byte_cursor name,
+    struct aws_byte_cursor value,
+    int num_blocks) {
+
+    struct aws_http_headers *headers = aws_http_headers_new(allocator);
+    ASSERT_SUCCESS(aws_http_headers_add(headers, name, value));
+    for (int i = 0; i < num_blocks; ++i) {
+        size_t encoded_len = 0;
+        ASSERT_SUCCESS(s_encode_and_check_header_block(allocator, encoder, decoder, headers, &encoded_len));
+    }
+    aws_http_headers_release(headers);
+    return AWS_OP_SUCCESS;
+}
+
+/* A header the indexing policy turned down must be asked about again each time, not replayed from the encoder cache */
+AWS_TEST_CASE(hpack_indexing_policy_not_cached, test_hpack_indexing_policy_not_cached)
+static int test_hpack_indexing_policy_not_cached(struct aws_allocator *allocator, void *ctx) {
+    (void)ctx;
+
+    aws_http_library_init(allocator);
+    struct aws_hpack_context *encoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_ENCODER, NULL);
+    ASSERT_NOT_NULL(encoder);
+    struct aws_hpack_context *decoder = aws_hpack_context_new(allocator, AWS_LS_HTTP_DECODER, NULL);
+    ASSERT_NOT_NULL(decoder);
+    ASSERT_SUCCESS(aws_hpack_set_indexing_policy(encoder, AWS_HTTP2_HPACK_INDEXING_ADAPTIVE));
+    struct aws_hpack_encoder_stats stats;
+
+    /* Every repeat of a never-indexed header counts as skipped */
+    ASSERT_SUCCESS(s_encode_repeated_header_block(
+        allocator,
+        encoder,
+        decoder,
+        aws_byte_cursor_from_c_str("x-amz-date"),
+        aws_byte_cursor_from_c_str("20231015T120000Z"),
+        3));
+    aws_hpack_get_encoder_stats(encoder, &stats);
+    ASSERT_UINT_EQUALS(3, stats.num_skipped_by_policy);
+    ASSERT_UINT_EQUALS(0, stats.num_inserted);
+
+    /* Unique values get the name locked out of indexing */
+    for (int i = 0; i < 20; ++i) {
+        char value_buf[64];
+        ASSERT_SUCCESS(s_encode_repeated_header_block(
+            allocator,
+            encoder,
+            decoder,
+            aws_byte_cursor_from_c_str("x-request-id"),
+            aws_byte_cursor_from_c_str(s_get_unique_value(i, value_buf, sizeof(value_buf))),
+            1));
+    }
+    struct aws_hpack_encoder_stats locked_out_stats;
+    aws_hpack_get_encoder_stats(encoder, &locked_out_stats);
+    ASSERT_TRUE(locked_out_stats.num_skipped_by_policy > stats.num_skipped_by_policy);
+
+    /* Once the value settles down, the name gets another chance, then is sent as an index */
+    ASSERT_SUCCESS(s_encode_repeated_header_block(
+        allocator,
+        encoder,
+        decoder,
+        aws_byte_cursor_from_c_str("x-request-id"),
+        aws_byte_cursor_from_c_str("steady"),
+        300));
+    aws_hpack_get_encoder_stats(encoder, &stats);
+    ASSERT_UINT_EQUALS(locked_out_stats.num_inserted + 1, stats.num_inserted);
+    ASSERT_TRUE(stats.num_indexed > locked_out_stats.num_indexed);
+
+    /* A header too big for half the table is turned down, until the table grows */
+    char big_value[600];
+    memset(big_value, 'b', sizeof(big_value));
+    aws_hpack_set_max_table_size(encoder, 1000);
+    ASSERT_SUCCESS(s_encode_repeated_header_block(
+        allocator,
+        encoder,
+        decoder,
+        aws_byte_cursor_from_c_str("x-big"),
+        aws_byte_cursor_from_array(big_value, sizeof(big_value)),
+        2));
+    struct aws_hpack_encoder_stats small_table_stats;
+    aws_hpack_get_encoder_stats(encoder, &small_table_stats);
+    ASSERT_UINT_EQUALS(stats.num_skipped_by_policy + 2, small_table_stats.num_skipped_by_policy);
+    ASSERT_UINT_EQUALS(stats.num_inserted, small_table_stats.num_inserted);
+
+    aws_hpack_set_max_table_size(encoder, 4096);
+    ASSERT_SUCCESS(s_encode_repeated_header_block(
+        allocator,
+        encoder,
+        decoder,
+        aws_byte_cursor_from_c_str("x-big"),
+        aws_byte_cursor_from_array(big_value, sizeof(big_value)),
+        1));
+    aws_hpack_get_encoder_stats(encoder, &stats);
+    ASSERT_UINT_EQUALS(small_table_stats.num_inserted + 1, stats.num_inserted);
+
+    aws_hpack_context_destroy(decoder);
+    aws_hpack_context_destroy(encoder);
+    aws_http_library_clean_up();
+    return AWS_OP_SUCCESS;
+}
@@ -322,6 +322,164 @@ TEST_CASE(headers_clear) {
     return AWS_OP_SUCCESS;
 }
 
+/* Arena headers store all their strings in a block or two, instead of one allocation per header */
+TEST_CASE(headers_arena_allocations) {
+    (void)ctx;
+    struct aws_allocator *tracer = aws_mem_tracer_new(allocator, NULL, AWS_MEMTRACE_BYTES, 0);
+    ASSERT_NOT_NULL(tracer);
+
+    struct aws_http_headers *headers = aws_http_headers_new_arena(tracer, 0 /*default block_size*/);
+    ASSERT_NOT_NULL(headers);
+    const size_t empty_allocation_count = aws_mem_tracer_count(tracer);
+
+    /* Roughly what a SigV4 signed S3 request carries */
+    char name_buf[32];
+    char value_buf[64];
+    for (size_t i = 0; i < 20; ++i) {
+        snprintf(name_buf, sizeof(name_buf), "x-amz-header-%zu", i);
+        snprintf(value_buf, sizeof(value_buf), "value-%zu-0123456789abcdef", i);
+        ASSERT_SUCCESS(
+            aws_http_headers_add(headers, aws_byte_cursor_from_c_str(name_buf), aws_byte_cursor_from_c_str(value_buf)));
+    }
+
+    /* The only new allocation is a single block holding every string */
+    ASSERT_UINT_EQUALS(empty_allocation_count + 1, aws_mem_tracer_count(tracer));
+
+    for (size_t i = 0; i < 20; ++i) {
+        snprintf(name_buf, sizeof(name_buf), "x-amz-header-%zu", i);
+        snprintf(value_buf, sizeof(value_buf), "value-%zu-0123456789abcdef", i);
+        struct aws_http_header get;
+        ASSERT_SUCCESS(aws_http_headers_get_index(headers, i, &get));
+        ASSERT_SUCCESS(s_check_header_eq(get, name_buf, value_buf));
+    }
+
+    /* Clearing keeps one block around to reuse */
+    aws_http_headers_clear(headers);
+    ASSERT_UINT_EQUALS(0, aws_http_headers_count(headers));
+    ASSERT_UINT_EQUALS(empty_allocation_count + 1, aws_mem_tracer_count(tracer));
+    ASSERT_SUCCESS(aws_http_headers_add(headers, aws_byte_cursor_from_c_str("Host"), aws_byte_cursor_from_c_str("a")));
+    ASSERT_UINT_EQUALS(empty_allocation_count + 1, aws_mem_tracer_count(tracer));
+
+    aws_http_headers_release(headers);
+    ASSERT_UINT_EQUALS(0, aws_mem_tracer_count(tracer));
+    aws_mem_tracer_destroy(tracer);
+    return AWS_OP_SUCCESS;
+}
+
+/* Erased headers leave dead bytes behind, check that memory doesn't grow without bound */
+TEST_CASE(headers_arena_erase_and_compact) {
+    (void)ctx;
+    struct aws_allocator *tracer = aws_mem_tracer_new(allocator, NULL, AWS_MEMTRACE_BYTES, 0);
+    ASSERT_NOT_NULL(tracer);
+
+    struct aws_http_headers *headers = aws_http_headers_new_arena(tracer, 64 /*block_size*/);
+    ASSERT_NOT_NULL(headers);
+
+    const struct aws_http_header src_headers[] = {
+        s_make_header("Host", "example.com"),
+        s_make_header("Cookie", "a=1"),
+        s_make_header("Accept", "*/*"),
+    };
+    ASSERT_SUCCESS(aws_http_headers_add_array(headers, src_headers, AWS_ARRAY_SIZE(src_headers)));
+
+    /* A header bigger than a block gets a block of its own */
+    char big_value[256];
+    memset(big_value, 'z', sizeof(big_value) - 1);
+    big_value[sizeof(big_value) - 1] = '\0';
+    ASSERT_SUCCESS(
+        aws_http_headers_add(headers, aws_byte_cursor_from_c_str("Big"), aws_byte_cursor_from_c_str(big_value)));
+
+    /* Replace a header over and over, while the others stay put */
+    char value_buf[32];
+    for (size_t i = 0; i < 1000; ++i) {
+        snprintf(value_buf, sizeof(value_buf), "a=%zu", i);
+        ASSERT_SUCCESS(
+            aws_http_headers_set(headers, aws_byte_cursor_from_c_str("Cookie"), aws_byte_cursor_from_c_str(value_buf)));
+    }
+
+    /* Everything survived being moved around */
+    ASSERT_UINT_EQUALS(4, aws_http_headers_count(headers));
+    struct aws_byte_cursor value_get;
+    ASSERT_SUCCESS(aws_http_headers_get(headers, aws_byte_cursor_from_c_str("host"), &value_get));
+    ASSERT_SUCCESS(s_check_value_eq(value_get, "example.com"));
+    ASSERT_SUCCESS(aws_http_headers_get(headers, aws_byte_cursor_from_c_str("cookie"), &value_get));
+    ASSERT_SUCCESS(s_check_value_eq(value_get, "a=999"));
+    ASSERT_SUCCESS(aws_http_headers_get(headers, aws_byte_cursor_from_c_str("accept"), &value_get));
+    ASSERT_SUCCESS(s_check_value_eq(value_get, "*/*"));
+    ASSERT_SUCCESS(aws_http_headers_get(headers, aws_byte_cursor_from_c_str("big"), &value_get));
+    ASSERT_SUCCESS(s_check_value_eq(value_get, big_value));
+
+    /* 1000 replacements would need far more than this, if dead bytes were never reclaimed */
+    ASSERT_TRUE(aws_mem_tracer_bytes(tracer) < 4096);
+
+    /* Erase everything, in every way */
+    ASSERT_SUCCESS(aws_http_headers_erase(headers, aws_byte_cursor_from_c_str("Big")));
+    ASSERT_SUCCESS(aws_http_headers_erase_value(
+        headers, aws_byte_cursor_from_c_str("Accept"), aws_byte_cursor_from_c_str("*/*")));
+    ASSERT_SUCCESS(aws_http_headers_erase_index(headers, 0));
+    ASSERT_SUCCESS(aws_http_headers_erase_index(headers, 0));
+    ASSERT_UINT_EQUALS(0, aws_http_headers_count(headers));
+
+    aws_http_headers_release(headers);
+    ASSERT_UINT_EQUALS(0, aws_mem_tracer_count(tracer));
+    aws_mem_tracer_destroy(tracer);
+    return AWS_OP_SUCCESS;
+}
+
+/* Once dead bytes outweigh live ones, the live strings get packed into a single block */
+TEST_CASE(headers_arena_compaction_moves_strings) {
+    (void)ctx;
+    struct aws_allocator *tracer = aws_mem_tracer_new(allocator, NULL, AWS_MEMTRACE_BYTES, 0);
+    ASSERT_NOT_NULL(tracer);
+
+    /* Each header is 10 bytes, so 3 fit per block */
+    struct aws_http_headers *headers = aws_http_headers_new_arena(tracer, 32 /*block_size*/);
+    ASSERT_NOT_NULL(headers);
+    const size_t empty_allocation_count = aws_mem_tracer_count(tracer);
+
+    const struct aws_http_header src_headers[] = {
+        s_make_header("H0", "value-00"),
+        s_make_header("H1", "value-01"),
+        s_make_header("H2", "value-02"),
+        s_make_header("H3", "value-03"),
+        s_make_header("H4", "value-04"),
+        s_make_header("H5", "value-05"),
+        s_make_header("H6", "value-06"),
+    };
+    ASSERT_SUCCESS(aws_http_headers_add_array(headers, src_headers, AWS_ARRAY_SIZE(src_headers)));
+    ASSERT_UINT_EQUALS(empty_allocation_count + 3, aws_mem_tracer_count(tracer));
+
+    struct aws_http_header get;
+    ASSERT_SUCCESS(aws_http_headers_get_index(headers, 0, &get));
+    const uint8_t *orig_ptr = get.name.ptr;
+
+    /* 30 bytes dead, 40 live. Strings don't move yet */
+    ASSERT_SUCCESS(aws_http_headers_erase(headers, aws_byte_cursor_from_c_str("H1")));
+    ASSERT_SUCCESS(aws_http_headers_erase(headers, aws_byte_cursor_from_c_str("H2")));
+    ASSERT_SUCCESS(aws_http_headers_erase(headers, aws_byte_cursor_from_c_str("H4")));
+    ASSERT_SUCCESS(aws_http_headers_get_index(headers, 0, &get));
+    ASSERT_PTR_EQUALS(orig_ptr, get.name.ptr);
+
+    /* 40 bytes dead, 30 live. Compaction leaves a single block */
+    ASSERT_SUCCESS(aws_http_headers_erase(headers, aws_byte_cursor_from_c_str("H5")));
+    ASSERT_SUCCESS(aws_http_headers_get_index(headers, 0, &get));
+    ASSERT_TRUE(orig_ptr != get.name.ptr);
+    ASSERT_UINT_EQUALS(empty_allocation_count + 1, aws_mem_tracer_count(tracer));
+
+    ASSERT_UINT_EQUALS(3, aws_http_headers_count(headers));
+    ASSERT_SUCCESS(aws_http_headers_get_index(headers, 0, &get));
+    ASSERT_SUCCESS(s_check_header_eq(get, "H0", "value-00"));
+    ASSERT_SUCCESS(aws_http_headers_get_index(headers, 1, &get));
+    ASSERT_SUCCESS(s_check_header_eq(get, "H3", "value-03"));
+    ASSERT_SUCCESS(aws_http_headers_get_index(headers, 2, &get));
+    ASSERT_SUCCESS(s_check_header_eq(get, "H6", "value-06"));
+
+    aws_http_headers_release(headers);
+    ASSERT_UINT_EQUALS(0, aws_mem_tracer_count(tracer));
+    aws_mem_tracer_destroy(tracer);
+    return AWS_OP_SUCCESS;
+}
+
 TEST_CASE(message_refcounts) {
     (void)ctx;
     struct aws_http_message *message = aws_http_message_new_request(allocator);
@@ -443,3 +601,49 @@ TEST_CASE(message_handles_oom) {
     aws_timebomb_allocator_clean_up(&timebomb_alloc);
     return AWS_OP_SUCCESS;
 }
+
+TEST_CASE(message_with_arena_headers_handles_oom) {
+    (void)ctx;
+    struct aws_allocator timebomb_alloc;
+    ASSERT_SUCCESS(aws_timebomb_allocator_init(&timebomb_alloc, allocator, SIZE_MAX));
+
+    bool test_succeeded = false;
+    size_t allocations_until_failure;
+    for (allocations_until_failure = 0; allocations_until_failure < 10000; ++allocations_until_failure) {
+        /* Allow one more allocation each time we loop. */
+        aws_timebomb_allocator_reset_countdown(&timebomb_alloc, allocations_until_failure);
+
+        /* Create a request, then do a bunch of stuff with it. */
+        struct aws_http_headers *headers = aws_http_headers_new_arena(&timebomb_alloc, 0 /*default block_size*/);
+        struct aws_http_message *request = NULL;
+        if (headers) {
+            request = aws_http_message_new_request_with_headers(&timebomb_alloc, headers);
+            aws_http_headers_release(headers);
+        }
+        int err = 0;
+        if (request) {
+            err = s_message_handles_oom_attempt(request);
+            if (err) {
+                /* Ensure failure was due to OOM */
+                ASSERT_INT_EQUALS(AWS_ERROR_OOM, aws_last_error());
+            } else {
+                test_succeeded = true;
+            }
+
+            aws_http_message_destroy(request);
+        } else {
+            /* Ensure failure was due to OOM */
+            ASSERT_INT_EQUALS(AWS_ERROR_OOM, aws_last_error());
+        }
+
+        if (test_succeeded) {
+            break;
+        }
+    }
+
+    ASSERT_TRUE(test_succeeded);
+    ASSERT_TRUE(allocations_until_failure > 2); /* Assert that this did fail a few times */
+
+    aws_timebomb_allocator_clean_up(&timebomb_alloc);
+    return AWS_OP_SUCCESS;
+}
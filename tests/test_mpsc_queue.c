@@ -0,0 +1,200 @@
+/**
+ * Copyright Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0.
+ */
+#include <aws/http/private/mpsc_queue.h>
+
+#include <aws/common/thread.h>
+#include <aws/testing/aws_test_harness.h>
+
+#define TEST_CASE(NAME)                                                                                                \
+    AWS_TEST_CASE(NAME, s_test_##NAME);                                                                                \
+    static int s_test_##NAME(struct aws_allocator *allocator, void *ctx)
+
+struct queue_item {
+    struct aws_linked_list_node node;
+    size_t producer_id;
+    size_t sequence;
+};
+
+TEST_CASE(mpsc_queue_fifo_order) {
+    (void)allocator;
+    (void)ctx;
+
+    struct aws_mpsc_queue queue;
+    aws_mpsc_queue_init(&queue);
+    ASSERT_TRUE(aws_mpsc_queue_is_empty(&queue));
+
+    struct queue_item items[3];
+    AWS_ZERO_ARRAY(items);
+
+    /* Only the push onto an empty queue should report the transition */
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(items); ++i) {
+        items[i].sequence = i;
+        bool was_empty = false;
+        ASSERT_SUCCESS(aws_mpsc_queue_push(&queue, &items[i].node, &was_empty));
+        ASSERT_UINT_EQUALS(i == 0, was_empty);
+    }
+    ASSERT_FALSE(aws_mpsc_queue_is_empty(&queue));
+
+    /* Popped in the order pushed */
+    struct aws_linked_list list;
+    aws_linked_list_init(&list);
+    aws_mpsc_queue_pop_all(&queue, &list);
+    ASSERT_TRUE(aws_mpsc_queue_is_empty(&queue));
+
+    for (size_t i = 0; i < AWS_ARRAY_SIZE(items); ++i) {
+        ASSERT_FALSE(aws_linked_list_empty(&list));
+        struct queue_item *item = AWS_CONTAINER_OF(aws_linked_list_pop_front(&list), struct queue_item, node);
+        ASSERT_UINT_EQUALS(i, item->sequence);
+    }
+    ASSERT_TRUE(aws_linked_list_empty(&list));
+
+    /* Popping an empty queue is harmless */
+    aws_mpsc_queue_pop_all(&queue, &list);
+    ASSERT_TRUE(aws_linked_list_empty(&list));
+
+    /* Once drained, the next push is a transition again */
+    bool was_empty = false;
+    ASSERT_SUCCESS(aws_mpsc_queue_push(&queue, &items[0].node, &was_empty));
+    ASSERT_TRUE(was_empty);
+    aws_mpsc_queue_pop_all(&queue, &list);
+    ASSERT_PTR_EQUALS(&items[0].node, aws_linked_list_front(&list));
+
+    return AWS_OP_SUCCESS;
+}
+
+TEST_CASE(mpsc_queue_seal) {
+    (void)allocator;
+    (void)ctx;
+
+    struct aws_mpsc_queue queue;
+    aws_mpsc_queue_init(&queue);
+
+    struct queue_item items[3];
+    AWS_ZERO_ARRAY(items);
+    ASSERT_SUCCESS(aws_mpsc_queue_push(&queue, &items[0].node, NULL));
+    ASSERT_SUCCESS(aws_mpsc_queue_push(&queue, &items[1].node, NULL));
+
+    /* Sealing hands back whatever was left */
+    struct aws_linked_list list;
+    aws_linked_list_init(&list);
+    aws_mpsc_queue_seal(&queue, &list);
+    ASSERT_PTR_EQUALS(&items[0].node, aws_linked_list_pop_front(&list));
+    ASSERT_PTR_EQUALS(&items[1].node, aws_linked_list_pop_front(&list));
+    ASSERT_TRUE(aws_linked_list_empty(&list));
+    ASSERT_TRUE(aws_mpsc_queue_is_empty(&queue));
+
+    /* Nothing gets in afterwards */
+    ASSERT_ERROR(AWS_ERROR_INVALID_STATE, aws_mpsc_queue_push(&queue, &items[2].node, NULL));
+    aws_mpsc_queue_pop_all(&queue, &list);
+    ASSERT_TRUE(aws_linked_list_empty(&list));
+
+    /* Sealing twice is harmless */
+    aws_mpsc_queue_seal(&queue, &list);
+    ASSERT_TRUE(aws_linked_list_empty(&list));
+    ASSERT_TRUE(aws_mpsc_queue_is_empty(&queue));
+
+    return AWS_OP_SUCCESS;
+}
+
+enum {
+    CONTENTION_PRODUCER_COUNT = 8,
+    CONTENTION_ITEMS_PER_PRODUCER = 20000,
+};
+
+struct contention_producer {
+    struct aws_thread thread;
+    struct aws_mpsc_queue *queue;
+    struct aws_atomic_var *transition_count;
+    struct queue_item *items;
+    size_t id;
+    int push_error;
+};
+
+static void s_contention_producer_run(void *arg) {
+    struct contention_producer *producer = arg;
+    for (size_t i = 0; i < CONTENTION_ITEMS_PER_PRODUCER; ++i) {
+        struct queue_item *item = &producer->items[i];
+        item->producer_id = producer->id;
+        item->sequence = i;
+
+        bool was_empty = false;
+        if (aws_mpsc_queue_push(producer->queue, &item->node, &was_empty)) {
+            producer->push_error = aws_last_error();
+            return;
+        }
+        if (was_empty) {
+            aws_atomic_fetch_add(producer->transition_count, 1);
+        }
+    }
+}
+
+/* Many threads push while one thread drains, the way streams are handed to an HTTP/2 connection.
+ * Every item must arrive exactly once, each producer's items must arrive in order, and every
+ * empty->non-empty transition must correspond to exactly one drain that found work. */
+TEST_CASE(mpsc_queue_contention) {
+    (void)ctx;
+
+    struct aws_mpsc_queue queue;
+    aws_mpsc_queue_init(&queue);
+
+    struct aws_atomic_var transition_count;
+    aws_atomic_init_int(&transition_count, 0);
+
+    struct contention_producer producers[CONTENTION_PRODUCER_COUNT];
+    AWS_ZERO_ARRAY(producers);
+
+    struct queue_item *items = aws_mem_calloc(
+        allocator, CONTENTION_PRODUCER_COUNT * CONTENTION_ITEMS_PER_PRODUCER, sizeof(struct queue_item));
+    ASSERT_NOT_NULL(items);
+
+    for (size_t i = 0; i < CONTENTION_PRODUCER_COUNT; ++i) {
+        struct contention_producer *producer = &producers[i];
+        producer->queue = &queue;
+        producer->transition_count = &transition_count;
+        producer->items = items + (i * CONTENTION_ITEMS_PER_PRODUCER);
+        producer->id = i;
+        ASSERT_SUCCESS(aws_thread_init(&producer->thread, allocator));
+    }
+
+    for (size_t i = 0; i < CONTENTION_PRODUCER_COUNT; ++i) {
+        ASSERT_SUCCESS(aws_thread_launch(&producers[i].thread, s_contention_producer_run, &producers[i], NULL));
+    }
+
+    size_t next_sequence[CONTENTION_PRODUCER_COUNT];
+    AWS_ZERO_ARRAY(next_sequence);
+    size_t received_count = 0;
+    size_t productive_drain_count = 0;
+    struct aws_linked_list list;
+    aws_linked_list_init(&list);
+
+    while (received_count < CONTENTION_PRODUCER_COUNT * CONTENTION_ITEMS_PER_PRODUCER) {
+        aws_mpsc_queue_pop_all(&queue, &list);
+        if (aws_linked_list_empty(&list)) {
+            continue;
+        }
+
+        ++productive_drain_count;
+        while (!aws_linked_list_empty(&list)) {
+            struct queue_item *item = AWS_CONTAINER_OF(aws_linked_list_pop_front(&list), struct queue_item, node);
+            ASSERT_TRUE(item->producer_id < CONTENTION_PRODUCER_COUNT);
+            ASSERT_UINT_EQUALS(next_sequence[item->producer_id], item->sequence);
+            next_sequence[item->producer_id]++;
+            received_count++;
+        }
+    }
+
+    for (size_t i = 0; i < CONTENTION_PRODUCER_COUNT; ++i) {
+        ASSERT_SUCCESS(aws_thread_join(&producers[i].thread));
+        aws_thread_clean_up(&producers[i].thread);
+        ASSERT_INT_EQUALS(0, producers[i].push_error);
+        ASSERT_UINT_EQUALS(CONTENTION_ITEMS_PER_PRODUCER, next_sequence[i]);
+    }
+
+    ASSERT_TRUE(aws_mpsc_queue_is_empty(&queue));
+    ASSERT_UINT_EQUALS(productive_drain_count, aws_atomic_load_int(&transition_count));
+
+    aws_mem_release(allocator, items);
+    return AWS_OP_SUCCESS;
+}
@@ -165,6 +165,28 @@ static int s_strutil_is_http_token(struct aws_allocator *allocator, void *ctx) {
     return 0;
 }
 
+AWS_TEST_CASE(strutil_http_token_span, s_strutil_http_token_span);
+static int s_strutil_http_token_span(struct aws_allocator *allocator, void *ctx) {
+    (void)allocator;
+    (void)ctx;
+
+    ASSERT_UINT_EQUALS(4, aws_strutil_http_token_span(aws_byte_cursor_from_c_str("Host: example.com")));
+    ASSERT_UINT_EQUALS(0, aws_strutil_http_token_span(aws_byte_cursor_from_c_str(": example.com")));
+    ASSERT_UINT_EQUALS(4, aws_strutil_http_token_span(aws_byte_cursor_from_c_str("Host")));
+    ASSERT_UINT_EQUALS(4, aws_strutil_http_token_span(aws_byte_cursor_from_c_str("Host :")));
+    ASSERT_UINT_EQUALS(0, aws_strutil_http_token_span(aws_byte_cursor_from_c_str("")));
+
+    /* must agree with aws_strutil_is_http_token() on every character */
+    for (size_t i = 0; i < 256; ++i) {
+        uint8_t str[3] = {'a', (uint8_t)i, 'b'};
+        struct aws_byte_cursor cursor = aws_byte_cursor_from_array(str, sizeof(str));
+        bool is_token = aws_strutil_is_http_token(aws_byte_cursor_from_array(&str[1], 1));
+        ASSERT_UINT_EQUALS(is_token ? 3 : 1, aws_strutil_http_token_span(cursor));
+    }
+
+    return 0;
+}
+
 AWS_TEST_CASE(strutil_is_lowercase_http_token, s_strutil_is_lowercase_http_token);
 static int s_strutil_is_lowercase_http_token(struct aws_allocator *allocator, void *ctx) {
     (void)allocator;
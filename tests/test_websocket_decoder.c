@@ -316,6 +316,61 @@ DECODER_TEST_CASE(websocket_decoder_masking) {
     return AWS_OP_SUCCESS;
 }
 
+/* Test unmasking a payload that's large enough to use word-at-a-time masking,
+ * delivered in chunks of varying size so each chunk starts at a different alignment and masking-key offset */
+DECODER_TEST_CASE(websocket_decoder_masking_unaligned_chunks) {
+    (void)ctx;
+    struct decoder_tester tester;
+    ASSERT_SUCCESS(s_decoder_tester_init(&tester, allocator));
+
+    enum { PAYLOAD_LEN = 200 };
+    const uint8_t masking_key[4] = {0x37, 0xfa, 0x21, 0x3d};
+
+    uint8_t expected_payload[PAYLOAD_LEN];
+    for (size_t i = 0; i < PAYLOAD_LEN; ++i) {
+        expected_payload[i] = (uint8_t)(i * 7);
+    }
+
+    uint8_t input[2 + 2 + 4 + PAYLOAD_LEN] = {
+        0x82, /* fin | rsv1 | rsv2 | rsv3 | 4bit opcode */
+        0xFE, /* mask | 7bit payload len (126 indicates 2byte extended length) */
+        0x00, /* 2byte extended length */
+        PAYLOAD_LEN,
+    };
+    memcpy(input + 4, masking_key, sizeof(masking_key));
+    for (size_t i = 0; i < PAYLOAD_LEN; ++i) {
+        input[8 + i] = expected_payload[i] ^ masking_key[i % 4];
+    }
+
+    struct aws_websocket_frame expected_frame = {
+        .fin = true,
+        .opcode = 2,
+        .masked = true,
+        .masking_key = {0x37, 0xfa, 0x21, 0x3d},
+        .payload_length = PAYLOAD_LEN,
+    };
+
+    /* Feed input in chunks of 1, 2, 3, ... bytes */
+    bool frame_complete = false;
+    size_t chunk_size = 1;
+    struct aws_byte_cursor input_cursor = aws_byte_cursor_from_array(input, sizeof(input));
+    while (input_cursor.len > 0) {
+        ASSERT_FALSE(frame_complete);
+        size_t bytes_to_process = aws_min_size(chunk_size++, input_cursor.len);
+        struct aws_byte_cursor chunk = aws_byte_cursor_advance(&input_cursor, bytes_to_process);
+        ASSERT_SUCCESS(aws_websocket_decoder_process(&tester.decoder, &chunk, &frame_complete));
+        ASSERT_UINT_EQUALS(0, chunk.len);
+    }
+
+    /* check result */
+    ASSERT_TRUE(frame_complete);
+    ASSERT_SUCCESS(s_compare_frame(&expected_frame, &tester.frame));
+    ASSERT_BIN_ARRAYS_EQUALS(expected_payload, PAYLOAD_LEN, tester.payload.buffer, tester.payload.len);
+
+    ASSERT_SUCCESS(s_decoder_tester_clean_up(&tester));
+    return AWS_OP_SUCCESS;
+}
+
 /* Test a data frame which uses the 2 byte extended-length encoding */
 DECODER_TEST_CASE(websocket_decoder_extended_length_2byte) {
     (void)ctx;